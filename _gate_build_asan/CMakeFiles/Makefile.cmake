@@ -0,0 +1,139 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/CLuceneBoost.cmake"
+  "/root/repo/cmake/CLuceneDocs.cmake"
+  "/root/repo/cmake/DefineOptions.cmake"
+  "/root/repo/cmake/cmake_uninstall.cmake.in"
+  "/root/repo/src/core/CMakeLists.txt"
+  "/root/repo/src/core/libclucene-core.pc.cmake"
+  "/root/repo/src/demo/CMakeLists.txt"
+  "/root/repo/src/ext/CMakeLists.txt"
+  "/root/repo/src/shared/CLucene/_clucene-config.h.cmake"
+  "/root/repo/src/shared/CLucene/clucene-config.h.cmake"
+  "/root/repo/src/shared/CMakeLists.txt"
+  "/root/repo/src/shared/cmake/CheckAtomicFunctions.cmake"
+  "/root/repo/src/shared/cmake/CheckErrorHandling.cmake"
+  "/root/repo/src/shared/cmake/CheckFloatByte.cmake"
+  "/root/repo/src/shared/cmake/CheckHashmaps.cmake"
+  "/root/repo/src/shared/cmake/CheckNamespace.cmake"
+  "/root/repo/src/shared/cmake/CheckPthread.cmake"
+  "/root/repo/src/shared/cmake/CheckSnprintf.cmake"
+  "/root/repo/src/shared/cmake/CheckStdCallFunctionExists.cmake"
+  "/root/repo/src/shared/cmake/DefineDword.cmake"
+  "/root/repo/src/shared/cmake/DefineFloat.cmake"
+  "/root/repo/src/shared/cmake/DefineLongLongSyntax.cmake"
+  "/root/repo/src/shared/cmake/DefineMAXPATHValue.cmake"
+  "/root/repo/src/shared/cmake/DefineStaticSyntax.cmake"
+  "/root/repo/src/shared/cmake/MacroCheckGccVisibility.cmake"
+  "/root/repo/src/shared/cmake/MacroChooseFunction.cmake"
+  "/root/repo/src/shared/cmake/MacroChooseMisc.cmake"
+  "/root/repo/src/shared/cmake/MacroChooseSymbol.cmake"
+  "/root/repo/src/shared/cmake/MacroChooseType.cmake"
+  "/root/repo/src/shared/cmake/MacroEnsureVersion.cmake"
+  "/root/repo/src/shared/cmake/MacroMustDefine.cmake"
+  "/root/repo/src/shared/cmake/Macro_ChooseStatus.cmake"
+  "/root/repo/src/test/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestCXXAcceptsFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/TestForANSIForScope.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "cmake_uninstall.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ext/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/shared/CLucene/clucene-config.h"
+  "src/shared/CLucene/_clucene-config.h"
+  "src/shared/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/libclucene-core.pc"
+  "src/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "src/shared/CMakeFiles/clucene-shared.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/clucene-core.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/cl_test.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/cl_test-ascii.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test-ascii.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/cl_test-namespace.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test-namespace.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/cl_test-mmap.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test-mmap.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/cl_test-singlethreading.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test-singlethreading.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/cl_test-refcnt.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test-refcnt.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/cl_test-platform-charfuncs.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test-platform-charfuncs.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/cl_test-pedantic.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test-pedantic.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/cl_test-gcov.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test-gcov.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test-all.dir/DependInfo.cmake"
+  "src/demo/CMakeFiles/cl_demo.dir/DependInfo.cmake"
+  "src/demo/CMakeFiles/cl_checkindex.dir/DependInfo.cmake"
+  )
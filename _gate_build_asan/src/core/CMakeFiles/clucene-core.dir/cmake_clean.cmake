@@ -0,0 +1,293 @@
+file(REMOVE_RECURSE
+  "../../bin/libclucene-core.pdb"
+  "../../bin/libclucene-core.so"
+  "../../bin/libclucene-core.so.1"
+  "../../bin/libclucene-core.so.2.3.3.4"
+  "CMakeFiles/clucene-core.dir/CLucene/StdHeader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/StdHeader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/analysis/AnalysisHeader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/analysis/AnalysisHeader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/analysis/Analyzers.o"
+  "CMakeFiles/clucene-core.dir/CLucene/analysis/Analyzers.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardAnalyzer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardAnalyzer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardFilter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardFilter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardTokenizer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardTokenizer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/debug/error.o"
+  "CMakeFiles/clucene-core.dir/CLucene/debug/error.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/document/DateField.o"
+  "CMakeFiles/clucene-core.dir/CLucene/document/DateField.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/document/DateTools.o"
+  "CMakeFiles/clucene-core.dir/CLucene/document/DateTools.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/document/Document.o"
+  "CMakeFiles/clucene-core.dir/CLucene/document/Document.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/document/Field.o"
+  "CMakeFiles/clucene-core.dir/CLucene/document/Field.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/document/FieldSelector.o"
+  "CMakeFiles/clucene-core.dir/CLucene/document/FieldSelector.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/document/NumberTools.o"
+  "CMakeFiles/clucene-core.dir/CLucene/document/NumberTools.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/CheckIndex.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/CheckIndex.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/CompoundFile.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/CompoundFile.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/DirectoryIndexReader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/DirectoryIndexReader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/DocValues.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/DocValues.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/DocumentsWriter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/DocumentsWriter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/DocumentsWriterThreadState.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/DocumentsWriterThreadState.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/FieldInfos.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/FieldInfos.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/FieldsReader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/FieldsReader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/FieldsWriter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/FieldsWriter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexDeletionPolicy.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexDeletionPolicy.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexFileDeleter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexFileDeleter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexFileNameFilter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexFileNameFilter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexFileNames.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexFileNames.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexModifier.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexModifier.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexReader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexReader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexWriter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexWriter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexingPipeline.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/IndexingPipeline.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/MergePolicy.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/MergePolicy.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/MergeScheduler.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/MergeScheduler.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/MultiReader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/MultiReader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/MultiSegmentReader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/MultiSegmentReader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/MultipleTermPositions.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/MultipleTermPositions.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/Payload.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/Payload.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentInfos.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentInfos.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentMergeInfo.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentMergeInfo.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentMergeQueue.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentMergeQueue.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentMerger.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentMerger.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentReader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentReader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermDocs.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermDocs.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermEnum.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermEnum.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermPositions.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermPositions.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermVector.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermVector.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SkipListReader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SkipListReader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SkipListWriter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/SkipListWriter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/Term.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/Term.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/TermInfo.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/TermInfo.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/TermInfosReader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/TermInfosReader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/TermInfosWriter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/TermInfosWriter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/TermVectorReader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/TermVectorReader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/TermVectorWriter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/TermVectorWriter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/index/Terms.o"
+  "CMakeFiles/clucene-core.dir/CLucene/index/Terms.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/FastCharStream.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/FastCharStream.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/MultiFieldQueryParser.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/MultiFieldQueryParser.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryParser.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryParser.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryParserTokenManager.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryParserTokenManager.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryToken.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryToken.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/Lexer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/Lexer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/MultiFieldQueryParser.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/MultiFieldQueryParser.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryParser.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryParser.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryParserBase.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryParserBase.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryToken.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryToken.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/TokenList.o"
+  "CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/TokenList.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/BooleanQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/BooleanQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/BooleanScorer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/BooleanScorer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/BooleanScorer2.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/BooleanScorer2.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/CachingSpanFilter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/CachingSpanFilter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/CachingWrapperFilter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/CachingWrapperFilter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/ChainedFilter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/ChainedFilter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Compare.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Compare.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/ConjunctionScorer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/ConjunctionScorer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/ConstantScoreQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/ConstantScoreQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/DateFilter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/DateFilter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/DisjunctionSumScorer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/DisjunctionSumScorer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/EarlyTerminatingCollector.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/EarlyTerminatingCollector.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/ExactPhraseScorer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/ExactPhraseScorer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Explanation.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Explanation.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FacetCollector.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FacetCollector.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FieldCache.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FieldCache.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FieldCacheImpl.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FieldCacheImpl.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FieldDocSortedHitQueue.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FieldDocSortedHitQueue.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FieldSortedHitQueue.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FieldSortedHitQueue.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FilteredTermEnum.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FilteredTermEnum.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FuzzyQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/FuzzyQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/HitQueue.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/HitQueue.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Hits.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Hits.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/IndexSearcher.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/IndexSearcher.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/MatchAllDocsQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/MatchAllDocsQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/MultiPhraseQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/MultiPhraseQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/MultiSearcher.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/MultiSearcher.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/MultiTermQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/MultiTermQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/MultiTermRewrite.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/MultiTermRewrite.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/PhrasePositions.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/PhrasePositions.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/PhraseQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/PhraseQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/PhraseScorer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/PhraseScorer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/PrefixQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/PrefixQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/QueryFilter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/QueryFilter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/QueryResultCache.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/QueryResultCache.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/RangeFilter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/RangeFilter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/RangeQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/RangeQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Scorer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Scorer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/ScorerDocQueue.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/ScorerDocQueue.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/SearchHeader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/SearchHeader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Similarity.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Similarity.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/SloppyPhraseScorer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/SloppyPhraseScorer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Sort.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/Sort.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/SpanQueryFilter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/SpanQueryFilter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/TermQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/TermQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/TermScorer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/TermScorer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/WildcardQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/WildcardQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/WildcardTermEnum.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/WildcardTermEnum.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/NearSpansOrdered.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/NearSpansOrdered.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/NearSpansUnordered.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/NearSpansUnordered.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanFirstQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanFirstQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanNearQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanNearQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanNotQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanNotQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanOrQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanOrQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanScorer.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanScorer.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanTermQuery.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanTermQuery.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanWeight.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanWeight.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/TermSpans.o"
+  "CMakeFiles/clucene-core.dir/CLucene/search/spans/TermSpans.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/Directory.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/Directory.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/FSDirectory.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/FSDirectory.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/IndexInput.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/IndexInput.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/IndexOutput.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/IndexOutput.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/Lock.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/Lock.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/LockFactory.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/LockFactory.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/MMapInput.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/MMapInput.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/MergeDirectory.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/MergeDirectory.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/NRTCachingDirectory.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/NRTCachingDirectory.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/RAMDirectory.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/RAMDirectory.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/store/RateLimiter.o"
+  "CMakeFiles/clucene-core.dir/CLucene/store/RateLimiter.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/util/BitSet.o"
+  "CMakeFiles/clucene-core.dir/CLucene/util/BitSet.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/util/Equators.o"
+  "CMakeFiles/clucene-core.dir/CLucene/util/Equators.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/util/FastCharStream.o"
+  "CMakeFiles/clucene-core.dir/CLucene/util/FastCharStream.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/util/MD5Digester.o"
+  "CMakeFiles/clucene-core.dir/CLucene/util/MD5Digester.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/util/Reader.o"
+  "CMakeFiles/clucene-core.dir/CLucene/util/Reader.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/util/StringIntern.o"
+  "CMakeFiles/clucene-core.dir/CLucene/util/StringIntern.o.d"
+  "CMakeFiles/clucene-core.dir/CLucene/util/ThreadLocal.o"
+  "CMakeFiles/clucene-core.dir/CLucene/util/ThreadLocal.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clucene-core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
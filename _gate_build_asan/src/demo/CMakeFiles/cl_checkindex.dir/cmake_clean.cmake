@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cl_checkindex"
+  "../../bin/cl_checkindex.pdb"
+  "CMakeFiles/cl_checkindex.dir/CheckIndex.o"
+  "CMakeFiles/cl_checkindex.dir/CheckIndex.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cl_checkindex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/demo/IndexFiles.cpp" "src/demo/CMakeFiles/cl_demo.dir/IndexFiles.o" "gcc" "src/demo/CMakeFiles/cl_demo.dir/IndexFiles.o.d"
+  "/root/repo/src/demo/Main.cpp" "src/demo/CMakeFiles/cl_demo.dir/Main.o" "gcc" "src/demo/CMakeFiles/cl_demo.dir/Main.o.d"
+  "/root/repo/src/demo/SearchFiles.cpp" "src/demo/CMakeFiles/cl_demo.dir/SearchFiles.o" "gcc" "src/demo/CMakeFiles/cl_demo.dir/SearchFiles.o.d"
+  "/root/repo/src/demo/Statistics.cpp" "src/demo/CMakeFiles/cl_demo.dir/Statistics.o" "gcc" "src/demo/CMakeFiles/cl_demo.dir/Statistics.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_asan/src/core/CMakeFiles/clucene-core.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_asan/src/shared/CMakeFiles/clucene-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
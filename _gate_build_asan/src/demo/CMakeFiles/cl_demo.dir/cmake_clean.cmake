@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../bin/cl_demo"
+  "../../bin/cl_demo.pdb"
+  "CMakeFiles/cl_demo.dir/IndexFiles.o"
+  "CMakeFiles/cl_demo.dir/IndexFiles.o.d"
+  "CMakeFiles/cl_demo.dir/Main.o"
+  "CMakeFiles/cl_demo.dir/Main.o.d"
+  "CMakeFiles/cl_demo.dir/SearchFiles.o"
+  "CMakeFiles/cl_demo.dir/SearchFiles.o.d"
+  "CMakeFiles/cl_demo.dir/Statistics.o"
+  "CMakeFiles/cl_demo.dir/Statistics.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cl_demo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
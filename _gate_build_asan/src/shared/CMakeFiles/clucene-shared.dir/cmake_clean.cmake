@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "../../bin/libclucene-shared.pdb"
+  "../../bin/libclucene-shared.so"
+  "../../bin/libclucene-shared.so.1"
+  "../../bin/libclucene-shared.so.2.3.3.4"
+  "CMakeFiles/clucene-shared.dir/CLucene/SharedHeader.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/SharedHeader.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/gunichartables.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/gunichartables.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_lltot.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_lltot.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcscasecmp.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcscasecmp.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcslwr.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcslwr.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcstod.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcstod.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcstoll.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcstoll.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_tprintf.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/repl_tprintf.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/threads.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/threads.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/utf8.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/config/utf8.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/debug/condition.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/debug/condition.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/util/Misc.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/util/Misc.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/util/StringBuffer.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/util/StringBuffer.o.d"
+  "CMakeFiles/clucene-shared.dir/CLucene/util/dirent.o"
+  "CMakeFiles/clucene-shared.dir/CLucene/util/dirent.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clucene-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
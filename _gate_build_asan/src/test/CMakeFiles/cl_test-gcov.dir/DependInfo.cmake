@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/test/CLMonolithic_Test.cpp" "src/test/CMakeFiles/cl_test-gcov.dir/CLMonolithic_Test.o" "gcc" "src/test/CMakeFiles/cl_test-gcov.dir/CLMonolithic_Test.o.d"
+  "/root/repo/src/core/CLucene/CLMonolithic.cpp" "src/test/CMakeFiles/cl_test-gcov.dir/__/core/CLucene/CLMonolithic.o" "gcc" "src/test/CMakeFiles/cl_test-gcov.dir/__/core/CLucene/CLMonolithic.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
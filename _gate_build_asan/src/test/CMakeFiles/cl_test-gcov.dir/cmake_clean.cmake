@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/cl_test-gcov"
+  "../../bin/cl_test-gcov.pdb"
+  "CMakeFiles/cl_test-gcov.dir/CLMonolithic_Test.o"
+  "CMakeFiles/cl_test-gcov.dir/CLMonolithic_Test.o.d"
+  "CMakeFiles/cl_test-gcov.dir/__/core/CLucene/CLMonolithic.o"
+  "CMakeFiles/cl_test-gcov.dir/__/core/CLucene/CLMonolithic.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cl_test-gcov.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/cl_test-pedantic"
+  "../../bin/cl_test-pedantic.pdb"
+  "CMakeFiles/cl_test-pedantic.dir/CLMonolithic_Test.o"
+  "CMakeFiles/cl_test-pedantic.dir/CLMonolithic_Test.o.d"
+  "CMakeFiles/cl_test-pedantic.dir/__/core/CLucene/CLMonolithic.o"
+  "CMakeFiles/cl_test-pedantic.dir/__/core/CLucene/CLMonolithic.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cl_test-pedantic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
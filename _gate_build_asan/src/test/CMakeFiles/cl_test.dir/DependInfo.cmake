@@ -0,0 +1,76 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/test/CuTest.cpp" "src/test/CMakeFiles/cl_test.dir/CuTest.o" "gcc" "src/test/CMakeFiles/cl_test.dir/CuTest.o.d"
+  "/root/repo/src/test/analysis/TestAnalysis.cpp" "src/test/CMakeFiles/cl_test.dir/analysis/TestAnalysis.o" "gcc" "src/test/CMakeFiles/cl_test.dir/analysis/TestAnalysis.o.d"
+  "/root/repo/src/test/analysis/TestAnalyzers.cpp" "src/test/CMakeFiles/cl_test.dir/analysis/TestAnalyzers.o" "gcc" "src/test/CMakeFiles/cl_test.dir/analysis/TestAnalyzers.o.d"
+  "/root/repo/src/test/debug/TestError.cpp" "src/test/CMakeFiles/cl_test.dir/debug/TestError.o" "gcc" "src/test/CMakeFiles/cl_test.dir/debug/TestError.o.d"
+  "/root/repo/src/test/document/TestDateTools.cpp" "src/test/CMakeFiles/cl_test.dir/document/TestDateTools.o" "gcc" "src/test/CMakeFiles/cl_test.dir/document/TestDateTools.o.d"
+  "/root/repo/src/test/document/TestDocument.cpp" "src/test/CMakeFiles/cl_test.dir/document/TestDocument.o" "gcc" "src/test/CMakeFiles/cl_test.dir/document/TestDocument.o.d"
+  "/root/repo/src/test/document/TestField.cpp" "src/test/CMakeFiles/cl_test.dir/document/TestField.o" "gcc" "src/test/CMakeFiles/cl_test.dir/document/TestField.o.d"
+  "/root/repo/src/test/document/TestNumberTools.cpp" "src/test/CMakeFiles/cl_test.dir/document/TestNumberTools.o" "gcc" "src/test/CMakeFiles/cl_test.dir/document/TestNumberTools.o.d"
+  "/root/repo/src/test/index/IndexWriter4Test.cpp" "src/test/CMakeFiles/cl_test.dir/index/IndexWriter4Test.o" "gcc" "src/test/CMakeFiles/cl_test.dir/index/IndexWriter4Test.o.d"
+  "/root/repo/src/test/index/TestAddIndexesNoOptimize.cpp" "src/test/CMakeFiles/cl_test.dir/index/TestAddIndexesNoOptimize.o" "gcc" "src/test/CMakeFiles/cl_test.dir/index/TestAddIndexesNoOptimize.o.d"
+  "/root/repo/src/test/index/TestHighFreqTerms.cpp" "src/test/CMakeFiles/cl_test.dir/index/TestHighFreqTerms.o" "gcc" "src/test/CMakeFiles/cl_test.dir/index/TestHighFreqTerms.o.d"
+  "/root/repo/src/test/index/TestIndexModifier.cpp" "src/test/CMakeFiles/cl_test.dir/index/TestIndexModifier.o" "gcc" "src/test/CMakeFiles/cl_test.dir/index/TestIndexModifier.o.d"
+  "/root/repo/src/test/index/TestIndexReader.cpp" "src/test/CMakeFiles/cl_test.dir/index/TestIndexReader.o" "gcc" "src/test/CMakeFiles/cl_test.dir/index/TestIndexReader.o.d"
+  "/root/repo/src/test/index/TestIndexWriter.cpp" "src/test/CMakeFiles/cl_test.dir/index/TestIndexWriter.o" "gcc" "src/test/CMakeFiles/cl_test.dir/index/TestIndexWriter.o.d"
+  "/root/repo/src/test/index/TestReuters.cpp" "src/test/CMakeFiles/cl_test.dir/index/TestReuters.o" "gcc" "src/test/CMakeFiles/cl_test.dir/index/TestReuters.o.d"
+  "/root/repo/src/test/index/TestTermVectorsReader.cpp" "src/test/CMakeFiles/cl_test.dir/index/TestTermVectorsReader.o" "gcc" "src/test/CMakeFiles/cl_test.dir/index/TestTermVectorsReader.o.d"
+  "/root/repo/src/test/index/TestThreading.cpp" "src/test/CMakeFiles/cl_test.dir/index/TestThreading.o" "gcc" "src/test/CMakeFiles/cl_test.dir/index/TestThreading.o.d"
+  "/root/repo/src/test/index/TestUtf8.cpp" "src/test/CMakeFiles/cl_test.dir/index/TestUtf8.o" "gcc" "src/test/CMakeFiles/cl_test.dir/index/TestUtf8.o.d"
+  "/root/repo/src/test/queryParser/TestMultiFieldQueryParser.cpp" "src/test/CMakeFiles/cl_test.dir/queryParser/TestMultiFieldQueryParser.o" "gcc" "src/test/CMakeFiles/cl_test.dir/queryParser/TestMultiFieldQueryParser.o.d"
+  "/root/repo/src/test/queryParser/TestQueryParser.cpp" "src/test/CMakeFiles/cl_test.dir/queryParser/TestQueryParser.o" "gcc" "src/test/CMakeFiles/cl_test.dir/queryParser/TestQueryParser.o.d"
+  "/root/repo/src/test/search/BaseTestRangeFilter.cpp" "src/test/CMakeFiles/cl_test.dir/search/BaseTestRangeFilter.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/BaseTestRangeFilter.o.d"
+  "/root/repo/src/test/search/CheckHits.cpp" "src/test/CMakeFiles/cl_test.dir/search/CheckHits.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/CheckHits.o.d"
+  "/root/repo/src/test/search/QueryUtils.cpp" "src/test/CMakeFiles/cl_test.dir/search/QueryUtils.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/QueryUtils.o.d"
+  "/root/repo/src/test/search/TestBoolean.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestBoolean.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestBoolean.o.d"
+  "/root/repo/src/test/search/TestConstantScoreRangeQuery.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestConstantScoreRangeQuery.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestConstantScoreRangeQuery.o.d"
+  "/root/repo/src/test/search/TestDateFilter.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestDateFilter.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestDateFilter.o.d"
+  "/root/repo/src/test/search/TestExplanations.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestExplanations.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestExplanations.o.d"
+  "/root/repo/src/test/search/TestExtractTerms.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestExtractTerms.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestExtractTerms.o.d"
+  "/root/repo/src/test/search/TestFacets.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestFacets.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestFacets.o.d"
+  "/root/repo/src/test/search/TestForDuplicates.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestForDuplicates.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestForDuplicates.o.d"
+  "/root/repo/src/test/search/TestIndexSearcher.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestIndexSearcher.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestIndexSearcher.o.d"
+  "/root/repo/src/test/search/TestIndexSort.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestIndexSort.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestIndexSort.o.d"
+  "/root/repo/src/test/search/TestQueries.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestQueries.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestQueries.o.d"
+  "/root/repo/src/test/search/TestQueryResultCache.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestQueryResultCache.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestQueryResultCache.o.d"
+  "/root/repo/src/test/search/TestRangeFilter.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestRangeFilter.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestRangeFilter.o.d"
+  "/root/repo/src/test/search/TestSearch.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestSearch.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestSearch.o.d"
+  "/root/repo/src/test/search/TestSort.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestSort.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestSort.o.d"
+  "/root/repo/src/test/search/TestTermVector.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestTermVector.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestTermVector.o.d"
+  "/root/repo/src/test/search/TestWildcard.cpp" "src/test/CMakeFiles/cl_test.dir/search/TestWildcard.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/TestWildcard.o.d"
+  "/root/repo/src/test/search/spans/TestBasics.cpp" "src/test/CMakeFiles/cl_test.dir/search/spans/TestBasics.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/spans/TestBasics.o.d"
+  "/root/repo/src/test/search/spans/TestNearSpansOrdered.cpp" "src/test/CMakeFiles/cl_test.dir/search/spans/TestNearSpansOrdered.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/spans/TestNearSpansOrdered.o.d"
+  "/root/repo/src/test/search/spans/TestSpanExplanations.cpp" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpanExplanations.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpanExplanations.o.d"
+  "/root/repo/src/test/search/spans/TestSpanExplanationsOfNonMatches.cpp" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpanExplanationsOfNonMatches.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpanExplanationsOfNonMatches.o.d"
+  "/root/repo/src/test/search/spans/TestSpanQueries.cpp" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpanQueries.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpanQueries.o.d"
+  "/root/repo/src/test/search/spans/TestSpans.cpp" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpans.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpans.o.d"
+  "/root/repo/src/test/search/spans/TestSpansAdvanced.cpp" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpansAdvanced.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpansAdvanced.o.d"
+  "/root/repo/src/test/search/spans/TestSpansAdvanced2.cpp" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpansAdvanced2.o" "gcc" "src/test/CMakeFiles/cl_test.dir/search/spans/TestSpansAdvanced2.o.d"
+  "/root/repo/src/test/store/MockRAMDirectory.cpp" "src/test/CMakeFiles/cl_test.dir/store/MockRAMDirectory.o" "gcc" "src/test/CMakeFiles/cl_test.dir/store/MockRAMDirectory.o.d"
+  "/root/repo/src/test/store/TestRAMDirectory.cpp" "src/test/CMakeFiles/cl_test.dir/store/TestRAMDirectory.o" "gcc" "src/test/CMakeFiles/cl_test.dir/store/TestRAMDirectory.o.d"
+  "/root/repo/src/test/store/TestStore.cpp" "src/test/CMakeFiles/cl_test.dir/store/TestStore.o" "gcc" "src/test/CMakeFiles/cl_test.dir/store/TestStore.o.d"
+  "/root/repo/src/test/testall.cpp" "src/test/CMakeFiles/cl_test.dir/testall.o" "gcc" "src/test/CMakeFiles/cl_test.dir/testall.o.d"
+  "/root/repo/src/test/tests.cpp" "src/test/CMakeFiles/cl_test.dir/tests.o" "gcc" "src/test/CMakeFiles/cl_test.dir/tests.o.d"
+  "/root/repo/src/test/util/English.cpp" "src/test/CMakeFiles/cl_test.dir/util/English.o" "gcc" "src/test/CMakeFiles/cl_test.dir/util/English.o.d"
+  "/root/repo/src/test/util/TestBitSet.cpp" "src/test/CMakeFiles/cl_test.dir/util/TestBitSet.o" "gcc" "src/test/CMakeFiles/cl_test.dir/util/TestBitSet.o.d"
+  "/root/repo/src/test/util/TestPriorityQueue.cpp" "src/test/CMakeFiles/cl_test.dir/util/TestPriorityQueue.o" "gcc" "src/test/CMakeFiles/cl_test.dir/util/TestPriorityQueue.o.d"
+  "/root/repo/src/test/util/TestStringBuffer.cpp" "src/test/CMakeFiles/cl_test.dir/util/TestStringBuffer.o" "gcc" "src/test/CMakeFiles/cl_test.dir/util/TestStringBuffer.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_asan/src/core/CMakeFiles/clucene-core.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_asan/src/shared/CMakeFiles/clucene-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_build_contrib
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(SimpleTest "/root/repo/_gate_build_contrib/bin/cl_test")
+set_tests_properties(SimpleTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;143;ADD_TEST;/root/repo/CMakeLists.txt;0;")
+subdirs("src/ext")
+subdirs("src/shared")
+subdirs("src/core")
+subdirs("src/test")
+subdirs("src/demo")
+subdirs("src/contribs")
+subdirs("src/contribs-lib")
@@ -0,0 +1,78 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/contribs-lib/CLucene/snowball/libstemmer/libstemmer.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/libstemmer/libstemmer.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/libstemmer/libstemmer.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/runtime/api.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/runtime/api.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/runtime/api.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/runtime/utilities.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/runtime/utilities.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/runtime/utilities.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_danish.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_danish.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_danish.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_dutch.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_dutch.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_dutch.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_english.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_english.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_english.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_finnish.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_finnish.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_finnish.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_french.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_french.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_french.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_german.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_german.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_german.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_italian.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_italian.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_italian.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_norwegian.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_norwegian.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_norwegian.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_porter.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_porter.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_porter.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_portuguese.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_portuguese.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_portuguese.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_spanish.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_spanish.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_spanish.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_ISO_8859_1_swedish.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_swedish.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_swedish.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_KOI8_R_russian.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_KOI8_R_russian.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_KOI8_R_russian.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_danish.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_danish.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_danish.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_dutch.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_dutch.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_dutch.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_english.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_english.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_english.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_finnish.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_finnish.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_finnish.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_french.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_french.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_french.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_german.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_german.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_german.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_italian.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_italian.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_italian.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_norwegian.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_norwegian.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_norwegian.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_porter.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_porter.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_porter.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_portuguese.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_portuguese.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_portuguese.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_russian.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_russian.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_russian.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_spanish.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_spanish.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_spanish.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/src_c/stem_UTF_8_swedish.c" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_swedish.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_swedish.o.d"
+  "/root/repo/src/contribs-lib/CLucene/analysis/LanguageBasedAnalyzer.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/LanguageBasedAnalyzer.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/LanguageBasedAnalyzer.o.d"
+  "/root/repo/src/contribs-lib/CLucene/analysis/cjk/CJKAnalyzer.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/cjk/CJKAnalyzer.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/cjk/CJKAnalyzer.o.d"
+  "/root/repo/src/contribs-lib/CLucene/analysis/de/GermanAnalyzer.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanAnalyzer.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanAnalyzer.o.d"
+  "/root/repo/src/contribs-lib/CLucene/analysis/de/GermanStemFilter.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanStemFilter.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanStemFilter.o.d"
+  "/root/repo/src/contribs-lib/CLucene/analysis/de/GermanStemmer.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanStemmer.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanStemmer.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/Encoder.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Encoder.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Encoder.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/FastVectorHighlighter.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/FastVectorHighlighter.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/FastVectorHighlighter.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/Formatter.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Formatter.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Formatter.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/Fragmenter.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Fragmenter.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Fragmenter.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/Highlighter.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Highlighter.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Highlighter.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/QueryScorer.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/QueryScorer.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/QueryScorer.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/QueryTermExtractor.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/QueryTermExtractor.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/QueryTermExtractor.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/SimpleFragmenter.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleFragmenter.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleFragmenter.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/SimpleHTMLEncoder.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleHTMLEncoder.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleHTMLEncoder.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/SimpleHTMLFormatter.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleHTMLFormatter.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleHTMLFormatter.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/TextFragment.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TextFragment.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TextFragment.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/TokenGroup.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TokenGroup.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TokenGroup.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/TokenSources.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TokenSources.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TokenSources.o.d"
+  "/root/repo/src/contribs-lib/CLucene/highlighter/WeightedTerm.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/WeightedTerm.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/WeightedTerm.o.d"
+  "/root/repo/src/contribs-lib/CLucene/snowball/Snowball.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/Snowball.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/Snowball.o.d"
+  "/root/repo/src/contribs-lib/CLucene/util/gzipcompressstream.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/util/gzipcompressstream.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/util/gzipcompressstream.o.d"
+  "/root/repo/src/contribs-lib/CLucene/util/gzipinputstream.cpp" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/util/gzipinputstream.o" "gcc" "src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/CLucene/util/gzipinputstream.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build_contrib/bin/libclucene-contribs-lib.so" "/root/repo/_gate_build_contrib/bin/libclucene-contribs-lib.so.2.3.3.4"
+  "/root/repo/_gate_build_contrib/bin/libclucene-contribs-lib.so.1" "/root/repo/_gate_build_contrib/bin/libclucene-contribs-lib.so.2.3.3.4"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_contrib/src/core/CMakeFiles/clucene-core.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_contrib/src/shared/CMakeFiles/clucene-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,113 @@
+file(REMOVE_RECURSE
+  "../../bin/libclucene-contribs-lib.pdb"
+  "../../bin/libclucene-contribs-lib.so"
+  "../../bin/libclucene-contribs-lib.so.1"
+  "../../bin/libclucene-contribs-lib.so.2.3.3.4"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/LanguageBasedAnalyzer.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/LanguageBasedAnalyzer.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/cjk/CJKAnalyzer.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/cjk/CJKAnalyzer.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanAnalyzer.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanAnalyzer.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanStemFilter.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanStemFilter.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanStemmer.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/analysis/de/GermanStemmer.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Encoder.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Encoder.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/FastVectorHighlighter.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/FastVectorHighlighter.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Formatter.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Formatter.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Fragmenter.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Fragmenter.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Highlighter.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/Highlighter.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/QueryScorer.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/QueryScorer.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/QueryTermExtractor.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/QueryTermExtractor.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleFragmenter.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleFragmenter.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleHTMLEncoder.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleHTMLEncoder.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleHTMLFormatter.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/SimpleHTMLFormatter.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TextFragment.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TextFragment.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TokenGroup.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TokenGroup.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TokenSources.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/TokenSources.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/WeightedTerm.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/highlighter/WeightedTerm.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/Snowball.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/Snowball.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/libstemmer/libstemmer.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/libstemmer/libstemmer.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/runtime/api.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/runtime/api.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/runtime/utilities.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/runtime/utilities.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_danish.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_danish.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_dutch.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_dutch.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_english.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_english.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_finnish.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_finnish.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_french.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_french.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_german.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_german.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_italian.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_italian.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_norwegian.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_norwegian.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_porter.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_porter.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_portuguese.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_portuguese.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_spanish.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_spanish.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_swedish.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_ISO_8859_1_swedish.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_KOI8_R_russian.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_KOI8_R_russian.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_danish.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_danish.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_dutch.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_dutch.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_english.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_english.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_finnish.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_finnish.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_french.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_french.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_german.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_german.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_italian.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_italian.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_norwegian.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_norwegian.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_porter.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_porter.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_portuguese.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_portuguese.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_russian.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_russian.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_spanish.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_spanish.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_swedish.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/snowball/src_c/stem_UTF_8_swedish.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/util/gzipcompressstream.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/util/gzipcompressstream.o.d"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/util/gzipinputstream.o"
+  "CMakeFiles/clucene-contribs-lib.dir/CLucene/util/gzipinputstream.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/clucene-contribs-lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
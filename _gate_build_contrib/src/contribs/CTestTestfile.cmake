@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/contribs
+# Build directory: /root/repo/_gate_build_contrib/src/contribs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("contribs-lib-test")
+subdirs("benchmarker")
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/contribs/benchmarker/Benchmarker.cpp" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/Benchmarker.o" "gcc" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/Benchmarker.o.d"
+  "/root/repo/src/contribs/benchmarker/Main.cpp" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/Main.o" "gcc" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/Main.o.d"
+  "/root/repo/src/contribs/benchmarker/TestAnalysis.cpp" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/TestAnalysis.o" "gcc" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/TestAnalysis.o.d"
+  "/root/repo/src/contribs/benchmarker/TestCLString.cpp" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/TestCLString.o" "gcc" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/TestCLString.o.d"
+  "/root/repo/src/contribs/benchmarker/TestMergePolicy.cpp" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/TestMergePolicy.o" "gcc" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/TestMergePolicy.o.d"
+  "/root/repo/src/contribs/benchmarker/TestStringIntern.cpp" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/TestStringIntern.o" "gcc" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/TestStringIntern.o.d"
+  "/root/repo/src/contribs/benchmarker/Unit.cpp" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/Unit.o" "gcc" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/Unit.o.d"
+  "/root/repo/src/contribs/benchmarker/stdafx.cpp" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/stdafx.o" "gcc" "src/contribs/benchmarker/CMakeFiles/cl_benchmarker.dir/stdafx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_contrib/src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_contrib/src/core/CMakeFiles/clucene-core.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_contrib/src/shared/CMakeFiles/clucene-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
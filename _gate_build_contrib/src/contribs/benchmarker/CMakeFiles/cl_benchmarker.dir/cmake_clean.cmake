@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../../bin/cl_benchmarker"
+  "../../../bin/cl_benchmarker.pdb"
+  "CMakeFiles/cl_benchmarker.dir/Benchmarker.o"
+  "CMakeFiles/cl_benchmarker.dir/Benchmarker.o.d"
+  "CMakeFiles/cl_benchmarker.dir/Main.o"
+  "CMakeFiles/cl_benchmarker.dir/Main.o.d"
+  "CMakeFiles/cl_benchmarker.dir/TestAnalysis.o"
+  "CMakeFiles/cl_benchmarker.dir/TestAnalysis.o.d"
+  "CMakeFiles/cl_benchmarker.dir/TestCLString.o"
+  "CMakeFiles/cl_benchmarker.dir/TestCLString.o.d"
+  "CMakeFiles/cl_benchmarker.dir/TestMergePolicy.o"
+  "CMakeFiles/cl_benchmarker.dir/TestMergePolicy.o.d"
+  "CMakeFiles/cl_benchmarker.dir/TestStringIntern.o"
+  "CMakeFiles/cl_benchmarker.dir/TestStringIntern.o.d"
+  "CMakeFiles/cl_benchmarker.dir/Unit.o"
+  "CMakeFiles/cl_benchmarker.dir/Unit.o.d"
+  "CMakeFiles/cl_benchmarker.dir/stdafx.o"
+  "CMakeFiles/cl_benchmarker.dir/stdafx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cl_benchmarker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
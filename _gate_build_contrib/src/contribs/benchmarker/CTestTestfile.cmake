@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/contribs/benchmarker
+# Build directory: /root/repo/_gate_build_contrib/src/contribs/benchmarker
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/contribs/contribs-lib-test/CuTest.cpp" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/CuTest.o" "gcc" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/CuTest.o.d"
+  "/root/repo/src/contribs/contribs-lib-test/TestAnalysis.cpp" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/TestAnalysis.o" "gcc" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/TestAnalysis.o.d"
+  "/root/repo/src/contribs/contribs-lib-test/TestHighlight.cpp" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/TestHighlight.o" "gcc" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/TestHighlight.o.d"
+  "/root/repo/src/contribs/contribs-lib-test/TestSnowball.cpp" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/TestSnowball.o" "gcc" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/TestSnowball.o.d"
+  "/root/repo/src/contribs/contribs-lib-test/TestStreams.cpp" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/TestStreams.o" "gcc" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/TestStreams.o.d"
+  "/root/repo/src/contribs/contribs-lib-test/TestUtf8.cpp" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/TestUtf8.o" "gcc" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/TestUtf8.o.d"
+  "/root/repo/src/contribs/contribs-lib-test/contribTests.cpp" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/contribTests.o" "gcc" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/contribTests.o.d"
+  "/root/repo/src/contribs/contribs-lib-test/testall.cpp" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/testall.o" "gcc" "src/contribs/contribs-lib-test/CMakeFiles/cl_contribs-lib-test.dir/testall.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_contrib/src/contribs-lib/CMakeFiles/clucene-contribs-lib.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_contrib/src/core/CMakeFiles/clucene-core.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_contrib/src/shared/CMakeFiles/clucene-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../../bin/cl_contribs-lib-test"
+  "../../../bin/cl_contribs-lib-test.pdb"
+  "CMakeFiles/cl_contribs-lib-test.dir/CuTest.o"
+  "CMakeFiles/cl_contribs-lib-test.dir/CuTest.o.d"
+  "CMakeFiles/cl_contribs-lib-test.dir/TestAnalysis.o"
+  "CMakeFiles/cl_contribs-lib-test.dir/TestAnalysis.o.d"
+  "CMakeFiles/cl_contribs-lib-test.dir/TestHighlight.o"
+  "CMakeFiles/cl_contribs-lib-test.dir/TestHighlight.o.d"
+  "CMakeFiles/cl_contribs-lib-test.dir/TestSnowball.o"
+  "CMakeFiles/cl_contribs-lib-test.dir/TestSnowball.o.d"
+  "CMakeFiles/cl_contribs-lib-test.dir/TestStreams.o"
+  "CMakeFiles/cl_contribs-lib-test.dir/TestStreams.o.d"
+  "CMakeFiles/cl_contribs-lib-test.dir/TestUtf8.o"
+  "CMakeFiles/cl_contribs-lib-test.dir/TestUtf8.o.d"
+  "CMakeFiles/cl_contribs-lib-test.dir/contribTests.o"
+  "CMakeFiles/cl_contribs-lib-test.dir/contribTests.o.d"
+  "CMakeFiles/cl_contribs-lib-test.dir/testall.o"
+  "CMakeFiles/cl_contribs-lib-test.dir/testall.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cl_contribs-lib-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
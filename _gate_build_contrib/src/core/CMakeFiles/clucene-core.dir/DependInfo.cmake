@@ -0,0 +1,167 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/CLucene/StdHeader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/StdHeader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/StdHeader.o.d"
+  "/root/repo/src/core/CLucene/analysis/AnalysisHeader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/analysis/AnalysisHeader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/analysis/AnalysisHeader.o.d"
+  "/root/repo/src/core/CLucene/analysis/Analyzers.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/analysis/Analyzers.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/analysis/Analyzers.o.d"
+  "/root/repo/src/core/CLucene/analysis/standard/StandardAnalyzer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardAnalyzer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardAnalyzer.o.d"
+  "/root/repo/src/core/CLucene/analysis/standard/StandardFilter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardFilter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardFilter.o.d"
+  "/root/repo/src/core/CLucene/analysis/standard/StandardTokenizer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardTokenizer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/analysis/standard/StandardTokenizer.o.d"
+  "/root/repo/src/core/CLucene/debug/error.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/debug/error.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/debug/error.o.d"
+  "/root/repo/src/core/CLucene/document/DateField.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/DateField.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/DateField.o.d"
+  "/root/repo/src/core/CLucene/document/DateTools.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/DateTools.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/DateTools.o.d"
+  "/root/repo/src/core/CLucene/document/Document.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/Document.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/Document.o.d"
+  "/root/repo/src/core/CLucene/document/Field.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/Field.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/Field.o.d"
+  "/root/repo/src/core/CLucene/document/FieldSelector.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/FieldSelector.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/FieldSelector.o.d"
+  "/root/repo/src/core/CLucene/document/NumberTools.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/NumberTools.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/document/NumberTools.o.d"
+  "/root/repo/src/core/CLucene/index/CheckIndex.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/CheckIndex.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/CheckIndex.o.d"
+  "/root/repo/src/core/CLucene/index/CompoundFile.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/CompoundFile.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/CompoundFile.o.d"
+  "/root/repo/src/core/CLucene/index/DirectoryIndexReader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/DirectoryIndexReader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/DirectoryIndexReader.o.d"
+  "/root/repo/src/core/CLucene/index/DocValues.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/DocValues.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/DocValues.o.d"
+  "/root/repo/src/core/CLucene/index/DocumentsWriter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/DocumentsWriter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/DocumentsWriter.o.d"
+  "/root/repo/src/core/CLucene/index/DocumentsWriterThreadState.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/DocumentsWriterThreadState.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/DocumentsWriterThreadState.o.d"
+  "/root/repo/src/core/CLucene/index/FieldInfos.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/FieldInfos.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/FieldInfos.o.d"
+  "/root/repo/src/core/CLucene/index/FieldsReader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/FieldsReader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/FieldsReader.o.d"
+  "/root/repo/src/core/CLucene/index/FieldsWriter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/FieldsWriter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/FieldsWriter.o.d"
+  "/root/repo/src/core/CLucene/index/IndexDeletionPolicy.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexDeletionPolicy.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexDeletionPolicy.o.d"
+  "/root/repo/src/core/CLucene/index/IndexFileDeleter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexFileDeleter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexFileDeleter.o.d"
+  "/root/repo/src/core/CLucene/index/IndexFileNameFilter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexFileNameFilter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexFileNameFilter.o.d"
+  "/root/repo/src/core/CLucene/index/IndexFileNames.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexFileNames.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexFileNames.o.d"
+  "/root/repo/src/core/CLucene/index/IndexModifier.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexModifier.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexModifier.o.d"
+  "/root/repo/src/core/CLucene/index/IndexReader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexReader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexReader.o.d"
+  "/root/repo/src/core/CLucene/index/IndexWriter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexWriter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexWriter.o.d"
+  "/root/repo/src/core/CLucene/index/IndexingPipeline.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexingPipeline.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/IndexingPipeline.o.d"
+  "/root/repo/src/core/CLucene/index/MergePolicy.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/MergePolicy.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/MergePolicy.o.d"
+  "/root/repo/src/core/CLucene/index/MergeScheduler.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/MergeScheduler.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/MergeScheduler.o.d"
+  "/root/repo/src/core/CLucene/index/MultiReader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/MultiReader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/MultiReader.o.d"
+  "/root/repo/src/core/CLucene/index/MultiSegmentReader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/MultiSegmentReader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/MultiSegmentReader.o.d"
+  "/root/repo/src/core/CLucene/index/MultipleTermPositions.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/MultipleTermPositions.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/MultipleTermPositions.o.d"
+  "/root/repo/src/core/CLucene/index/Payload.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/Payload.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/Payload.o.d"
+  "/root/repo/src/core/CLucene/index/SegmentInfos.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentInfos.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentInfos.o.d"
+  "/root/repo/src/core/CLucene/index/SegmentMergeInfo.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentMergeInfo.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentMergeInfo.o.d"
+  "/root/repo/src/core/CLucene/index/SegmentMergeQueue.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentMergeQueue.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentMergeQueue.o.d"
+  "/root/repo/src/core/CLucene/index/SegmentMerger.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentMerger.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentMerger.o.d"
+  "/root/repo/src/core/CLucene/index/SegmentReader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentReader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentReader.o.d"
+  "/root/repo/src/core/CLucene/index/SegmentTermDocs.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermDocs.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermDocs.o.d"
+  "/root/repo/src/core/CLucene/index/SegmentTermEnum.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermEnum.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermEnum.o.d"
+  "/root/repo/src/core/CLucene/index/SegmentTermPositions.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermPositions.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermPositions.o.d"
+  "/root/repo/src/core/CLucene/index/SegmentTermVector.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermVector.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SegmentTermVector.o.d"
+  "/root/repo/src/core/CLucene/index/SkipListReader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SkipListReader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SkipListReader.o.d"
+  "/root/repo/src/core/CLucene/index/SkipListWriter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SkipListWriter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/SkipListWriter.o.d"
+  "/root/repo/src/core/CLucene/index/Term.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/Term.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/Term.o.d"
+  "/root/repo/src/core/CLucene/index/TermInfo.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/TermInfo.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/TermInfo.o.d"
+  "/root/repo/src/core/CLucene/index/TermInfosReader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/TermInfosReader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/TermInfosReader.o.d"
+  "/root/repo/src/core/CLucene/index/TermInfosWriter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/TermInfosWriter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/TermInfosWriter.o.d"
+  "/root/repo/src/core/CLucene/index/TermVectorReader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/TermVectorReader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/TermVectorReader.o.d"
+  "/root/repo/src/core/CLucene/index/TermVectorWriter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/TermVectorWriter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/TermVectorWriter.o.d"
+  "/root/repo/src/core/CLucene/index/Terms.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/Terms.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/index/Terms.o.d"
+  "/root/repo/src/core/CLucene/queryParser/FastCharStream.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/FastCharStream.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/FastCharStream.o.d"
+  "/root/repo/src/core/CLucene/queryParser/MultiFieldQueryParser.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/MultiFieldQueryParser.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/MultiFieldQueryParser.o.d"
+  "/root/repo/src/core/CLucene/queryParser/QueryParser.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryParser.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryParser.o.d"
+  "/root/repo/src/core/CLucene/queryParser/QueryParserTokenManager.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryParserTokenManager.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryParserTokenManager.o.d"
+  "/root/repo/src/core/CLucene/queryParser/QueryToken.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryToken.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/QueryToken.o.d"
+  "/root/repo/src/core/CLucene/queryParser/legacy/Lexer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/Lexer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/Lexer.o.d"
+  "/root/repo/src/core/CLucene/queryParser/legacy/MultiFieldQueryParser.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/MultiFieldQueryParser.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/MultiFieldQueryParser.o.d"
+  "/root/repo/src/core/CLucene/queryParser/legacy/QueryParser.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryParser.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryParser.o.d"
+  "/root/repo/src/core/CLucene/queryParser/legacy/QueryParserBase.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryParserBase.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryParserBase.o.d"
+  "/root/repo/src/core/CLucene/queryParser/legacy/QueryToken.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryToken.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/QueryToken.o.d"
+  "/root/repo/src/core/CLucene/queryParser/legacy/TokenList.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/TokenList.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/queryParser/legacy/TokenList.o.d"
+  "/root/repo/src/core/CLucene/search/BooleanQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/BooleanQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/BooleanQuery.o.d"
+  "/root/repo/src/core/CLucene/search/BooleanScorer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/BooleanScorer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/BooleanScorer.o.d"
+  "/root/repo/src/core/CLucene/search/BooleanScorer2.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/BooleanScorer2.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/BooleanScorer2.o.d"
+  "/root/repo/src/core/CLucene/search/CachingSpanFilter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/CachingSpanFilter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/CachingSpanFilter.o.d"
+  "/root/repo/src/core/CLucene/search/CachingWrapperFilter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/CachingWrapperFilter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/CachingWrapperFilter.o.d"
+  "/root/repo/src/core/CLucene/search/ChainedFilter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/ChainedFilter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/ChainedFilter.o.d"
+  "/root/repo/src/core/CLucene/search/Compare.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Compare.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Compare.o.d"
+  "/root/repo/src/core/CLucene/search/ConjunctionScorer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/ConjunctionScorer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/ConjunctionScorer.o.d"
+  "/root/repo/src/core/CLucene/search/ConstantScoreQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/ConstantScoreQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/ConstantScoreQuery.o.d"
+  "/root/repo/src/core/CLucene/search/DateFilter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/DateFilter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/DateFilter.o.d"
+  "/root/repo/src/core/CLucene/search/DisjunctionSumScorer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/DisjunctionSumScorer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/DisjunctionSumScorer.o.d"
+  "/root/repo/src/core/CLucene/search/EarlyTerminatingCollector.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/EarlyTerminatingCollector.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/EarlyTerminatingCollector.o.d"
+  "/root/repo/src/core/CLucene/search/ExactPhraseScorer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/ExactPhraseScorer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/ExactPhraseScorer.o.d"
+  "/root/repo/src/core/CLucene/search/Explanation.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Explanation.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Explanation.o.d"
+  "/root/repo/src/core/CLucene/search/FacetCollector.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FacetCollector.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FacetCollector.o.d"
+  "/root/repo/src/core/CLucene/search/FieldCache.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FieldCache.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FieldCache.o.d"
+  "/root/repo/src/core/CLucene/search/FieldCacheImpl.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FieldCacheImpl.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FieldCacheImpl.o.d"
+  "/root/repo/src/core/CLucene/search/FieldDocSortedHitQueue.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FieldDocSortedHitQueue.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FieldDocSortedHitQueue.o.d"
+  "/root/repo/src/core/CLucene/search/FieldSortedHitQueue.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FieldSortedHitQueue.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FieldSortedHitQueue.o.d"
+  "/root/repo/src/core/CLucene/search/FilteredTermEnum.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FilteredTermEnum.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FilteredTermEnum.o.d"
+  "/root/repo/src/core/CLucene/search/FuzzyQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FuzzyQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/FuzzyQuery.o.d"
+  "/root/repo/src/core/CLucene/search/HitQueue.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/HitQueue.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/HitQueue.o.d"
+  "/root/repo/src/core/CLucene/search/Hits.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Hits.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Hits.o.d"
+  "/root/repo/src/core/CLucene/search/IndexSearcher.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/IndexSearcher.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/IndexSearcher.o.d"
+  "/root/repo/src/core/CLucene/search/MatchAllDocsQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/MatchAllDocsQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/MatchAllDocsQuery.o.d"
+  "/root/repo/src/core/CLucene/search/MultiPhraseQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/MultiPhraseQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/MultiPhraseQuery.o.d"
+  "/root/repo/src/core/CLucene/search/MultiSearcher.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/MultiSearcher.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/MultiSearcher.o.d"
+  "/root/repo/src/core/CLucene/search/MultiTermQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/MultiTermQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/MultiTermQuery.o.d"
+  "/root/repo/src/core/CLucene/search/MultiTermRewrite.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/MultiTermRewrite.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/MultiTermRewrite.o.d"
+  "/root/repo/src/core/CLucene/search/PhrasePositions.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/PhrasePositions.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/PhrasePositions.o.d"
+  "/root/repo/src/core/CLucene/search/PhraseQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/PhraseQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/PhraseQuery.o.d"
+  "/root/repo/src/core/CLucene/search/PhraseScorer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/PhraseScorer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/PhraseScorer.o.d"
+  "/root/repo/src/core/CLucene/search/PrefixQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/PrefixQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/PrefixQuery.o.d"
+  "/root/repo/src/core/CLucene/search/QueryFilter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/QueryFilter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/QueryFilter.o.d"
+  "/root/repo/src/core/CLucene/search/QueryResultCache.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/QueryResultCache.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/QueryResultCache.o.d"
+  "/root/repo/src/core/CLucene/search/RangeFilter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/RangeFilter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/RangeFilter.o.d"
+  "/root/repo/src/core/CLucene/search/RangeQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/RangeQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/RangeQuery.o.d"
+  "/root/repo/src/core/CLucene/search/Scorer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Scorer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Scorer.o.d"
+  "/root/repo/src/core/CLucene/search/ScorerDocQueue.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/ScorerDocQueue.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/ScorerDocQueue.o.d"
+  "/root/repo/src/core/CLucene/search/SearchHeader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/SearchHeader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/SearchHeader.o.d"
+  "/root/repo/src/core/CLucene/search/Similarity.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Similarity.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Similarity.o.d"
+  "/root/repo/src/core/CLucene/search/SloppyPhraseScorer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/SloppyPhraseScorer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/SloppyPhraseScorer.o.d"
+  "/root/repo/src/core/CLucene/search/Sort.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Sort.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/Sort.o.d"
+  "/root/repo/src/core/CLucene/search/SpanQueryFilter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/SpanQueryFilter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/SpanQueryFilter.o.d"
+  "/root/repo/src/core/CLucene/search/TermQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/TermQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/TermQuery.o.d"
+  "/root/repo/src/core/CLucene/search/TermScorer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/TermScorer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/TermScorer.o.d"
+  "/root/repo/src/core/CLucene/search/WildcardQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/WildcardQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/WildcardQuery.o.d"
+  "/root/repo/src/core/CLucene/search/WildcardTermEnum.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/WildcardTermEnum.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/WildcardTermEnum.o.d"
+  "/root/repo/src/core/CLucene/search/spans/NearSpansOrdered.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/NearSpansOrdered.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/NearSpansOrdered.o.d"
+  "/root/repo/src/core/CLucene/search/spans/NearSpansUnordered.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/NearSpansUnordered.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/NearSpansUnordered.o.d"
+  "/root/repo/src/core/CLucene/search/spans/SpanFirstQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanFirstQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanFirstQuery.o.d"
+  "/root/repo/src/core/CLucene/search/spans/SpanNearQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanNearQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanNearQuery.o.d"
+  "/root/repo/src/core/CLucene/search/spans/SpanNotQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanNotQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanNotQuery.o.d"
+  "/root/repo/src/core/CLucene/search/spans/SpanOrQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanOrQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanOrQuery.o.d"
+  "/root/repo/src/core/CLucene/search/spans/SpanScorer.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanScorer.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanScorer.o.d"
+  "/root/repo/src/core/CLucene/search/spans/SpanTermQuery.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanTermQuery.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanTermQuery.o.d"
+  "/root/repo/src/core/CLucene/search/spans/SpanWeight.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanWeight.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/SpanWeight.o.d"
+  "/root/repo/src/core/CLucene/search/spans/TermSpans.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/TermSpans.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/search/spans/TermSpans.o.d"
+  "/root/repo/src/core/CLucene/store/Directory.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/Directory.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/Directory.o.d"
+  "/root/repo/src/core/CLucene/store/FSDirectory.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/FSDirectory.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/FSDirectory.o.d"
+  "/root/repo/src/core/CLucene/store/IndexInput.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/IndexInput.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/IndexInput.o.d"
+  "/root/repo/src/core/CLucene/store/IndexOutput.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/IndexOutput.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/IndexOutput.o.d"
+  "/root/repo/src/core/CLucene/store/Lock.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/Lock.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/Lock.o.d"
+  "/root/repo/src/core/CLucene/store/LockFactory.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/LockFactory.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/LockFactory.o.d"
+  "/root/repo/src/core/CLucene/store/MMapInput.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/MMapInput.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/MMapInput.o.d"
+  "/root/repo/src/core/CLucene/store/MergeDirectory.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/MergeDirectory.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/MergeDirectory.o.d"
+  "/root/repo/src/core/CLucene/store/NRTCachingDirectory.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/NRTCachingDirectory.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/NRTCachingDirectory.o.d"
+  "/root/repo/src/core/CLucene/store/RAMDirectory.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/RAMDirectory.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/RAMDirectory.o.d"
+  "/root/repo/src/core/CLucene/store/RateLimiter.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/RateLimiter.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/store/RateLimiter.o.d"
+  "/root/repo/src/core/CLucene/util/BitSet.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/BitSet.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/BitSet.o.d"
+  "/root/repo/src/core/CLucene/util/Equators.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/Equators.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/Equators.o.d"
+  "/root/repo/src/core/CLucene/util/FastCharStream.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/FastCharStream.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/FastCharStream.o.d"
+  "/root/repo/src/core/CLucene/util/MD5Digester.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/MD5Digester.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/MD5Digester.o.d"
+  "/root/repo/src/core/CLucene/util/Reader.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/Reader.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/Reader.o.d"
+  "/root/repo/src/core/CLucene/util/StringIntern.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/StringIntern.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/StringIntern.o.d"
+  "/root/repo/src/core/CLucene/util/ThreadLocal.cpp" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/ThreadLocal.o" "gcc" "src/core/CMakeFiles/clucene-core.dir/CLucene/util/ThreadLocal.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build_contrib/bin/libclucene-core.so" "/root/repo/_gate_build_contrib/bin/libclucene-core.so.2.3.3.4"
+  "/root/repo/_gate_build_contrib/bin/libclucene-core.so.1" "/root/repo/_gate_build_contrib/bin/libclucene-core.so.2.3.3.4"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_contrib/src/shared/CMakeFiles/clucene-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/shared/CLucene/SharedHeader.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/SharedHeader.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/SharedHeader.o.d"
+  "/root/repo/src/shared/CLucene/config/gunichartables.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/gunichartables.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/gunichartables.o.d"
+  "/root/repo/src/shared/CLucene/config/repl_lltot.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_lltot.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_lltot.o.d"
+  "/root/repo/src/shared/CLucene/config/repl_tcscasecmp.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcscasecmp.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcscasecmp.o.d"
+  "/root/repo/src/shared/CLucene/config/repl_tcslwr.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcslwr.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcslwr.o.d"
+  "/root/repo/src/shared/CLucene/config/repl_tcstod.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcstod.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcstod.o.d"
+  "/root/repo/src/shared/CLucene/config/repl_tcstoll.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcstoll.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_tcstoll.o.d"
+  "/root/repo/src/shared/CLucene/config/repl_tprintf.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_tprintf.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/repl_tprintf.o.d"
+  "/root/repo/src/shared/CLucene/config/threads.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/threads.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/threads.o.d"
+  "/root/repo/src/shared/CLucene/config/utf8.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/utf8.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/config/utf8.o.d"
+  "/root/repo/src/shared/CLucene/debug/condition.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/debug/condition.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/debug/condition.o.d"
+  "/root/repo/src/shared/CLucene/util/Misc.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/util/Misc.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/util/Misc.o.d"
+  "/root/repo/src/shared/CLucene/util/StringBuffer.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/util/StringBuffer.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/util/StringBuffer.o.d"
+  "/root/repo/src/shared/CLucene/util/dirent.cpp" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/util/dirent.o" "gcc" "src/shared/CMakeFiles/clucene-shared.dir/CLucene/util/dirent.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build_contrib/bin/libclucene-shared.so" "/root/repo/_gate_build_contrib/bin/libclucene-shared.so.2.3.3.4"
+  "/root/repo/_gate_build_contrib/bin/libclucene-shared.so.1" "/root/repo/_gate_build_contrib/bin/libclucene-shared.so.2.3.3.4"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
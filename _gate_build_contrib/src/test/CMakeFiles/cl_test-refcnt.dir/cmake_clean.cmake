@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/cl_test-refcnt"
+  "../../bin/cl_test-refcnt.pdb"
+  "CMakeFiles/cl_test-refcnt.dir/CLMonolithic_Test.o"
+  "CMakeFiles/cl_test-refcnt.dir/CLMonolithic_Test.o.d"
+  "CMakeFiles/cl_test-refcnt.dir/__/core/CLucene/CLMonolithic.o"
+  "CMakeFiles/cl_test-refcnt.dir/__/core/CLucene/CLMonolithic.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cl_test-refcnt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,121 @@
+file(REMOVE_RECURSE
+  "../../bin/cl_test"
+  "../../bin/cl_test.pdb"
+  "CMakeFiles/cl_test.dir/CuTest.o"
+  "CMakeFiles/cl_test.dir/CuTest.o.d"
+  "CMakeFiles/cl_test.dir/analysis/TestAnalysis.o"
+  "CMakeFiles/cl_test.dir/analysis/TestAnalysis.o.d"
+  "CMakeFiles/cl_test.dir/analysis/TestAnalyzers.o"
+  "CMakeFiles/cl_test.dir/analysis/TestAnalyzers.o.d"
+  "CMakeFiles/cl_test.dir/debug/TestError.o"
+  "CMakeFiles/cl_test.dir/debug/TestError.o.d"
+  "CMakeFiles/cl_test.dir/document/TestDateTools.o"
+  "CMakeFiles/cl_test.dir/document/TestDateTools.o.d"
+  "CMakeFiles/cl_test.dir/document/TestDocument.o"
+  "CMakeFiles/cl_test.dir/document/TestDocument.o.d"
+  "CMakeFiles/cl_test.dir/document/TestField.o"
+  "CMakeFiles/cl_test.dir/document/TestField.o.d"
+  "CMakeFiles/cl_test.dir/document/TestNumberTools.o"
+  "CMakeFiles/cl_test.dir/document/TestNumberTools.o.d"
+  "CMakeFiles/cl_test.dir/index/IndexWriter4Test.o"
+  "CMakeFiles/cl_test.dir/index/IndexWriter4Test.o.d"
+  "CMakeFiles/cl_test.dir/index/TestAddIndexesNoOptimize.o"
+  "CMakeFiles/cl_test.dir/index/TestAddIndexesNoOptimize.o.d"
+  "CMakeFiles/cl_test.dir/index/TestHighFreqTerms.o"
+  "CMakeFiles/cl_test.dir/index/TestHighFreqTerms.o.d"
+  "CMakeFiles/cl_test.dir/index/TestIndexModifier.o"
+  "CMakeFiles/cl_test.dir/index/TestIndexModifier.o.d"
+  "CMakeFiles/cl_test.dir/index/TestIndexReader.o"
+  "CMakeFiles/cl_test.dir/index/TestIndexReader.o.d"
+  "CMakeFiles/cl_test.dir/index/TestIndexWriter.o"
+  "CMakeFiles/cl_test.dir/index/TestIndexWriter.o.d"
+  "CMakeFiles/cl_test.dir/index/TestReuters.o"
+  "CMakeFiles/cl_test.dir/index/TestReuters.o.d"
+  "CMakeFiles/cl_test.dir/index/TestTermVectorsReader.o"
+  "CMakeFiles/cl_test.dir/index/TestTermVectorsReader.o.d"
+  "CMakeFiles/cl_test.dir/index/TestThreading.o"
+  "CMakeFiles/cl_test.dir/index/TestThreading.o.d"
+  "CMakeFiles/cl_test.dir/index/TestUtf8.o"
+  "CMakeFiles/cl_test.dir/index/TestUtf8.o.d"
+  "CMakeFiles/cl_test.dir/queryParser/TestMultiFieldQueryParser.o"
+  "CMakeFiles/cl_test.dir/queryParser/TestMultiFieldQueryParser.o.d"
+  "CMakeFiles/cl_test.dir/queryParser/TestQueryParser.o"
+  "CMakeFiles/cl_test.dir/queryParser/TestQueryParser.o.d"
+  "CMakeFiles/cl_test.dir/search/BaseTestRangeFilter.o"
+  "CMakeFiles/cl_test.dir/search/BaseTestRangeFilter.o.d"
+  "CMakeFiles/cl_test.dir/search/CheckHits.o"
+  "CMakeFiles/cl_test.dir/search/CheckHits.o.d"
+  "CMakeFiles/cl_test.dir/search/QueryUtils.o"
+  "CMakeFiles/cl_test.dir/search/QueryUtils.o.d"
+  "CMakeFiles/cl_test.dir/search/TestBoolean.o"
+  "CMakeFiles/cl_test.dir/search/TestBoolean.o.d"
+  "CMakeFiles/cl_test.dir/search/TestConstantScoreRangeQuery.o"
+  "CMakeFiles/cl_test.dir/search/TestConstantScoreRangeQuery.o.d"
+  "CMakeFiles/cl_test.dir/search/TestDateFilter.o"
+  "CMakeFiles/cl_test.dir/search/TestDateFilter.o.d"
+  "CMakeFiles/cl_test.dir/search/TestExplanations.o"
+  "CMakeFiles/cl_test.dir/search/TestExplanations.o.d"
+  "CMakeFiles/cl_test.dir/search/TestExtractTerms.o"
+  "CMakeFiles/cl_test.dir/search/TestExtractTerms.o.d"
+  "CMakeFiles/cl_test.dir/search/TestFacets.o"
+  "CMakeFiles/cl_test.dir/search/TestFacets.o.d"
+  "CMakeFiles/cl_test.dir/search/TestForDuplicates.o"
+  "CMakeFiles/cl_test.dir/search/TestForDuplicates.o.d"
+  "CMakeFiles/cl_test.dir/search/TestIndexSearcher.o"
+  "CMakeFiles/cl_test.dir/search/TestIndexSearcher.o.d"
+  "CMakeFiles/cl_test.dir/search/TestIndexSort.o"
+  "CMakeFiles/cl_test.dir/search/TestIndexSort.o.d"
+  "CMakeFiles/cl_test.dir/search/TestQueries.o"
+  "CMakeFiles/cl_test.dir/search/TestQueries.o.d"
+  "CMakeFiles/cl_test.dir/search/TestQueryResultCache.o"
+  "CMakeFiles/cl_test.dir/search/TestQueryResultCache.o.d"
+  "CMakeFiles/cl_test.dir/search/TestRangeFilter.o"
+  "CMakeFiles/cl_test.dir/search/TestRangeFilter.o.d"
+  "CMakeFiles/cl_test.dir/search/TestSearch.o"
+  "CMakeFiles/cl_test.dir/search/TestSearch.o.d"
+  "CMakeFiles/cl_test.dir/search/TestSort.o"
+  "CMakeFiles/cl_test.dir/search/TestSort.o.d"
+  "CMakeFiles/cl_test.dir/search/TestTermVector.o"
+  "CMakeFiles/cl_test.dir/search/TestTermVector.o.d"
+  "CMakeFiles/cl_test.dir/search/TestWildcard.o"
+  "CMakeFiles/cl_test.dir/search/TestWildcard.o.d"
+  "CMakeFiles/cl_test.dir/search/spans/TestBasics.o"
+  "CMakeFiles/cl_test.dir/search/spans/TestBasics.o.d"
+  "CMakeFiles/cl_test.dir/search/spans/TestNearSpansOrdered.o"
+  "CMakeFiles/cl_test.dir/search/spans/TestNearSpansOrdered.o.d"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpanExplanations.o"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpanExplanations.o.d"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpanExplanationsOfNonMatches.o"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpanExplanationsOfNonMatches.o.d"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpanQueries.o"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpanQueries.o.d"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpans.o"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpans.o.d"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpansAdvanced.o"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpansAdvanced.o.d"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpansAdvanced2.o"
+  "CMakeFiles/cl_test.dir/search/spans/TestSpansAdvanced2.o.d"
+  "CMakeFiles/cl_test.dir/store/MockRAMDirectory.o"
+  "CMakeFiles/cl_test.dir/store/MockRAMDirectory.o.d"
+  "CMakeFiles/cl_test.dir/store/TestRAMDirectory.o"
+  "CMakeFiles/cl_test.dir/store/TestRAMDirectory.o.d"
+  "CMakeFiles/cl_test.dir/store/TestStore.o"
+  "CMakeFiles/cl_test.dir/store/TestStore.o.d"
+  "CMakeFiles/cl_test.dir/testall.o"
+  "CMakeFiles/cl_test.dir/testall.o.d"
+  "CMakeFiles/cl_test.dir/tests.o"
+  "CMakeFiles/cl_test.dir/tests.o.d"
+  "CMakeFiles/cl_test.dir/util/English.o"
+  "CMakeFiles/cl_test.dir/util/English.o.d"
+  "CMakeFiles/cl_test.dir/util/TestBitSet.o"
+  "CMakeFiles/cl_test.dir/util/TestBitSet.o.d"
+  "CMakeFiles/cl_test.dir/util/TestPriorityQueue.o"
+  "CMakeFiles/cl_test.dir/util/TestPriorityQueue.o.d"
+  "CMakeFiles/cl_test.dir/util/TestStringBuffer.o"
+  "CMakeFiles/cl_test.dir/util/TestStringBuffer.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cl_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test-pedantic"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/test-pedantic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test-platform-charfuncs"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/test-platform-charfuncs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
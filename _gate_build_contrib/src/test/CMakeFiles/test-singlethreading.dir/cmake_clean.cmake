@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test-singlethreading"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/test-singlethreading.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,456 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+
+#include "CLucene/_ApiHeader.h"
+#include "FastVectorHighlighter.h"
+#include "Formatter.h"
+#include "Encoder.h"
+#include "SimpleHTMLFormatter.h"
+#include "TokenGroup.h"
+
+#include "CLucene/analysis/AnalysisHeader.h"
+#include "CLucene/search/Query.h"
+#include "CLucene/search/BooleanQuery.h"
+#include "CLucene/search/BooleanClause.h"
+#include "CLucene/search/PhraseQuery.h"
+#include "CLucene/index/IndexReader.h"
+#include "CLucene/index/Term.h"
+#include "CLucene/index/TermVector.h"
+#include "CLucene/document/Document.h"
+#include "CLucene/document/FieldSelector.h"
+#include "CLucene/util/StringBuffer.h"
+#include "CLucene/util/Array.h"
+
+#include <algorithm>
+
+CL_NS_DEF2(search,highlight)
+CL_NS_USE(analysis)
+CL_NS_USE(index)
+CL_NS_USE(util)
+
+/** A term of the query, with the weight it is highlighted with */
+struct FVHQueryTerm {
+	const TCHAR* text;
+	float_t weight;
+	bool standalone; ///< false if the term is only part of phrases
+};
+
+/** A phrase of the query */
+struct FVHPhrase {
+	std::vector<size_t> terms; ///< indexes into the query terms
+	std::vector<int32_t> positions;
+	int32_t slop;
+	float_t weight;
+};
+
+/** An occurrence of a query term in the text */
+struct FVHHit {
+	int32_t startOffset;
+	int32_t endOffset;
+	int32_t position;
+	size_t term;          ///< index into the query terms
+	float_t weight;       ///< 0 if the hit is not highlighted
+	int32_t groupEnd;     ///< end offset of the longest phrase match this hit is part of
+};
+
+static bool fvhHitOrder(const FVHHit& a, const FVHHit& b){
+	if ( a.startOffset != b.startOffset )
+		return a.startOffset < b.startOffset;
+	return a.endOffset < b.endOffset;
+}
+
+/** A candidate fragment: the range of hits it contains and its score */
+struct FVHFragment {
+	size_t firstHit;
+	size_t lastHit; ///< exclusive
+	int32_t startOffset;
+	int32_t endOffset;
+	float_t score;
+};
+
+static bool fvhFragmentOrder(const FVHFragment& a, const FVHFragment& b){
+	if ( a.score != b.score )
+		return a.score > b.score;
+	return a.startOffset < b.startOffset;
+}
+
+static size_t fvhAddTerm(std::vector<FVHQueryTerm>& terms, const TCHAR* text, float_t weight, bool standalone){
+	for ( size_t i=0;i<terms.size();i++ ){
+		if ( _tcscmp(terms[i].text, text) == 0 ){
+			if ( weight > terms[i].weight )
+				terms[i].weight = weight;
+			terms[i].standalone |= standalone;
+			return i;
+		}
+	}
+	FVHQueryTerm t = { text, weight, standalone };
+	terms.push_back(t);
+	return terms.size()-1;
+}
+
+/** Collects the terms and phrases of query that search field. The term texts
+* point into the query, which must outlive the collected values. */
+static void fvhCollect(const Query* query, const TCHAR* field,
+	std::vector<FVHQueryTerm>& terms, std::vector<FVHPhrase>& phrases)
+{
+	if ( query->instanceOf(BooleanQuery::getClassName()) ){
+		const BooleanQuery* bq = (const BooleanQuery*)query;
+		size_t numClauses = bq->getClauseCount();
+		BooleanClause** clauses = _CL_NEWARRAY(BooleanClause*, numClauses);
+		bq->getClauses(clauses);
+		for ( size_t i=0;i<numClauses;i++ ){
+			if ( !clauses[i]->prohibited )
+				fvhCollect(clauses[i]->getQuery(), field, terms, phrases);
+		}
+		_CLDELETE_ARRAY(clauses);
+
+	}else if ( query->instanceOf(PhraseQuery::getClassName()) ){
+		const PhraseQuery* pq = (const PhraseQuery*)query;
+		if ( _tcscmp(pq->getFieldName(), field) != 0 )
+			return;
+		Term** pqTerms = pq->getTerms();
+		ValueArray<int32_t> positions;
+		pq->getPositions(positions);
+
+		FVHPhrase phrase;
+		phrase.slop = pq->getSlop();
+		phrase.weight = pq->getBoost();
+		for ( size_t i=0;pqTerms[i]!=NULL;i++ ){
+			phrase.terms.push_back(fvhAddTerm(terms, pqTerms[i]->text(), 0, false));
+			phrase.positions.push_back(positions[i]);
+		}
+		if ( phrase.terms.size() == 1 ){
+			// a single term phrase is just a term
+			fvhAddTerm(terms, pqTerms[0]->text(), phrase.weight, true);
+		}else if ( phrase.terms.size() > 1 )
+			phrases.push_back(phrase);
+		_CLDELETE_ARRAY(pqTerms);
+
+	}else{
+		TermSet termSet;
+		query->extractTerms(&termSet);
+		for ( TermSet::iterator itr = termSet.begin(); itr != termSet.end(); itr++ ){
+			Term* term = *itr;
+			if ( _tcscmp(term->field(), field) == 0 )
+				fvhAddTerm(terms, term->text(), query->getBoost(), true);
+			_CLLDECDELETE(term);
+		}
+	}
+}
+
+/** Finds a hit of term at a position in [minPosition,maxPosition], using a
+* binary search on hits sorted by position */
+static FVHHit* fvhFindHit(std::vector<FVHHit>& hits, const std::vector<size_t>& byPosition,
+	size_t term, int32_t minPosition, int32_t maxPosition)
+{
+	size_t lo = 0, hi = byPosition.size();
+	while ( lo < hi ){
+		size_t mid = (lo + hi) / 2;
+		if ( hits[byPosition[mid]].position < minPosition )
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	for ( ; lo < byPosition.size() && hits[byPosition[lo]].position <= maxPosition; lo++ ){
+		if ( hits[byPosition[lo]].term == term )
+			return &hits[byPosition[lo]];
+	}
+	return NULL;
+}
+
+class FVHPositionOrder {
+	const std::vector<FVHHit>& hits;
+public:
+	FVHPositionOrder(const std::vector<FVHHit>& hits): hits(hits){}
+	bool operator()(size_t a, size_t b) const{
+		return hits[a].position < hits[b].position;
+	}
+};
+
+/** Weights the hits of complete phrase matches, and records the extent of
+* each match so that fragments do not split it */
+static void fvhMatchPhrases(std::vector<FVHHit>& hits, const std::vector<FVHPhrase>& phrases)
+{
+	std::vector<size_t> byPosition;
+	for ( size_t i=0;i<hits.size();i++ ){
+		if ( hits[i].position >= 0 )
+			byPosition.push_back(i);
+	}
+	if ( byPosition.empty() )
+		return;
+	std::sort(byPosition.begin(), byPosition.end(), FVHPositionOrder(hits));
+
+	std::vector<FVHHit*> match;
+	for ( size_t p=0;p<phrases.size();p++ ){
+		const FVHPhrase& phrase = phrases[p];
+		for ( size_t h=0;h<byPosition.size();h++ ){
+			FVHHit& first = hits[byPosition[h]];
+			if ( first.term != phrase.terms[0] )
+				continue;
+			const int32_t base = first.position - phrase.positions[0];
+
+			match.clear();
+			match.push_back(&first);
+			for ( size_t i=1;i<phrase.terms.size();i++ ){
+				const int32_t expected = base + phrase.positions[i];
+				FVHHit* hit = fvhFindHit(hits, byPosition, phrase.terms[i],
+					expected - phrase.slop, expected + phrase.slop);
+				if ( hit == NULL )
+					break;
+				match.push_back(hit);
+			}
+			if ( match.size() != phrase.terms.size() )
+				continue;
+
+			int32_t start = first.startOffset, end = first.endOffset;
+			for ( size_t i=1;i<match.size();i++ ){
+				start = cl_min(start, match[i]->startOffset);
+				end = cl_max(end, match[i]->endOffset);
+			}
+			for ( size_t i=0;i<match.size();i++ ){
+				FVHHit* hit = match[i];
+				// a phrase match counts for more than the same terms on their own
+				hit->weight = cl_max(hit->weight, phrase.weight * match.size());
+				if ( hit->startOffset == start )
+					hit->groupEnd = cl_max(hit->groupEnd, end);
+			}
+		}
+	}
+}
+
+/** Appends the encoded text between start and end */
+static void fvhAppendText(StringBuffer& sb, Encoder* encoder, const TCHAR* text, int32_t start, int32_t end){
+	if ( end <= start )
+		return;
+	TCHAR* buf = _CL_NEWARRAY(TCHAR, end - start + 1);
+	_tcsncpy(buf, text + start, end - start);
+	buf[end - start] = 0;
+	if ( encoder != NULL ){
+		TCHAR* encoded = encoder->encodeText(buf);
+		sb.append(encoded);
+		_CLDELETE_CARRAY(encoded);
+	}else
+		sb.append(buf);
+	_CLDELETE_CARRAY(buf);
+}
+
+
+FastVectorHighlighter::FastVectorHighlighter(int32_t fragmentSize):
+	fragmentSize(fragmentSize),
+	delete_formatter(true),
+	delete_encoder(false)
+{
+	_formatter = _CLNEW SimpleHTMLFormatter();
+	_encoder = NULL;
+}
+
+FastVectorHighlighter::FastVectorHighlighter(Formatter* formatter, Encoder* encoder, int32_t fragmentSize):
+	fragmentSize(fragmentSize),
+	delete_formatter(false),
+	delete_encoder(false)
+{
+	_formatter = formatter;
+	_encoder = encoder;
+}
+
+FastVectorHighlighter::~FastVectorHighlighter()
+{
+	if ( delete_formatter )
+		_CLDELETE(_formatter);
+	if ( delete_encoder )
+		_CLDELETE(_encoder);
+}
+
+int32_t FastVectorHighlighter::getFragmentSize() const
+{
+	return fragmentSize;
+}
+
+void FastVectorHighlighter::setFragmentSize(int32_t fragmentSize)
+{
+	this->fragmentSize = fragmentSize;
+}
+
+TCHAR* FastVectorHighlighter::getBestFragment(const Query* query, IndexReader* reader, int32_t docId, const TCHAR* field)
+{
+	TCHAR** results = getBestFragments(query, reader, docId, field, 1);
+	TCHAR* result = results[0];
+	results[0] = NULL;
+	_CLDELETE_CARRAY_ALL(results);
+	return result;
+}
+
+TCHAR** FastVectorHighlighter::getBestFragments(const Query* query, IndexReader* reader, int32_t docId,
+	const TCHAR* field, int32_t maxNumFragments)
+{
+	TermFreqVector* tfv = reader->getTermFreqVector(docId, field);
+	TermPositionVector* tpv = tfv == NULL ? NULL : tfv->__asTermPositionVector();
+	if ( tpv == NULL ){
+		_CLLDELETE(tfv);
+		TCHAR buf[250];
+		_sntprintf(buf,250,_T("%s in doc #%d does not have any term position data stored"),field,docId);
+		_CLTHROWT(CL_ERR_IllegalArgument,buf);
+	}
+
+	// only load the field being highlighted
+	CL_NS(document)::MapFieldSelector selector;
+	selector.add(field);
+	CL_NS(document)::Document doc;
+	reader->document(docId, doc, &selector);
+	const TCHAR* text = doc.get(field);
+	if ( text == NULL ){
+		_CLLDELETE(tfv);
+		TCHAR buf[250];
+		_sntprintf(buf,250,_T("Field %s in document #%d is not stored and cannot be highlighted"),field,docId);
+		_CLTHROWT(CL_ERR_IllegalArgument,buf);
+	}
+
+	TCHAR** ret = NULL;
+	try{
+		ret = getBestFragments(query, tpv, text, maxNumFragments);
+	}_CLFINALLY(
+		_CLLDELETE(tfv);
+	)
+	return ret;
+}
+
+TCHAR** FastVectorHighlighter::getBestFragments(const Query* query, TermPositionVector* tpv,
+	const TCHAR* text, int32_t maxNumFragments)
+{
+	std::vector<FVHQueryTerm> terms;
+	std::vector<FVHPhrase> phrases;
+	fvhCollect(query, tpv->getField(), terms, phrases);
+
+	// read the positions and offsets of the query terms only
+	const int32_t textLength = _tcslen(text);
+	std::vector<FVHHit> hits;
+	for ( size_t t=0;t<terms.size();t++ ){
+		const int32_t index = tpv->indexOf(terms[t].text);
+		if ( index < 0 )
+			continue;
+		const ArrayBase<TermVectorOffsetInfo*>* offsets = tpv->getOffsets(index);
+		if ( offsets == NULL ){
+			TCHAR buf[250];
+			_sntprintf(buf,250,_T("the term vector of %s does not have any offsets stored"),tpv->getField());
+			_CLTHROWT(CL_ERR_IllegalArgument,buf);
+		}
+		const ArrayBase<int32_t>* positions = tpv->getTermPositions(index);
+		if ( positions != NULL && positions->length != offsets->length )
+			positions = NULL;
+
+		for ( size_t i=0;i<offsets->length;i++ ){
+			FVHHit hit;
+			hit.startOffset = (*offsets)[i]->getStartOffset();
+			hit.endOffset = cl_min((*offsets)[i]->getEndOffset(), textLength);
+			if ( hit.startOffset >= hit.endOffset )
+				continue; // offsets don't fit the text
+			hit.position = positions == NULL ? -1 : (*positions)[i];
+			hit.term = t;
+			hit.weight = terms[t].standalone ? terms[t].weight : 0;
+			hit.groupEnd = hit.endOffset;
+			hits.push_back(hit);
+		}
+	}
+	if ( !phrases.empty() )
+		fvhMatchPhrases(hits, phrases);
+
+	// drop the phrase terms that are not part of a phrase match
+	size_t numHits = 0;
+	for ( size_t i=0;i<hits.size();i++ ){
+		if ( hits[i].weight > 0 )
+			hits[numHits++] = hits[i];
+	}
+	hits.resize(numHits);
+	std::sort(hits.begin(), hits.end(), fvhHitOrder);
+
+	// build the candidate fragments: each one starts at the first hit that is
+	// not covered yet and takes all following hits (and phrase matches) that
+	// fit into fragmentSize characters
+	std::vector<FVHFragment> fragments;
+	for ( size_t i=0;i<hits.size(); ){
+		FVHFragment frag;
+		frag.firstHit = i;
+		frag.startOffset = hits[i].startOffset;
+		frag.endOffset = hits[i].groupEnd;
+		frag.score = hits[i].weight;
+		const int32_t limit = cl_max(frag.startOffset + fragmentSize, frag.endOffset);
+		for ( i++; i<hits.size(); i++ ){
+			if ( hits[i].groupEnd > limit )
+				break;
+			frag.endOffset = cl_max(frag.endOffset, hits[i].groupEnd);
+			frag.score += hits[i].weight;
+		}
+		frag.lastHit = i;
+		fragments.push_back(frag);
+	}
+	std::stable_sort(fragments.begin(), fragments.end(), fvhFragmentOrder);
+
+	const size_t numFragments = cl_min((size_t)cl_max(maxNumFragments,0), fragments.size());
+	TCHAR** ret = _CL_NEWARRAY(TCHAR*, numFragments+1);
+	ret[numFragments] = NULL;
+
+	StringBuffer sb;
+	TokenGroup group;
+	Token token;
+	for ( size_t f=0;f<numFragments;f++ ){
+		const FVHFragment& frag = fragments[f];
+
+		// spread the free space around the hits, then move the borders to
+		// whitespace so that no word is cut
+		int32_t start = frag.startOffset;
+		int32_t end = frag.endOffset;
+		const int32_t slack = fragmentSize - (end - start);
+		if ( slack > 0 ){
+			start = cl_max(0, start - slack / 2);
+			end = cl_min(textLength, start + fragmentSize);
+			start = cl_max(0, cl_min(start, end - fragmentSize));
+		}
+		while ( start > 0 && start < frag.startOffset && !_istspace(text[start-1]) )
+			start++;
+		while ( start < frag.startOffset && _istspace(text[start]) )
+			start++;
+		while ( end < textLength && end > frag.endOffset && !_istspace(text[end]) )
+			end--;
+		while ( end > frag.endOffset && _istspace(text[end-1]) )
+			end--;
+
+		// mark up the hits, overlapping hits are formatted as one group
+		sb.clear();
+		int32_t lastEnd = start;
+		for ( size_t h=frag.firstHit;h<frag.lastHit; ){
+			group.clear();
+			int32_t groupStart = hits[h].startOffset;
+			int32_t groupEnd = hits[h].endOffset;
+			for ( ; h<frag.lastHit && hits[h].startOffset < groupEnd; h++ ){
+				token.set(terms[hits[h].term].text, hits[h].startOffset, hits[h].endOffset);
+				group.addToken(&token, hits[h].weight);
+				groupEnd = cl_max(groupEnd, hits[h].endOffset);
+			}
+			if ( groupStart < lastEnd )
+				groupStart = lastEnd; // overlaps the previous group
+
+			fvhAppendText(sb, _encoder, text, lastEnd, groupStart);
+
+			TCHAR* original = _CL_NEWARRAY(TCHAR, groupEnd - groupStart + 1);
+			_tcsncpy(original, text + groupStart, groupEnd - groupStart);
+			original[groupEnd - groupStart] = 0;
+			TCHAR* encoded = _encoder != NULL ? _encoder->encodeText(original) : STRDUP_TtoT(original);
+			TCHAR* markedUp = _formatter->highlightTerm(encoded, &group);
+			sb.append(markedUp);
+			_CLDELETE_CARRAY(markedUp);
+			_CLDELETE_CARRAY(encoded);
+			_CLDELETE_CARRAY(original);
+
+			lastEnd = groupEnd;
+		}
+		fvhAppendText(sb, _encoder, text, lastEnd, end);
+		ret[f] = sb.toString();
+	}
+	return ret;
+}
+
+CL_NS_END2
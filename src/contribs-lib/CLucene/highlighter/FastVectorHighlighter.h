@@ -0,0 +1,120 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+
+#ifndef _lucene_search_highlight_fastvectorhighlighter_
+#define _lucene_search_highlight_fastvectorhighlighter_
+
+CL_CLASS_DEF(search, Query)
+CL_CLASS_DEF(index, IndexReader)
+CL_CLASS_DEF(index, TermPositionVector)
+CL_CLASS_DEF2(search,highlight,Formatter)
+CL_CLASS_DEF2(search,highlight,Encoder)
+
+CL_NS_DEF2(search,highlight)
+
+/**
+* A highlighter that works from the term vector of a field instead of
+* re-analyzing its stored text.
+*
+* <p>Only the term vector entries of the query terms are read. Their
+* offsets are used to build candidate fragments directly, which are then
+* sliced out of the stored text and marked up with the {@link Formatter}
+* and {@link Encoder}. This makes the cost of highlighting depend on the
+* number of query term occurrences instead of the size of the document.</p>
+*
+* <p>The field must have been indexed with Field::TERMVECTOR_WITH_POSITIONS_OFFSETS
+* (offsets alone are enough if the query contains no phrases). Terms of a
+* {@link PhraseQuery} are only highlighted where the whole phrase matches,
+* within the slop of the query, and a phrase is never split across two
+* fragments. Multi-term queries (prefix, wildcard, range, fuzzy) must be
+* rewritten before they are passed in.</p>
+*/
+class CLUCENE_CONTRIBS_EXPORT FastVectorHighlighter :LUCENE_BASE
+{
+private:
+	int32_t fragmentSize;
+
+	Formatter* _formatter;
+	bool delete_formatter;
+
+	Encoder* _encoder;
+	bool delete_encoder;
+
+public:
+	LUCENE_STATIC_CONSTANT(int32_t, DEFAULT_FRAGMENT_SIZE=100);
+
+	/**
+	 * Constructs a highlighter which marks up terms with a SimpleHTMLFormatter
+	 * and does not encode the text.
+	 */
+	FastVectorHighlighter(int32_t fragmentSize=DEFAULT_FRAGMENT_SIZE);
+
+	/**
+	 * @param formatter used to mark up the terms. Memory is owned by the caller.
+	 * @param encoder used to encode the text, or NULL to leave it unchanged.
+	 * Memory is owned by the caller.
+	 * @param fragmentSize the number of characters per fragment
+	 */
+	FastVectorHighlighter(Formatter* formatter, Encoder* encoder=NULL, int32_t fragmentSize=DEFAULT_FRAGMENT_SIZE);
+
+	~FastVectorHighlighter();
+
+	/**
+	 * Returns the highest scoring fragment of a stored field of a document,
+	 * or NULL if no query term was found in it.
+	 *
+	 * @param query the (rewritten) query whose terms are highlighted
+	 * @param reader the reader the document is read from
+	 * @param docId the document to highlight
+	 * @param field the field to highlight, it must be stored and have a term vector
+	 *        with offsets
+	 * @memory the returned string is owned by the caller
+	 */
+	TCHAR* getBestFragment(const Query* query, CL_NS(index)::IndexReader* reader,
+		int32_t docId, const TCHAR* field);
+
+	/**
+	 * Returns the highest scoring fragments of a stored field of a document in
+	 * order of score.
+	 *
+	 * @see #getBestFragment
+	 * @return a NULL terminated array of between 0 and maxNumFragments fragments.
+	 * Free it with _CLDELETE_CARRAY_ALL
+	 */
+	TCHAR** getBestFragments(const Query* query, CL_NS(index)::IndexReader* reader,
+		int32_t docId, const TCHAR* field, int32_t maxNumFragments);
+
+	/**
+	 * Low level api to get the highest scoring fragments of a text from an
+	 * already loaded term vector.
+	 *
+	 * @param query the (rewritten) query whose terms are highlighted
+	 * @param tpv the term vector of text. Only the entries of the query terms
+	 *        are read.
+	 * @param text the text the term vector was created from
+	 * @param maxNumFragments the maximum number of fragments
+	 * @return a NULL terminated array of between 0 and maxNumFragments fragments,
+	 * in order of score. Free it with _CLDELETE_CARRAY_ALL
+	 */
+	TCHAR** getBestFragments(const Query* query, CL_NS(index)::TermPositionVector* tpv,
+		const TCHAR* text, int32_t maxNumFragments);
+
+	/**
+	 * @return the number of characters per fragment
+	 */
+	int32_t getFragmentSize() const;
+
+	/**
+	 * @param fragmentSize the number of characters per fragment. A fragment is
+	 * made larger than this if a phrase would not fit otherwise.
+	 */
+	void setFragmentSize(int32_t fragmentSize);
+};
+
+CL_NS_END2
+
+#endif
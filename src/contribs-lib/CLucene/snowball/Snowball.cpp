@@ -20,7 +20,9 @@ CL_NS_USE2(analysis,standard)
 CL_NS_DEF2(analysis,snowball)
 
   /** Builds the named analyzer with no stop words. */
-  SnowballAnalyzer::SnowballAnalyzer(const TCHAR* language) {
+  SnowballAnalyzer::SnowballAnalyzer(const TCHAR* language):
+	stemCacheSize(SnowballStemCache::DEFAULT_SIZE)
+  {
     this->language = STRDUP_TtoT(language);
 	stopSet = NULL;
   }
@@ -33,20 +35,46 @@ CL_NS_DEF2(analysis,snowball)
 
   /** Builds the named analyzer with the given stop words.
   */
-  SnowballAnalyzer::SnowballAnalyzer(const TCHAR* language, const TCHAR** stopWords) {
+  SnowballAnalyzer::SnowballAnalyzer(const TCHAR* language, const TCHAR** stopWords):
+	stemCacheSize(SnowballStemCache::DEFAULT_SIZE)
+  {
     this->language = STRDUP_TtoT(language);
 
     stopSet = _CLNEW CLTCSetList(true);
 	StopFilter::fillStopTable(stopSet,stopWords);
   }
 
+  /** The stream last returned by reusableTokenStream, and the stem cache of a thread */
+  class SnowballAnalyzer::SavedStreams : public TokenStream {
+  public:
+	  StandardTokenizer* tokenStream;
+	  TokenStream* filteredTokenStream;
+	  FilteredBufferedReader* bufferedReader; // wraps the current reader if it is not buffered
+	  SnowballStemCache* cache;
+
+	  SavedStreams():tokenStream(NULL), filteredTokenStream(NULL), bufferedReader(NULL), cache(NULL)
+	  {
+	  }
+
+	  virtual ~SavedStreams()
+	  {
+		  //the tokenStream is deleted with the filteredTokenStream
+		  _CLDELETE(filteredTokenStream);
+		  _CLDELETE(bufferedReader);
+		  _CLDELETE(cache);
+	  }
+
+	  void close(){}
+	  Token* next(Token* /*token*/) {return NULL;}
+  };
+
   TokenStream* SnowballAnalyzer::tokenStream(const TCHAR* fieldName, CL_NS(util)::Reader* reader) {
 	 return this->tokenStream(fieldName,reader,false);
   }
 
   /** Constructs a {@link StandardTokenizer} filtered by a {@link
       StandardFilter}, a {@link LowerCaseFilter} and a {@link StopFilter}. */
-  TokenStream* SnowballAnalyzer::tokenStream(const TCHAR* fieldName, CL_NS(util)::Reader* reader, bool deleteReader) {
+  TokenStream* SnowballAnalyzer::tokenStream(const TCHAR* /*fieldName*/, CL_NS(util)::Reader* reader, bool deleteReader) {
 		BufferedReader* bufferedReader = reader->__asBufferedReader();
 		TokenStream* result;
 
@@ -54,28 +82,158 @@ CL_NS_DEF2(analysis,snowball)
 			result =  _CLNEW StandardTokenizer( _CLNEW FilteredBufferedReader(reader, deleteReader), true );
 		else
 			result = _CLNEW StandardTokenizer(bufferedReader, deleteReader);
+		return addFilters(result, NULL);
+  }
+
+  TokenStream* SnowballAnalyzer::reusableTokenStream(const TCHAR* /*fieldName*/, CL_NS(util)::Reader* reader) {
+	  BufferedReader* bufferedReader = reader->__asBufferedReader();
+	  FilteredBufferedReader* wrapper = NULL;
+	  if ( bufferedReader == NULL )
+		  bufferedReader = wrapper = _CLNEW FilteredBufferedReader(reader, false);
 
-	 result = _CLNEW StandardFilter(result, true);
+	  SavedStreams* streams = reinterpret_cast<SavedStreams*>(getPreviousTokenStream());
+	  if (streams == NULL) {
+		  streams = _CLNEW SavedStreams();
+		  if ( stemCacheSize > 0 )
+			  streams->cache = _CLNEW SnowballStemCache(stemCacheSize);
+		  setPreviousTokenStream(streams);
+
+		  streams->tokenStream = _CLNEW StandardTokenizer(bufferedReader, false);
+		  streams->filteredTokenStream = addFilters(streams->tokenStream, streams->cache);
+	  } else {
+		  streams->tokenStream->reset(bufferedReader);
+	  }
+	  //the tokenizer no longer reads the previous wrapper
+	  _CLDELETE(streams->bufferedReader);
+	  streams->bufferedReader = wrapper;
+	  return streams->filteredTokenStream;
+  }
+
+  const SnowballStemCache* SnowballAnalyzer::getStemCache() {
+	  SavedStreams* streams = reinterpret_cast<SavedStreams*>(getPreviousTokenStream());
+	  return streams == NULL ? NULL : streams->cache;
+  }
+
+  TokenStream* SnowballAnalyzer::addFilters(TokenStream* tokenizer, SnowballStemCache* cache) {
+	 TokenStream* result = _CLNEW StandardFilter(tokenizer, true);
     result = _CLNEW CL_NS(analysis)::LowerCaseFilter(result, true);
     if (stopSet != NULL)
       result = _CLNEW CL_NS(analysis)::StopFilter(result, true, stopSet);
-    result = _CLNEW SnowballFilter(result, language, true);
+    result = _CLNEW SnowballFilter(result, language, true, cache);
     return result;
   }
-  
-  
-  
-  
-  
-  
-  
+
+  void SnowballAnalyzer::setStemCacheSize(int32_t stemCacheSize){
+	  this->stemCacheSize = stemCacheSize;
+  }
+  int32_t SnowballAnalyzer::getStemCacheSize() const{
+	  return stemCacheSize;
+  }
+
+
+
+  struct SnowballStemCacheSlot {
+	  int32_t termLength; ///< -1 if the slot is empty
+	  int32_t stemLength;
+	  TCHAR term[SnowballStemCache::MAX_TERM_LENGTH];
+	  TCHAR stem[SnowballStemCache::MAX_TERM_LENGTH];
+  };
+
+  class SnowballStemCache::Internal{
+  public:
+	  SnowballStemCacheSlot* slots;
+	  int32_t size;
+	  int32_t mask;
+	  int64_t hitCount;
+	  int64_t missCount;
+
+	  Internal(int32_t requestedSize):
+		  hitCount(0),
+		  missCount(0)
+	  {
+		  size = 1;
+		  while ( size < requestedSize )
+			  size <<= 1;
+		  mask = size - 1;
+		  slots = _CL_NEWARRAY(SnowballStemCacheSlot, size);
+		  clear();
+	  }
+	  ~Internal(){
+		  _CLDELETE_ARRAY(slots);
+	  }
+
+	  void clear(){
+		  for ( int32_t i=0;i<size;i++ )
+			  slots[i].termLength = -1;
+	  }
+
+	  SnowballStemCacheSlot& slot(const TCHAR* term, int32_t termLength){
+		  uint32_t hash = 0;
+		  for ( int32_t i=0;i<termLength;i++ )
+			  hash = 31 * hash + (uint32_t)term[i];
+		  hash ^= hash >> 16;
+		  return slots[hash & mask];
+	  }
+  };
+
+  SnowballStemCache::SnowballStemCache(int32_t size):
+	  _internal(_CLNEW Internal(size))
+  {
+  }
+  SnowballStemCache::~SnowballStemCache(){
+	  _CLDELETE(_internal);
+  }
+
+  const TCHAR* SnowballStemCache::get(const TCHAR* term, int32_t termLength, int32_t& stemLength){
+	  if ( termLength <= MAX_TERM_LENGTH ){
+		  SnowballStemCacheSlot& s = _internal->slot(term, termLength);
+		  if ( s.termLength == termLength && memcmp(s.term, term, termLength * sizeof(TCHAR)) == 0 ){
+			  _internal->hitCount++;
+			  stemLength = s.stemLength;
+			  return s.stem;
+		  }
+	  }
+	  _internal->missCount++;
+	  return NULL;
+  }
+
+  void SnowballStemCache::put(const TCHAR* term, int32_t termLength, const TCHAR* stem, int32_t stemLength){
+	  if ( termLength > MAX_TERM_LENGTH || stemLength > MAX_TERM_LENGTH )
+		  return;
+	  SnowballStemCacheSlot& s = _internal->slot(term, termLength);
+	  memcpy(s.term, term, termLength * sizeof(TCHAR));
+	  memcpy(s.stem, stem, stemLength * sizeof(TCHAR));
+	  s.termLength = termLength;
+	  s.stemLength = stemLength;
+  }
+
+  void SnowballStemCache::clear(){
+	  _internal->clear();
+  }
+  int64_t SnowballStemCache::getHitCount() const{
+	  return _internal->hitCount;
+  }
+  int64_t SnowballStemCache::getMissCount() const{
+	  return _internal->missCount;
+  }
+  int32_t SnowballStemCache::size() const{
+	  return _internal->size;
+  }
+
+
+
     /** Construct the named stemming filter.
    *
    * @param in the input tokens to stem
    * @param name the name of a stemmer
    */
-	SnowballFilter::SnowballFilter(TokenStream* in, const TCHAR* language, bool deleteTS):
-		TokenFilter(in,deleteTS)
+	SnowballFilter::SnowballFilter(TokenStream* in, const TCHAR* language, bool deleteTS, SnowballStemCache* cache):
+		TokenFilter(in,deleteTS),
+		cache(cache)
+#ifdef _UCS2
+		,utf8Buffer(NULL),
+		utf8BufferLength(0)
+#endif
 	{
 		TCHAR tlang[50];
 		char lang[50];
@@ -92,6 +250,9 @@ CL_NS_DEF2(analysis,snowball)
 
 	SnowballFilter::~SnowballFilter(){
 		sb_stemmer_delete(stemmer);
+#ifdef _UCS2
+		free(utf8Buffer);
+#endif
 	}
 
   /** Returns the next input Token, after being stemmed */
@@ -99,37 +260,67 @@ CL_NS_DEF2(analysis,snowball)
     if (input->next(token) == NULL)
       return NULL;
 
-	unsigned char uctext[LUCENE_MAX_WORD_LEN];
-	TCHAR tchartext[LUCENE_MAX_WORD_LEN];
+	const int32_t len = (int32_t)token->termLength();
+	TCHAR* buffer = token->termBuffer();
 
-#ifdef _UCS2
-	char utf8text[LUCENE_MAX_WORD_LEN];
+	if ( cache != NULL ){
+		int32_t cachedLen;
+		const TCHAR* cached = cache->get(buffer, len, cachedLen);
+		if ( cached != NULL ){
+			buffer = token->resizeTermBuffer(cachedLen + 1);
+			memcpy(buffer, cached, cachedLen * sizeof(TCHAR));
+			buffer[cachedLen] = 0;
+			token->setTermLength(cachedLen);
+			return token;
+		}
+	}
 
-	size_t len = lucene_wcstoutf8(utf8text,token->termBuffer(),LUCENE_MAX_WORD_LEN);
-	memcpy(uctext,utf8text,len);
-	uctext[len]='\0';
+#ifdef _UCS2
+	//a character takes at most 6 bytes in utf8
+	const size_t required = len * 6 + 1;
+	if ( utf8BufferLength < required ){
+		utf8Buffer = (char*)realloc(utf8Buffer, required);
+		utf8BufferLength = required;
+	}
+	char* p = utf8Buffer;
+	for ( int32_t i=0;i<len;i++ )
+		p += lucene_wctoutf8(p, buffer[i]);
+	const sb_symbol* stemmed = sb_stemmer_stem(stemmer, (const sb_symbol*)utf8Buffer, (int)(p - utf8Buffer));
 #else
-	const char* tmp = token->termText();
-	int len = token->termTextLength();
-	for (int i=0;i<len+1;i++)
-		uctext[i]=tmp[i];
+	const sb_symbol* stemmed = sb_stemmer_stem(stemmer, (const sb_symbol*)buffer, len);
 #endif
-
-    const sb_symbol* stemmed = sb_stemmer_stem(stemmer, uctext, len);
 	if ( stemmed == NULL )
 		_CLTHROWA(CL_ERR_Runtime,"Out of memory");
 
-	int stemmedLen=sb_stemmer_length(stemmer);
+	const int32_t stemmedLen=sb_stemmer_length(stemmer);
 
+	//the stem has no more characters than bytes, decode it into the token
+	//buffer. The term was already converted, so it may be overwritten
+	TCHAR original[SnowballStemCache::MAX_TERM_LENGTH];
+	const bool cacheable = cache != NULL && len <= SnowballStemCache::MAX_TERM_LENGTH;
+	if ( cacheable )
+		memcpy(original, buffer, len * sizeof(TCHAR));
+	buffer = token->resizeTermBuffer(stemmedLen + 1);
 #ifdef _UCS2
-	memcpy(utf8text,stemmed,stemmedLen);
-	utf8text[stemmedLen]=0;
-	lucene_utf8towcs(tchartext,utf8text,LUCENE_MAX_WORD_LEN);
+	const char* sp = (const char*)stemmed;
+	const char* se = sp + stemmedLen;
+	int32_t resultLen = 0;
+	while ( sp < se ){
+		size_t r = lucene_utf8towc(buffer[resultLen], sp);
+		if ( r == 0 )
+			break;
+		sp += r;
+		resultLen++;
+	}
 #else
-	for (int i=0;i<stemmedLen+1;i++)
-		tchartext[i]=stemmed[i];
+	const int32_t resultLen = stemmedLen;
+	memcpy(buffer, stemmed, stemmedLen);
 #endif
-	token->set(tchartext,token->startOffset(), token->endOffset(), token->type());
+	buffer[resultLen] = 0;
+	token->setTermLength(resultLen);
+
+	if ( cacheable )
+		cache->put(original, len, buffer, resultLen);
 	return token;
   }
 
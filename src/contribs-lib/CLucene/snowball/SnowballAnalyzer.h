@@ -10,6 +10,7 @@
 #include "CLucene/analysis/AnalysisHeader.h"
 
 CL_CLASS_DEF(util,BufferedReader)
+CL_CLASS_DEF2(analysis,snowball,SnowballStemCache)
 CL_NS_DEF2(analysis,snowball)
 
 /** Filters {@link StandardTokenizer} with {@link StandardFilter}, {@link
@@ -22,6 +23,10 @@ CL_NS_DEF2(analysis,snowball)
 class CLUCENE_CONTRIBS_EXPORT SnowballAnalyzer: public Analyzer {
   TCHAR* language;
   CLTCSetList* stopSet;
+  int32_t stemCacheSize;
+
+  class SavedStreams;
+  TokenStream* addFilters(TokenStream* tokenizer, SnowballStemCache* cache);
 
 public:
   /** Builds the named analyzer with no stop words. */
@@ -37,6 +42,21 @@ public:
       StandardFilter}, a {@link LowerCaseFilter} and a {@link StopFilter}. */
   TokenStream* tokenStream(const TCHAR* fieldName, CL_NS(util)::Reader* reader);
   TokenStream* tokenStream(const TCHAR* fieldName, CL_NS(util)::Reader* reader, bool deleteReader);
+
+  /** Same as tokenStream, but the stream is owned by the analyzer. Each
+      thread keeps its stream, which is reset to read the next reader, and a
+      cache of stems across calls. See #setStemCacheSize */
+  TokenStream* reusableTokenStream(const TCHAR* fieldName, CL_NS(util)::Reader* reader);
+
+  /** Returns the stem cache of the calling thread, or NULL if the thread has
+      not called reusableTokenStream yet or the cache is disabled */
+  const SnowballStemCache* getStemCache();
+
+  /** Sets the number of stems that are cached per thread by reusableTokenStream.
+      0 disables the cache. Only affects threads that have not used the analyzer
+      yet. Defaults to SnowballStemCache::DEFAULT_SIZE */
+  void setStemCacheSize(int32_t stemCacheSize);
+  int32_t getStemCacheSize() const;
 };
 
 CL_NS_END2
@@ -12,24 +12,85 @@
 
 CL_NS_DEF2(analysis,snowball)
 
+/**
+ * A bounded cache of the stems produced by a {@link SnowballFilter}.
+ *
+ * <p>Natural language text repeats a small set of words over and over, so
+ * remembering their stems avoids most of the conversions and stemmer runs.
+ * The cache is a fixed size, direct mapped table: a term that hashes to an
+ * occupied slot replaces the term that was cached there, so memory use never
+ * grows. Terms longer than MAX_TERM_LENGTH are not cached.</p>
+ *
+ * <p>The cache is not thread safe, and holds the stems of one language only.
+ * Share it only between filters of the same language that are used by the
+ * same thread. {@link SnowballAnalyzer#reusableTokenStream} keeps one cache
+ * per thread.</p>
+ */
+class CLUCENE_CONTRIBS_EXPORT SnowballStemCache: LUCENE_BASE {
+	class Internal;
+	Internal* _internal;
+public:
+	/** Default number of cached stems */
+	LUCENE_STATIC_CONSTANT(int32_t, DEFAULT_SIZE=2048);
+
+	/** Terms longer than this are not cached */
+	LUCENE_STATIC_CONSTANT(int32_t, MAX_TERM_LENGTH=24);
+
+	/** @param size the number of stems to cache, rounded up to a power of two */
+	SnowballStemCache(int32_t size=DEFAULT_SIZE);
+	~SnowballStemCache();
+
+	/**
+	 * Looks up the stem of a term.
+	 * @param stemLength set to the length of the stem if it is found
+	 * @return the stem, valid until the next call to put, or NULL if it is not cached
+	 */
+	const TCHAR* get(const TCHAR* term, int32_t termLength, int32_t& stemLength);
+
+	/** Remembers the stem of a term, replacing a term in the same slot */
+	void put(const TCHAR* term, int32_t termLength, const TCHAR* stem, int32_t stemLength);
+
+	/** Removes all stems */
+	void clear();
+
+	/** Number of stems that were found by get */
+	int64_t getHitCount() const;
+
+	/** Number of stems that were not found by get */
+	int64_t getMissCount() const;
+
+	/** Number of slots of the cache */
+	int32_t size() const;
+};
+
 /** A filter that stems words using a Snowball-generated stemmer.
  *
  * Available stemmers are listed in {@link net.sf.snowball.ext}.  The name of a
  * stemmer is the part of the class name before "Stemmer", e.g., the stemmer in
  * {@link EnglishStemmer} is named "English".
  *
+ * The terms are stemmed in place in the token buffer, the only other buffer
+ * used is the encoding buffer of the filter, which is reused for all tokens.
+ *
  * Note: todo: This is not thread safe...
  */
 class CLUCENE_CONTRIBS_EXPORT SnowballFilter: public TokenFilter {
 	struct sb_stemmer * stemmer;
+	SnowballStemCache* cache;
+#ifdef _UCS2
+	char* utf8Buffer;
+	size_t utf8BufferLength;
+#endif
 public:
 
   /** Construct the named stemming filter.
    *
    * @param in the input tokens to stem
    * @param name the name of a stemmer
+   * @param cache an optional cache of stems for this language. Memory is owned
+   *        by the caller. See SnowballStemCache
    */
-	SnowballFilter(TokenStream* in, const TCHAR* language, bool deleteTS);
+	SnowballFilter(TokenStream* in, const TCHAR* language, bool deleteTS, SnowballStemCache* cache=NULL);
 
 	~SnowballFilter();
 
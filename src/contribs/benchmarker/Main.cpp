@@ -6,6 +6,9 @@
 ------------------------------------------------------------------------------*/
 #include "stdafx.h"
 #include "TestCLString.h"
+#include "TestAnalysis.h"
+#include "TestStringIntern.h"
+#include "TestMergePolicy.h"
 
 #ifdef COMPILER_MSVC
 #ifdef _DEBUG
@@ -44,6 +47,9 @@ int main( int argc, char** argv ){
 
 	Benchmarker bench;
 	TestCLString clstring;
+	TestAnalysis analysis;
+	TestStringIntern stringIntern;
+	TestMergePolicy mergePolicy;
 	bool ret_result = false;
 
 	cl_tempDir = NULL;
@@ -92,6 +98,9 @@ int main( int argc, char** argv ){
 
 
 	bench.Add(&clstring);
+	bench.Add(&analysis);
+	bench.Add(&stringIntern);
+	bench.Add(&mergePolicy);
 	ret_result = bench.run();
 
 
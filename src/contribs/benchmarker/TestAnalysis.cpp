@@ -0,0 +1,46 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "stdafx.h"
+#include "CLucene/snowball/SnowballAnalyzer.h"
+
+using namespace lucene::util;
+using namespace lucene::analysis;
+using namespace lucene::analysis::snowball;
+
+/** Tokenizes and stems the Reuters articles. With reusable set, the
+* analyzer keeps its stream and stem cache between the files */
+static int BenchmarkSnowball(Timer* timerCase, bool reusable){
+	SnowballAnalyzer an(_T("english"));
+	char fname[1024];
+	int64_t count = 0;
+	Token t;
+
+	timerCase->start();
+	for ( int i=0;i<22;i++ ){
+		sprintf(fname, "%sreuters-21578/reut2-%03d.sgm", clucene_data_location, i);
+		FileReader reader(fname, "ASCII");
+
+		TokenStream* ts = reusable ? an.reusableTokenStream(_T("contents"), &reader) :
+			an.tokenStream(_T("contents"), &reader);
+		while ( ts->next(&t) != NULL )
+			count++;
+		ts->close();
+		if ( !reusable )
+			_CLDELETE(ts);
+	}
+	timerCase->stop();
+
+	return count > 0 ? 0 : 1;
+}
+
+int BenchmarkSnowballAnalyzer(Timer* timerCase){
+	return BenchmarkSnowball(timerCase, false);
+}
+
+int BenchmarkSnowballAnalyzerStemCache(Timer* timerCase){
+	return BenchmarkSnowball(timerCase, true);
+}
@@ -0,0 +1,146 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "stdafx.h"
+#include "CLucene/config/repl_tchar.h"
+#include "CLucene/config/repl_wchar.h"
+
+using namespace lucene::analysis;
+using namespace lucene::document;
+using namespace lucene::index;
+using namespace lucene::store;
+using namespace lucene::util;
+
+#define INGEST_DOCS 20000
+#define INGEST_BATCH 200
+#define INGEST_UPDATES 40  //documents of every batch that replace older ones
+
+/** Counts the bytes of every file that was written to the directory: the
+* files that were deleted, and the files that are left at the end */
+class CountingRAMDirectory: public RAMDirectory{
+	int64_t deletedBytes;
+protected:
+	bool doDeleteFile(const char* name){
+		if ( RAMDirectory::fileExists(name) )
+			deletedBytes += RAMDirectory::fileLength(name);
+		return RAMDirectory::doDeleteFile(name);
+	}
+public:
+	CountingRAMDirectory(): deletedBytes(0){
+	}
+	int64_t bytesWritten(){
+		int64_t ret = deletedBytes;
+		std::vector<std::string> names;
+		RAMDirectory::list(&names);
+		for ( size_t i=0;i<names.size();i++ )
+			ret += RAMDirectory::fileLength(names[i].c_str());
+		return ret;
+	}
+};
+
+static void addIngestDoc(IndexWriter* writer, int32_t id, uint32_t& seed, Term* replaced = NULL){
+	static const TCHAR* words[] = {_T("alpha"), _T("bravo"), _T("charlie"), _T("delta"),
+		_T("echo"), _T("foxtrot"), _T("golf"), _T("hotel"), _T("india"), _T("juliet"),
+		_T("kilo"), _T("lima"), _T("mike"), _T("november"), _T("oscar"), _T("papa")};
+	TCHAR idText[20];
+	TCHAR body[1024];
+	_i64tot(id, idText, 10);
+	body[0] = 0;
+	for ( int32_t i=0;i<40;i++ ){
+		seed = seed * 1103515245 + 12345;
+		_tcscat(body, words[(seed >> 16) % 16]);
+		_tcscat(body, _T(" "));
+	}
+	Document doc;
+	doc.add(*_CLNEW Field(_T("id"), idText, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+	doc.add(*_CLNEW Field(_T("body"), body, Field::STORE_YES | Field::INDEX_TOKENIZED));
+	if ( replaced != NULL )
+		writer->updateDocument(replaced, &doc);
+	else
+		writer->addDocument(&doc);
+}
+
+/** Adds documents in batches, and replaces some older documents in every
+* batch, so that the older segments collect deletes. Returns the bytes that
+* were written to the directory. */
+static int64_t ingest(Timer* timerCase, MergePolicy* policy, int32_t& segmentCount){
+	CountingRAMDirectory dir;
+	WhitespaceAnalyzer analyzer;
+	uint32_t seed = 42;
+	int32_t nextId = 0;
+
+	timerCase->start();
+	IndexWriter* writer = _CLNEW IndexWriter(&dir, &analyzer, true);
+	writer->setMergePolicy(policy);
+	writer->setMaxBufferedDocs(INGEST_BATCH);
+	TCHAR idText[20];
+	while ( nextId < INGEST_DOCS ){
+		for ( int32_t i=0;i<INGEST_BATCH-INGEST_UPDATES;i++ )
+			addIngestDoc(writer, nextId++, seed);
+		for ( int32_t i=0;i<INGEST_UPDATES && nextId > 0;i++ ){
+			seed = seed * 1103515245 + 12345;
+			const int32_t id = (seed >> 8) % nextId;
+			_i64tot(id, idText, 10);
+			Term* t = _CLNEW Term(_T("id"), idText);
+			addIngestDoc(writer, id, seed, t);
+			_CLDECDELETE(t);
+		}
+		writer->flush();
+	}
+	writer->close();
+	_CLDELETE(writer);
+	timerCase->stop();
+
+	// every segment has its own field infos
+	segmentCount = 0;
+	std::vector<std::string> names;
+	dir.list(&names);
+	for ( size_t i=0;i<names.size();i++ )
+		if ( names[i].length() > 4 && names[i].compare(names[i].length()-4, 4, ".fnm") == 0 )
+			segmentCount++;
+	return dir.bytesWritten();
+}
+
+static int64_t ingestedBytes = 0;
+
+static int BenchmarkIngest(Timer* timerCase, MergePolicy* policy, const char* name){
+	int32_t segmentCount = 0;
+	const int64_t written = ingest(timerCase, policy, segmentCount);
+	if ( ingestedBytes == 0 ){
+		// without merges, every byte is written once
+		LogByteSizeMergePolicy* noMerges = _CLNEW LogByteSizeMergePolicy();
+		noMerges->setMaxMergeMB(0);
+		noMerges->setUseCompoundFile(false);
+		Timer baseline;
+		int32_t baselineSegments = 0;
+		ingestedBytes = ingest(&baseline, noMerges, baselineSegments);
+	}
+	printf("\n   %s: %d KB written, write amplification %.2f, %d segments", name,
+		(int32_t)(written/1024), (double)written/ingestedBytes, segmentCount);
+	return written > 0 ? 0 : 1;
+}
+
+int BenchmarkIngestNoMerges(Timer* timerCase){
+	LogByteSizeMergePolicy* policy = _CLNEW LogByteSizeMergePolicy();
+	policy->setMaxMergeMB(0);
+	policy->setUseCompoundFile(false);
+	return BenchmarkIngest(timerCase, policy, "no merges");
+}
+
+int BenchmarkIngestLogByteSizeMergePolicy(Timer* timerCase){
+	LogByteSizeMergePolicy* policy = _CLNEW LogByteSizeMergePolicy();
+	policy->setUseCompoundFile(false);
+	return BenchmarkIngest(timerCase, policy, "LogByteSizeMergePolicy");
+}
+
+int BenchmarkIngestTieredMergePolicy(Timer* timerCase){
+	TieredMergePolicy* policy = _CLNEW TieredMergePolicy();
+	policy->setUseCompoundFile(false);
+	// the simulated flushes are far smaller than the default floor, which
+	// would make the whole index a single tier
+	policy->setFloorSegmentMB(0.1);
+	return BenchmarkIngest(timerCase, policy, "TieredMergePolicy");
+}
@@ -0,0 +1,25 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#pragma once
+
+int BenchmarkIngestNoMerges(Timer*);
+int BenchmarkIngestLogByteSizeMergePolicy(Timer*);
+int BenchmarkIngestTieredMergePolicy(Timer*);
+
+class TestMergePolicy:public Unit
+{
+protected:
+	void runTests(){
+		this->runTest("BenchmarkIngestNoMerges",BenchmarkIngestNoMerges,1);
+		this->runTest("BenchmarkIngestLogByteSizeMergePolicy",BenchmarkIngestLogByteSizeMergePolicy,1);
+		this->runTest("BenchmarkIngestTieredMergePolicy",BenchmarkIngestTieredMergePolicy,1);
+	}
+public:
+	const char* getName(){
+		return "TestMergePolicy";
+	}
+};
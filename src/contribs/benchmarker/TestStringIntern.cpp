@@ -0,0 +1,61 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "stdafx.h"
+
+using namespace lucene::util;
+using namespace lucene::index;
+
+#define INTERN_THREADS 32
+#define INTERN_TERMS 200000
+
+static const TCHAR* internFields[] = {_T("contents"), _T("title"), _T("id"), _T("date")};
+
+/** Creates and destroys terms, each of which interns its field name, like
+* the queries and term enumerations of a busy searcher do */
+_LUCENE_THREAD_FUNC(internTerms, arg){
+	int64_t* count = (int64_t*)arg;
+	for ( int32_t i=0;i<INTERN_TERMS;i++ ){
+		Term* t = _CLNEW Term(internFields[i % 4], _T("text"));
+		if ( t->field() != NULL )
+			(*count)++;
+		_CLDECDELETE(t);
+	}
+	_LUCENE_THREAD_FUNC_RETURN(0);
+}
+
+static int BenchmarkInternFields(Timer* timerCase, int32_t numThreads){
+	// keeps the field names intern'd, like open readers do
+	Term* held[4];
+	for ( int32_t i=0;i<4;i++ )
+		held[i] = _CLNEW Term(internFields[i], _T(""));
+
+	int64_t counts[INTERN_THREADS];
+	_LUCENE_THREADID_TYPE threads[INTERN_THREADS];
+	timerCase->start();
+	for ( int32_t i=0;i<numThreads;i++ ){
+		counts[i] = 0;
+		threads[i] = _LUCENE_THREAD_CREATE(&internTerms, &counts[i]);
+	}
+	int64_t count = 0;
+	for ( int32_t i=0;i<numThreads;i++ ){
+		_LUCENE_THREAD_JOIN(threads[i]);
+		count += counts[i];
+	}
+	timerCase->stop();
+
+	for ( int32_t i=0;i<4;i++ )
+		_CLDECDELETE(held[i]);
+	return count == (int64_t)numThreads * INTERN_TERMS ? 0 : 1;
+}
+
+int BenchmarkInternFieldsSingleThread(Timer* timerCase){
+	return BenchmarkInternFields(timerCase, 1);
+}
+
+int BenchmarkInternFieldsContended(Timer* timerCase){
+	return BenchmarkInternFields(timerCase, INTERN_THREADS);
+}
@@ -0,0 +1,23 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#pragma once
+
+int BenchmarkInternFieldsSingleThread(Timer*);
+int BenchmarkInternFieldsContended(Timer*);
+
+class TestStringIntern:public Unit
+{
+protected:
+	void runTests(){
+		this->runTest("BenchmarkInternFieldsSingleThread",BenchmarkInternFieldsSingleThread,5);
+		this->runTest("BenchmarkInternFieldsContended",BenchmarkInternFieldsContended,5);
+	}
+public:
+	const char* getName(){
+		return "TestStringIntern";
+	}
+};
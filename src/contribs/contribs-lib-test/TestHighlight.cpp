@@ -13,6 +13,7 @@
 #include "CLucene/highlighter/TokenGroup.h"
 #include "CLucene/highlighter/SimpleHTMLFormatter.h"
 #include "CLucene/highlighter/SimpleFragmenter.h"
+#include "CLucene/highlighter/FastVectorHighlighter.h"
 
 CL_NS_USE2(search, highlight);
 
@@ -217,6 +218,54 @@ void testGetRangeFragments(CuTest *tc) {
     CuAssert(tc, msg, hl_formatter.numHighlights == 5);
 }
 
+void testFastVectorHighlighter(CuTest *tc) {
+    RAMDirectory dir;
+    {
+        IndexWriter writer(&dir, &hl_analyzer, true);
+        for (int i = 0; hl_texts[i] != NULL; i++) {
+            Document d;
+            d.add(*_CLNEW Field(hl_FIELD_NAME, hl_texts[i], Field::STORE_YES | Field::INDEX_TOKENIZED | Field::TERMVECTOR_WITH_POSITIONS_OFFSETS));
+            writer.addDocument(&d);
+        }
+        writer.close();
+    }
+    IndexReader* reader = IndexReader::open(&dir);
+    FastVectorHighlighter highlighter(&hl_formatter, NULL, 40);
+
+    // terms
+    Query* query = QueryParser::parse(_T("JFK OR Kennedy"), hl_FIELD_NAME, &hl_analyzer);
+    hl_formatter.numHighlights = 0;
+    for (int i = 0; hl_texts[i] != NULL; i++) {
+        TCHAR** result = highlighter.getBestFragments(query, reader, i, hl_FIELD_NAME, 2);
+        for (int j = 0; result[j] != NULL; j++)
+            CuMessage(tc, _T("%s\n"), result[j]);
+        _CLDELETE_CARRAY_ALL(result);
+    }
+    TCHAR msg[1024];
+    _sntprintf(msg, 1024, _T("Failed to find correct number of highlights %d found"), hl_formatter.numHighlights);
+    CuAssert(tc, msg, hl_formatter.numHighlights == 5);
+
+    TCHAR* best = highlighter.getBestFragment(query, reader, 3, hl_FIELD_NAME);
+    CuAssertStrEquals(tc, _T("best fragment"), _T("John <b>Kennedy</b> has been shot"), best);
+    _CLDELETE_CARRAY(best);
+    _CLDELETE(query);
+
+    // phrases are only highlighted where the whole phrase matches
+    query = QueryParser::parse(_T("\"John Kennedy\""), hl_FIELD_NAME, &hl_analyzer);
+    hl_formatter.numHighlights = 0;
+    best = highlighter.getBestFragment(query, reader, 3, hl_FIELD_NAME);
+    CuAssertStrEquals(tc, _T("phrase"), _T("<b>John</b> <b>Kennedy</b> has been shot"), best);
+    _CLDELETE_CARRAY(best);
+    best = highlighter.getBestFragment(query, reader, 1, hl_FIELD_NAME);
+    CuAssert(tc, _T("no phrase match expected"), best == NULL);
+    CuAssertIntEquals(tc, _T("numHighlights"), 2, hl_formatter.numHighlights);
+    _CLDELETE(query);
+
+    reader->close();
+    _CLLDELETE(reader);
+    dir.close();
+}
+
 void setupHighlighter(CuTest *tc) {
     IndexWriter writer(&hl_ramDir, &hl_analyzer, true);
     for (int i = 0; hl_texts[i] != NULL; i++) {
@@ -262,6 +311,7 @@ CuSuite *testhighlighter(void) {
     SUITE_ADD_TEST(suite, testGetBestFragmentsPhrase);
     SUITE_ADD_TEST(suite, testGetBestFragmentsMultiTerm);
     SUITE_ADD_TEST(suite, testGetBestFragmentsWithOr);
+    SUITE_ADD_TEST(suite, testFastVectorHighlighter);
 
 
     SUITE_ADD_TEST(suite, cleanupHighlighter);
@@ -7,6 +7,7 @@
 #include "test.h"
 
 #include "CLucene/snowball/SnowballAnalyzer.h"
+#include "CLucene/snowball/SnowballFilter.h"
 
 CL_NS_USE2(analysis, snowball);
 
@@ -27,10 +28,66 @@ void testSnowball(CuTest *tc) {
     _CLDELETE(ts);
 }
 
+void testSnowballStemCache(CuTest *tc) {
+    const TCHAR* text = _T("he abhorred accents and abhorred the accents of abhorring people");
+    SnowballAnalyzer an(_T("English"));
+    SnowballStemCache cache(60);
+    CLUCENE_ASSERT(cache.size() == 64);
+
+    // stems from the cache are the same as freshly computed stems
+    CL_NS(util)::StringReader reader(text);
+    CL_NS(util)::StringReader cachedReader(text);
+    TokenStream* ts = an.tokenStream(_T("test"), &reader);
+    TokenStream* cached = _CLNEW SnowballFilter(_CLNEW WhitespaceTokenizer(&cachedReader), _T("English"), true, &cache);
+    Token t, ct;
+    int32_t count = 0;
+    while ( ts->next(&t) != NULL ){
+        CLUCENE_ASSERT(cached->next(&ct) != NULL);
+        CuAssertStrEquals(tc, _T("stem"), t.termBuffer(), ct.termBuffer());
+        CLUCENE_ASSERT(t.termLength() == ct.termLength());
+        count++;
+    }
+    CLUCENE_ASSERT(cached->next(&ct) == NULL);
+    CLUCENE_ASSERT(cache.getHitCount() == 2);
+    CLUCENE_ASSERT(cache.getMissCount() == count - 2);
+    _CLDELETE(cached);
+    _CLDELETE(ts);
+
+    // the reusable stream is reset to read the next reader, and keeps its
+    // cache between calls
+    CLUCENE_ASSERT(an.getStemCache() == NULL);
+    CL_NS(util)::StringReader reader2(_T("accents"));
+    ts = an.reusableTokenStream(_T("test"), &reader2);
+    CLUCENE_ASSERT(ts->next(&t) != NULL);
+    CuAssertStrEquals(tc, _T("stem"), _T("accent"), t.termBuffer());
+    CLUCENE_ASSERT(ts->next(&t) == NULL);
+    const SnowballStemCache* streamCache = an.getStemCache();
+    CLUCENE_ASSERT(streamCache != NULL);
+    CLUCENE_ASSERT(streamCache->getHitCount() == 0);
+    CLUCENE_ASSERT(streamCache->getMissCount() == 1);
+
+    CL_NS(util)::StringReader reader3(_T("accents abhorred"));
+    TokenStream* reused = an.reusableTokenStream(_T("test"), &reader3);
+    CLUCENE_ASSERT(reused == ts);
+    CLUCENE_ASSERT(an.getStemCache() == streamCache);
+    CLUCENE_ASSERT(ts->next(&t) != NULL);
+    CuAssertStrEquals(tc, _T("stem"), _T("accent"), t.termBuffer());
+    CLUCENE_ASSERT(ts->next(&t) != NULL);
+    CuAssertStrEquals(tc, _T("stem"), _T("abhor"), t.termBuffer());
+    CLUCENE_ASSERT(ts->next(&t) == NULL);
+    CLUCENE_ASSERT(streamCache->getHitCount() == 1);
+    CLUCENE_ASSERT(streamCache->getMissCount() == 2);
+
+    cache.clear();
+    int32_t stemLength;
+    CLUCENE_ASSERT(cache.get(_T("accents"), 7, stemLength) == NULL);
+}
+
 CuSuite *testsnowball(void) {
     CuSuite *suite = CuSuiteNew(_T("CLucene Snowball Test"));
 
     SUITE_ADD_TEST(suite, testSnowball);
+    SUITE_ADD_TEST(suite, testSnowballStemCache);
 
     return suite;
 }
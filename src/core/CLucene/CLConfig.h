@@ -161,6 +161,10 @@
 //Size of TermScore cache. Required.
 #define LUCENE_SCORE_CACHE_SIZE 32
 //
+//Maximum number of bytes of the upper skip levels of frequent terms that
+//every SegmentReader keeps in memory. 0 disables the cache. Required.
+#define LUCENE_SKIP_LEVEL_CACHE_SIZE 262144
+//
 //analysis options
 //maximum length that the CharTokenizer uses. Required.
 //By adjusting this value, you can greatly improve the performance of searching
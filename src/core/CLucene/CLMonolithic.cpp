@@ -25,6 +25,7 @@
 #include "CLucene/document/Field.cpp"
 #include "CLucene/index/CompoundFile.cpp"
 #include "CLucene/index/DirectoryIndexReader.cpp"
+#include "CLucene/index/DocValues.cpp"
 #include "CLucene/index/DocumentsWriter.cpp"
 #include "CLucene/index/DocumentsWriterThreadState.cpp"
 #include "CLucene/index/FieldInfos.cpp"
@@ -37,6 +38,7 @@
 #include "CLucene/index/IndexModifier.cpp"
 #include "CLucene/index/IndexWriter.cpp"
 #include "CLucene/index/IndexReader.cpp"
+#include "CLucene/index/IndexingPipeline.cpp"
 #include "CLucene/index/MergePolicy.cpp"
 #include "CLucene/index/MergeScheduler.cpp"
 #include "CLucene/index/MultipleTermPositions.cpp"
@@ -76,8 +78,10 @@
 #include "CLucene/search/DateFilter.cpp"
 #include "CLucene/search/ConjunctionScorer.cpp"
 #include "CLucene/search/DisjunctionSumScorer.cpp"
+#include "CLucene/search/EarlyTerminatingCollector.cpp"
 #include "CLucene/search/ExactPhraseScorer.cpp"
 #include "CLucene/search/Explanation.cpp"
+#include "CLucene/search/FacetCollector.cpp"
 #include "CLucene/search/FieldCache.cpp"
 #include "CLucene/search/FieldCacheImpl.cpp"
 #include "CLucene/search/FieldDocSortedHitQueue.cpp"
@@ -87,10 +91,12 @@
 #include "CLucene/search/Hits.cpp"
 #include "CLucene/search/HitQueue.cpp"
 #include "CLucene/search/IndexSearcher.cpp"
+#include "CLucene/search/QueryResultCache.cpp"
 #include "CLucene/search/MatchAllDocsQuery.cpp"
 #include "CLucene/search/MultiPhraseQuery.cpp"
 #include "CLucene/search/MultiSearcher.cpp"
 #include "CLucene/search/MultiTermQuery.cpp"
+#include "CLucene/search/MultiTermRewrite.cpp"
 #include "CLucene/search/PhrasePositions.cpp"
 #include "CLucene/search/PhraseQuery.cpp"
 #include "CLucene/search/PhraseScorer.cpp"
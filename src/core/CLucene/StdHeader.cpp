@@ -10,6 +10,7 @@
 #include "CLucene/search/Sort.h"
 #include "CLucene/search/Similarity.h"
 #include "CLucene/search/FieldCache.h"
+#include "CLucene/search/FacetCollector.h"
 #include "CLucene/index/TermVector.h"
 #include "CLucene/index/_IndexFileNameFilter.h"
 #include "CLucene/search/FieldSortedHitQueue.h"
@@ -35,6 +36,7 @@ void _lucene_shutdown(){
   ScoreDocComparator::_shutdown();
   SortField::_shutdown();
   FieldCache::_shutdown();
+  FacetCollector::_shutdown();
   Similarity::_shutdown();
   CLStringIntern::_shutdown();
   NoLockFactory::_shutdown();
@@ -233,6 +233,127 @@ Token* StopFilter::next(Token* token) {
 	return NULL;
 }
 
+CommonGramsFilter::CommonGramsFilter(TokenStream* in, bool deleteTokenStream, const TCHAR** _commonWords):
+	TokenFilter(in, deleteTokenStream),
+	commonWords(_CLNEW CLTCSetList(true)),
+	deleteCommonWords(true),
+	current(_CLNEW Token()),
+	following(_CLNEW Token()),
+	hasCurrent(false),
+	currentDone(false),
+	currentCommon(false),
+	exhausted(false),
+	skippedPositions(0)
+{
+	StopFilter::fillStopTable(commonWords, _commonWords);
+}
+
+CommonGramsFilter::CommonGramsFilter(TokenStream* in, bool deleteTokenStream, CLTCSetList* _commonWords, bool _deleteCommonWords):
+	TokenFilter(in, deleteTokenStream),
+	commonWords(_commonWords),
+	deleteCommonWords(_deleteCommonWords),
+	current(_CLNEW Token()),
+	following(_CLNEW Token()),
+	hasCurrent(false),
+	currentDone(false),
+	currentCommon(false),
+	exhausted(false),
+	skippedPositions(0)
+{
+}
+
+CommonGramsFilter::~CommonGramsFilter(){
+	_CLDELETE(current);
+	_CLDELETE(following);
+	if ( deleteCommonWords )
+		_CLLDELETE(commonWords);
+}
+
+bool CommonGramsFilter::isCommon(Token* token) const{
+	return commonWords->find(token->termBuffer()) != commonWords->end();
+}
+
+TCHAR* CommonGramsFilter::makeGram(const TCHAR* first, const TCHAR* second){
+	const size_t firstLength = _tcslen(first);
+	const size_t secondLength = _tcslen(second);
+	TCHAR* ret = _CL_NEWARRAY(TCHAR, firstLength + secondLength + 2);
+	_tcsncpy(ret, first, firstLength);
+	ret[firstLength] = SEPARATOR;
+	_tcsncpy(ret + firstLength + 1, second, secondLength);
+	ret[firstLength + secondLength + 1] = 0;
+	return ret;
+}
+
+Token* CommonGramsFilter::next(Token* token){
+	while ( true ){
+		if ( !hasCurrent ){
+			if ( exhausted || input->next(current) == NULL ){
+				exhausted = true;
+				return NULL;
+			}
+			hasCurrent = true;
+			currentDone = false;
+			currentCommon = isCommon(current);
+			skippedPositions += current->getPositionIncrement();
+		}
+
+		if ( !currentDone ){
+			currentDone = true;
+			if ( !currentCommon ){
+				token->set(current->termBuffer(), current->startOffset(), current->endOffset(), current->type());
+				token->setPositionIncrement(skippedPositions);
+				skippedPositions = 0;
+				return token;
+			}
+		}
+
+		// current has been handled on its own, now pair it with the next word
+		if ( input->next(following) == NULL ){
+			exhausted = true;
+			hasCurrent = false;
+			return NULL;
+		}
+		const bool followingCommon = isCommon(following);
+		const bool gram = following->getPositionIncrement() == 1 && (currentCommon || followingCommon);
+		if ( gram ){
+			const size_t firstLength = current->termLength();
+			const size_t secondLength = following->termLength();
+			TCHAR* buffer = token->resizeTermBuffer(firstLength + secondLength + 2);
+			_tcsncpy(buffer, current->termBuffer(), firstLength);
+			buffer[firstLength] = SEPARATOR;
+			_tcsncpy(buffer + firstLength + 1, following->termBuffer(), secondLength);
+			buffer[firstLength + secondLength + 1] = 0;
+			token->setTermLength(firstLength + secondLength + 1);
+			token->setStartOffset(current->startOffset());
+			token->setEndOffset(following->endOffset());
+			token->setType(_T("gram"));
+			token->setPayload(NULL);
+			token->setPositionIncrement(skippedPositions);
+			skippedPositions = 0;
+		}
+
+		// the following word becomes the current one
+		Token* tmp = current;
+		current = following;
+		following = tmp;
+		currentDone = false;
+		currentCommon = followingCommon;
+		skippedPositions += current->getPositionIncrement();
+
+		if ( gram )
+			return token;
+	}
+}
+
+void CommonGramsFilter::reset(){
+	input->reset();
+	hasCurrent = false;
+	currentDone = false;
+	currentCommon = false;
+	exhausted = false;
+	skippedPositions = 0;
+}
+
 StopAnalyzer::StopAnalyzer(const char* stopwordsFile, const char* enc):
 	stopTable(_CLNEW CLTCSetList(true))
 {
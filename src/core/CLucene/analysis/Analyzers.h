@@ -389,6 +389,59 @@ public:
     Token* next(Token* token);
 };
 
+/**
+* Builds the terms of a shadow field that speeds up phrase searches
+* containing common words (see PhraseQuery::setCommonGrams).
+*
+* <p>Words that are not common are passed through. For every two adjacent
+* words of which at least one is common, a bigram of the two words joined
+* by {@link #SEPARATOR} is emitted at the position of the first word. Common
+* words are not emitted on their own. For "the quick fox" with the common
+* word "the" this gives "the_quick", "quick" and "fox", at the same
+* positions the words have in the main field.</p>
+*
+* <p>Index the same text into a main field and, with this filter at the
+* end of the same analysis chain, into the shadow field. A phrase like
+* "to be or not to be" then only reads the postings of a few rare bigrams
+* instead of the positions of every occurrence of each common word.</p>
+*/
+class CLUCENE_EXPORT CommonGramsFilter: public TokenFilter {
+private:
+	CLTCSetList* commonWords;
+	bool deleteCommonWords;
+
+	Token* current;    ///< the last word read from the input
+	Token* following;  ///< the word after it, while a bigram is built
+	bool hasCurrent;
+	bool currentDone;  ///< whether current was passed through (or is common)
+	bool currentCommon;
+	bool exhausted;
+	int32_t skippedPositions; ///< position increment of the next token returned
+
+	bool isCommon(Token* token) const;
+public:
+	/** Separates the two words of a bigram */
+	LUCENE_STATIC_CONSTANT(TCHAR, SEPARATOR=_T('_'));
+
+	/** Constructs a filter which makes bigrams with the words in the
+	* NULL terminated array of common words */
+	CommonGramsFilter(TokenStream* in, bool deleteTokenStream, const TCHAR** commonWords);
+
+	/** Constructs a filter which makes bigrams with the words in the set.
+	* The set is not copied, it is deleted with the filter if
+	* deleteCommonWords is true. */
+	CommonGramsFilter(TokenStream* in, bool deleteTokenStream, CLTCSetList* commonWords, bool deleteCommonWords=false);
+
+	virtual ~CommonGramsFilter();
+
+	Token* next(Token* token);
+	void reset();
+
+	/** Returns the bigram term of two words.
+	* @memory the caller owns the returned string */
+	static TCHAR* makeGram(const TCHAR* first, const TCHAR* second);
+};
+
 
 CL_NS_END
 #endif
@@ -133,7 +133,10 @@ CL_NS_DEF2(analysis,standard)
 
   void StandardTokenizer::reset(Reader* _input) {
 	this->input = _input;
-    if (rd->input==NULL) rd->input = _input->__asBufferedReader();
+    // the char stream reads buffered readers only, the caller wraps others.
+    // The reader the tokenizer was constructed with is still deleted by it
+    BufferedReader* bufferedReader = _input->__asBufferedReader();
+    if (bufferedReader != NULL) rd->input = bufferedReader;
     rdPos = -1;
     tokenStart = -1;
     rd->reset();
@@ -15,7 +15,8 @@ CL_NS_USE(util)
 CL_NS_DEF(document)
 
 Field::Field(const TCHAR* Name, Reader* reader, int config):
-	lazy(false)
+	lazy(false),
+	tokenStream(NULL)
 {
 	CND_PRECONDITION(Name != NULL, "Name cannot be NULL");
 	CND_PRECONDITION(reader != NULL, "reader cannot be NULL");
@@ -31,7 +32,8 @@ Field::Field(const TCHAR* Name, Reader* reader, int config):
 
 
 Field::Field(const TCHAR* Name, const TCHAR* Value, int _config, const bool duplicateValue):
-	lazy(false)
+	lazy(false),
+	tokenStream(NULL)
 {
 	CND_PRECONDITION(Name != NULL, "Name cannot be NULL");
 	CND_PRECONDITION(Value != NULL, "value cannot be NULL");
@@ -59,7 +61,8 @@ Field::Field(const TCHAR* Name, const TCHAR* Value, int _config, const bool dupl
 }
 
 Field::Field(const TCHAR* Name, ValueArray<uint8_t>* Value, int config, bool duplicateValue):
-	lazy(false)
+	lazy(false),
+	tokenStream(NULL)
 {
 	CND_PRECONDITION(Name != NULL, "Name cannot be NULL");
 	CND_PRECONDITION(Value != NULL, "value cannot be NULL");
@@ -81,7 +84,8 @@ Field::Field(const TCHAR* Name, ValueArray<uint8_t>* Value, int config, bool dup
 }
 
 Field::Field(const TCHAR* Name, int config):
-	lazy(false)
+	lazy(false),
+	tokenStream(NULL)
 {
 	CND_PRECONDITION(Name != NULL, "Name cannot be NULL");
 
@@ -109,7 +113,11 @@ const TCHAR* Field::name() const	{ return _name; } ///<returns reference
 const TCHAR* Field::stringValue()	{ return (valueType & VALUE_STRING) ? static_cast<TCHAR*>(fieldsData) : NULL; } ///<returns reference
 const ValueArray<uint8_t>* Field::binaryValue() { return (valueType & VALUE_BINARY) ? static_cast<ValueArray<uint8_t>*>(fieldsData) : NULL; } ///<returns reference
 Reader* Field::readerValue()	{ return (valueType & VALUE_READER) ? static_cast<Reader*>(fieldsData) : NULL; } ///<returns reference
-CL_NS(analysis)::TokenStream* Field::tokenStreamValue() { return (valueType & VALUE_TOKENSTREAM) ? static_cast<CL_NS(analysis)::TokenStream*>(fieldsData) : NULL; }
+CL_NS(analysis)::TokenStream* Field::tokenStreamValue() {
+	if ( tokenStream != NULL )
+		return tokenStream;
+	return (valueType & VALUE_TOKENSTREAM) ? static_cast<CL_NS(analysis)::TokenStream*>(fieldsData) : NULL;
+}
 
 bool	Field::isStored() const 	{ return (config & STORE_YES) != 0; }
 bool 	Field::isIndexed() const	{ return (config & INDEX_TOKENIZED)!=0 || (config & INDEX_UNTOKENIZED)!=0; }
@@ -121,6 +129,8 @@ bool	Field::isTermVectorStored() const { return (config & TERMVECTOR_YES) != 0;
 bool	Field::isStoreOffsetWithTermVector() const { return (config & TERMVECTOR_YES) != 0 && (config & TERMVECTOR_WITH_OFFSETS) != 0 && ((config & TERMVECTOR_WITH_OFFSETS) != TERMVECTOR_YES); }
 bool	Field::isStorePositionWithTermVector() const { return (config & TERMVECTOR_YES) != 0 && (config & TERMVECTOR_WITH_POSITIONS) != 0 && ((config & TERMVECTOR_WITH_POSITIONS) != TERMVECTOR_YES); }
 
+int32_t Field::getDocValuesType() const { return config & (DOCVALUES_INTS | DOCVALUES_BYTES); }
+
 bool Field::getOmitNorms() const { return (config & INDEX_NONORMS) != 0; }
 void Field::setOmitNorms(const bool omitNorms) {
     if ( omitNorms )
@@ -158,6 +168,10 @@ void Field::setValue(CL_NS(analysis)::TokenStream* value) {
 	valueType = VALUE_TOKENSTREAM;
 }
 
+void Field::setTokenStream(CL_NS(analysis)::TokenStream* tokenStream) {
+	this->tokenStream = tokenStream;
+}
+
 void Field::setBoost(const float_t boost)	{ this->boost = boost; }
 float_t Field::getBoost() const				{ return boost; }
 
@@ -197,7 +211,12 @@ void Field::setConfig(const uint32_t x){
 	}else
 		newConfig |= INDEX_NO;
 
-	if ( newConfig & INDEX_NO && newConfig & STORE_NO )
+	//set doc values settings
+	if ( (x & DOCVALUES_INTS) && (x & DOCVALUES_BYTES) )
+		_CLTHROWA(CL_ERR_IllegalArgument,"a field can only have one type of doc values");
+	newConfig |= x & (DOCVALUES_INTS | DOCVALUES_BYTES);
+
+	if ( newConfig & INDEX_NO && newConfig & STORE_NO && (newConfig & (DOCVALUES_INTS | DOCVALUES_BYTES)) == 0 )
 		_CLTHROWA(CL_ERR_IllegalArgument,"it doesn't make sense to have a field that is neither indexed nor stored");
 
 	//set termvector settings
@@ -270,6 +289,11 @@ TCHAR* Field::toString() {
     }
     if (getOmitNorms()) {
       result.append( _T(",omitNorms") );
+    }
+    if (getDocValuesType() != 0) {
+      if (result.length() > 0)
+        result.appendChar( ',' );
+      result.append( getDocValuesType() == DOCVALUES_INTS ? _T("docValuesInts") : _T("docValuesBytes") );
     }
 	if (isLazy()){
       result.append( _T(",lazy") );
@@ -113,6 +113,26 @@ public:
 		TERMVECTOR_WITH_POSITIONS_OFFSETS = TERMVECTOR_WITH_OFFSETS | TERMVECTOR_WITH_POSITIONS
 	};
 
+	enum DocValues{
+		/** Also write the value to a column of integers, one per document,
+		* which can be read at random without uninverting the field. The
+		* string value of the field is parsed as a decimal 64 bit integer.
+		* Each segment stores the values with the smallest fixed width
+		* that fits their range.
+		*
+		* @see CL_NS(index)::IndexReader#getDocValues
+		*/
+		DOCVALUES_INTS=4096,
+
+		/** Also write the value to a column of variable length byte values,
+		* one per document. String values are stored as UTF-8, binary
+		* values as they are.
+		*
+		* @see CL_NS(index)::IndexReader#getDocValues
+		*/
+		DOCVALUES_BYTES=8192
+	};
+
 	bool lazy;
 
 	enum ValueType {
@@ -241,6 +261,10 @@ public:
 	/** True if the value of the filed is stored as binary */
 	bool isBinary() const;
 	
+	/** Returns DOCVALUES_INTS or DOCVALUES_BYTES if the value of this field
+	* is written to a per document column, or 0 */
+	int32_t getDocValuesType() const;
+
 	/** True if norms are omitted for this indexed field */
 	bool getOmitNorms() const;
 
@@ -290,6 +314,14 @@ public:
 	/** Expert: change the value of this field.  See <a href="#setValue(TCHAR*)">setValue(TCHAR*)</a>. */
 	void setValue(CL_NS(analysis)::TokenStream* value);
 
+	/** Expert: sets the token stream to be used for indexing this field, without
+	* changing its value. The stream replaces the Analyzer for this field, so a
+	* pre-analyzed field can still be stored. Pass NULL to clear it.
+	*
+	* @memory The caller keeps ownership of the stream, which must stay valid
+	* until the document has been added to the index. */
+	void setTokenStream(CL_NS(analysis)::TokenStream* tokenStream);
+
 	virtual const char* getObjectName() const;
 	static const char* getClassName();
 
@@ -305,6 +337,7 @@ protected:
 
 	void* fieldsData;
 	ValueType valueType;
+	CL_NS(analysis)::TokenStream* tokenStream; ///< see setTokenStream
 
 	const TCHAR* _name;
 	uint32_t config;
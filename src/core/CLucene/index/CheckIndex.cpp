@@ -0,0 +1,696 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "CLucene/_ApiHeader.h"
+#include "CheckIndex.h"
+#include "_SegmentHeader.h"
+#include "_SegmentInfos.h"
+#include "_IndexFileNames.h"
+#include "_CompoundFile.h"
+#include "Term.h"
+#include "Terms.h"
+#include "TermVector.h"
+#include "CLucene/store/Directory.h"
+#include "CLucene/document/Document.h"
+#include "CLucene/util/Misc.h"
+#include "CLucene/util/BitSet.h"
+#include "CLucene/util/_ThreadLocal.h"
+#include "CLucene/config/_threads.h"
+#include <set>
+
+CL_NS_USE(util)
+CL_NS_USE(store)
+CL_NS_USE(document)
+CL_NS_DEF(index)
+
+static const char* TEST_OPEN_READER = "test: open reader";
+static const char* TEST_DELETIONS = "test: deletions";
+static const char* TEST_NORMS = "test: fields, norms";
+static const char* TEST_POSTINGS = "test: terms, freq, prox";
+static const char* TEST_STORED_FIELDS = "test: stored fields";
+static const char* TEST_TERM_VECTORS = "test: term vectors";
+
+CheckIndex::SegmentStatus::SegmentStatus():
+  docCount(0), compound(false), numFiles(0), sizeMB(0), docStoreOffset(-1),
+  hasDeletions(false), numDeleted(0), numFields(0), normCount(0), termCount(0),
+  totFreq(0), totPos(0), storedFieldCount(0), termVectorCount(0)
+{
+}
+
+CheckIndex::Status::Status():
+  clean(false), missingSegments(false), partial(false), numSegments(0),
+  numBadSegments(0), totLoseDocCount(0), newSegments(NULL)
+{
+}
+CheckIndex::Status::~Status(){
+  _CLDELETE(newSegments);
+}
+
+/**
+* The parts of the segments that are read, shared by the checking threads.
+* A part that fails records its error in the status of its segment and the
+* other parts are still checked.
+*/
+class CheckIndex::Tasks {
+public:
+  enum Part { DELETIONS, NORMS, POSTINGS, STORED_FIELDS, TERM_VECTORS, NUM_PARTS };
+
+  struct Segment {
+    SegmentInfo* info;
+    SegmentReader* reader;
+    SegmentStatus* status;
+    int64_t millis[NUM_PARTS];
+  };
+  struct Task {
+    Part part;
+    Segment* segment;
+    const TCHAR* field; // the field of the POSTINGS task
+  };
+
+  std::vector<Task> tasks;
+  size_t next;
+  DEFINE_MUTEX(THIS_LOCK)
+
+  Tasks(): next(0) {}
+
+  void add(Part part, Segment* segment, const TCHAR* field = NULL) {
+    Task task;
+    task.part = part;
+    task.segment = segment;
+    task.field = field;
+    tasks.push_back(task);
+  }
+
+  static const char* getTestName(Part part) {
+    switch (part) {
+      case DELETIONS: return TEST_DELETIONS;
+      case NORMS: return TEST_NORMS;
+      case POSTINGS: return TEST_POSTINGS;
+      case STORED_FIELDS: return TEST_STORED_FIELDS;
+      default: return TEST_TERM_VECTORS;
+    }
+  }
+
+  void addError(const Task& task, const char* what) {
+    std::string msg = std::string(getTestName(task.part)) + " FAILED: ";
+    if (task.field != NULL)
+      msg += "field " + Misc::toString(task.field) + ": ";
+    SCOPED_LOCK_MUTEX(THIS_LOCK)
+    task.segment->status->errors.push_back(msg + what);
+  }
+
+  /** Runs tasks until there are none left */
+  void run() {
+    while (true) {
+      Task task;
+      {
+        SCOPED_LOCK_MUTEX(THIS_LOCK)
+        if (next == tasks.size())
+          return;
+        task = tasks[next++];
+      }
+      uint64_t start = Misc::currentTimeMillis();
+      try {
+        switch (task.part) {
+          case DELETIONS:
+            checkDeletions(task.segment);
+            break;
+          case NORMS:
+            checkNorms(task.segment);
+            break;
+          case POSTINGS:
+            checkPostings(task.segment, task.field);
+            break;
+          case STORED_FIELDS:
+            checkStoredFields(task.segment);
+            break;
+          case TERM_VECTORS:
+            checkTermVectors(task.segment);
+            break;
+          default:
+            break;
+        }
+      } catch (CLuceneError& err) {
+        addError(task, err.what());
+      } catch (...) {
+        addError(task, "unknown error");
+      }
+      int64_t elapsed = (int64_t)(Misc::currentTimeMillis() - start);
+      SCOPED_LOCK_MUTEX(THIS_LOCK)
+      task.segment->millis[task.part] += elapsed;
+    }
+  }
+
+#ifndef _CL_DISABLE_MULTITHREADING
+  static _LUCENE_THREAD_FUNC(worker, arg) {
+    ((Tasks*)arg)->run();
+    _ThreadLocal::UnregisterCurrentThread();
+    _LUCENE_THREAD_FUNC_RETURN(0);
+  }
+#endif
+
+  /** Compares the deleted documents with the count stored in the deletions file */
+  void checkDeletions(Segment* segment) {
+    SegmentReader* reader = segment->reader;
+    int32_t maxDoc = reader->maxDoc();
+    int32_t numDeleted = 0;
+    if (segment->info->hasDeletions()) {
+      BitSet* deletedDocs = reader->deletedDocs;
+      if (deletedDocs == NULL)
+        _CLTHROWA(CL_ERR_CorruptIndex, "the deletions file was not loaded");
+      if (deletedDocs->size() != maxDoc)
+        _CLTHROWA(CL_ERR_CorruptIndex, ("the deletions cover " + Misc::toString(deletedDocs->size()) +
+          " documents, but the segment has " + Misc::toString(maxDoc)).c_str());
+      for (int32_t i = deletedDocs->nextSetBit(0); i >= 0; i = deletedDocs->nextSetBit(i + 1))
+        numDeleted++;
+      if (numDeleted != deletedDocs->count())
+        _CLTHROWA(CL_ERR_CorruptIndex, ("the deletions file counts " + Misc::toString(deletedDocs->count()) +
+          " deleted documents, but " + Misc::toString(numDeleted) + " are marked").c_str());
+    }
+    if (reader->numDocs() != maxDoc - numDeleted)
+      _CLTHROWA(CL_ERR_CorruptIndex, ("numDocs is " + Misc::toString(reader->numDocs()) + ", expected " +
+        Misc::toString(maxDoc - numDeleted)).c_str());
+
+    SCOPED_LOCK_MUTEX(THIS_LOCK)
+    segment->status->numDeleted = numDeleted;
+  }
+
+  /** Checks that every indexed field with norms has them */
+  void checkNorms(Segment* segment) {
+    SegmentReader* reader = segment->reader;
+    FieldInfos* fieldInfos = reader->getFieldInfos();
+    int32_t normCount = 0;
+    for (size_t i = 0; i < fieldInfos->size(); i++) {
+      FieldInfo* fi = fieldInfos->fieldInfo(i);
+      if (!fi->isIndexed || fi->omitNorms)
+        continue;
+      if (!reader->hasNorms(fi->name) || reader->norms(fi->name) == NULL)
+        _CLTHROWA(CL_ERR_CorruptIndex, ("field " + Misc::toString(fi->name) + " has no norms").c_str());
+      normCount++;
+    }
+
+    SCOPED_LOCK_MUTEX(THIS_LOCK)
+    segment->status->normCount = normCount;
+  }
+
+  /**
+  * Reads the postings of every term of the field, and compares them with
+  * the document frequency of the term dictionary. Each term's skip data is
+  * checked by skipping to a few of the documents the postings listed.
+  */
+  void checkPostings(Segment* segment, const TCHAR* field) {
+    SegmentReader* reader = segment->reader;
+    int32_t maxDoc = reader->maxDoc();
+    bool hasDeletions = segment->info->hasDeletions();
+    int64_t termCount = 0, totFreq = 0, totPos = 0;
+    std::vector<int32_t> docs;
+
+    Term* start = _CLNEW Term(field, LUCENE_BLANK_STRING);
+    TermEnum* termEnum = reader->terms(start);
+    _CLDECDELETE(start);
+    TermPositions* termPositions = reader->termPositions();
+    TermDocs* skipper = reader->termDocs();
+    Term* lastTerm = NULL;
+    try {
+      Term* term = termEnum->term(false);
+      while (term != NULL && _tcscmp(term->field(), field) == 0) {
+        if (lastTerm != NULL && term->compareTo(lastTerm) <= 0)
+          _CLTHROWA(CL_ERR_CorruptIndex, ("term " + Misc::toString(term->text()) +
+            " is out of order").c_str());
+        _CLDECDELETE(lastTerm);
+        lastTerm = _CL_POINTER(term);
+
+        int32_t docFreq = termEnum->docFreq();
+        if (docFreq <= 0)
+          _CLTHROWA(CL_ERR_CorruptIndex, ("term " + Misc::toString(term->text()) +
+            ": docFreq " + Misc::toString(docFreq) + " is not positive").c_str());
+        // the term index finds the term on its own
+        if (reader->docFreq(term) != docFreq)
+          _CLTHROWA(CL_ERR_CorruptIndex, ("term " + Misc::toString(term->text()) +
+            ": the term index gives docFreq " + Misc::toString(reader->docFreq(term)) +
+            ", the term dictionary " + Misc::toString(docFreq)).c_str());
+        termCount++;
+
+        docs.clear();
+        int32_t lastDoc = -1;
+        termPositions->seek(termEnum);
+        while (termPositions->next()) {
+          int32_t doc = termPositions->doc();
+          int32_t freq = termPositions->freq();
+          if (doc <= lastDoc || doc >= maxDoc)
+            _CLTHROWA(CL_ERR_CorruptIndex, ("term " + Misc::toString(term->text()) +
+              ": doc " + Misc::toString(doc) + " after doc " + Misc::toString(lastDoc) +
+              " is out of order or beyond maxDoc " + Misc::toString(maxDoc)).c_str());
+          if (freq <= 0)
+            _CLTHROWA(CL_ERR_CorruptIndex, ("term " + Misc::toString(term->text()) +
+              ": doc " + Misc::toString(doc) + " has freq " + Misc::toString(freq)).c_str());
+          int32_t lastPos = -1;
+          for (int32_t j = 0; j < freq; j++) {
+            int32_t pos = termPositions->nextPosition();
+            if (pos < 0 || pos < lastPos)
+              _CLTHROWA(CL_ERR_CorruptIndex, ("term " + Misc::toString(term->text()) +
+                ": doc " + Misc::toString(doc) + " has position " + Misc::toString(pos) +
+                " after " + Misc::toString(lastPos)).c_str());
+            lastPos = pos;
+          }
+          totPos += freq;
+          docs.push_back(doc);
+          lastDoc = doc;
+        }
+        // deleted documents are not listed
+        int32_t freq0 = (int32_t)docs.size();
+        if (freq0 > docFreq || (!hasDeletions && freq0 != docFreq))
+          _CLTHROWA(CL_ERR_CorruptIndex, ("term " + Misc::toString(term->text()) +
+            ": docFreq is " + Misc::toString(docFreq) + " but " + Misc::toString(freq0) +
+            " documents were read").c_str());
+        totFreq += freq0;
+
+        // skip to the documents after the first few gaps
+        size_t skips = cl_min(docs.size(), (size_t)8);
+        for (size_t j = 1; j < skips; j++) {
+          size_t target = j * docs.size() / skips;
+          skipper->seek(termEnum);
+          if (!skipper->skipTo(docs[target - 1] + 1) || skipper->doc() != docs[target])
+            _CLTHROWA(CL_ERR_CorruptIndex, ("term " + Misc::toString(term->text()) +
+              ": skipTo(" + Misc::toString(docs[target - 1] + 1) + ") did not find doc " +
+              Misc::toString(docs[target])).c_str());
+        }
+
+        if (!termEnum->next())
+          break;
+        term = termEnum->term(false);
+      }
+    }_CLFINALLY(
+      _CLDECDELETE(lastTerm);
+      skipper->close();
+      _CLDELETE(skipper);
+      termPositions->close();
+      _CLDELETE(termPositions);
+      termEnum->close();
+      _CLDELETE(termEnum);
+    );
+
+    SCOPED_LOCK_MUTEX(THIS_LOCK)
+    segment->status->termCount += termCount;
+    segment->status->totFreq += totFreq;
+    segment->status->totPos += totPos;
+  }
+
+  /** Reads the stored fields of every document that is not deleted */
+  void checkStoredFields(Segment* segment) {
+    SegmentReader* reader = segment->reader;
+    int32_t maxDoc = reader->maxDoc();
+    int32_t numDocs = 0;
+    int64_t storedFieldCount = 0;
+    for (int32_t i = 0; i < maxDoc; i++) {
+      if (reader->isDeleted(i))
+        continue;
+      Document doc;
+      if (!reader->document(i, doc, NULL))
+        _CLTHROWA(CL_ERR_CorruptIndex, ("doc " + Misc::toString(i) + " could not be read").c_str());
+      storedFieldCount += doc.getFields()->size();
+      numDocs++;
+    }
+    if (numDocs != reader->numDocs())
+      _CLTHROWA(CL_ERR_CorruptIndex, ("read " + Misc::toString(numDocs) + " documents, expected " +
+        Misc::toString(reader->numDocs())).c_str());
+
+    SCOPED_LOCK_MUTEX(THIS_LOCK)
+    segment->status->storedFieldCount = storedFieldCount;
+  }
+
+  /** Reads the term vectors of every document that is not deleted */
+  void checkTermVectors(Segment* segment) {
+    SegmentReader* reader = segment->reader;
+    int32_t maxDoc = reader->maxDoc();
+    int64_t termVectorCount = 0;
+    for (int32_t i = 0; i < maxDoc; i++) {
+      if (reader->isDeleted(i))
+        continue;
+      ArrayBase<TermFreqVector*>* vectors = reader->getTermFreqVectors(i);
+      if (vectors == NULL)
+        continue;
+      try {
+        for (size_t j = 0; j < vectors->length; j++) {
+          TermFreqVector* vector = vectors->values[j];
+          const ArrayBase<const TCHAR*>* terms = vector->getTerms();
+          const ArrayBase<int32_t>* freqs = vector->getTermFrequencies();
+          size_t size = (size_t)vector->size();
+          if (terms == NULL || freqs == NULL || terms->length != size || freqs->length != size)
+            _CLTHROWA(CL_ERR_CorruptIndex, ("doc " + Misc::toString(i) + ": the term vector of field " +
+              Misc::toString(vector->getField()) + " has inconsistent sizes").c_str());
+          for (size_t k = 0; k < size; k++) {
+            if (k > 0 && _tcscmp(terms->values[k - 1], terms->values[k]) >= 0)
+              _CLTHROWA(CL_ERR_CorruptIndex, ("doc " + Misc::toString(i) + ": the term vector of field " +
+                Misc::toString(vector->getField()) + " is out of order").c_str());
+            if (freqs->values[k] <= 0)
+              _CLTHROWA(CL_ERR_CorruptIndex, ("doc " + Misc::toString(i) + ": the term vector of field " +
+                Misc::toString(vector->getField()) + " has a freq of " + Misc::toString(freqs->values[k])).c_str());
+          }
+          termVectorCount++;
+        }
+      }_CLFINALLY(
+        vectors->deleteValues();
+        _CLLDELETE(vectors);
+      );
+    }
+
+    SCOPED_LOCK_MUTEX(THIS_LOCK)
+    segment->status->termVectorCount = termVectorCount;
+  }
+
+  /** Adds the files that a part of the segment was read from */
+  static void addFiles(Segment* segment, Part part) {
+    PartStatus partStatus;
+    partStatus.test = getTestName(part);
+    partStatus.bytes = 0;
+    partStatus.millis = segment->millis[part];
+    addFiles(segment, part, partStatus);
+    if (!partStatus.files.empty())
+      segment->status->parts.push_back(partStatus);
+  }
+
+  static void addFiles(Segment* segment, Part part, PartStatus& partStatus) {
+    SegmentInfo* info = segment->info;
+    SegmentReader* reader = segment->reader;
+    std::vector<std::string> names;
+    Directory* dir = reader->cfsReader != NULL ? (Directory*)reader->cfsReader : info->dir;
+    std::string base = info->name + ".";
+    switch (part) {
+      case DELETIONS:
+        if (info->hasDeletions())
+          names.push_back(info->getDelFileName());
+        dir = info->dir;
+        break;
+      case NORMS: {
+        FieldInfos* fieldInfos = reader->getFieldInfos();
+        std::set<std::string> seen;
+        for (size_t i = 0; i < fieldInfos->size(); i++) {
+          FieldInfo* fi = fieldInfos->fieldInfo(i);
+          if (!fi->isIndexed || fi->omitNorms)
+            continue;
+          std::string name = info->getNormFileName((int32_t)i);
+          if (seen.insert(name).second) {
+            // separate norms are never in the compound file
+            Directory* normDir = info->hasSeparateNorms((int32_t)i) ? info->dir : dir;
+            addFile(partStatus, normDir, name);
+          }
+        }
+        return;
+      }
+      case POSTINGS:
+        names.push_back(base + IndexFileNames::TERMS_EXTENSION);
+        names.push_back(base + IndexFileNames::TERMS_INDEX_EXTENSION);
+        names.push_back(base + IndexFileNames::FREQ_EXTENSION);
+        names.push_back(base + IndexFileNames::PROX_EXTENSION);
+        break;
+      case STORED_FIELDS:
+      case TERM_VECTORS:
+        if (info->getDocStoreOffset() != -1) {
+          base = info->getDocStoreSegment() + ".";
+          dir = reader->storeCFSReader != NULL ? (Directory*)reader->storeCFSReader : info->dir;
+        }
+        if (part == STORED_FIELDS) {
+          names.push_back(base + IndexFileNames::FIELDS_EXTENSION);
+          names.push_back(base + IndexFileNames::FIELDS_INDEX_EXTENSION);
+        } else {
+          names.push_back(base + IndexFileNames::VECTORS_INDEX_EXTENSION);
+          names.push_back(base + IndexFileNames::VECTORS_DOCUMENTS_EXTENSION);
+          names.push_back(base + IndexFileNames::VECTORS_FIELDS_EXTENSION);
+        }
+        break;
+      default:
+        break;
+    }
+    for (size_t i = 0; i < names.size(); i++)
+      addFile(partStatus, dir, names[i]);
+  }
+
+  static void addFile(PartStatus& partStatus, Directory* dir, const std::string& name) {
+    if (!dir->fileExists(name.c_str()))
+      return;
+    partStatus.files.push_back(name);
+    partStatus.bytes += dir->fileLength(name.c_str());
+  }
+};
+
+CheckIndex::CheckIndex(Directory* dir):
+  directory(_CL_POINTER(dir)), infoStream(NULL), threadCount(4)
+{
+}
+CheckIndex::~CheckIndex(){
+  _CLDECDELETE(directory);
+}
+
+void CheckIndex::setInfoStream(std::ostream* out){
+  infoStream = out;
+}
+void CheckIndex::setThreadCount(int32_t count){
+  if (count < 1)
+    _CLTHROWA(CL_ERR_IllegalArgument, "threadCount must be at least 1");
+  threadCount = count;
+}
+int32_t CheckIndex::getThreadCount() const{
+  return threadCount;
+}
+
+void CheckIndex::message(const std::string& msg){
+  if (infoStream != NULL)
+    (*infoStream) << msg << std::string("\n");
+}
+
+static std::string formatDouble(double value){
+  char buf[32];
+  cl_sprintf(buf, 32, "%.3f", value);
+  return buf;
+}
+
+static std::string testResult(const CheckIndex::SegmentStatus& status, const char* test, const std::string& ok){
+  std::string line = std::string("    ") + test;
+  line.append(cl_max(3, (int)(30 - line.length())), '.');
+  for (size_t i = 0; i < status.errors.size(); i++) {
+    if (status.errors[i].compare(0, strlen(test), test) == 0)
+      return line + status.errors[i].substr(strlen(test) + 1);
+  }
+  return line + (ok.empty() ? "OK" : "OK " + ok);
+}
+
+void CheckIndex::report(const SegmentStatus& status, bool opened, int32_t i, int32_t numSegments){
+  if (infoStream == NULL)
+    return;
+  message("  " + Misc::toString(i + 1) + " of " + Misc::toString(numSegments) + ": name=" +
+    status.name + " docCount=" + Misc::toString(status.docCount));
+  message(std::string("    compound=") + (status.compound ? "true" : "false"));
+  message("    numFiles=" + Misc::toString(status.numFiles));
+  message("    size (MB)=" + formatDouble(status.sizeMB));
+  if (status.docStoreOffset != -1)
+    message("    docStoreOffset=" + Misc::toString(status.docStoreOffset) +
+      " docStoreSegment=" + status.docStoreSegment);
+  if (status.hasDeletions)
+    message("    has deletions [delFileName=" + status.deletionsFileName + "]");
+  else
+    message("    no deletions");
+
+  for (size_t j = 0; j < status.errors.size(); j++) {
+    if (status.errors[j].compare(0, 5, "test:") != 0)
+      message("    " + status.errors[j]);
+  }
+  if (!opened) {
+    if (!status.errors.empty() && status.errors.back().compare(0, 5, "test:") == 0)
+      message("    " + status.errors.back());
+  } else {
+    message(testResult(status, TEST_OPEN_READER, ""));
+    message(testResult(status, TEST_DELETIONS, "[" + Misc::toString(status.numDeleted) + " deleted docs]"));
+    message(testResult(status, TEST_NORMS, "[" + Misc::toString(status.numFields) + " fields, " +
+      Misc::toString(status.normCount) + " with norms]"));
+    message(testResult(status, TEST_POSTINGS, "[" + Misc::toString(status.termCount) + " terms; " +
+      Misc::toString(status.totFreq) + " terms/docs pairs; " + Misc::toString(status.totPos) + " tokens]"));
+    message(testResult(status, TEST_STORED_FIELDS, "[" + Misc::toString(status.storedFieldCount) +
+      " total field count]"));
+    message(testResult(status, TEST_TERM_VECTORS, "[" + Misc::toString(status.termVectorCount) +
+      " total vector count]"));
+  }
+
+  for (size_t j = 0; j < status.parts.size(); j++) {
+    const PartStatus& part = status.parts[j];
+    std::string files;
+    for (size_t f = 0; f < part.files.size(); f++)
+      files += (f == 0 ? "" : ", ") + part.files[f];
+    std::string line = "    " + part.test + " read " + files + ": " + Misc::toString(part.bytes) +
+      " bytes in " + Misc::toString(part.millis) + " ms of thread time";
+    if (part.millis > 0)
+      line += " (" + formatDouble((part.bytes / 1048576.0) / (part.millis / 1000.0)) + " MB/sec)";
+    message(line);
+  }
+  if (!status.errors.empty())
+    message("    FAILED: the " + Misc::toString(status.docCount) +
+      " documents of this segment would be lost by fixIndex");
+}
+
+CheckIndex::Status* CheckIndex::checkIndex(const std::vector<std::string>* onlySegments){
+  Status* result = _CLNEW Status();
+  SegmentInfos* sis = _CLNEW SegmentInfos();
+  try {
+    sis->read(directory);
+  } catch (CLuceneError& err) {
+    message(std::string("ERROR: could not read any segments file in directory: ") + err.what());
+    result->missingSegments = true;
+    _CLDELETE(sis);
+    return result;
+  }
+  result->segmentsFileName = sis->getCurrentSegmentFileName();
+  result->numSegments = sis->size();
+  message("Segments file=" + result->segmentsFileName + " numSegments=" + Misc::toString(result->numSegments));
+
+  // the segments to check, in the order of the index
+  std::vector<int32_t> checked;
+  for (int32_t i = 0; i < sis->size(); i++) {
+    if (onlySegments != NULL) {
+      bool found = false;
+      for (size_t j = 0; j < onlySegments->size() && !found; j++)
+        found = (*onlySegments)[j] == sis->info(i)->name;
+      if (!found)
+        continue;
+    }
+    checked.push_back(i);
+  }
+  if (onlySegments != NULL) {
+    result->partial = true;
+    message("Checking only " + Misc::toString((int32_t)checked.size()) + " of the segments");
+  }
+
+  result->segments.resize(checked.size());
+  std::vector<Tasks::Segment> segments(checked.size());
+  Tasks tasks;
+  for (size_t k = 0; k < checked.size(); k++) {
+    SegmentInfo* info = sis->info(checked[k]);
+    SegmentStatus& status = result->segments[k];
+    Tasks::Segment& segment = segments[k];
+    segment.info = info;
+    segment.reader = NULL;
+    segment.status = &status;
+    for (int32_t p = 0; p < Tasks::NUM_PARTS; p++)
+      segment.millis[p] = 0;
+
+    status.name = info->name;
+    status.docCount = info->docCount;
+    status.compound = info->getUseCompoundFile();
+    status.docStoreOffset = info->getDocStoreOffset();
+    if (status.docStoreOffset != -1)
+      status.docStoreSegment = info->getDocStoreSegment();
+    status.hasDeletions = info->hasDeletions();
+    if (status.hasDeletions)
+      status.deletionsFileName = info->getDelFileName();
+
+    try {
+      const std::vector<std::string>& files = info->files();
+      status.numFiles = (int32_t)files.size();
+      for (size_t i = 0; i < files.size(); i++) {
+        if (!info->dir->fileExists(files[i].c_str()))
+          status.errors.push_back("ERROR: file " + files[i] + " does not exist");
+      }
+      if (status.errors.empty())
+        status.sizeMB = info->sizeInBytes() / 1048576.0;
+    } catch (CLuceneError& err) {
+      status.errors.push_back(std::string("ERROR: could not list the files: ") + err.what());
+    }
+    if (!status.errors.empty())
+      continue;
+
+    try {
+      segment.reader = SegmentReader::get(info, true);
+      if (segment.reader->maxDoc() != info->docCount)
+        status.errors.push_back(std::string(TEST_OPEN_READER) + " FAILED: maxDoc " +
+          Misc::toString(segment.reader->maxDoc()) + " differs from docCount " + Misc::toString(info->docCount));
+    } catch (CLuceneError& err) {
+      status.errors.push_back(std::string(TEST_OPEN_READER) + " FAILED: " + err.what());
+      continue;
+    }
+
+    tasks.add(Tasks::DELETIONS, &segment);
+    tasks.add(Tasks::NORMS, &segment);
+    FieldInfos* fieldInfos = segment.reader->getFieldInfos();
+    status.numFields = (int32_t)fieldInfos->size();
+    for (size_t i = 0; i < fieldInfos->size(); i++) {
+      FieldInfo* fi = fieldInfos->fieldInfo(i);
+      if (fi->isIndexed)
+        tasks.add(Tasks::POSTINGS, &segment, fi->name);
+    }
+    tasks.add(Tasks::STORED_FIELDS, &segment);
+    if (fieldInfos->hasVectors())
+      tasks.add(Tasks::TERM_VECTORS, &segment);
+  }
+
+  // the big fields of a segment and the big segments take longest, so they
+  // are spread over the threads by handing out the tasks one at a time
+#ifndef _CL_DISABLE_MULTITHREADING
+  if (threadCount > 1 && tasks.tasks.size() > 1) {
+    // this thread checks as well
+    ValueArray<_LUCENE_THREADID_TYPE> threads(cl_min((size_t)threadCount, tasks.tasks.size()) - 1);
+    for (size_t i = 0; i < threads.length; i++)
+      threads.values[i] = _LUCENE_THREAD_CREATE(&Tasks::worker, &tasks);
+    tasks.run();
+    for (size_t i = 0; i < threads.length; i++)
+      _LUCENE_THREAD_JOIN(threads[i]);
+  } else
+#endif
+    tasks.run();
+
+  std::set<std::string> bad;
+  for (size_t k = 0; k < segments.size(); k++) {
+    Tasks::Segment& segment = segments[k];
+    SegmentStatus& status = result->segments[k];
+    bool opened = segment.reader != NULL;
+    if (opened) {
+      for (int32_t p = 0; p < Tasks::NUM_PARTS; p++)
+        Tasks::addFiles(&segment, (Tasks::Part)p);
+      try {
+        segment.reader->close();
+      } catch (CLuceneError& err) {
+        status.errors.push_back(std::string("ERROR: could not close the reader: ") + err.what());
+      }
+      _CLDELETE(segment.reader);
+    }
+    if (!status.errors.empty()) {
+      result->numBadSegments++;
+      result->totLoseDocCount += status.docCount;
+      bad.insert(status.name);
+    }
+    report(status, opened, checked[k], result->numSegments);
+  }
+
+  // the segments that were read keep their generation and counter, so
+  // they are written as the next segments_N
+  for (int32_t i = sis->size() - 1; i >= 0; i--) {
+    if (bad.find(sis->info(i)->name) != bad.end())
+      sis->remove(i);
+  }
+  result->newSegments = sis;
+
+  result->clean = result->numBadSegments == 0;
+  if (result->clean) {
+    message("No problems were detected with this index.");
+  } else {
+    message("WARNING: " + Misc::toString(result->numBadSegments) + " broken segments (containing " +
+      Misc::toString(result->totLoseDocCount) + " documents) detected");
+  }
+  return result;
+}
+
+void CheckIndex::fixIndex(Status* result){
+  if (result->partial)
+    _CLTHROWA(CL_ERR_IllegalArgument, "can only fix an index that was fully checked");
+  if (result->missingSegments || result->newSegments == NULL)
+    _CLTHROWA(CL_ERR_IllegalArgument, "no segments file was read, there is nothing to fix");
+  result->newSegments->write(directory);
+
+  std::vector<std::string> names;
+  names.push_back(result->newSegments->getCurrentSegmentFileName());
+  directory->sync(names);
+  message("Wrote new segments file \"" + names[0] + "\"");
+}
+
+CL_NS_END
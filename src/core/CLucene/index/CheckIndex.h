@@ -0,0 +1,153 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_index_CheckIndex_
+#define _lucene_index_CheckIndex_
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+CL_CLASS_DEF(store,Directory)
+
+CL_NS_DEF(index)
+class SegmentInfos;
+
+/**
+* Checks the health of an index, and can write a new segments file that
+* leaves out the segments that are broken.
+*
+* <p>Every segment is opened and then read completely: its deletions, the
+* norms of its fields, its stored fields and term vectors, and the postings
+* of every term, which are compared with the term dictionary. The skip data
+* of every term is checked by skipping to documents that reading the
+* postings found. The parts of a segment, and the postings of every field,
+* are read by a pool of threads, so that large indexes with many segments
+* and fields are checked in a fraction of the time. For every part, the
+* files it read and the bytes read per second of thread time are reported.
+*
+* <p>The index must not be changed while it is checked.
+*
+* <p><b>WARNING</b>: {@link #fixIndex} removes the documents of the broken
+* segments from the index for good. Make a backup copy of the index first,
+* and make sure no IndexWriter is open on it.
+*/
+class CLUCENE_EXPORT CheckIndex: LUCENE_BASE {
+public:
+	/** The files that a part of a segment was read from, and how long it took */
+	struct PartStatus {
+		/** the test that read the part, for example "test: stored fields" */
+		std::string test;
+		std::vector<std::string> files;
+		/** the total length of the files */
+		int64_t bytes;
+		/** the time the checking threads spent on the part, summed over its
+		* tasks. The files of a part are read together, so there is no time
+		* per file. With several threads this may exceed the elapsed time. */
+		int64_t millis;
+	};
+
+	/** The result of checking a single segment */
+	struct SegmentStatus {
+		std::string name;
+		int32_t docCount;
+		bool compound;
+		int32_t numFiles;
+		double sizeMB;
+		/** -1 if the segment has its own stored fields and term vectors */
+		int32_t docStoreOffset;
+		std::string docStoreSegment;
+		bool hasDeletions;
+		std::string deletionsFileName;
+		int32_t numDeleted;
+		int32_t numFields;
+		int32_t normCount;
+		int64_t termCount;
+		/** the number of term and document pairs */
+		int64_t totFreq;
+		int64_t totPos;
+		int64_t storedFieldCount;
+		int64_t termVectorCount;
+		std::vector<PartStatus> parts;
+		/** the problems that were found, empty if the segment is intact */
+		std::vector<std::string> errors;
+
+		SegmentStatus();
+	};
+
+	/** The result of checking an index */
+	class CLUCENE_EXPORT Status: LUCENE_BASE {
+	public:
+		/** true if no problems were found */
+		bool clean;
+		/** true if no segments file could be read */
+		bool missingSegments;
+		/** true if only some of the segments were checked */
+		bool partial;
+		std::string segmentsFileName;
+		int32_t numSegments;
+		int32_t numBadSegments;
+		/** the number of documents that {@link #fixIndex} would remove */
+		int32_t totLoseDocCount;
+		std::vector<SegmentStatus> segments;
+		/** the segments that {@link #fixIndex} writes, without the broken ones */
+		SegmentInfos* newSegments;
+
+		Status();
+		~Status();
+	};
+
+private:
+	class Tasks;
+	friend class Tasks;
+
+	CL_NS(store)::Directory* directory;
+	std::ostream* infoStream;
+	int32_t threadCount;
+
+	void message(const std::string& msg);
+	void report(const SegmentStatus& status, bool opened, int32_t i, int32_t numSegments);
+
+public:
+	CheckIndex(CL_NS(store)::Directory* dir);
+	~CheckIndex();
+
+	/** Sets the stream that the progress and the problems are printed to, or NULL */
+	void setInfoStream(std::ostream* out);
+
+	/**
+	* Sets the number of threads that read the segments. The default is 4,
+	* 1 checks the index in the calling thread only.
+	*/
+	void setThreadCount(int32_t count);
+	int32_t getThreadCount() const;
+
+	/**
+	* Checks the index, or the named segments only.
+	*
+	* <p>The documents of a segment that fails a check are lost when
+	* {@link #fixIndex} is called, even if the other checks of the segment
+	* pass.
+	*
+	* @param onlySegments the names of the segments to check, NULL to
+	*  check all of them
+	* @return the status of the index, which the caller deletes
+	*/
+	Status* checkIndex(const std::vector<std::string>* onlySegments = NULL);
+
+	/**
+	* Writes a new segments file that leaves out the broken segments found
+	* by {@link #checkIndex}, so that the index can be opened again. The
+	* documents of the broken segments are lost.
+	*
+	* @throws CLuceneError (CL_ERR_IllegalArgument) if not every segment was
+	*  checked, or no segments file could be read
+	*/
+	void fixIndex(Status* result);
+};
+
+CL_NS_END
+#endif
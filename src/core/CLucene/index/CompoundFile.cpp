@@ -379,12 +379,10 @@ void CompoundFileWriter::close(){
       // Open the files and copy their data into the stream.
       // Remember the locations of each file's data section.
       { //msvc6 for scope fix
-      const int32_t bufferLength = 16384;
-		  uint8_t buffer[bufferLength];
 		  for ( CL_NS(util)::CLLinkedList<WriterFileEntry*>::iterator i=_internal->entries->begin();i!=_internal->entries->end();i++ ){
 			  WriterFileEntry* fe = *i;
 			  fe->dataOffset = os->getFilePointer();
-			  copyFile(fe, os, buffer, bufferLength);
+			  copyFile(fe, os);
 		  }
 	  }
 
@@ -405,35 +403,28 @@ void CompoundFileWriter::close(){
 }
 
 
-void CompoundFileWriter::copyFile(WriterFileEntry* source, IndexOutput* os, uint8_t* buffer, int32_t bufferLength){
+void CompoundFileWriter::copyFile(WriterFileEntry* source, IndexOutput* os){
   IndexInput* is = NULL;
+  CLuceneError err;
+  if ( !_internal->directory->openMergeInput(source->file, is, err) )
+    throw err;
   try {
       int64_t startPtr = os->getFilePointer();
-
-      is = _internal->directory->openInput(source->file);
       int64_t length = is->length();
       int64_t remainder = length;
-      int32_t chunk = bufferLength;
 
+      // copyBytes copies in the kernel where it can, so the chunks
+      // only bound how long we go without checking for an abort
+      const int64_t chunk = 2*1024*1024;
       while(remainder > 0) {
-          int32_t len = (int32_t)cl_min((int64_t)chunk, remainder);
-          is->readBytes(buffer, len);
-          os->writeBytes(buffer, len);
+          const int64_t len = cl_min(chunk, remainder);
+          os->copyBytes(is, len);
           remainder -= len;
 
           if (_internal->checkAbort != NULL)
-            // Roughly every 2 MB we will check if
-            // it's time to abort
-            _internal->checkAbort->work(80);
-      }
-
-      // Verify that remainder is 0
-      if (remainder != 0){
-         TCHAR buf[CL_MAX_PATH+100];
-         _sntprintf(buf,CL_MAX_PATH+100,_T("Non-zero remainder length after copying")
-            _T(": %d (id: %s, length: %d, buffer size: %d)"),
-            (int)remainder,source->file,(int)length,(int)chunk );
-		    _CLTHROWT(CL_ERR_IO,buf);
+            // The same work as copying the chunk in 16 KB
+            // pieces, 80 units each
+            _internal->checkAbort->work(80 * (float_t)((len + 16383) / 16384));
       }
 
       // Verify that the output length diff is equal to original file
@@ -446,10 +437,8 @@ void CompoundFileWriter::copyFile(WriterFileEntry* source, IndexOutput* os, uint
          _CLTHROWT(CL_ERR_IO,buf);
       }
   } _CLFINALLY (
-     if (is != NULL){
-        is->close();
-        _CLDELETE(is);
-     }
+      is->close();
+      _CLDELETE(is);
   );
 }
 
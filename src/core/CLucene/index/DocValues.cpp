@@ -0,0 +1,384 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "CLucene/_ApiHeader.h"
+#include "_DocValues.h"
+#include "_FieldInfos.h"
+#include "IndexReader.h"
+#include "CLucene/store/Directory.h"
+#include "CLucene/store/IndexInput.h"
+#include "CLucene/store/IndexOutput.h"
+
+CL_NS_USE(store)
+CL_NS_USE(util)
+CL_NS_DEF(index)
+
+DocValues::~DocValues(){
+}
+
+
+const uint8_t DocValuesFormat::HEADER[] = {'D','V','S', (uint8_t)-1};
+const int DocValuesFormat::HEADER_length = 4;
+
+void DocValuesFormat::writeColumn(IndexOutput* out, const int64_t* values, const int32_t count){
+  int64_t minValue = count > 0 ? values[0] : 0;
+  int64_t maxValue = minValue;
+  for ( int32_t i=1;i<count;i++ ){
+    if ( values[i] < minValue ) minValue = values[i];
+    else if ( values[i] > maxValue ) maxValue = values[i];
+  }
+  const uint64_t range = (uint64_t)maxValue - (uint64_t)minValue;
+  int32_t width;
+  if ( range == 0 ) width = 0;
+  else if ( range <= 0xFF ) width = 1;
+  else if ( range <= 0xFFFF ) width = 2;
+  else if ( range <= 0xFFFFFFFFULL ) width = 4;
+  else width = 8;
+
+  out->writeLong(minValue);
+  out->writeByte((uint8_t)width);
+  if ( width == 0 )
+    return;
+
+  uint8_t buffer[1024];
+  int32_t upto = 0;
+  for ( int32_t i=0;i<count;i++ ){
+    uint64_t v = (uint64_t)values[i] - (uint64_t)minValue;
+    for ( int32_t b=width-1;b>=0;b-- ){
+      buffer[upto+b] = (uint8_t)v;
+      v >>= 8;
+    }
+    upto += width;
+    if ( upto == sizeof(buffer) ){
+      out->writeBytes(buffer, upto);
+      upto = 0;
+    }
+  }
+  if ( upto > 0 )
+    out->writeBytes(buffer, upto);
+}
+
+
+DocValuesBuffer::DocValuesBuffer(DocValues::Type _type):
+  type(_type)
+{
+}
+int32_t DocValuesBuffer::size() const{
+  return (int32_t)ints.size();
+}
+void DocValuesBuffer::addInt(const int64_t value){
+  ints.push_back(value);
+}
+void DocValuesBuffer::addBytes(const uint8_t* value, const int32_t length){
+  bytes.insert(bytes.end(), value, value + length);
+  ints.push_back((int64_t)bytes.size());
+}
+void DocValuesBuffer::fill(const int32_t docs){
+  if ( (int32_t)ints.size() < docs )
+    ints.resize(docs, type == DocValues::INTS ? 0 : (int64_t)bytes.size());
+}
+void DocValuesBuffer::write(IndexOutput* out, const int32_t fieldNumber, const int32_t docs){
+  fill(docs);
+  out->writeVInt(fieldNumber);
+  out->writeByte((uint8_t)type);
+  if ( type == DocValues::INTS ){
+    DocValuesFormat::writeColumn(out, docs > 0 ? &ints[0] : NULL, docs);
+  }else{
+    ints.insert(ints.begin(), 0);
+    DocValuesFormat::writeColumn(out, &ints[0], docs + 1);
+    out->writeVLong((int64_t)bytes.size());
+    if ( bytes.size() > 0 )
+      out->writeBytes(&bytes[0], (int32_t)bytes.size());
+  }
+}
+void DocValuesBuffer::reset(){
+  ints.clear();
+  bytes.clear();
+}
+
+
+/** Reads the fixed width values of a column, from RAM or from the file */
+class SegmentDocValues::Column {
+  int64_t minValue;
+  int32_t width;
+  uint8_t* values;          // NULL if read from the file
+  IndexInput* in;
+  int64_t start;
+  DEFINE_MUTEX(THIS_LOCK)
+
+  static int64_t decode(const uint8_t* b, const int32_t width){
+    uint64_t v = 0;
+    for ( int32_t i=0;i<width;i++ )
+      v = (v << 8) | b[i];
+    return (int64_t)v;
+  }
+public:
+  /** Reads the column header at the current position of input, and skips
+  * the count values */
+  Column(IndexInput* input, const int64_t count, const bool inRAM):
+    values(NULL),
+    in(NULL)
+  {
+    minValue = input->readLong();
+    width = input->readByte();
+    start = input->getFilePointer();
+    if ( width == 0 )
+      return;
+    if ( inRAM ){
+      values = _CL_NEWARRAY(uint8_t, (size_t)(count * width));
+      input->readBytes(values, (int32_t)(count * width));
+    }else{
+      in = input->clone();
+      input->seek(start + count * width);
+    }
+  }
+  ~Column(){
+    _CLDELETE_ARRAY(values);
+    if ( in != NULL ){
+      in->close();
+      _CLDELETE(in);
+    }
+  }
+  /** Skips the column at the current position of input */
+  static void skip(IndexInput* input, const int64_t count){
+    input->readLong();
+    const int32_t width = input->readByte();
+    input->seek(input->getFilePointer() + count * width);
+  }
+
+  int64_t get(const int64_t i){
+    if ( width == 0 )
+      return minValue;
+    uint64_t v;
+    if ( values != NULL ){
+      v = decode(values + i * width, width);
+    }else{
+      uint8_t b[8];
+      SCOPED_LOCK_MUTEX(THIS_LOCK)
+      in->seek(start + i * width);
+      in->readBytes(b, width);
+      v = decode(b, width);
+    }
+    return (int64_t)((uint64_t)minValue + v);
+  }
+};
+
+class SegmentDocValues::Ints: public DocValues {
+  const int32_t maxDoc;
+  Column column;
+public:
+  Ints(IndexInput* input, const int32_t _maxDoc, const bool inRAM):
+    maxDoc(_maxDoc),
+    column(input, _maxDoc, inRAM)
+  {
+  }
+  Type getType() const{ return INTS; }
+  int32_t size() const{ return maxDoc; }
+  int64_t getInt(const int32_t doc){
+    return column.get(doc);
+  }
+  int32_t getBytes(const int32_t /*doc*/, ValueArray<uint8_t>& /*buffer*/){
+    _CLTHROWA(CL_ERR_UnsupportedOperation, "the doc values are integers");
+  }
+};
+
+class SegmentDocValues::Bytes: public DocValues {
+  const int32_t maxDoc;
+  Column offsets;
+  uint8_t* data;            // NULL if read from the file
+  IndexInput* in;
+  int64_t start;
+  DEFINE_MUTEX(THIS_LOCK)
+public:
+  Bytes(IndexInput* input, const int32_t _maxDoc, const bool inRAM):
+    maxDoc(_maxDoc),
+    offsets(input, _maxDoc + 1, inRAM),
+    data(NULL),
+    in(NULL)
+  {
+    const int64_t length = input->readVLong();
+    start = input->getFilePointer();
+    if ( inRAM ){
+      data = _CL_NEWARRAY(uint8_t, (size_t)cl_max(length, (int64_t)1));
+      input->readBytes(data, (int32_t)length);
+    }else{
+      in = input->clone();
+    }
+  }
+  ~Bytes(){
+    _CLDELETE_ARRAY(data);
+    if ( in != NULL ){
+      in->close();
+      _CLDELETE(in);
+    }
+  }
+  Type getType() const{ return BYTES; }
+  int32_t size() const{ return maxDoc; }
+  int64_t getInt(const int32_t /*doc*/){
+    _CLTHROWA(CL_ERR_UnsupportedOperation, "the doc values are bytes");
+  }
+  int32_t getBytes(const int32_t doc, ValueArray<uint8_t>& buffer){
+    const int64_t from = offsets.get(doc);
+    const int32_t length = (int32_t)(offsets.get(doc + 1) - from);
+    if ( buffer.length < (size_t)length )
+      buffer.resize(length);
+    if ( length == 0 )
+      return 0;
+    if ( data != NULL ){
+      memcpy(buffer.values, data + from, length);
+    }else{
+      SCOPED_LOCK_MUTEX(THIS_LOCK)
+      in->seek(start + from);
+      in->readBytes(buffer.values, length);
+    }
+    return length;
+  }
+};
+
+SegmentDocValues::Entry::Entry(DocValues::Type _type, int64_t _pointer):
+  type(_type),
+  pointer(_pointer),
+  inRAM(NULL),
+  direct(NULL)
+{
+}
+SegmentDocValues::Entry::~Entry(){
+  _CLDELETE(inRAM);
+  _CLDELETE(direct);
+}
+
+SegmentDocValues::SegmentDocValues(Directory* dir, const char* fileName, FieldInfos* fieldInfos,
+    const int32_t _maxDoc, const int32_t readBufferSize):
+  input(NULL),
+  maxDoc(_maxDoc),
+  entries(true, true)
+{
+  input = dir->openInput(fileName, readBufferSize);
+  try{
+    uint8_t header[4];
+    input->readBytes(header, DocValuesFormat::HEADER_length);
+    if ( memcmp(header, DocValuesFormat::HEADER, DocValuesFormat::HEADER_length) != 0 )
+      _CLTHROWA(CL_ERR_CorruptIndex, "doc values file has an invalid header");
+
+    const int32_t fieldCount = input->readVInt();
+    for ( int32_t i=0;i<fieldCount;i++ ){
+      FieldInfo* fi = fieldInfos->fieldInfo(input->readVInt());
+      const DocValues::Type type = (DocValues::Type)input->readByte();
+      if ( fi == NULL || (type != DocValues::INTS && type != DocValues::BYTES) )
+        _CLTHROWA(CL_ERR_CorruptIndex, "doc values file has an invalid field");
+
+      entries.put(STRDUP_TtoT(fi->name), _CLNEW Entry(type, input->getFilePointer()));
+      if ( type == DocValues::INTS ){
+        Column::skip(input, maxDoc);
+      }else{
+        Column::skip(input, maxDoc + 1);
+        const int64_t length = input->readVLong();
+        input->seek(input->getFilePointer() + length);
+      }
+    }
+  }catch(...){
+    close();
+    throw;
+  }
+}
+
+SegmentDocValues::~SegmentDocValues(){
+  close();
+}
+
+void SegmentDocValues::close(){
+  SCOPED_LOCK_MUTEX(THIS_LOCK)
+  entries.clear();
+  if ( input != NULL ){
+    input->close();
+    _CLDELETE(input);
+  }
+}
+
+DocValues* SegmentDocValues::get(const TCHAR* field, const bool inRAM){
+  SCOPED_LOCK_MUTEX(THIS_LOCK)
+  Entry* entry = entries.get((TCHAR*)field);
+  if ( entry == NULL )
+    return NULL;
+
+  DocValues*& values = inRAM ? entry->inRAM : entry->direct;
+  if ( values == NULL ){
+    input->seek(entry->pointer);
+    if ( entry->type == DocValues::INTS )
+      values = _CLNEW Ints(input, maxDoc, inRAM);
+    else
+      values = _CLNEW Bytes(input, maxDoc, inRAM);
+  }
+  return values;
+}
+
+
+MultiDocValues::MultiDocValues(Type _type, int32_t _maxDoc, int32_t numSubs):
+  type(_type),
+  maxDoc(_maxDoc),
+  subs(numSubs),
+  starts(numSubs + 1)
+{
+}
+MultiDocValues::~MultiDocValues(){
+  //the values of the sub readers belong to them
+}
+
+MultiDocValues* MultiDocValues::create(ArrayBase<IndexReader*>* subReaders, const int32_t* starts,
+    const int32_t maxDoc, const TCHAR* field, const bool inRAM){
+  MultiDocValues* ret = NULL;
+  for ( size_t i=0;i<subReaders->length;i++ ){
+    DocValues* sub = (*subReaders)[i]->getDocValues(field, inRAM);
+    if ( sub == NULL )
+      continue;
+    if ( ret == NULL ){
+      ret = _CLNEW MultiDocValues(sub->getType(), maxDoc, (int32_t)subReaders->length);
+      for ( size_t j=0;j<subReaders->length;j++ )
+        ret->starts.values[j] = starts[j];
+      ret->starts.values[subReaders->length] = maxDoc;
+    }
+    if ( sub->getType() == ret->type )
+      ret->subs.values[i] = sub;
+  }
+  return ret;
+}
+
+int32_t MultiDocValues::subIndex(const int32_t doc) const{
+  int32_t lo = 0;
+  int32_t hi = (int32_t)subs.length - 1;
+  while ( hi >= lo ){
+    const int32_t mid = (lo + hi) >> 1;
+    const int32_t midValue = starts[mid];
+    if ( doc < midValue )
+      hi = mid - 1;
+    else if ( doc > midValue )
+      lo = mid + 1;
+    else{
+      //skip empty sub readers
+      int32_t ret = mid;
+      while ( ret + 1 < (int32_t)subs.length && starts[ret + 1] == midValue )
+        ret++;
+      return ret;
+    }
+  }
+  return hi;
+}
+
+DocValues::Type MultiDocValues::getType() const{ return type; }
+int32_t MultiDocValues::size() const{ return maxDoc; }
+
+int64_t MultiDocValues::getInt(const int32_t doc){
+  const int32_t i = subIndex(doc);
+  DocValues* sub = subs[i];
+  return sub == NULL ? 0 : sub->getInt(doc - starts[i]);
+}
+int32_t MultiDocValues::getBytes(const int32_t doc, ValueArray<uint8_t>& buffer){
+  const int32_t i = subIndex(doc);
+  DocValues* sub = subs[i];
+  return sub == NULL ? 0 : sub->getBytes(doc - starts[i], buffer);
+}
+
+CL_NS_END
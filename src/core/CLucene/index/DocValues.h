@@ -0,0 +1,51 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_index_DocValues_
+#define _lucene_index_DocValues_
+
+#include "CLucene/util/Array.h"
+
+CL_NS_DEF(index)
+
+/**
+* Random access to the per document values of a field, written at index
+* time for fields added with {@link Field#DOCVALUES_INTS} or
+* {@link Field#DOCVALUES_BYTES}. Unlike the FieldCache, reading the values
+* does not need to walk the terms and postings of the field.
+*
+* Documents that did not have a value read as 0, or as an empty value.
+*
+* @see IndexReader#getDocValues
+*/
+class CLUCENE_EXPORT DocValues: LUCENE_BASE {
+public:
+	enum Type{
+		/** Signed 64 bit integers, see {@link #getInt} */
+		INTS=1,
+		/** Variable length byte values, see {@link #getBytes} */
+		BYTES=2
+	};
+
+	virtual ~DocValues();
+
+	/** The type of the values */
+	virtual Type getType() const = 0;
+
+	/** The number of documents, equal to IndexReader::maxDoc() */
+	virtual int32_t size() const = 0;
+
+	/** Returns the value of document doc, for an INTS column */
+	virtual int64_t getInt(const int32_t doc) = 0;
+
+	/** Reads the value of document doc of a BYTES column into buffer,
+	* growing it if needed.
+	* @return the length of the value */
+	virtual int32_t getBytes(const int32_t doc, CL_NS(util)::ValueArray<uint8_t>& buffer) = 0;
+};
+
+CL_NS_END
+#endif
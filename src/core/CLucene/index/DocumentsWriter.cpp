@@ -33,6 +33,7 @@
 #include "_TermInfosWriter.h"
 #include "_FieldsWriter.h"
 #include "_DocumentsWriter.h"
+#include "_DocValues.h"
 #include <assert.h>
 #include <algorithm>
 #include <iostream>
@@ -89,7 +90,7 @@ DocumentsWriter::DocumentsWriter(CL_NS(store)::Directory* directory, IndexWriter
   numBytesUsed = 0;
   this->directory = directory;
   this->writer = writer;
-  this->hasNorms = this->bufferIsFull = false;
+  this->hasNorms = this->hasDocValues = this->bufferIsFull = false;
   fieldInfos = _CLNEW FieldInfos();
 
 	maxBufferedDeleteTerms = IndexWriter::DEFAULT_MAX_BUFFERED_DELETE_TERMS;
@@ -362,6 +363,12 @@ void DocumentsWriter::abort(AbortException* ae) {
         }
       }
 
+      // Discard pending doc values:
+      for (size_t i=0;i<docValues.length;i++) {
+        _CLDELETE(docValues.values[i]);
+      }
+      hasDocValues = false;
+
       // Reset all postings data
       resetPostingsData();
 
@@ -540,6 +547,35 @@ void DocumentsWriter::writeNorms(const std::string& segmentName, int32_t totalNu
   )
 }
 
+void DocumentsWriter::writeDocValues(const std::string& segmentName, int32_t totalNumDoc) {
+  IndexOutput* out = directory->createOutput( (segmentName + "." + IndexFileNames::DOCVALUES_EXTENSION).c_str() );
+
+  try {
+    out->writeBytes(DocValuesFormat::HEADER, DocValuesFormat::HEADER_length);
+
+    int32_t numFields = 0;
+    for (size_t i=0;i<docValues.length;i++) {
+      if (docValues[i] != NULL)
+        numFields++;
+    }
+    out->writeVInt(numFields);
+
+    // the buffers are dropped, so that the next segment only writes
+    // the fields its documents have values for
+    for (size_t i=0;i<docValues.length;i++) {
+      DocValuesBuffer* buffer = docValues[i];
+      if (buffer != NULL) {
+        buffer->write(out, (int32_t)i, totalNumDoc);
+        _CLDELETE(docValues.values[i]);
+      }
+    }
+  } _CLFINALLY (
+    out->close();
+    _CLDELETE(out);
+  )
+  hasDocValues = false;
+}
+
 void DocumentsWriter::writeSegment(std::vector<std::string>& flushedFiles) {
 
   assert ( allThreadsIdle() );
@@ -620,6 +656,11 @@ void DocumentsWriter::writeSegment(std::vector<std::string>& flushedFiles) {
     flushedFiles.push_back(segmentFileName(IndexFileNames::NORMS_EXTENSION));
   }
 
+  if (hasDocValues) {
+    writeDocValues(segmentName, numDocsInRAM);
+    flushedFiles.push_back(segmentFileName(IndexFileNames::DOCVALUES_EXTENSION));
+  }
+
   if (infoStream != NULL) {
     const int64_t newSegmentSize = segmentSize(segmentName);
 
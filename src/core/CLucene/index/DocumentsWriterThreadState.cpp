@@ -31,6 +31,7 @@
 #include "_TermInfosWriter.h"
 #include "_FieldsWriter.h"
 #include "_DocumentsWriter.h"
+#include "_DocValues.h"
 #include <assert.h>
 #include <iostream>
 
@@ -157,6 +158,21 @@ void DocumentsWriter::ThreadState::writeDocument() {
         bn->add(norm);
       }
     }
+
+    // Append doc values for the fields we saw:
+    for(int32_t i=0;i<numFieldData;i++) {
+      FieldData* fp = fieldDataArray[i];
+      if (fp->docValuesType != 0) {
+        DocValuesBuffer* buffer = _parent->docValues[fp->fieldInfo->number];
+        assert ( buffer != NULL );
+        assert ( buffer->size() <= docID );
+        buffer->fill(docID);
+        if (fp->docValuesType == Field::DOCVALUES_INTS)
+          buffer->addInt(fp->docValueInt);
+        else
+          buffer->addBytes(fp->docValueBytes.values, fp->docValueLength);
+      }
+    }
   } catch (CLuceneError& t) {
     // Forcefully idle this threadstate -- its state will
     // be reset by abort()
@@ -260,6 +276,7 @@ void DocumentsWriter::ThreadState::init(Document* doc, int32_t docID) {
       fp->fieldCount = 0;
       fp->doVectors = fp->doVectorPositions = fp->doVectorOffsets = false;
       fp->doNorms = fi->isIndexed && !fi->omitNorms;
+      fp->docValuesType = 0;
 
       if (numFieldData == fieldDataArray.length) {
         fieldDataArray.resize(fieldDataArray.length*2);
@@ -288,6 +305,9 @@ void DocumentsWriter::ThreadState::init(Document* doc, int32_t docID) {
     if (field->isIndexed() && fp->postingsHash.values == NULL)
       fp->initPostingArrays();
 
+    if (field->getDocValuesType() != 0)
+      fp->initDocValue(field);
+
     fp->docFields.values[fp->fieldCount++] = field;
   }
 
@@ -719,11 +739,68 @@ DocumentsWriter::ThreadState::FieldData::FieldData(DocumentsWriter* __parent, Th
   this->fieldInfo = fieldInfo;
   this->threadState = __threadState;
   this->postingsCompacted = false;
+  this->docValuesType = 0;
+  this->docValueInt = 0;
+  this->docValueLength = 0;
 }
 DocumentsWriter::ThreadState::FieldData::~FieldData(){
   _CLDELETE(vectorSliceReader);
   _CLDELETE(localToken);
 }
+void DocumentsWriter::ThreadState::FieldData::initDocValue(Field* field) {
+  // The value is copied now, since the document may be
+  // written after the caller has reused the field
+  const int32_t type = field->getDocValuesType();
+  const DocValues::Type valuesType = type == Field::DOCVALUES_INTS ? DocValues::INTS : DocValues::BYTES;
+
+  // Maybe grow our buffered doc values
+  if (_parent->docValues.length <= (size_t)fieldInfo->number) {
+    int32_t newSize = (int32_t) ((1+fieldInfo->number)*1.25);
+    _parent->docValues.resize(newSize);
+  }
+  DocValuesBuffer* buffer = _parent->docValues[fieldInfo->number];
+  if (buffer == NULL) {
+    buffer = _parent->docValues.values[fieldInfo->number] = _CLNEW DocValuesBuffer(valuesType);
+  } else if (buffer->type != valuesType) {
+    _CLTHROWA(CL_ERR_IllegalArgument, "field has doc values of another type in this segment");
+  }
+  if (docValuesType != 0)
+    _CLTHROWA(CL_ERR_IllegalArgument, "a document can only have one doc value per field");
+
+  if (type == Field::DOCVALUES_INTS) {
+    const TCHAR* value = field->stringValue();
+    if (value == NULL)
+      _CLTHROWA(CL_ERR_IllegalArgument, "DOCVALUES_INTS needs a string value");
+    docValueInt = _tcstoi64(value, NULL, 10);
+  } else if (field->isBinary()) {
+    const ValueArray<uint8_t>* value = field->binaryValue();
+    docValueLength = (int32_t)value->length;
+    if (docValueBytes.length < value->length)
+      docValueBytes.resize(value->length);
+    memcpy(docValueBytes.values, value->values, value->length);
+  } else {
+    const TCHAR* value = field->stringValue();
+    if (value == NULL)
+      _CLTHROWA(CL_ERR_IllegalArgument, "DOCVALUES_BYTES needs a string or binary value");
+    const size_t textLen = _tcslen(value);
+#ifdef _UCS2
+    const size_t needed = textLen * 6 + 1; //worst case utf8 length
+#else
+    const size_t needed = textLen + 1;
+#endif
+    if (docValueBytes.length < needed)
+      docValueBytes.resize(needed);
+#ifdef _UCS2
+    docValueLength = (int32_t)lucene_wcstoutf8((char*)docValueBytes.values, value, needed);
+#else
+    docValueLength = (int32_t)textLen;
+    memcpy(docValueBytes.values, value, textLen);
+#endif
+  }
+  docValuesType = type;
+  _parent->hasDocValues = true;
+}
+
 bool DocumentsWriter::ThreadState::FieldData::sort(FieldData* e1, FieldData* e2){
   return _tcscmp(e1->fieldInfo->name, e2->fieldInfo->name) < 0;
 }
@@ -449,6 +449,14 @@ bool IndexReader::hasNorms(const TCHAR* field) {
 	return norms(field) != NULL;
 }
 
+DocValues* IndexReader::getDocValues(const TCHAR* /*field*/, const bool /*inRAM*/){
+  return NULL;
+}
+
+const CL_NS(search)::SortField* IndexReader::getIndexSort(){
+  return NULL;
+}
+
 void IndexReader::unlock(const char* path){
 	FSDirectory* dir = FSDirectory::getDirectory(path);
 	unlock(dir);
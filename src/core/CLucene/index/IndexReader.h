@@ -16,6 +16,7 @@ CL_CLASS_DEF(store,Directory)
 CL_CLASS_DEF(store,LuceneLock)
 CL_CLASS_DEF(document,Document)
 CL_CLASS_DEF(document,FieldSelector)
+CL_CLASS_DEF(search,SortField)
 
 CL_NS_DEF(index)
 class SegmentInfos;
@@ -26,6 +27,7 @@ class TermDocs;
 class TermPositions;
 class IndexDeletionPolicy;
 class TermVectorMapper;
+class DocValues;
 
 /** IndexReader is an abstract class, providing an interface for accessing an
  index.  Search of an index is done entirely through this abstract interface,
@@ -523,6 +525,24 @@ public:
 	/** Returns true if there are norms stored for this field. */
 	virtual bool hasNorms(const TCHAR* field);
 
+	/** Returns the per document values written for field, if it was added
+	* with {@link Field#DOCVALUES_INTS} or {@link Field#DOCVALUES_BYTES}, or
+	* NULL if there are none. This implementation returns NULL.
+	*
+	* @param inRAM if true the values are loaded into memory the first time
+	* they are requested. Otherwise every access reads the index file, which
+	* with a memory mapped FSDirectory reads the mapped column in place.
+	* @memory The values belong to the reader and are valid until it is closed.
+	*/
+	virtual DocValues* getDocValues(const TCHAR* field, const bool inRAM=true);
+
+	/** Returns the sort the documents of this segment are ordered by, if
+	* it was written by an IndexWriter with an index sort, see
+	* {@link IndexWriter#setIndexSort}. Composite readers, and segments
+	* that were not sorted, return NULL. This implementation returns NULL.
+	*/
+	virtual const CL_NS(search)::SortField* getIndexSort();
+
 /** Returns an enumeration of all the terms in the index. The
   * enumeration is ordered by Term.compareTo(). Each term is greater
   * than all that precede it in the enumeration. Note that after
@@ -10,11 +10,14 @@
 #include "CLucene/document/Document.h"
 #include "CLucene/store/Directory.h"
 #include "CLucene/search/Similarity.h"
+#include "CLucene/search/Sort.h"
 #include "CLucene/util/Misc.h"
 
 #include "CLucene/store/_Lock.h"
 #include "CLucene/store/_RAMDirectory.h"
 #include "CLucene/store/FSDirectory.h"
+#include "CLucene/store/RateLimiter.h"
+#include "CLucene/store/_MergeDirectory.h"
 #include "CLucene/util/Array.h"
 #include "CLucene/util/PriorityQueue.h"
 #include "_DocumentsWriter.h"
@@ -31,6 +34,7 @@
 #include <assert.h>
 #include <algorithm>
 #include <iostream>
+#include <set>
 
 CL_NS_USE(store)
 CL_NS_USE(util)
@@ -58,6 +62,9 @@ const int32_t IndexWriter::MAX_TERM_LENGTH = DocumentsWriter::MAX_TERM_LENGTH;
 class IndexWriter::Internal{
 public:
   IndexWriter* _this;
+  // the files that were synced by a commit and are still referenced
+  std::set<std::string> syncedFiles;
+
   Internal(IndexWriter* _this){
     this->_this = _this;
   }
@@ -81,8 +88,11 @@ void IndexWriter::deinit(bool releaseWriteLock) throw() {
   _CLLDELETE(pendingMerges);
   _CLLDELETE(runningMerges);
   _CLLDELETE(mergeExceptions);
+  _CLLDELETE(expungeDeletesError);
   _CLLDELETE(segmentsToOptimize);
+  _CLLDELETE(indexSort);
   _CLLDELETE(mergeScheduler);
+  _CLLDELETE(mergeRateLimiter);
   _CLLDELETE(mergePolicy);
   _CLLDELETE(deleter);
   _CLLDELETE(docWriter);
@@ -183,11 +193,14 @@ void IndexWriter::init(Directory* d, Analyzer* a, const bool create, const bool
   this->_internal = new Internal(this);
   this->termIndexInterval = IndexWriter::DEFAULT_TERM_INDEX_INTERVAL;
   this->mergeScheduler = _CLNEW SerialMergeScheduler(); //TODO: implement and use ConcurrentMergeScheduler
+  this->mergeRateLimiter = _CLNEW RateLimiter();
   this->mergingSegments = _CLNEW MergingSegmentsType;
   this->pendingMerges = _CLNEW PendingMergesType;
   this->runningMerges = _CLNEW RunningMergesType;
   this->mergeExceptions = _CLNEW MergeExceptionsType;
+  this->expungeDeletesError = NULL;
   this->segmentsToOptimize = _CLNEW SegmentsToOptimizeType;
+  this->indexSort = NULL;
   this->mergePolicy = _CLNEW LogByteSizeMergePolicy();
   this->localRollbackSegmentInfos = NULL;
   this->stopMerges = false;
@@ -198,6 +211,9 @@ void IndexWriter::init(Directory* d, Analyzer* a, const bool create, const bool
   this->commitLockTimeout =0;
   this->closeDir = closeDir;
   this->commitPending = this->closed = this->closing = false;
+  this->syncPending = false;
+  this->commitRequests = this->commitsDone = 0;
+  this->committing = false;
   directory = d;
   analyzer = a;
   this->infoStream = defaultInfoStream;
@@ -243,9 +259,16 @@ void IndexWriter::init(Directory* d, Analyzer* a, const bool create, const bool
         if ( e.number() != CL_ERR_IO ) throw e;
         // Likely this means it's a fresh directory
       }
-      segmentInfos->write(directory);
+      writeSegmentInfos();
     } else {
       segmentInfos->read(directory);
+
+      // the files of the index were synced by the writer that committed it
+      for (int32_t i = 0; i < segmentInfos->size(); i++) {
+        SegmentInfo* info = segmentInfos->info(i);
+        if (info->dir == directory)
+          _internal->syncedFiles.insert(info->files().begin(), info->files().end());
+      }
     }
 
     this->autoCommit = autoCommit;
@@ -317,6 +340,41 @@ MergeScheduler* IndexWriter::getMergeScheduler() {
   return mergeScheduler;
 }
 
+RateLimiter* IndexWriter::getMergeRateLimiter() {
+  ensureOpen();
+  return mergeRateLimiter;
+}
+
+int32_t IndexWriter::numDeletedDocs(SegmentInfo* info) {
+  // the count is cached per deletions generation, so merge
+  // policies don't read the .del files on every findMerges
+  SCOPED_LOCK_MUTEX(THIS_LOCK)
+  return info->getDelCount();
+}
+
+bool IndexWriter::isMerging(SegmentInfo* info) {
+  SCOPED_LOCK_MUTEX(THIS_LOCK)
+  return mergingSegments->find(info) != mergingSegments->end();
+}
+
+void IndexWriter::setIndexSort(const CL_NS(search)::SortField* sort) {
+  ensureOpen();
+  if (sort != NULL && sort->getType() != CL_NS(search)::SortField::INT &&
+      sort->getType() != CL_NS(search)::SortField::FLOAT &&
+      sort->getType() != CL_NS(search)::SortField::STRING)
+    _CLTHROWA(CL_ERR_IllegalArgument, "index sort must be by an INT, FLOAT or STRING field");
+
+  SCOPED_LOCK_MUTEX(THIS_LOCK)
+  _CLLDELETE(indexSort);
+  if (sort != NULL)
+    indexSort = sort->clone();
+}
+
+const CL_NS(search)::SortField* IndexWriter::getIndexSort() {
+  ensureOpen();
+  return indexSort;
+}
+
 void IndexWriter::setMaxMergeDocs(int32_t maxMergeDocs) {
   getLogMergePolicy()->setMaxMergeDocs(maxMergeDocs);
 }
@@ -524,10 +582,10 @@ void IndexWriter::closeInternal(bool waitForMerges) {
     mergeScheduler->close();
 
     { SCOPED_LOCK_MUTEX(this->THIS_LOCK)
-      if (commitPending) {
+      if (commitPending || syncPending) {
         bool success = false;
         try {
-          segmentInfos->write(directory);         // now commit changes
+          writeSegmentInfos();         // now commit changes
           success = true;
         } _CLFINALLY (
           if (!success) {
@@ -580,7 +638,8 @@ void IndexWriter::closeInternal(bool waitForMerges) {
 bool IndexWriter::flushDocStores() {
 	SCOPED_LOCK_MUTEX(THIS_LOCK)
 
-  const std::vector<std::string>& files = docWriter->files();
+  // a copy, closeDocStore drops the list of the docWriter
+  const std::vector<std::string> files = docWriter->files();
 
   bool useCompoundDocStore = false;
 
@@ -880,6 +939,67 @@ void IndexWriter::optimize(int32_t maxNumSegments, bool doWait) {
   // background threads accomplish the optimization
 }
 
+void IndexWriter::expungeDeletes(bool doWait) {
+  ensureOpen();
+
+  if (infoStream != NULL)
+    message("expungeDeletes: index now " + segString());
+
+  // apply the buffered deletes
+  flush();
+
+  { SCOPED_LOCK_MUTEX(this->THIS_LOCK)
+    resetMergeExceptions();
+    _CLDELETE(expungeDeletesError);
+    MergePolicy::MergeSpecification* spec = mergePolicy->findMergesToExpungeDeletes(segmentInfos, this);
+    if (spec != NULL) {
+      const int32_t numMerges = spec->merges->size();
+      for(int32_t i=0;i<numMerges;i++) {
+        MergePolicy::OneMerge* _merge = (*spec->merges)[i];
+        // the merge is deleted once it is done, so it is
+        // flagged rather than remembered
+        _merge->expungeDeletes = true;
+        if (!registerMerge(_merge))
+          _CLLDELETE(_merge);
+      }
+    }
+    _CLDELETE(spec);
+  }
+
+  mergeScheduler->merge(this);
+
+  if (doWait) {
+    SCOPED_LOCK_MUTEX(this->THIS_LOCK)
+    while (expungeDeletesMergesPending())
+      CONDITION_WAIT(THIS_LOCK, THIS_WAIT_CONDITION);
+
+    // Forward an exception hit by one of our merges in a
+    // background merge thread to the current thread:
+    if (expungeDeletesError != NULL) {
+      CLuceneError err(*expungeDeletesError);
+      _CLDELETE(expungeDeletesError);
+      throw err;
+    }
+  }
+}
+
+bool IndexWriter::expungeDeletesMergesPending() {
+  SCOPED_LOCK_MUTEX(THIS_LOCK)
+  for(PendingMergesType::iterator it = pendingMerges->begin();
+      it != pendingMerges->end(); it++){
+    if ((*it)->expungeDeletes)
+      return true;
+  }
+
+  for(RunningMergesType::iterator it = runningMerges->begin();
+      it != runningMerges->end(); it++){
+    if ((*it)->expungeDeletes)
+      return true;
+  }
+
+  return false;
+}
+
 bool IndexWriter::optimizeMergesPending() {
 	SCOPED_LOCK_MUTEX(THIS_LOCK)
   for(PendingMergesType::iterator it = pendingMerges->begin();
@@ -946,6 +1066,39 @@ void IndexWriter::updatePendingMerges(int32_t maxNumSegmentsOptimize, bool optim
     }
   }
   _CLDELETE(spec);
+
+  if (indexSort != NULL)
+    registerSortMerges(maxNumSegmentsOptimize, optimize);
+}
+
+void IndexWriter::registerSortMerges(int32_t maxNumSegmentsOptimize, bool optimize){
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+
+  // Segments that were merged away are sorted now
+  std::vector<std::string> stillUnsorted;
+
+  const int32_t numSegments = segmentInfos->size();
+  for(int32_t i=0;i<numSegments;i++) {
+    SegmentInfo* info = segmentInfos->info(i);
+    if (std::find(unsortedSegments.begin(), unsortedSegments.end(), info->name) == unsortedSegments.end())
+      continue;
+    stillUnsorted.push_back(info->name);
+
+    // A segment the merge policy picked is sorted by that merge
+    if (mergingSegments->find(info) != mergingSegments->end())
+      continue;
+
+    SegmentInfos* range = _CLNEW SegmentInfos;
+    segmentInfos->range(i, i+1, *range);
+    MergePolicy::OneMerge* _merge = _CLNEW MergePolicy::OneMerge(range, mergePolicy->useCompoundFile(segmentInfos, info));
+    _merge->optimize = optimize;
+    _merge->maxNumSegmentsOptimize = maxNumSegmentsOptimize;
+    if (infoStream != NULL)
+      message("sort merge of flushed segment " + info->name);
+    if (!registerMerge(_merge))
+      _CLLDELETE(_merge);
+  }
+  unsortedSegments.swap(stillUnsorted);
 }
 
 MergePolicy::OneMerge* IndexWriter::getNextMerge() {
@@ -1156,7 +1309,9 @@ void IndexWriter::finishMerges(bool waitForMerges) {
 void IndexWriter::checkpoint() {
 	SCOPED_LOCK_MUTEX(THIS_LOCK)
   if (autoCommit) {
+    // the files are synced by the next commit or close
     segmentInfos->write(directory);
+    syncPending = true;
     commitPending = false;
     if (infoStream != NULL)
       message("checkpoint: wrote segments file \"" + segmentInfos->getCurrentSegmentFileName() + "\"");
@@ -1165,6 +1320,118 @@ void IndexWriter::checkpoint() {
   }
 }
 
+void IndexWriter::unsyncedFiles(std::vector<std::string>& files) {
+  for (int32_t i = 0; i < segmentInfos->size(); i++) {
+    SegmentInfo* info = segmentInfos->info(i);
+    if (info->dir != directory)
+      continue;
+    const vector<string>& segmentFiles = info->files();
+    for (size_t j = 0; j < segmentFiles.size(); j++) {
+      // segments that share their doc stores list the same files
+      if (_internal->syncedFiles.find(segmentFiles[j]) == _internal->syncedFiles.end() &&
+          std::find(files.begin(), files.end(), segmentFiles[j]) == files.end())
+        files.push_back(segmentFiles[j]);
+    }
+  }
+}
+
+void IndexWriter::writeSegmentInfos() {
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+
+  // the segments file must not be found before the files it references
+  vector<string> files;
+  unsyncedFiles(files);
+  directory->sync(files);
+
+  segmentInfos->write(directory);
+  files.clear();
+  files.push_back(segmentInfos->getCurrentSegmentFileName());
+  directory->sync(files);
+
+  // file names are never reused, so files that are no longer
+  // referenced are forgotten
+  _internal->syncedFiles.clear();
+  for (int32_t i = 0; i < segmentInfos->size(); i++) {
+    SegmentInfo* info = segmentInfos->info(i);
+    if (info->dir == directory)
+      _internal->syncedFiles.insert(info->files().begin(), info->files().end());
+  }
+  syncPending = false;
+}
+
+void IndexWriter::commit() {
+  ensureOpen();
+
+  if (infoStream != NULL)
+    message(string("now flush at commit"));
+
+  // the doc stores are flushed as well, so that no file of the commit
+  // is still written to
+  flush(true, true);
+
+  int64_t ticket;
+  int64_t covered;
+  vector<string> files;
+  { SCOPED_LOCK_MUTEX(this->THIS_LOCK)
+    ticket = ++commitRequests;
+
+    // A commit that is syncing may have missed the changes this thread
+    // just flushed, so we wait for it. The first thread that is woken
+    // commits the changes of all threads that waited.
+    while (committing && commitsDone < ticket) {
+      CONDITION_WAIT(THIS_LOCK, THIS_WAIT_CONDITION)
+    }
+    if (commitsDone >= ticket)
+      return;
+
+    committing = true;
+    covered = commitRequests;
+    unsyncedFiles(files);
+    // a flush or merge that checkpoints while the files are synced
+    // must not delete them
+    deleter->incRef(files);
+  }
+
+  try {
+    // Most of the files are synced without holding the lock, so that
+    // other threads can keep adding documents and queue up their commits
+    directory->sync(files);
+
+    SCOPED_LOCK_MUTEX(THIS_LOCK)
+    _internal->syncedFiles.insert(files.begin(), files.end());
+    if (commitPending || syncPending) {
+      bool success = false;
+      try {
+        writeSegmentInfos();
+        success = true;
+      } _CLFINALLY (
+        if (!success) {
+          if (infoStream != NULL)
+            message(string("hit exception committing segments file"));
+          deletePartialSegmentsFile();
+        }
+      )
+      if (infoStream != NULL)
+        message("commit: wrote segments file \"" + segmentInfos->getCurrentSegmentFileName() + "\"");
+
+      deleter->checkpoint(segmentInfos, true);
+      commitPending = false;
+
+      // abort now returns to this commit
+      if (!autoCommit) {
+        _CLDELETE(rollbackSegmentInfos);
+        rollbackSegmentInfos = segmentInfos->clone();
+      }
+    }
+    commitsDone = covered;
+  } _CLFINALLY ({
+    SCOPED_LOCK_MUTEX(THIS_LOCK)
+    deleter->decRef(files);
+    committing = false;
+    CONDITION_NOTIFYALL(THIS_WAIT_CONDITION)
+  })
+}
+
 void IndexWriter::addIndexes(CL_NS(util)::ArrayBase<CL_NS(store)::Directory*>& dirs){
 
   ensureOpen();
@@ -1441,6 +1708,11 @@ bool IndexWriter::doFlush(bool _flushDocStores) {
                                        docStoreOffset, docStoreSegment.c_str(),
                                        docStoreIsCompoundFile);
           segmentInfos->insert(newSegment);
+
+          // The documents were flushed in the order they were
+          // added; a merge of just this segment sorts them
+          if (indexSort != NULL)
+            unsortedSegments.push_back(segment);
         }
 
         if (flushDeletes)
@@ -1544,24 +1816,18 @@ int32_t IndexWriter::numRamDocs() {
   return docWriter->getNumDocsInRAM();
 }
 
-int32_t IndexWriter::ensureContiguousMerge(MergePolicy::OneMerge* _merge) {
+int32_t IndexWriter::ensureValidMerge(MergePolicy::OneMerge* _merge) {
 
-  int32_t first = segmentInfos->indexOf(_merge->segments->info(0));
-  if (first == -1)
-    _CLTHROWA(CL_ERR_Merge, (string("could not find segment ") + _merge->segments->info(0)->name + " in current segments").c_str());
-
-  const int32_t numSegments = segmentInfos->size();
+  int32_t first = -1;
 
   const int32_t numSegmentsToMerge = _merge->segments->size();
   for(int32_t i=0;i<numSegmentsToMerge;i++) {
     const SegmentInfo* info = _merge->segments->info(i);
-
-    if (first + i >= numSegments || !segmentInfos->info(first+i)->equals(info) ) {
-      if (segmentInfos->indexOf(info) == -1)
-        _CLTHROWA(CL_ERR_Merge, (string("MergePolicy selected a segment (") + info->name + ") that is not in the index").c_str());
-      else
-        _CLTHROWA(CL_ERR_Merge, (string("MergePolicy selected non-contiguous segments to merge (") + _merge->getObjectName() + " vs " + segString() + "), which IndexWriter (currently) cannot handle").c_str() );
-    }
+    const int32_t pos = segmentInfos->indexOf(info);
+    if (pos == -1)
+      _CLTHROWA(CL_ERR_Merge, (string("MergePolicy selected a segment (") + info->name + ") that is not in the index").c_str());
+    if (first == -1 || pos < first)
+      first = pos;
   }
 
   return first;
@@ -1602,7 +1868,7 @@ bool IndexWriter::commitMerge(MergePolicy::OneMerge* _merge) {
     SegmentInfos* sourceSegmentsClone = _merge->segmentsClone;
     const SegmentInfos* sourceSegments = _merge->segments;
 
-    start = ensureContiguousMerge(_merge);
+    start = ensureValidMerge(_merge);
     if (infoStream != NULL)
       message("commitMerge " + _merge->segString(directory));
 
@@ -1612,6 +1878,10 @@ bool IndexWriter::commitMerge(MergePolicy::OneMerge* _merge) {
     BitVector* deletes = NULL;
     int32_t docUpto = 0;
 
+    // If the merged documents were sorted, docUpto is their
+    // number before sorting
+    const int32_t* sortedDocMap = _merge->sortedDocMap;
+
     const int32_t numSegmentsToMerge = sourceSegments->size();
     for(int32_t i=0;i<numSegmentsToMerge;i++) {
       const SegmentInfo* previousInfo = sourceSegmentsClone->info(i);
@@ -1648,7 +1918,7 @@ bool IndexWriter::commitMerge(MergePolicy::OneMerge* _merge) {
               assert (currentDeletes.get(j));
             else {
               if (currentDeletes.get(j))
-                deletes->set(docUpto);
+                deletes->set(sortedDocMap == NULL ? docUpto : sortedDocMap[docUpto]);
               docUpto++;
             }
           }
@@ -1664,7 +1934,7 @@ bool IndexWriter::commitMerge(MergePolicy::OneMerge* _merge) {
 
         for(int32_t j=0;j<docCount;j++) {
           if (currentDeletes.get(j))
-            deletes->set(docUpto);
+            deletes->set(sortedDocMap == NULL ? docUpto : sortedDocMap[docUpto]);
           docUpto++;
         }
 
@@ -1712,9 +1982,11 @@ bool IndexWriter::commitMerge(MergePolicy::OneMerge* _merge) {
   SegmentInfos* rollback = NULL;
   try {
     rollback = segmentInfos->clone();
+    // the merged segments need not be adjacent, they all come at or
+    // after start, so removing them does not move start
     int32_t segmentssize = _merge->segments->size();
     for ( int32_t i=0;i<segmentssize;i++ ){
-      segmentInfos->remove(start);
+      segmentInfos->remove(segmentInfos->indexOf(_merge->segments->info(i)));
     }
     segmentInfos->add(_merge->info,start);
     checkpoint();
@@ -1778,8 +2050,8 @@ void IndexWriter::merge(MergePolicy::OneMerge* _merge)
         mergeMiddle(_merge);
         success = true;
       } catch (CLuceneError& e) {
-        if ( e.number() != CL_ERR_MergeAborted ) throw e;
         _merge->setException(e);
+        if ( e.number() != CL_ERR_MergeAborted ) throw e;
         addMergeException(_merge);
         // We can ignore this exception, unless the merge
         // involves segments from external directories, in
@@ -1799,6 +2071,13 @@ void IndexWriter::merge(MergePolicy::OneMerge* _merge)
             if (infoStream != NULL)
               message(string("hit exception during merge"));
             addMergeException(_merge);
+            if (_merge->expungeDeletes && expungeDeletesError == NULL) {
+              CLuceneError tmp(_merge->getException());
+              if (tmp.number() == 0)
+                tmp.set(CL_ERR_Runtime, "unknown error");
+              expungeDeletesError = _CLNEW CLuceneError(tmp.number(),
+                (string("background merge hit exception: ") + _merge->segString(directory) + ":" + tmp.what()).c_str(), false);
+            }
             if (_merge->info != NULL && segmentInfos->indexOf(_merge->info)==-1)
               deleter->refresh(_merge->info->name.c_str());
           }
@@ -1895,7 +2174,7 @@ void IndexWriter::_mergeInit(MergePolicy::OneMerge* _merge) {
   const SegmentInfos* sourceSegments = _merge->segments;
   const int32_t end = sourceSegments->size();
 
-  ensureContiguousMerge(_merge);
+  ensureValidMerge(_merge);
 
   // Check whether this merge will allow us to skip
   // merging the doc stores (stored field & vectors).
@@ -1957,6 +2236,11 @@ void IndexWriter::_mergeInit(MergePolicy::OneMerge* _merge) {
       doFlushDocStore = true;
   }
 
+  // Sorting renumbers the documents, so their stored
+  // fields and vectors must be rewritten
+  if (indexSort != NULL)
+    mergeDocStores = true;
+
   int32_t docStoreOffset;
   string docStoreSegment;
   bool docStoreIsCompoundFile;
@@ -2052,7 +2336,13 @@ int32_t IndexWriter::mergeMiddle(MergePolicy::OneMerge* _merge) {
   if (infoStream != NULL)
     message("merging " + _merge->segString(directory));
 
+  // the merge reads and writes through the rate limiter
+  MergeDirectory mergeDirectory(directory, mergeRateLimiter);
   SegmentMerger merger (this, mergedName.c_str(), _merge) ;
+  merger.setDirectory(&mergeDirectory);
+  if (indexSort != NULL)
+    merger.setIndexSort(indexSort);
+  merger.setThreadCount(mergeScheduler->getMergeThreadCount());
 
   // This is try/finally to make sure merger's readers are
   // closed:
@@ -2064,7 +2354,8 @@ int32_t IndexWriter::mergeMiddle(MergePolicy::OneMerge* _merge) {
 
     for (int32_t i = 0; i < numSegments; i++) {
       SegmentInfo* si = sourceSegmentsClone->info(i);
-      IndexReader* reader = SegmentReader::get(si, MERGE_READ_BUFFER_SIZE, _merge->mergeDocStores); // no need to set deleter (yet)
+      Directory* dir = si->dir == directory ? &mergeDirectory : si->dir;
+      IndexReader* reader = SegmentReader::get(dir, si, NULL, false, false, MERGE_READ_BUFFER_SIZE, _merge->mergeDocStores); // no need to set deleter (yet)
       merger.add(reader);
       totDocCount += reader->numDocs();
     }
@@ -2075,6 +2366,7 @@ int32_t IndexWriter::mergeMiddle(MergePolicy::OneMerge* _merge) {
     _merge->checkAborted(directory);
 
     mergedDocCount = _merge->info->docCount = merger.merge(_merge->mergeDocStores);
+    _merge->sortedDocMap = merger.releaseSortedDocMap();
 
     assert (mergedDocCount == totDocCount);
 
@@ -10,10 +10,12 @@
 #include "CLucene/util/VoidList.h"
 #include "CLucene/util/Array.h"
 CL_CLASS_DEF(search,Similarity)
+CL_CLASS_DEF(search,SortField)
 CL_CLASS_DEF(store,Lock)
 CL_CLASS_DEF(analysis,Analyzer)
 CL_CLASS_DEF(store,Directory)
 CL_CLASS_DEF(store,LuceneLock)
+CL_CLASS_DEF(store,RateLimiter)
 CL_CLASS_DEF(document,Document)
 
 #include "MergePolicy.h"
@@ -192,6 +194,7 @@ class CLUCENE_EXPORT IndexWriter:LUCENE_BASE {
   MergingSegmentsType* mergingSegments;
   MergePolicy* mergePolicy;
   MergeScheduler* mergeScheduler;
+  CL_NS(store)::RateLimiter* mergeRateLimiter;
 
   typedef  CL_NS(util)::CLLinkedList<MergePolicy::OneMerge*,
   CL_NS(util)::Deletor::Object<MergePolicy::OneMerge> > PendingMergesType;
@@ -204,6 +207,8 @@ class CLUCENE_EXPORT IndexWriter:LUCENE_BASE {
 
   typedef CL_NS(util)::CLArrayList<MergePolicy::OneMerge*> MergeExceptionsType;
   MergeExceptionsType* mergeExceptions;
+  // first exception hit by a merge that expungeDeletes waits for
+  CLuceneError* expungeDeletesError;
   int64_t mergeGen;
   bool stopMerges;
 
@@ -216,6 +221,10 @@ class CLUCENE_EXPORT IndexWriter:LUCENE_BASE {
 
 
   bool commitPending; // true if segmentInfos has changes not yet committed
+  bool syncPending;   // true if the last segments file was written without syncing
+  int64_t commitRequests;  // the number of calls to commit
+  int64_t commitsDone;     // the calls to commit whose changes were committed
+  bool committing;         // true while a thread syncs the files of a commit
   SegmentInfos* rollbackSegmentInfos;      // segmentInfos we will fallback to if the commit fails
 
   SegmentInfos* localRollbackSegmentInfos;      // segmentInfos we will fallback to if the commit fails
@@ -228,6 +237,9 @@ class CLUCENE_EXPORT IndexWriter:LUCENE_BASE {
   typedef std::vector<SegmentInfo*> SegmentsToOptimizeType;
   SegmentsToOptimizeType* segmentsToOptimize;           // used by optimize to note those needing optimization
 
+  CL_NS(search)::SortField* indexSort;      // if not NULL, the order of the documents of merged segments
+  std::vector<std::string> unsortedSegments; // flushed segments that were not sorted yet
+
 
   CL_NS(store)::LuceneLock* writeLock;
 
@@ -623,6 +635,31 @@ public:
    */
   MergeScheduler* getMergeScheduler();
 
+  /**
+   * Returns the limiter that every byte merges read and write passes. It
+   * does not limit merges until its rate is set, which can be done at any
+   * time, for example to slow merges down while searches are busy. It also
+   * counts the bytes merges transferred and the time they were paused.
+   * Merged files are also kept out of the operating system's page cache,
+   * see {@link CL_NS(store)::Directory#createMergeOutput}.
+   * @memory the limiter belongs to the writer
+   */
+  CL_NS(store)::RateLimiter* getMergeRateLimiter();
+
+  /**
+   * Expert: returns the number of deleted documents of a segment of this
+   * writer's index, as of the last flush. Merge policies use it to find
+   * the segments that merging would reclaim the most space of.
+   */
+  int32_t numDeletedDocs(SegmentInfo* info);
+
+  /**
+   * Expert: returns true if the segment takes part in a merge that is
+   * pending or running, so that merge policies can leave it out of the
+   * merges they select.
+   */
+  bool isMerging(SegmentInfo* info);
+
   /**
    * Returns the value set by {@link #setRAMBufferSizeMB} if enabled.
    */
@@ -664,6 +701,28 @@ public:
    */
   void setMergeScheduler(MergeScheduler* mergeScheduler);
 
+  /**
+   * Keeps the documents of every segment sorted by sort, which must be an
+   * INT, FLOAT or STRING sort. Merged segments are written in sorted order,
+   * and a segment flushed by this writer is sorted by a merge of just that
+   * segment right after the flush. Documents with equal values keep the
+   * order they were added in.
+   *
+   * <p>Searches sorted by the same field can then stop collecting a
+   * segment once it yielded enough hits, see
+   * {@link CL_NS(search)::EarlyTerminatingCollector}. Sorting rewrites the
+   * stored fields and vectors of every merge, so it costs merge
+   * throughput. Set the sort before adding documents; pass NULL to stop
+   * sorting.
+   * @memory the sort is copied
+   */
+  void setIndexSort(const CL_NS(search)::SortField* sort);
+
+  /**
+   * Returns the sort set by {@link #setIndexSort}, or NULL.
+   */
+  const CL_NS(search)::SortField* getIndexSort();
+
   /** Determines the amount of RAM that may be used for
    * buffering added documents before they are flushed as a
    * new Segment.  Generally for faster indexing performance
@@ -898,6 +957,22 @@ public:
    */
   void optimize(int32_t maxNumSegments, bool doWait=true);
 
+  /**
+   * Flushes and then merges the segments that have deleted documents,
+   * as selected by {@link MergePolicy#findMergesToExpungeDeletes}, so
+   * that the space of the deleted documents is reclaimed without
+   * optimizing the whole index.
+   *
+   * <p>Exceptions that merges hit in background threads are not
+   * forwarded by this call, see {@link MergeScheduler}.</p>
+   *
+   * @param doWait Specifies whether the call should block
+   *  until the merges complete.  This is only meaningful
+   *  with a {@link MergeScheduler} that is able to run merges
+   *  in background threads.
+   */
+  void expungeDeletes(bool doWait=true);
+
   /**
    * Flush all in-memory buffered updates (adds and deletes)
    * to the Directory.
@@ -908,6 +983,27 @@ public:
    */
   void flush();
 
+  /**
+   * Flushes all buffered updates and commits them: a new segments_N file
+   * is written and the files of the index, along with the segments file,
+   * are synced to stable storage with {@link Directory#sync}, so that the
+   * changes survive a crash of the machine. Only the files that were not
+   * synced by an earlier commit of this writer are synced.
+   *
+   * <p>Commits of several threads are grouped: the files are synced
+   * without blocking other threads, and the threads that call commit
+   * while a commit is syncing wait for it and are then committed
+   * together, with a single segments file.
+   *
+   * <p>With <code>autoCommit=false</code>, readers see the changes after
+   * the commit. With <code>autoCommit=true</code>, readers see the changes
+   * after every flush, but the files written by flushes and merges are only
+   * synced by commit and {@link #close}.
+   * @throws CorruptIndexException if the index is corrupt
+   * @throws IOException if there is a low-level IO error
+   */
+  void commit();
+
   /**
    * Adds a document to this index.  If the document contains more than
    * {@link #setMaxFieldLength(int)} terms for a given field, the remainder are
@@ -1178,10 +1274,18 @@ private:
    *  runningMerges are optimization merges. */
   bool optimizeMergesPending();
 
+  /** Returns true if any merges in pendingMerges or
+   *  runningMerges were registered by expungeDeletes. */
+  bool expungeDeletesMergesPending();
+
   void resetMergeExceptions();
 
   void updatePendingMerges(int32_t maxNumSegmentsOptimize, bool optimize);
 
+  /** Registers a merge of each flushed segment that is not
+   *  sorted yet and not part of another merge. */
+  void registerSortMerges(int32_t maxNumSegmentsOptimize, bool optimize);
+
   /*
    * Begin a transaction.  During a transaction, any segment
    * merges that happen (or ram segments flushed) will not
@@ -1233,12 +1337,22 @@ private:
    */
   void checkpoint();
 
+  /* Appends the files of segmentInfos that were not synced yet. */
+  void unsyncedFiles(std::vector<std::string>& files);
+
+  /* Syncs the files of segmentInfos that were not synced yet, and
+   * writes and syncs a new segments_N file. */
+  void writeSegmentInfos();
+
   bool doFlush(bool flushDocStores);
 
-  /* FIXME if we want to support non-contiguous segment merges */
+  /* Replaces the segments of the merge, which need not be adjacent,
+   * with the merged segment, at the position of the first of them. */
   bool commitMerge(MergePolicy::OneMerge* merge);
 
-  int32_t ensureContiguousMerge(MergePolicy::OneMerge* merge);
+  /* Checks that the segments of the merge are still in the index and
+   * returns the lowest position of them. */
+  int32_t ensureValidMerge(MergePolicy::OneMerge* merge);
 
   void decrefMergeSegments(MergePolicy::OneMerge* _merge);
 
@@ -0,0 +1,429 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "CLucene/_ApiHeader.h"
+#include "IndexingPipeline.h"
+#include "IndexWriter.h"
+#include "Term.h"
+#include "CLucene/document/Document.h"
+#include "CLucene/document/Field.h"
+#include "CLucene/analysis/AnalysisHeader.h"
+#include "CLucene/util/CLStreams.h"
+#include "CLucene/util/Array.h"
+#include "CLucene/util/_ThreadLocal.h"
+#include "CLucene/config/_threads.h"
+
+CL_NS_USE(analysis)
+CL_NS_USE(document)
+CL_NS_USE(util)
+CL_NS_DEF(index)
+
+/**
+* A TokenStream that records all tokens of another stream into a
+* single character buffer plus a flat array of token attributes, and
+* replays them on demand. This is what the analysis stage hands over to
+* the inversion stage.
+*/
+class TokenBatch: public TokenStream {
+	struct Entry {
+		int32_t textStart;
+		int32_t textLength;
+		int32_t startOffset;
+		int32_t endOffset;
+		int32_t positionIncrement;
+		const TCHAR* type;  ///< types are interned/static strings, not copied
+		Payload* payload;
+	};
+	ValueArray<TCHAR> text;
+	size_t textUpto;
+	ValueArray<Entry> entries;
+	size_t numTokens;
+	size_t upto;
+public:
+	TokenBatch():
+		textUpto(0),
+		numTokens(0),
+		upto(0)
+	{
+	}
+	virtual ~TokenBatch(){
+		clear();
+	}
+
+	/** Records up to maxTokens tokens of stream */
+	void fill(TokenStream* stream, const size_t maxTokens){
+		Token token;
+		while ( numTokens < maxTokens ){
+			Token* t = stream->next(&token);
+			if ( t == NULL )
+				break;
+
+			const size_t len = t->termLength();
+			if ( textUpto + len > text.length ){
+				size_t newLength = text.length < 256 ? 256 : text.length * 2;
+				while ( newLength < textUpto + len )
+					newLength *= 2;
+				text.resize(newLength);
+			}
+			_tcsncpy(text.values + textUpto, t->termBuffer(), len);
+
+			if ( numTokens == entries.length )
+				entries.resize(entries.length < 32 ? 32 : entries.length * 2);
+			Entry& e = entries.values[numTokens++];
+			e.textStart = textUpto;
+			e.textLength = len;
+			e.startOffset = t->startOffset();
+			e.endOffset = t->endOffset();
+			e.positionIncrement = t->getPositionIncrement();
+			e.type = t->type();
+			e.payload = t->getPayload() == NULL ? NULL : t->getPayload()->clone();
+
+			textUpto += len;
+		}
+	}
+
+	/** Forgets all recorded tokens, but keeps the buffers */
+	void clear(){
+		for ( size_t i=0;i<numTokens;i++ )
+			_CLLDELETE(entries.values[i].payload);
+		textUpto = 0;
+		numTokens = 0;
+		upto = 0;
+	}
+
+	Token* next(Token* t){
+		if ( upto >= numTokens )
+			return NULL;
+		const Entry& e = entries.values[upto++];
+		t->clear();
+		t->setText(text.values + e.textStart, e.textLength);
+		t->setStartOffset(e.startOffset);
+		t->setEndOffset(e.endOffset);
+		t->setPositionIncrement(e.positionIncrement);
+		t->setType(e.type);
+		if ( e.payload != NULL )
+			t->setPayload(e.payload->clone());
+		return t;
+	}
+	void reset(){
+		upto = 0;
+	}
+	void close(){
+	}
+};
+
+/** A document travelling through the pipeline */
+struct PipelineItem {
+	Document* doc;
+	Term* delTerm;
+	std::vector<TokenBatch*> batches;
+};
+
+// Maximum number of unused token batches kept for re-use
+#define PIPELINE_MAX_FREE_BATCHES 256
+
+#ifndef _CL_DISABLE_MULTITHREADING
+/** Bounded blocking FIFO between two stages of the pipeline. A NULL item
+* tells the consumer to exit. */
+class PipelineQueue {
+	ValueArray<PipelineItem*> items;
+	size_t head;
+	size_t count;
+	DEFINE_MUTEX(THIS_LOCK)
+	DEFINE_CONDITION(notEmpty)
+	DEFINE_CONDITION(notFull)
+public:
+	PipelineQueue(const size_t capacity):
+		items(capacity),
+		head(0),
+		count(0)
+	{
+	}
+	void put(PipelineItem* item){
+		SCOPED_LOCK_MUTEX(THIS_LOCK)
+		while ( count == items.length )
+			CONDITION_WAIT(THIS_LOCK, notFull)
+		items.values[(head + count) % items.length] = item;
+		count++;
+		CONDITION_NOTIFYALL(notEmpty)
+	}
+	PipelineItem* take(){
+		SCOPED_LOCK_MUTEX(THIS_LOCK)
+		while ( count == 0 )
+			CONDITION_WAIT(THIS_LOCK, notEmpty)
+		PipelineItem* ret = items.values[head];
+		head = (head + 1) % items.length;
+		count--;
+		CONDITION_NOTIFYALL(notFull)
+		return ret;
+	}
+};
+#endif
+
+class IndexingPipeline::Internal{
+public:
+	IndexWriter* writer;
+	Analyzer* analyzer;
+	bool closed;
+	int32_t numDocsIndexed;
+	CLuceneError* error;
+	std::vector<TokenBatch*> freeBatches;
+	DEFINE_MUTEX(THIS_LOCK)
+
+#ifndef _CL_DISABLE_MULTITHREADING
+	PipelineQueue analysisQueue;
+	PipelineQueue inversionQueue;
+	ValueArray<_LUCENE_THREADID_TYPE> analysisThreads;
+	ValueArray<_LUCENE_THREADID_TYPE> inversionThreads;
+#endif
+
+	Internal(IndexWriter* writer, Analyzer* analyzer, const int32_t numAnalysisThreads,
+			const int32_t numInversionThreads, const int32_t queueSize):
+		writer(writer),
+		analyzer(analyzer),
+		closed(false),
+		numDocsIndexed(0),
+		error(NULL)
+#ifndef _CL_DISABLE_MULTITHREADING
+		,analysisQueue(queueSize),
+		inversionQueue(queueSize),
+		analysisThreads(numAnalysisThreads),
+		inversionThreads(numInversionThreads)
+#endif
+	{
+		if ( this->analyzer == NULL )
+			this->analyzer = writer->getAnalyzer();
+	}
+	~Internal(){
+		for ( size_t i=0;i<freeBatches.size();i++ )
+			_CLLDELETE(freeBatches[i]);
+		_CLLDELETE(error);
+	}
+
+	TokenBatch* getBatch(){
+		SCOPED_LOCK_MUTEX(THIS_LOCK)
+		if ( freeBatches.empty() )
+			return _CLNEW TokenBatch();
+		TokenBatch* ret = freeBatches.back();
+		freeBatches.pop_back();
+		return ret;
+	}
+
+	void deleteItem(PipelineItem* item){
+		_CLDELETE(item->doc);
+		_CLDECDELETE(item->delTerm);
+		SCOPED_LOCK_MUTEX(THIS_LOCK)
+		for ( size_t i=0;i<item->batches.size();i++ ){
+			TokenBatch* batch = item->batches[i];
+			if ( freeBatches.size() < PIPELINE_MAX_FREE_BATCHES ){
+				batch->clear();
+				freeBatches.push_back(batch);
+			}else
+				_CLLDELETE(batch);
+		}
+		delete item;
+	}
+
+	void setError(const CLuceneError& err){
+		SCOPED_LOCK_MUTEX(THIS_LOCK)
+		if ( error == NULL )
+			error = _CLNEW CLuceneError(err);
+	}
+
+	/** Analysis stage: runs the analyzer over every tokenized field that
+	* does not have a token stream yet, and attaches the recorded tokens */
+	void analyze(PipelineItem* item){
+		int32_t maxFieldLength = writer->getMaxFieldLength();
+		// one token more than allowed, so that the writer still reports
+		// the overflow for the warning policy
+		const size_t maxTokens = maxFieldLength == IndexWriter::FIELD_TRUNC_POLICY__WARN ?
+			IndexWriter::DEFAULT_MAX_FIELD_LENGTH + 1 : maxFieldLength;
+
+		const Document::FieldsType& fields = *item->doc->getFields();
+		for ( size_t i=0;i<fields.size();i++ ){
+			Field* field = fields[i];
+			if ( !field->isIndexed() || !field->isTokenized() || field->tokenStreamValue() != NULL )
+				continue;
+
+			Reader* reader = field->readerValue();
+			StringReader* stringReader = NULL;
+			if ( reader == NULL ){
+				const TCHAR* stringValue = field->stringValue();
+				if ( stringValue == NULL )
+					_CLTHROWA(CL_ERR_IllegalArgument, "field must have either TokenStream, String or Reader value");
+				reader = stringReader = _CLNEW StringReader(stringValue, -1, false);
+			}
+
+			TokenBatch* batch = getBatch();
+			item->batches.push_back(batch);
+			try{
+				TokenStream* stream = analyzer->reusableTokenStream(field->name(), reader);
+				stream->reset();
+				try{
+					batch->fill(stream, maxTokens);
+				}_CLFINALLY(
+					stream->close(); //don't delete, this stream is re-used
+				)
+			}_CLFINALLY(
+				_CLDELETE(stringReader);
+			)
+			field->setTokenStream(batch);
+		}
+	}
+
+	/** Inversion stage: passes the analyzed document to the writer */
+	void invert(PipelineItem* item){
+		if ( item->delTerm != NULL )
+			writer->updateDocument(item->delTerm, item->doc, analyzer);
+		else
+			writer->addDocument(item->doc, analyzer);
+		SCOPED_LOCK_MUTEX(THIS_LOCK)
+		numDocsIndexed++;
+	}
+
+	void add(PipelineItem* item);
+	void close();
+
+#ifndef _CL_DISABLE_MULTITHREADING
+	static _LUCENE_THREAD_FUNC(analysisWorker, arg);
+	static _LUCENE_THREAD_FUNC(inversionWorker, arg);
+#endif
+};
+
+#ifndef _CL_DISABLE_MULTITHREADING
+_LUCENE_THREAD_FUNC(IndexingPipeline::Internal::analysisWorker, arg){
+	IndexingPipeline::Internal* _this = (IndexingPipeline::Internal*)arg;
+	PipelineItem* item;
+	while ( (item = _this->analysisQueue.take()) != NULL ){
+		try{
+			_this->analyze(item);
+		}catch(CLuceneError& err){
+			_this->setError(err);
+			_this->deleteItem(item);
+			continue;
+		}catch(...){
+			_this->setError(CLuceneError(CL_ERR_Runtime, "unknown error in indexing pipeline", false));
+			_this->deleteItem(item);
+			continue;
+		}
+		_this->inversionQueue.put(item);
+	}
+	_ThreadLocal::UnregisterCurrentThread();
+	_LUCENE_THREAD_FUNC_RETURN(0);
+}
+
+_LUCENE_THREAD_FUNC(IndexingPipeline::Internal::inversionWorker, arg){
+	IndexingPipeline::Internal* _this = (IndexingPipeline::Internal*)arg;
+	PipelineItem* item;
+	while ( (item = _this->inversionQueue.take()) != NULL ){
+		try{
+			_this->invert(item);
+		}catch(CLuceneError& err){
+			_this->setError(err);
+		}catch(...){
+			_this->setError(CLuceneError(CL_ERR_Runtime, "unknown error in indexing pipeline", false));
+		}
+		_this->deleteItem(item);
+	}
+	_ThreadLocal::UnregisterCurrentThread();
+	_LUCENE_THREAD_FUNC_RETURN(0);
+}
+
+void IndexingPipeline::Internal::add(PipelineItem* item){
+	analysisQueue.put(item);
+}
+
+void IndexingPipeline::Internal::close(){
+	// poison the analysis workers first, so that everything they still
+	// hold reaches the inversion queue before its workers are stopped
+	for ( size_t i=0;i<analysisThreads.length;i++ )
+		analysisQueue.put(NULL);
+	for ( size_t i=0;i<analysisThreads.length;i++ )
+		_LUCENE_THREAD_JOIN(analysisThreads[i]);
+	for ( size_t i=0;i<inversionThreads.length;i++ )
+		inversionQueue.put(NULL);
+	for ( size_t i=0;i<inversionThreads.length;i++ )
+		_LUCENE_THREAD_JOIN(inversionThreads[i]);
+}
+
+#else
+
+void IndexingPipeline::Internal::add(PipelineItem* item){
+	try{
+		analyze(item);
+		invert(item);
+	}catch(CLuceneError& err){
+		setError(err);
+	}catch(...){
+		setError(CLuceneError(CL_ERR_Runtime, "unknown error in indexing pipeline", false));
+	}
+	deleteItem(item);
+}
+
+void IndexingPipeline::Internal::close(){
+}
+#endif
+
+
+IndexingPipeline::IndexingPipeline(IndexWriter* writer, int32_t analysisThreads,
+	int32_t inversionThreads, int32_t queueSize, Analyzer* analyzer)
+{
+	if ( analysisThreads < 1 || inversionThreads < 1 )
+		_CLTHROWA(CL_ERR_IllegalArgument, "IndexingPipeline needs at least one thread per stage");
+	if ( queueSize < 1 )
+		_CLTHROWA(CL_ERR_IllegalArgument, "queueSize must be at least 1");
+
+	_internal = _CLNEW Internal(writer, analyzer, analysisThreads, inversionThreads, queueSize);
+#ifndef _CL_DISABLE_MULTITHREADING
+	for ( int32_t i=0;i<inversionThreads;i++ )
+		_internal->inversionThreads.values[i] = _LUCENE_THREAD_CREATE(&Internal::inversionWorker, _internal);
+	for ( int32_t i=0;i<analysisThreads;i++ )
+		_internal->analysisThreads.values[i] = _LUCENE_THREAD_CREATE(&Internal::analysisWorker, _internal);
+#endif
+}
+
+IndexingPipeline::~IndexingPipeline(){
+	if ( !_internal->closed ){
+		_internal->closed = true;
+		_internal->close();
+	}
+	_CLDELETE(_internal);
+}
+
+void IndexingPipeline::addDocument(Document* doc){
+	updateDocument(NULL, doc);
+}
+
+void IndexingPipeline::updateDocument(Term* term, Document* doc){
+	if ( _internal->closed ){
+		_CLDELETE(doc);
+		_CLTHROWA(CL_ERR_AlreadyClosed, "this IndexingPipeline is closed");
+	}
+	PipelineItem* item = new PipelineItem;
+	item->doc = doc;
+	item->delTerm = term == NULL ? NULL : _CL_POINTER(term);
+	_internal->add(item);
+}
+
+void IndexingPipeline::close(){
+	if ( _internal->closed )
+		return;
+	_internal->closed = true;
+	_internal->close();
+
+	if ( _internal->error != NULL ){
+		CLuceneError err(*_internal->error);
+		_CLDELETE(_internal->error);
+		throw err;
+	}
+}
+
+int32_t IndexingPipeline::getNumDocsIndexed(){
+	SCOPED_LOCK_MUTEX(_internal->THIS_LOCK)
+	return _internal->numDocsIndexed;
+}
+
+CL_NS_END
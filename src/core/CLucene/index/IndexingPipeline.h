@@ -0,0 +1,84 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_index_IndexingPipeline_
+#define _lucene_index_IndexingPipeline_
+
+#include "CLucene/LuceneThreads.h"
+CL_CLASS_DEF(analysis,Analyzer)
+CL_CLASS_DEF(document,Document)
+
+CL_NS_DEF(index)
+class IndexWriter;
+class Term;
+
+/**
+* Expert: feeds documents to an {@link IndexWriter} through two separate
+* stages, so that expensive analysis scales independently of inversion.
+*
+* <p>A pool of analysis threads runs the Analyzer (and its TokenFilters)
+* over every tokenized field and records the resulting tokens in a compact
+* token batch, which is attached to the field with
+* {@link Field#setTokenStream}.  The analyzed documents are handed through a
+* bounded queue to a pool of inversion threads, which call
+* IndexWriter::addDocument.  Because DocumentsWriter binds a ThreadState to
+* each calling thread, every inversion thread owns its own postings hash
+* and only replays the recorded tokens into it.</p>
+*
+* <p>Documents added to the pipeline are owned by it and are deleted once
+* they have been indexed.  Documents may reach the index in a different
+* order than they were added when more than one analysis thread is used.
+* Errors hit by a worker are remembered and the first one is re-thrown from
+* {@link #close()}; the failing document is not indexed.</p>
+*
+* <p>When CLucene is built without multithreading support, documents are
+* analyzed and indexed directly in the calling thread.</p>
+*/
+class CLUCENE_EXPORT IndexingPipeline:LUCENE_BASE {
+	class Internal;
+	Internal* _internal;
+public:
+	/** Default number of documents each queue can hold before
+	* addDocument blocks */
+	LUCENE_STATIC_CONSTANT(int32_t, DEFAULT_QUEUE_SIZE=64);
+
+	/**
+	* @param writer the writer the documents are added to. The writer must stay
+	*        open until the pipeline has been closed.
+	* @param analysisThreads number of threads running the analyzer
+	* @param inversionThreads number of threads inverting analyzed documents
+	*        into the writer
+	* @param queueSize maximum number of documents waiting in each stage
+	* @param analyzer the analyzer to use, or NULL to use the writer's analyzer
+	*/
+	IndexingPipeline(IndexWriter* writer, int32_t analysisThreads=2,
+		int32_t inversionThreads=1, int32_t queueSize=DEFAULT_QUEUE_SIZE,
+		CL_NS(analysis)::Analyzer* analyzer=NULL);
+
+	/** Closes the pipeline if this has not been done yet. Errors are not
+	* re-thrown from here, call close() to see them. */
+	virtual ~IndexingPipeline();
+
+	/** Queues a document for indexing. Blocks while the pipeline is full.
+	* @memory takes ownership of doc */
+	void addDocument(CL_NS(document)::Document* doc);
+
+	/** Queues a document that replaces all documents containing term.
+	* @see IndexWriter#updateDocument
+	* @memory takes ownership of doc, term is reference counted */
+	void updateDocument(Term* term, CL_NS(document)::Document* doc);
+
+	/** Waits until all queued documents have been indexed and stops the
+	* worker threads. The IndexWriter is not closed. If a worker hit an
+	* error, the first one is thrown from here. */
+	void close();
+
+	/** Number of documents that have been passed to the IndexWriter so far */
+	int32_t getNumDocsIndexed();
+};
+
+CL_NS_END
+#endif
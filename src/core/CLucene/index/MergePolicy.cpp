@@ -10,6 +10,8 @@
 #include "IndexWriter.h"
 #include "CLucene/store/Directory.h"
 #include <assert.h>
+#include <algorithm>
+#include <math.h>
 
 CL_NS_USE(util)
 CL_NS_USE(store)
@@ -29,10 +31,12 @@ MergePolicy::OneMerge::OneMerge(SegmentInfos* segments, bool _useCompoundFile):
   this->segmentsClone = NULL;
   this->mergeGen = 0;
   this->maxNumSegmentsOptimize = 0;
-  aborted = mergeDocStores = optimize = increfDone = registerDone = isExternal = false;
+  this->sortedDocMap = NULL;
+  aborted = mergeDocStores = optimize = expungeDeletes = increfDone = registerDone = isExternal = false;
 }
 MergePolicy::OneMerge::~OneMerge(){
   _CLDELETE(this->segmentsClone);
+  _CLDELETE_ARRAY(this->sortedDocMap);
 
   while ( this->segments->size() > 0 ){
     this->segments->remove(0,true);//don't delete...
@@ -385,6 +389,34 @@ MergePolicy::MergeSpecification* LogMergePolicy::findMerges(SegmentInfos* infos,
   return spec;
 }
 
+MergePolicy::MergeSpecification* LogMergePolicy::findMergesToExpungeDeletes(SegmentInfos* infos, IndexWriter* writer){
+  const int32_t numSegments = infos->size();
+  this->writer = writer;
+  MESSAGE( string("findMergesToExpungeDeletes: ") + Misc::toString(numSegments) + " segments");
+
+  MergeSpecification* spec = NULL;
+  int32_t firstSegmentWithDeletions = -1;
+  for(int32_t i=0;i<=numSegments;i++) {
+    // a segment without deletions, or the end of the index, ends a run
+    // of segments with deletions
+    const bool hasDeletions = i < numSegments && infos->info(i)->hasDeletions();
+    if (hasDeletions && firstSegmentWithDeletions == -1)
+      firstSegmentWithDeletions = i;
+    else if (firstSegmentWithDeletions != -1 &&
+             (!hasDeletions || i - firstSegmentWithDeletions == mergeFactor)) {
+      MESSAGE( string("  add merge ") + Misc::toString(firstSegmentWithDeletions) + " to " + Misc::toString(i-1) + " inclusive");
+      if (spec == NULL)
+        spec = _CLNEW MergeSpecification();
+      SegmentInfos* range = _CLNEW SegmentInfos;
+      infos->range(firstSegmentWithDeletions, i, *range);
+      spec->add(_CLNEW OneMerge(range, _useCompoundFile));
+      firstSegmentWithDeletions = hasDeletions ? i : -1;
+    }
+  }
+
+  return spec;
+}
+
 void LogMergePolicy::setMaxMergeDocs(int32_t maxMergeDocs) {
   this->maxMergeDocs = maxMergeDocs;
 }
@@ -511,4 +543,421 @@ const char* LogByteSizeMergePolicy::getObjectName() const{
 }
 
 
+
+
+/** The sizes of a segment, as TieredMergePolicy sees them */
+struct TieredMergePolicy::SegmentSize {
+  SegmentInfo* info;
+  int32_t pos;          // position in the index
+  int64_t bytes;        // size of the files
+  int64_t size;         // size without the deleted documents
+  int32_t delCount;
+  bool merging;         // taking part in a merge already
+  bool selected;        // selected for a merge by this call
+
+  static bool bySizeDescending(const SegmentSize& a, const SegmentSize& b){
+    return a.size > b.size || (a.size == b.size && a.pos < b.pos);
+  }
+  static bool byPosition(const SegmentSize* a, const SegmentSize* b){
+    return a->pos < b->pos;
+  }
+};
+
+TieredMergePolicy::TieredMergePolicy(){
+  maxMergeAtOnce = 10;
+  maxMergedSegmentBytes = (int64_t)5*1024*1024*1024;
+  maxMergeAtOnceExplicit = 30;
+  floorSegmentBytes = 2*1024*1024;
+  segsPerTier = 10.0;
+  expungeDeletesPctAllowed = 10.0;
+  reclaimDeletesWeight = 2.0;
+  _useCompoundFile = true;
+  _useCompoundDocStore = true;
+  writer = NULL;
+}
+
+void TieredMergePolicy::message(const string& message) {
+  if (writer != NULL){
+    string msg = "TMP: " + message;
+    writer->message( msg );
+  }
+}
+
+void TieredMergePolicy::setMaxMergeAtOnce(int32_t v) {
+  if (v < 2)
+    _CLTHROWA(CL_ERR_IllegalArgument, "maxMergeAtOnce must be > 1");
+  maxMergeAtOnce = v;
+}
+int32_t TieredMergePolicy::getMaxMergeAtOnce() const {
+  return maxMergeAtOnce;
+}
+
+void TieredMergePolicy::setMaxMergeAtOnceExplicit(int32_t v) {
+  if (v < 2)
+    _CLTHROWA(CL_ERR_IllegalArgument, "maxMergeAtOnceExplicit must be > 1");
+  maxMergeAtOnceExplicit = v;
+}
+int32_t TieredMergePolicy::getMaxMergeAtOnceExplicit() const {
+  return maxMergeAtOnceExplicit;
+}
+
+void TieredMergePolicy::setMaxMergedSegmentMB(float_t v) {
+  if (v <= 0)
+    _CLTHROWA(CL_ERR_IllegalArgument, "maxMergedSegmentMB must be > 0");
+  maxMergedSegmentBytes = (int64_t)(v*1024*1024);
+}
+float_t TieredMergePolicy::getMaxMergedSegmentMB() const {
+  return ((float_t)maxMergedSegmentBytes)/1024/1024;
+}
+
+void TieredMergePolicy::setReclaimDeletesWeight(float_t v) {
+  if (v < 0)
+    _CLTHROWA(CL_ERR_IllegalArgument, "reclaimDeletesWeight must be >= 0");
+  reclaimDeletesWeight = v;
+}
+float_t TieredMergePolicy::getReclaimDeletesWeight() const {
+  return reclaimDeletesWeight;
+}
+
+void TieredMergePolicy::setFloorSegmentMB(float_t v) {
+  if (v <= 0)
+    _CLTHROWA(CL_ERR_IllegalArgument, "floorSegmentMB must be > 0");
+  floorSegmentBytes = (int64_t)(v*1024*1024);
+}
+float_t TieredMergePolicy::getFloorSegmentMB() const {
+  return ((float_t)floorSegmentBytes)/1024/1024;
+}
+
+void TieredMergePolicy::setExpungeDeletesPctAllowed(float_t v) {
+  if (v < 0 || v > 100)
+    _CLTHROWA(CL_ERR_IllegalArgument, "expungeDeletesPctAllowed must be between 0 and 100");
+  expungeDeletesPctAllowed = v;
+}
+float_t TieredMergePolicy::getExpungeDeletesPctAllowed() const {
+  return expungeDeletesPctAllowed;
+}
+
+void TieredMergePolicy::setSegmentsPerTier(float_t v) {
+  if (v < 2)
+    _CLTHROWA(CL_ERR_IllegalArgument, "segmentsPerTier must be >= 2");
+  segsPerTier = v;
+}
+float_t TieredMergePolicy::getSegmentsPerTier() const {
+  return segsPerTier;
+}
+
+void TieredMergePolicy::setUseCompoundFile(bool useCompoundFile) {
+  this->_useCompoundFile = useCompoundFile;
+}
+bool TieredMergePolicy::getUseCompoundFile() const {
+  return _useCompoundFile;
+}
+void TieredMergePolicy::setUseCompoundDocStore(bool useCompoundDocStore) {
+  this->_useCompoundDocStore = useCompoundDocStore;
+}
+bool TieredMergePolicy::getUseCompoundDocStore() const {
+  return _useCompoundDocStore;
+}
+
+bool TieredMergePolicy::useCompoundFile(SegmentInfos* /*infos*/, SegmentInfo* /*info*/) {
+  return _useCompoundFile;
+}
+bool TieredMergePolicy::useCompoundDocStore(SegmentInfos* /*infos*/) {
+  return _useCompoundDocStore;
+}
+void TieredMergePolicy::close() {}
+
+void TieredMergePolicy::sortedSizes(SegmentInfos* infos, std::vector<SegmentSize>& sizes) {
+  const int32_t numSegments = infos->size();
+  sizes.resize(numSegments);
+  for(int32_t i=0;i<numSegments;i++) {
+    SegmentSize& s = sizes[i];
+    s.info = infos->info(i);
+    s.pos = i;
+    s.bytes = s.info->sizeInBytes();
+    s.delCount = writer->numDeletedDocs(s.info);
+    const int32_t docCount = s.info->docCount;
+    s.size = docCount <= 0 ? s.bytes :
+      (int64_t)(s.bytes * (1.0 - (double)s.delCount / docCount));
+    s.merging = writer->isMerging(s.info);
+    s.selected = false;
+  }
+  std::sort(sizes.begin(), sizes.end(), SegmentSize::bySizeDescending);
+}
+
+int64_t TieredMergePolicy::floorSize(int64_t bytes) const {
+  return bytes > floorSegmentBytes ? bytes : floorSegmentBytes;
+}
+
+float_t TieredMergePolicy::score(const std::vector<SegmentSize*>& candidate, bool hitTooLarge) const {
+  int64_t totBeforeMergeBytes = 0;
+  int64_t totAfterMergeBytes = 0;
+  int64_t totAfterMergeBytesFloored = 0;
+  for(size_t i=0;i<candidate.size();i++) {
+    totAfterMergeBytes += candidate[i]->size;
+    totAfterMergeBytesFloored += floorSize(candidate[i]->size);
+    totBeforeMergeBytes += candidate[i]->bytes;
+  }
+
+  // Roughly measure "skew" of the merge, i.e. how
+  // "balanced" the merge is (whether it merges segments
+  // of about the same size), which can be in [0..1]
+  double skew;
+  if (hitTooLarge)
+    // Pretend the merge has perfect skew; skew doesn't
+    // matter in this case because this merge will not
+    // "cascade" and so it cannot lead to N^2 merge cost
+    // over time:
+    skew = 1.0/maxMergeAtOnce;
+  else
+    skew = ((double)floorSize(candidate[0]->size))/totAfterMergeBytesFloored;
+
+  // Strongly favor merges with less skew (smaller
+  // mergeScore is better):
+  double mergeScore = skew;
+
+  // Gently favor smaller merges over bigger ones.  We
+  // don't want to make this exponent too large else we
+  // can end up doing poor merges of small segments in
+  // order to avoid the large merges:
+  mergeScore *= pow((double)totAfterMergeBytes, 0.05);
+
+  // Strongly favor merges that reclaim deletes:
+  const double nonDelRatio = totBeforeMergeBytes <= 0 ? 1.0 :
+    ((double)totAfterMergeBytes)/totBeforeMergeBytes;
+  mergeScore *= pow(nonDelRatio, (double)reclaimDeletesWeight);
+
+  return (float_t)mergeScore;
+}
+
+MergePolicy::OneMerge* TieredMergePolicy::newMerge(SegmentInfos* /*infos*/, const std::vector<SegmentSize*>& candidate) const {
+  // keep the segments in the order of the index, so that segments
+  // that share their doc stores can still share them after the merge
+  std::vector<SegmentSize*> ordered(candidate);
+  std::sort(ordered.begin(), ordered.end(), SegmentSize::byPosition);
+  SegmentInfos* range = _CLNEW SegmentInfos;
+  for(size_t i=0;i<ordered.size();i++)
+    range->add(ordered[i]->info);
+  return _CLNEW OneMerge(range, _useCompoundFile);
+}
+
+bool TieredMergePolicy::isOptimized(SegmentInfo* info){
+  return !info->hasDeletions() &&
+    !info->hasSeparateNorms() &&
+    info->dir == writer->getDirectory() &&
+    info->getUseCompoundFile() == _useCompoundFile;
+}
+
+MergePolicy::MergeSpecification* TieredMergePolicy::findMerges(SegmentInfos* infos, IndexWriter* writer){
+  this->writer = writer;
+  MESSAGE( string("findMerges: ") + Misc::toString(infos->size()) + " segments");
+  if (infos->size() == 0)
+    return NULL;
+
+  std::vector<SegmentSize> sizes;
+  sortedSizes(infos, sizes);
+
+  // Compute total index bytes & print details about the index
+  int64_t totIndexBytes = 0;
+  int64_t minSegmentBytes = LUCENE_INT64_MAX_SHOULDBE;
+  for(size_t i=0;i<sizes.size();i++) {
+    totIndexBytes += sizes[i].size;
+    minSegmentBytes = cl_min(sizes[i].size, minSegmentBytes);
+  }
+
+  // If we have too-large segments, grace them out
+  // of the maxSegmentCount:
+  size_t tooBigCount = 0;
+  while (tooBigCount < sizes.size() && sizes[tooBigCount].size >= maxMergedSegmentBytes/2) {
+    totIndexBytes -= sizes[tooBigCount].size;
+    tooBigCount++;
+  }
+
+  minSegmentBytes = floorSize(minSegmentBytes);
+
+  // Compute max allowed segs in the index
+  int64_t levelSize = minSegmentBytes;
+  int64_t bytesLeft = totIndexBytes;
+  double allowedSegCount = 0;
+  while(true) {
+    const double segCountLevel = bytesLeft / (double) levelSize;
+    if (segCountLevel < segsPerTier) {
+      allowedSegCount += ceil(segCountLevel);
+      break;
+    }
+    allowedSegCount += segsPerTier;
+    bytesLeft -= (int64_t)(segsPerTier * levelSize);
+    levelSize *= maxMergeAtOnce;
+  }
+  const int32_t allowedSegCountInt = (int32_t) allowedSegCount;
+  MESSAGE( string("  allowedSegmentCount=") + Misc::toString(allowedSegCountInt) + " vs count=" + Misc::toString((int32_t)sizes.size()) + " (eligible count=" + Misc::toString((int32_t)(sizes.size() - tooBigCount)) + ") tooBigCount=" + Misc::toString((int32_t)tooBigCount));
+
+  MergeSpecification* spec = NULL;
+
+  // Cycle to possibly select more than one merge:
+  while(true) {
+    int64_t mergingBytes = 0;
+
+    // Gather eligible segments for merging, ie segments
+    // not already being merged and not already picked (by
+    // prior iteration of this loop) for merging:
+    std::vector<SegmentSize*> eligible;
+    for(size_t i=tooBigCount;i<sizes.size();i++) {
+      if (sizes[i].merging)
+        mergingBytes += sizes[i].bytes;
+      else if (!sizes[i].selected)
+        eligible.push_back(&sizes[i]);
+    }
+
+    const bool maxMergeIsRunning = mergingBytes >= maxMergedSegmentBytes;
+
+    if (eligible.size() == 0 || (int32_t)eligible.size() <= allowedSegCountInt)
+      break;
+
+    // OK we are over budget -- find best merge!
+    std::vector<SegmentSize*> best;
+    float_t bestScore = 0;
+    bool bestTooLarge = false;
+    int64_t bestMergeBytes = 0;
+
+    // Consider all merge starts:
+    for(int32_t startIdx = 0;startIdx <= (int32_t)eligible.size()-maxMergeAtOnce; startIdx++) {
+      int64_t totAfterMergeBytes = 0;
+      std::vector<SegmentSize*> candidate;
+      bool hitTooLarge = false;
+      for(size_t idx = startIdx;idx<eligible.size() && (int32_t)candidate.size() < maxMergeAtOnce;idx++) {
+        SegmentSize* s = eligible[idx];
+        if (totAfterMergeBytes + s->size > maxMergedSegmentBytes) {
+          hitTooLarge = true;
+          // NOTE: we continue, so that we can try
+          // "packing" smaller segments into this merge
+          // to see if we can get closer to the max
+          // size; this in general is not perfect since
+          // this is really "bin packing" and we'd have
+          // to try different permutations.
+          continue;
+        }
+        candidate.push_back(s);
+        totAfterMergeBytes += s->size;
+      }
+
+      const float_t candidateScore = score(candidate, hitTooLarge);
+      if ((best.size() == 0 || candidateScore < bestScore) && (!hitTooLarge || !maxMergeIsRunning)) {
+        best.swap(candidate);
+        bestScore = candidateScore;
+        bestTooLarge = hitTooLarge;
+        bestMergeBytes = totAfterMergeBytes;
+      }
+    }
+
+    if (best.size() == 0)
+      break;
+
+    if (spec == NULL)
+      spec = _CLNEW MergeSpecification();
+    OneMerge* _merge = newMerge(infos, best);
+    spec->add(_merge);
+    for(size_t i=0;i<best.size();i++)
+      best[i]->selected = true;
+
+    MESSAGE( string("  add merge=") + _merge->segString(writer->getDirectory()) + " size=" + Misc::toString((int64_t)(bestMergeBytes/1024)) + " KB score=" + Misc::toString(bestScore) + (bestTooLarge ? " [max merge]" : ""));
+  }
+
+  return spec;
+}
+
+MergePolicy::MergeSpecification* TieredMergePolicy::findMergesForOptimize(SegmentInfos* infos, IndexWriter* writer, int32_t maxSegmentCount, std::vector<SegmentInfo*>& segmentsToOptimize){
+  this->writer = writer;
+  MESSAGE( string("findMergesForOptimize maxSegmentCount=") + Misc::toString(maxSegmentCount) + " infos=" + Misc::toString(infos->size()) + " segmentsToOptimize=" + Misc::toString((int32_t)segmentsToOptimize.size()));
+
+  std::vector<SegmentSize> sizes;
+  sortedSizes(infos, sizes);
+
+  std::vector<SegmentSize*> eligible;
+  bool optimizeMergeRunning = false;
+  for(size_t i=0;i<sizes.size();i++) {
+    if (std::find(segmentsToOptimize.begin(), segmentsToOptimize.end(), sizes[i].info) == segmentsToOptimize.end())
+      continue;
+    if (sizes[i].merging)
+      optimizeMergeRunning = true;
+    else
+      eligible.push_back(&sizes[i]);
+  }
+
+  if (eligible.size() == 0)
+    return NULL;
+
+  if ((maxSegmentCount > 1 && (int32_t)eligible.size() <= maxSegmentCount) ||
+      (maxSegmentCount == 1 && eligible.size() == 1 && isOptimized(eligible[0]->info))) {
+    MESSAGE("already optimized");
+    return NULL;
+  }
+
+  MergeSpecification* spec = NULL;
+
+  // Do full merges, first, backwards:
+  int32_t end = (int32_t)eligible.size();
+  while(end >= maxMergeAtOnceExplicit + maxSegmentCount - 1) {
+    if (spec == NULL)
+      spec = _CLNEW MergeSpecification();
+    std::vector<SegmentSize*> candidate(eligible.begin() + (end-maxMergeAtOnceExplicit), eligible.begin() + end);
+    OneMerge* _merge = newMerge(infos, candidate);
+    MESSAGE( string("add merge=") + _merge->segString(writer->getDirectory()));
+    spec->add(_merge);
+    end -= maxMergeAtOnceExplicit;
+  }
+
+  if (spec == NULL && !optimizeMergeRunning) {
+    // Do final merge
+    const int32_t numToMerge = end - maxSegmentCount + 1;
+    std::vector<SegmentSize*> candidate(eligible.begin() + (end-numToMerge), eligible.begin() + end);
+    OneMerge* _merge = newMerge(infos, candidate);
+    MESSAGE( string("add final merge=") + _merge->segString(writer->getDirectory()));
+    spec = _CLNEW MergeSpecification();
+    spec->add(_merge);
+  }
+
+  return spec;
+}
+
+MergePolicy::MergeSpecification* TieredMergePolicy::findMergesToExpungeDeletes(SegmentInfos* infos, IndexWriter* writer){
+  this->writer = writer;
+  MESSAGE( string("findMergesToExpungeDeletes infos=") + Misc::toString(infos->size()) + " expungeDeletesPctAllowed=" + Misc::toString(expungeDeletesPctAllowed));
+
+  std::vector<SegmentSize> sizes;
+  sortedSizes(infos, sizes);
+
+  std::vector<SegmentSize*> eligible;
+  for(size_t i=0;i<sizes.size();i++) {
+    const int32_t docCount = sizes[i].info->docCount;
+    const double pctDeletes = docCount <= 0 ? 0 : 100.0*sizes[i].delCount/docCount;
+    if (pctDeletes > expungeDeletesPctAllowed && !sizes[i].merging)
+      eligible.push_back(&sizes[i]);
+  }
+
+  if (eligible.size() == 0)
+    return NULL;
+
+  MergeSpecification* spec = _CLNEW MergeSpecification();
+  size_t start = 0;
+  while(start < eligible.size()) {
+    const size_t end = cl_min(start + maxMergeAtOnceExplicit, eligible.size());
+    std::vector<SegmentSize*> candidate(eligible.begin() + start, eligible.begin() + end);
+    OneMerge* _merge = newMerge(infos, candidate);
+    MESSAGE( string("add merge=") + _merge->segString(writer->getDirectory()));
+    spec->add(_merge);
+    start = end;
+  }
+
+  return spec;
+}
+
+const char* TieredMergePolicy::getClassName(){
+  return "TieredMergePolicy";
+}
+const char* TieredMergePolicy::getObjectName() const{
+  return getClassName();
+}
+
+
 CL_NS_END
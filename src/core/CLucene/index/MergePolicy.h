@@ -57,12 +57,14 @@ public:
     SegmentInfo* info;               // used by IndexWriter
     bool mergeDocStores;         // used by IndexWriter
     bool optimize;               // used by IndexWriter
+    bool expungeDeletes;         // used by IndexWriter
     SegmentInfos* segmentsClone;     // used by IndexWriter
     bool increfDone;             // used by IndexWriter
     bool registerDone;           // used by IndexWriter
     int64_t mergeGen;                  // used by IndexWriter
     bool isExternal;             // used by IndexWriter
     int32_t maxNumSegmentsOptimize;     // used by IndexWriter
+    int32_t* sortedDocMap;             // used by IndexWriter, if the merged docs were sorted
 
     SegmentInfos* segments;
     const bool useCompoundFile;
@@ -155,6 +157,18 @@ public:
                                                     int32_t maxSegmentCount,
                                                     std::vector<SegmentInfo*>& segmentsToOptimize) = 0;
 
+  /**
+   * Determine what set of merge operations is necessary in
+   * order to expunge all deletes from the index.  The
+   * IndexWriter calls this when its expungeDeletes() method
+   * is called.
+   *
+   * @param segmentInfos the total set of segments in the index
+   * @param writer IndexWriter instance
+   */
+  virtual MergeSpecification* findMergesToExpungeDeletes(SegmentInfos* segmentInfos,
+                                                         IndexWriter* writer) = 0;
+
   /**
    * Release all resources for the policy.
    */
@@ -308,6 +322,13 @@ public:
    *  MergeScheduler} to use concurrency. */
   MergeSpecification* findMerges(SegmentInfos* infos, IndexWriter* writer);
 
+  /**
+   * Finds merges necessary to expunge all deletes from the
+   * index.  We simply merge adjacent segments that have
+   * deletes, up to mergeFactor at a time.
+   */
+  MergeSpecification* findMergesToExpungeDeletes(SegmentInfos* infos, IndexWriter* writer);
+
   /** <p>Determines the largest segment (measured by
    * document count) that may be merged with other segments.
    * Small values (e.g., less than 10,000) are best for
@@ -432,6 +453,149 @@ public:
 };
 
 
+/**
+ * <p>Merges segments of roughly equal size, which need not be adjacent in
+ * the index, subject to an allowed number of segments per tier. This is
+ * like {@link LogByteSizeMergePolicy}, except that it is able to merge
+ * non-adjacent segments, and separates how many segments are merged at
+ * once ({@link #setMaxMergeAtOnce}) from how many segments are allowed
+ * per tier ({@link #setSegmentsPerTier}). It also does not over-merge
+ * (that is, cascade merges).</p>
+ *
+ * <p>For normal merging, this policy first computes a "budget" of how many
+ * segments are allowed to be in the index. If the index is over-budget,
+ * then the policy sorts segments by decreasing size (pro-rating by percent
+ * deletes), and then finds the least-cost merge. Merge cost is measured by
+ * a combination of the "skew" of the merge (size of largest segment
+ * divided by the total size of the merge), the total merge size and the
+ * percent of deletes reclaimed, so that merges with lower skew, smaller
+ * size and that reclaim more deletes are favored.</p>
+ *
+ * <p>If a merge will produce a segment that's larger than {@link
+ * #setMaxMergedSegmentMB}, then the policy will merge fewer segments
+ * (down to 1 at once, if that one has deletions) to keep the segment size
+ * under budget. Segments larger than half of that size are only merged by
+ * optimize and expungeDeletes, so large segments are not rewritten over
+ * and over.</p>
+ *
+ * <p><b>NOTE</b>: this policy freely merges non-adjacent segments, so the
+ * documents of an index may be reordered by merges; use {@link
+ * LogMergePolicy} if the order of the documents matters.</p>
+ */
+class CLUCENE_EXPORT TieredMergePolicy: public MergePolicy {
+  struct SegmentSize;
+
+  int32_t maxMergeAtOnce;
+  int64_t maxMergedSegmentBytes;
+  int32_t maxMergeAtOnceExplicit;
+  int64_t floorSegmentBytes;
+  float_t segsPerTier;
+  float_t expungeDeletesPctAllowed;
+  float_t reclaimDeletesWeight;
+  bool _useCompoundFile;
+  bool _useCompoundDocStore;
+  IndexWriter* writer;
+
+  void message(const std::string& message);
+
+  /** Computes the sizes of the segments in infos, sorted by decreasing
+   *  size after deletions */
+  void sortedSizes(SegmentInfos* infos, std::vector<SegmentSize>& sizes);
+
+  int64_t floorSize(int64_t bytes) const;
+
+  /** Returns the cost of merging the candidate segments, lower is better */
+  float_t score(const std::vector<SegmentSize*>& candidate, bool hitTooLarge) const;
+
+  /** Returns a merge of the candidate segments, in the order of infos */
+  OneMerge* newMerge(SegmentInfos* infos, const std::vector<SegmentSize*>& candidate) const;
+
+  bool isOptimized(SegmentInfo* info);
+
+public:
+  TieredMergePolicy();
+
+  /** Maximum number of segments to be merged at a time
+   *  during "normal" merging.  For explicit merging (eg,
+   *  optimize or expungeDeletes was called), see {@link
+   *  #setMaxMergeAtOnceExplicit}.  Default is 10. */
+  void setMaxMergeAtOnce(int32_t v);
+  int32_t getMaxMergeAtOnce() const;
+
+  /** Maximum number of segments to be merged at a time,
+   *  during optimize or expungeDeletes. Default is 30. */
+  void setMaxMergeAtOnceExplicit(int32_t v);
+  int32_t getMaxMergeAtOnceExplicit() const;
+
+  /** Maximum sized segment to produce during
+   *  normal merging.  This setting is approximate: the
+   *  estimate of the merged segment size is made by summing
+   *  sizes of to-be-merged segments (compensating for
+   *  percent deleted docs).  Default is 5 GB. */
+  void setMaxMergedSegmentMB(float_t v);
+  float_t getMaxMergedSegmentMB() const;
+
+  /** Controls how aggressively merges that reclaim more
+   *  deletions are favored.  Higher values favor selecting
+   *  merges that reclaim deletions.  A value of 0.0 means
+   *  deletions don't impact merge selection.  Default is 2.0. */
+  void setReclaimDeletesWeight(float_t v);
+  float_t getReclaimDeletesWeight() const;
+
+  /** Segments smaller than this are "rounded up" to this
+   *  size, ie treated as equal (floor) size for merge
+   *  selection.  This is to prevent frequent flushing of
+   *  tiny segments from allowing a long tail in the index.
+   *  Default is 2 MB. */
+  void setFloorSegmentMB(float_t v);
+  float_t getFloorSegmentMB() const;
+
+  /** When expungeDeletes is called, we only merge away a
+   *  segment if its delete percentage is over this
+   *  threshold.  Default is 10%. */
+  void setExpungeDeletesPctAllowed(float_t v);
+  float_t getExpungeDeletesPctAllowed() const;
+
+  /** Sets the allowed number of segments per tier.  Smaller
+   *  values mean more merging but fewer segments.  This
+   *  should be >= {@link #setMaxMergeAtOnce} otherwise
+   *  you'll force too much merging to occur.  Default is 10. */
+  void setSegmentsPerTier(float_t v);
+  float_t getSegmentsPerTier() const;
+
+  /** Sets whether compound file format should be used for
+   *  newly flushed and newly merged segments.  Default is true. */
+  void setUseCompoundFile(bool useCompoundFile);
+  bool getUseCompoundFile() const;
+
+  /** Sets whether compound file format should be used for
+   *  newly flushed and newly merged doc store segment
+   *  files.  Default is true. */
+  void setUseCompoundDocStore(bool useCompoundDocStore);
+  bool getUseCompoundDocStore() const;
+
+  MergeSpecification* findMerges(SegmentInfos* infos, IndexWriter* writer);
+
+  /** Merges the segments to optimize, largest first, up to
+   *  maxMergeAtOnceExplicit at a time, until maxSegmentCount
+   *  segments are left. */
+  MergeSpecification* findMergesForOptimize(SegmentInfos* infos,
+                                            IndexWriter* writer,
+                                            int32_t maxSegmentCount,
+                                            std::vector<SegmentInfo*>& segmentsToOptimize);
+
+  /** Merges the segments that have more than
+   *  expungeDeletesPctAllowed percent deleted documents,
+   *  largest first, up to maxMergeAtOnceExplicit at a time. */
+  MergeSpecification* findMergesToExpungeDeletes(SegmentInfos* infos, IndexWriter* writer);
+
+  bool useCompoundFile(SegmentInfos* infos, SegmentInfo* info);
+  bool useCompoundDocStore(SegmentInfos* infos);
+  void close();
+
+  static const char* getClassName();
+  virtual const char* getObjectName() const;
+};
 
 CL_NS_END
 #endif
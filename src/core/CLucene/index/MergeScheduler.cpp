@@ -12,6 +12,15 @@
 CL_NS_DEF(index)
 
 
+int32_t MergeScheduler::getMergeThreadCount(){
+	return 1;
+}
+
+SerialMergeScheduler::SerialMergeScheduler():
+	maxThreadCount(1)
+{
+}
+
 const char* SerialMergeScheduler::getObjectName() const{
 	return getClassName();
 }
@@ -31,4 +40,18 @@ void SerialMergeScheduler::merge(IndexWriter* writer){
 
 void SerialMergeScheduler::close() {}
 
+void SerialMergeScheduler::setMaxThreadCount(int32_t count){
+  if (count < 1)
+    _CLTHROWA(CL_ERR_IllegalArgument, "count should be at least 1");
+  maxThreadCount = count;
+}
+
+int32_t SerialMergeScheduler::getMaxThreadCount() const{
+  return maxThreadCount;
+}
+
+int32_t SerialMergeScheduler::getMergeThreadCount(){
+  return maxThreadCount;
+}
+
 CL_NS_END
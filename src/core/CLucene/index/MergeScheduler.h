@@ -27,20 +27,36 @@ public:
 
   /** Close this MergeScheduler. */
   virtual void close() = 0;
+
+  /** Returns the number of threads a merge that starts now may use to
+   *  merge the postings, stored fields, term vectors and norms of its
+   *  segments concurrently. The default is 1: every part is merged one
+   *  after the other by the thread that runs the merge. */
+  virtual int32_t getMergeThreadCount();
 };
 
 /** A {@link MergeScheduler} that simply does each merge
  *  sequentially, using the current thread. */
 class CLUCENE_EXPORT SerialMergeScheduler: public MergeScheduler {
+  int32_t maxThreadCount;
 public:
   DEFINE_MUTEX(THIS_LOCK)
 
+  SerialMergeScheduler();
+
   /** Just do the merges in sequence. We do this
    * "synchronized" so that even if the application is using
    * multiple threads, only one merge may run at a time. */
   void merge(IndexWriter* writer);
   void close();
 
+  /** Sets the number of threads the merges may use. Since only one
+   *  merge runs at a time, every merge may use all of them to merge
+   *  its parts concurrently. The default is 1. */
+  void setMaxThreadCount(int32_t count);
+  int32_t getMaxThreadCount() const;
+  int32_t getMergeThreadCount();
+
   const char* getObjectName() const;
   static const char* getClassName();
 };
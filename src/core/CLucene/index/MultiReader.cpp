@@ -27,6 +27,8 @@ CL_NS_DEF(index)
 class MultiReader::Internal: LUCENE_BASE{
 public:
   MultiSegmentReader::NormsCacheType normsCache;
+  DocValuesCacheType docValuesCache;
+  DocValuesCacheType directDocValuesCache;
 
   bool* closeOnClose; //remember which subreaders to close on close
   bool _hasDeletions;
@@ -35,7 +37,9 @@ public:
   int32_t _numDocs;
 
 	Internal():
-  		normsCache(true, true)
+  		normsCache(true, true),
+  		docValuesCache(true, true),
+  		directDocValuesCache(true, true)
 	{
     _maxDoc        = 0;
     _numDocs       = -1;
@@ -246,6 +250,19 @@ void MultiReader::norms(const TCHAR* field, uint8_t* result) {
 	}
 }
 
+DocValues* MultiReader::getDocValues(const TCHAR* field, const bool inRAM){
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+	ensureOpen();
+	DocValuesCacheType& cache = inRAM ? _internal->docValuesCache : _internal->directDocValuesCache;
+	if ( cache.exists((TCHAR*)field) )
+	  return cache.get((TCHAR*)field);
+
+	//fields without values are cached as NULL
+	DocValues* ret = MultiDocValues::create(subReaders, starts, maxDoc(), field, inRAM);
+	cache.put(STRDUP_TtoT(field), ret);
+	return ret;
+}
+
 
 void MultiReader::doSetNorm(int32_t n, const TCHAR* field, uint8_t value){
 	_internal->normsCache.removeitr( _internal->normsCache.find((TCHAR*)field) );                         // clear cache
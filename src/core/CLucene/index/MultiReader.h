@@ -94,6 +94,9 @@ public:
 	bool hasDeletions() const;
 	uint8_t* norms(const TCHAR* field);
 	void norms(const TCHAR* field, uint8_t* result);
+
+	// synchronized
+	DocValues* getDocValues(const TCHAR* field, const bool inRAM=true);
 	TermEnum* terms();
 	TermEnum* terms(const Term* term);
 
@@ -45,7 +45,9 @@ void MultiSegmentReader::initialize(CL_NS(util)::ArrayBase<IndexReader*>* _subRe
 
 MultiSegmentReader::MultiSegmentReader(CL_NS(store)::Directory* directory, SegmentInfos* sis, bool closeDirectory):
   DirectoryIndexReader(directory,sis,closeDirectory),
-  normsCache(NormsCacheType(true,true))
+  normsCache(NormsCacheType(true,true)),
+  docValuesCache(true,true),
+  directDocValuesCache(true,true)
 {
   // To reduce the chance of hitting FileNotFound
   // (and having to retry), we open segments in
@@ -83,7 +85,9 @@ MultiSegmentReader::MultiSegmentReader(
       int32_t* oldStarts,
       NormsCacheType* oldNormsCache):
   DirectoryIndexReader(directory, infos, closeDirectory),
-  normsCache(NormsCacheType(true,true))
+  normsCache(NormsCacheType(true,true)),
+  docValuesCache(true,true),
+  directDocValuesCache(true,true)
 {
   // we put the old SegmentReaders in a map, that allows us
   // to lookup a reader using its segment name
@@ -317,6 +321,19 @@ void MultiSegmentReader::norms(const TCHAR* field, uint8_t* result) {
 	  (*subReaders)[i]->norms(field, result + starts[i]);
 }
 
+DocValues* MultiSegmentReader::getDocValues(const TCHAR* field, const bool inRAM){
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+	ensureOpen();
+	DocValuesCacheType& cache = inRAM ? docValuesCache : directDocValuesCache;
+	if ( cache.exists((TCHAR*)field) )
+	  return cache.get((TCHAR*)field);
+
+	//fields without values are cached as NULL
+	DocValues* ret = MultiDocValues::create(subReaders, starts, maxDoc(), field, inRAM);
+	cache.put(STRDUP_TtoT(field), ret);
+	return ret;
+}
+
 
 void MultiSegmentReader::doSetNorm(int32_t n, const TCHAR* field, uint8_t value){
 	normsCache.removeitr( normsCache.find((TCHAR*)field) );                         // clear cache
@@ -15,6 +15,7 @@
 
 #include "CLucene/store/Directory.h"
 #include "CLucene/util/Misc.h"
+#include "CLucene/util/BitSet.h"
 
 CL_NS_USE(store)
 CL_NS_USE(util)
@@ -31,6 +32,8 @@ SegmentInfo::SegmentInfo(const char* _name, const int32_t _docCount, CL_NS(store
 			isCompoundFile(_isCompoundFile ? SegmentInfo::YES : SegmentInfo::NO),
 			hasSingleNormFile(_hasSingleNormFile),
 			_sizeInBytes(-1),
+			delCount(0),
+			delCountGen(SegmentInfo::NO),
 			docStoreOffset(_docStoreOffset),
       docStoreSegment( _docStoreSegment == NULL ? "" : _docStoreSegment ),
 			docStoreIsCompoundFile(_docStoreIsCompoundFile)
@@ -66,7 +69,9 @@ string SegmentInfo::segString(Directory* dir) {
     Misc::toString(docCount) + docStore;
 }
    SegmentInfo::SegmentInfo(CL_NS(store)::Directory* _dir, int32_t format, CL_NS(store)::IndexInput* input):
-     _sizeInBytes(-1)
+     _sizeInBytes(-1),
+     delCount(0),
+     delCountGen(SegmentInfo::NO)
    {
 	   this->dir = _dir;
 
@@ -131,6 +136,7 @@ string SegmentInfo::segString(Directory* dir) {
 	   dir = src->dir;
 	   preLockless = src->preLockless;
 	   delGen = src->delGen;
+	   delCountGen = NO;
 	   docStoreOffset = src->docStoreOffset;
 	   docStoreIsCompoundFile = src->docStoreIsCompoundFile;
 	   if (src->normGen.values == NULL) {
@@ -322,6 +328,16 @@ string SegmentInfo::segString(Directory* dir) {
 	   }
    }
 
+   int32_t SegmentInfo::getDelCount() {
+	   if (!hasDeletions())
+		   return 0;
+	   if (delCountGen != delGen) {
+		   delCount = BitSet::readCount(dir, getDelFileName().c_str());
+		   delCountGen = delGen;
+	   }
+	   return delCount;
+   }
+
    void SegmentInfo::advanceDelGen() {
 	   // delGen 0 is reserved for pre-LOCKLESS format
 	   if (delGen == NO) {
@@ -341,6 +357,8 @@ string SegmentInfo::segString(Directory* dir) {
 	   SegmentInfo* si = _CLNEW SegmentInfo(name.c_str(), docCount, dir);
 	   si->isCompoundFile = isCompoundFile;
 	   si->delGen = delGen;
+	   si->delCount = delCount;
+	   si->delCountGen = delCountGen;
 	   si->preLockless = preLockless;
 	   si->hasSingleNormFile = hasSingleNormFile;
 	   if (this->normGen.values != NULL) {
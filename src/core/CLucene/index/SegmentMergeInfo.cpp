@@ -26,6 +26,8 @@ SegmentMergeInfo::SegmentMergeInfo(const int32_t b, TermEnum* te, IndexReader* r
     CND_PRECONDITION(b >= 0, "b is a negative number");
 
     postings=NULL;
+    freqStream=NULL;
+    proxStream=NULL;
 	term   = te->term();
 }
 
@@ -68,6 +70,17 @@ TermPositions* SegmentMergeInfo::getPositions() {
     return postings;
 }
 
+CL_NS(store)::IndexInput* SegmentMergeInfo::getFreqStream() {
+    if (freqStream == NULL && reader->instanceOf(SegmentReader::getClassName()))
+    	freqStream = ((SegmentReader*)reader)->freqStream->clone();
+    return freqStream;
+}
+
+CL_NS(store)::IndexInput* SegmentMergeInfo::getProxStream() {
+    if (proxStream == NULL && reader->instanceOf(SegmentReader::getClassName()))
+    	proxStream = ((SegmentReader*)reader)->proxStream->clone();
+    return proxStream;
+}
 
 bool SegmentMergeInfo::next() {
 //Func - Moves the current term of the enumeration termEnum to the next and term
@@ -95,6 +108,14 @@ void SegmentMergeInfo::close() {
         postings->close();
         _CLVDELETE(postings); //todo: not a clucene object... should be
     }
+    if ( freqStream != NULL ){
+        freqStream->close();
+        _CLDELETE(freqStream);
+    }
+    if ( proxStream != NULL ){
+        proxStream->close();
+        _CLDELETE(proxStream);
+    }
 
     if ( termEnum != NULL ){
         termEnum->close();
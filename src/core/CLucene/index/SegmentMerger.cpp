@@ -17,11 +17,19 @@
 #include "CLucene/index/_IndexFileNames.h"
 #include "_CompoundFile.h"
 #include "_SkipListWriter.h"
+#include "_SegmentTermEnum.h"
+#include "_DocValues.h"
 #include "CLucene/document/FieldSelector.h"
+#include "CLucene/search/Sort.h"
+#include "CLucene/search/FieldCache.h"
+#include "CLucene/util/_ThreadLocal.h"
+#include "CLucene/config/_threads.h"
+#include <algorithm>
 
 CL_NS_USE(util)
 CL_NS_USE(document)
 CL_NS_USE(store)
+CL_NS_USE(search)
 CL_NS_DEF(index)
 
 const uint8_t SegmentMerger::NORMS_HEADER[] = {'N','R','M', (uint8_t)-1};
@@ -37,6 +45,14 @@ void SegmentMerger::init(){
   fieldInfos       = NULL;
   checkAbort       = NULL;
   skipInterval     = 0;
+  hasDocValues     = false;
+  indexSort        = NULL;
+  isSorted         = false;
+  sortedDocMap     = NULL;
+  threadCount      = 1;
+  parent           = NULL;
+  minField         = NULL;
+  maxField         = NULL;
 }
 
 SegmentMerger::SegmentMerger(IndexWriter* writer, const char* name, MergePolicy::OneMerge* merge){
@@ -57,6 +73,27 @@ SegmentMerger::SegmentMerger(IndexWriter* writer, const char* name, MergePolicy:
   this->maxSkipLevels = 0;
 }
 
+SegmentMerger::SegmentMerger(SegmentMerger* parent, const std::string& name, const TCHAR* minField, const TCHAR* maxField){
+  this->init();
+  this->parent = parent;
+  this->directory = parent->directory;
+  this->segment = name;
+  this->minField = minField;
+  this->maxField = maxField;
+
+  // the readers and the rest of the merge state belong to the parent
+  readers.setDoDelete(false);
+  for (size_t i = 0; i < parent->readers.size(); i++)
+    readers.push_back(parent->readers[i]);
+  this->fieldInfos = parent->fieldInfos;
+  this->checkAbort = parent->checkAbort;
+  this->sortedDocMap = parent->sortedDocMap;
+  this->mergeDocStores = parent->mergeDocStores;
+  this->termIndexInterval = parent->termIndexInterval;
+  this->mergedDocs = parent->mergedDocs;
+  this->maxSkipLevels = 0;
+}
+
 SegmentMerger::~SegmentMerger(){
 //Func - Destructor
 //Pre  - true
@@ -65,6 +102,12 @@ SegmentMerger::~SegmentMerger(){
 	//Clear the readers set
 	readers.clear();
 
+	if (parent != NULL) {
+		fieldInfos = NULL;
+		checkAbort = NULL;
+		sortedDocMap = NULL;
+	}
+
 	//Delete field Infos
 	_CLDELETE(fieldInfos);
 	//Close and destroy the IndexOutput to the Frequency File
@@ -90,6 +133,7 @@ SegmentMerger::~SegmentMerger(){
 
   _CLDELETE(checkAbort);
   _CLDELETE(skipListWriter);
+  _CLDELETE_ARRAY(sortedDocMap);
 
 }
 
@@ -116,9 +160,34 @@ IndexReader* SegmentMerger::segmentReader(const int32_t i) {
     return ret;
 }
 
+void SegmentMerger::setIndexSort(const SortField* sort) {
+  this->indexSort = sort;
+}
+
+int32_t* SegmentMerger::releaseSortedDocMap() {
+  int32_t* ret = sortedDocMap;
+  sortedDocMap = NULL;
+  return ret;
+}
+
+void SegmentMerger::setThreadCount(const int32_t count) {
+  if (count < 1)
+    _CLTHROWA(CL_ERR_IllegalArgument, "count should be at least 1");
+  this->threadCount = count;
+}
+
+void SegmentMerger::setDirectory(Directory* dir) {
+  this->directory = dir;
+}
+
 int32_t SegmentMerger::merge(bool mergeDocStores) {
   this->mergeDocStores = mergeDocStores;
 
+  // documents can only be renumbered when their stored
+  // fields and vectors are rewritten
+  if (indexSort != NULL && mergeDocStores)
+    sortDocuments();
+
   // NOTE: it's important to add calls to
   // checkAbort.work(...) if you make any changes to this
   // method that will spend alot of time.  The frequency
@@ -126,13 +195,27 @@ int32_t SegmentMerger::merge(bool mergeDocStores) {
   // IndexWriter.close(false) takes to actually stop the
   // threads.
 
-  mergedDocs = mergeFields();
+  mergedDocs = mergeFieldInfos();
+
+#ifndef _CL_DISABLE_MULTITHREADING
+  if (threadCount > 1) {
+    mergeConcurrently();
+  } else
+#endif
+  {
+    if (mergeDocStores)
+      mergeFields();
 
-	mergeTerms();
-	mergeNorms();
+	  mergeTerms();
+	  mergeNorms();
+	  mergeDocValues();
+
+	  if (mergeDocStores && fieldInfos->hasVectors())
+		  mergeVectors();
+  }
 
-	if (mergeDocStores && fieldInfos->hasVectors())
-		mergeVectors();
+	if (isSorted)
+		writeIndexSort();
 
 	return mergedDocs;
 }
@@ -172,6 +255,14 @@ void SegmentMerger::createCompoundFile(const char* filename, std::vector<std::st
 		}
 	}
 
+  // Doc values file
+  if (hasDocValues)
+    files->push_back ( segment + "." + IndexFileNames::DOCVALUES_EXTENSION );
+
+  // Index sort file
+  if (isSorted)
+    files->push_back ( segment + "." + IndexFileNames::SORT_EXTENSION );
+
   // Vector files
   if ( mergeDocStores && fieldInfos->hasVectors()) {
     for (int32_t i = 0; i < IndexFileNames::VECTOR_EXTENSIONS().length; i++) {
@@ -215,10 +306,32 @@ public:
 };
 
 
-int32_t SegmentMerger::mergeFields() {
-//Func - Merge the fields of all segments
+void SegmentMerger::setMatchingSegmentReaders() {
+  matchingSegmentReaders.resize(readers.size());
+
+  // If this reader is a SegmentReader, and all of its
+  // field name -> number mappings match the "merged"
+  // FieldInfos, then we can do a bulk copy of the
+  // stored fields and term vectors:
+  for (size_t i = 0; i < readers.size(); i++) {
+    IndexReader* reader = readers[i];
+    if (reader->instanceOf(SegmentReader::getClassName())) {
+      SegmentReader* segmentReader = (SegmentReader*) reader;
+      bool same = true;
+      FieldInfos* segmentFieldInfos = segmentReader->getFieldInfos();
+      for (size_t j = 0; same && j < segmentFieldInfos->size(); j++)
+        same = _tcscmp(fieldInfos->fieldName(j), segmentFieldInfos->fieldName(j)) == 0;
+      if (same) {
+        matchingSegmentReaders.values[i] = segmentReader;
+      }
+    }
+  }
+}
+
+int32_t SegmentMerger::mergeFieldInfos() {
+//Func - Merge the field infos of all segments
 //Pre  - true
-//Post - The field infos and field values of all segments have been merged.
+//Post - The field infos of all segments have been merged and written.
 
   if (!mergeDocStores) {
     // When we are not merging by doc stores, that means
@@ -289,40 +402,50 @@ int32_t SegmentMerger::mergeFields() {
   //Write the new FieldInfos file to the directory
   fieldInfos->write(directory, Misc::segmentname(segment.c_str(),".fnm").c_str() );
 
-	int32_t docCount = 0;
+  if (mergeDocStores)
+    setMatchingSegmentReaders();
 
-  if (mergeDocStores) {
+  // The merged segment has all documents that are not deleted
+	int32_t docCount = 0;
+  for (size_t i = 0; i < readers.size(); i++)
+    docCount += readers[i]->numDocs();
+  return docCount;
+}
 
-    // If the i'th reader is a SegmentReader and has
-    // identical fieldName -> number mapping, then this
-    // array will be non-NULL at position i:
-    ValueArray<SegmentReader*> matchingSegmentReaders(readers.size());
+int32_t SegmentMerger::mergeFields() {
+//Func - Merge the stored fields of all segments
+//Pre  - mergeFieldInfos was called and mergeDocStores is true
+//Post - The field values of all segments have been merged.
 
-    // If this reader is a SegmentReader, and all of its
-    // field name -> number mappings match the "merged"
-    // FieldInfos, then we can do a bulk copy of the
-    // stored fields:
-    for (size_t i = 0; i < readers.size(); i++) {
-      IndexReader* reader = readers[i];
-      if (reader->instanceOf(SegmentReader::getClassName())) {
-        SegmentReader* segmentReader = (SegmentReader*) reader;
-        bool same = true;
-        FieldInfos* segmentFieldInfos = segmentReader->getFieldInfos();
-        for (size_t j = 0; same && j < segmentFieldInfos->size(); j++)
-          same = _tcscmp(fieldInfos->fieldName(j), segmentFieldInfos->fieldName(j)) == 0;
-        if (same) {
-          matchingSegmentReaders.values[i] = segmentReader;
-        }
-      }
-    }
+	int32_t docCount = 0;
 
-    // Used for bulk-reading raw bytes for stored fields
-    ValueArray<int32_t> rawDocLengths(MAX_RAW_MERGE_DOCS);
+  // Used for bulk-reading raw bytes for stored fields
+  ValueArray<int32_t> rawDocLengths(MAX_RAW_MERGE_DOCS);
 
-    // merge field values
-    FieldsWriter fieldsWriter(directory, segment.c_str(), fieldInfos);
+  // merge field values
+  FieldsWriter fieldsWriter(directory, segment.c_str(), fieldInfos);
 
-    try {
+  try {
+    if (sortedDocMap != NULL) {
+      // copy the documents one at a time, in their new order
+      Document doc;
+      FieldSelectorMerge fieldSelectorMerge;
+      for (size_t i = 0; i < sortedDocs.length; i++) {
+        const int32_t j = sortedDocs[i];
+        SegmentReader* matchingSegmentReader = matchingSegmentReaders[sortedReaders[i]];
+        if (matchingSegmentReader != NULL) {
+          IndexInput* stream = matchingSegmentReader->getFieldsReader()->rawDocs(rawDocLengths.values, j, 1);
+          fieldsWriter.addRawDocuments(stream, rawDocLengths.values, 1);
+        } else {
+          doc.clear();
+          readers[sortedReaders[i]]->document(j, doc, &fieldSelectorMerge);
+          fieldsWriter.addDocument(&doc);
+        }
+        docCount++;
+        if (checkAbort != NULL)
+          checkAbort->work(300);
+      }
+    } else {
       for (size_t i = 0; i < readers.size(); i++) {
         IndexReader* reader = readers[i];
         SegmentReader* matchingSegmentReader = matchingSegmentReaders[i];
@@ -365,20 +488,13 @@ int32_t SegmentMerger::mergeFields() {
             j++;
         }
       }
-    } _CLFINALLY (
-      fieldsWriter.close();
-    )
-
-    CND_PRECONDITION (docCount*8 == directory->fileLength( (segment + "." + IndexFileNames::FIELDS_INDEX_EXTENSION).c_str() ),
-    (string("after mergeFields: fdx size mismatch: ") + Misc::toString(docCount) + " docs vs " + Misc::toString(directory->fileLength( (segment + "." + IndexFileNames::FIELDS_INDEX_EXTENSION).c_str() )) + " length in bytes of " + segment + "." + IndexFileNames::FIELDS_INDEX_EXTENSION).c_str() );
-
-  } else{
-    // If we are skipping the doc stores, that means there
-    // are no deletions in any of these segments, so we
-    // just sum numDocs() of each segment to get total docCount
-    for (size_t i = 0; i < readers.size(); i++)
-      docCount += readers[i]->numDocs();
-  }
+    }
+  } _CLFINALLY (
+    fieldsWriter.close();
+  )
+
+  CND_PRECONDITION (docCount*8 == directory->fileLength( (segment + "." + IndexFileNames::FIELDS_INDEX_EXTENSION).c_str() ),
+  (string("after mergeFields: fdx size mismatch: ") + Misc::toString(docCount) + " docs vs " + Misc::toString(directory->fileLength( (segment + "." + IndexFileNames::FIELDS_INDEX_EXTENSION).c_str() )) + " length in bytes of " + segment + "." + IndexFileNames::FIELDS_INDEX_EXTENSION).c_str() );
   return docCount;
 }
 
@@ -388,21 +504,72 @@ void SegmentMerger::mergeVectors(){
 		_CLNEW TermVectorsWriter(directory, segment.c_str(), fieldInfos);
 
 	try {
-		for (uint32_t r = 0; r < readers.size(); r++) {
-			IndexReader* reader = readers[r];
-			int32_t maxDoc = reader->maxDoc();
-			for (int32_t docNum = 0; docNum < maxDoc; docNum++) {
-				// skip deleted docs
-				if (reader->isDeleted(docNum))
-					continue;
-
-				ArrayBase<TermFreqVector*>* tmp = reader->getTermFreqVectors(docNum);
-//        if ( tmp != NULL ){
+		// If the vectors of a matching reader are in the current
+		// format, we can do a bulk copy of them
+		ValueArray<TermVectorsReader*> matchingVectorsReaders(readers.size());
+		for (size_t r = 0; r < readers.size(); r++) {
+			SegmentReader* matchingSegmentReader = matchingSegmentReaders[r];
+			if (matchingSegmentReader != NULL && matchingSegmentReader->termVectorsReaderOrig != NULL) {
+				TermVectorsReader* vectorsReader = matchingSegmentReader->getTermVectorsReader();
+				if (vectorsReader->canReadRawDocs())
+					matchingVectorsReaders.values[r] = vectorsReader;
+			}
+		}
+
+		// Used for bulk-reading raw bytes for term vectors
+		ValueArray<int32_t> rawDocLengths(MAX_RAW_MERGE_DOCS);
+		ValueArray<int32_t> rawDocLengths2(MAX_RAW_MERGE_DOCS);
+
+		if (sortedDocMap != NULL) {
+			for (size_t i = 0; i < sortedDocs.length; i++) {
+				TermVectorsReader* matchingVectorsReader = matchingVectorsReaders[sortedReaders[i]];
+				if (matchingVectorsReader != NULL) {
+					matchingVectorsReader->rawDocs(rawDocLengths.values, rawDocLengths2.values, sortedDocs[i], 1);
+					termVectorsWriter->addRawDocuments(matchingVectorsReader, rawDocLengths.values, rawDocLengths2.values, 1);
+				} else {
+					ArrayBase<TermFreqVector*>* tmp = readers[sortedReaders[i]]->getTermFreqVectors(sortedDocs[i]);
 					termVectorsWriter->addAllDocVectors(tmp);
-				  _CLLDELETE(tmp);
-//        }
-          if (checkAbort != NULL)
-            checkAbort->work(300);
+					_CLLDELETE(tmp);
+				}
+				if (checkAbort != NULL)
+					checkAbort->work(300);
+			}
+		} else {
+			for (uint32_t r = 0; r < readers.size(); r++) {
+				IndexReader* reader = readers[r];
+				TermVectorsReader* matchingVectorsReader = matchingVectorsReaders[r];
+				int32_t maxDoc = reader->maxDoc();
+				for (int32_t docNum = 0; docNum < maxDoc;) {
+					// skip deleted docs
+					if (reader->isDeleted(docNum)) {
+						docNum++;
+						continue;
+					}
+
+					if (matchingVectorsReader != NULL) {
+						// We can optimize this case (doing a bulk
+						// byte copy) since the field numbers are
+						// identical
+						int32_t start = docNum;
+						int32_t numDocs = 0;
+						do {
+							docNum++;
+							numDocs++;
+						} while(docNum < maxDoc && !reader->isDeleted(docNum) && numDocs < MAX_RAW_MERGE_DOCS);
+
+						matchingVectorsReader->rawDocs(rawDocLengths.values, rawDocLengths2.values, start, numDocs);
+						termVectorsWriter->addRawDocuments(matchingVectorsReader, rawDocLengths.values, rawDocLengths2.values, numDocs);
+						if (checkAbort != NULL)
+							checkAbort->work(300*numDocs);
+					} else {
+						ArrayBase<TermFreqVector*>* tmp = reader->getTermFreqVectors(docNum);
+						termVectorsWriter->addAllDocVectors(tmp);
+						_CLLDELETE(tmp);
+						docNum++;
+						if (checkAbort != NULL)
+							checkAbort->work(300);
+					}
+				}
 			}
 		}
 	}_CLFINALLY(
@@ -426,45 +593,237 @@ void SegmentMerger::mergeTerms() {
 	CND_PRECONDITION(fieldInfos != NULL, "fieldInfos is NULL");
 
     try{
-      //Open an IndexOutput to the new Frequency File
-      freqOutput = directory->createOutput( Misc::segmentname(segment.c_str(),".frq").c_str() );
+      openTerms();
+
+      //And merge the Term Infos
+      mergeTermInfos();
+    }_CLFINALLY(
+      closeTerms();
+    );
+}
 
-      //Open an IndexOutput to the new Prox File
-      proxOutput = directory->createOutput( Misc::segmentname(segment.c_str(),".prx").c_str() );
+void SegmentMerger::openTerms() {
+  //Open an IndexOutput to the new Frequency File
+  freqOutput = directory->createOutput( Misc::segmentname(segment.c_str(),".frq").c_str() );
 
-      //Instantiate  a new termInfosWriter which will write in directory
-      //for the segment name segment using the new merged fieldInfos
-      termInfosWriter = _CLNEW TermInfosWriter(directory, segment.c_str(), fieldInfos, termIndexInterval);
+  //Open an IndexOutput to the new Prox File
+  proxOutput = directory->createOutput( Misc::segmentname(segment.c_str(),".prx").c_str() );
 
-      //Condition check to see if termInfosWriter points to a valid instance
-      CND_CONDITION(termInfosWriter != NULL,"Memory allocation for termInfosWriter failed")	;
+  //Instantiate  a new termInfosWriter which will write in directory
+  //for the segment name segment using the new merged fieldInfos
+  termInfosWriter = _CLNEW TermInfosWriter(directory, segment.c_str(), fieldInfos, termIndexInterval);
 
-      skipInterval = termInfosWriter->skipInterval;
-      maxSkipLevels = termInfosWriter->maxSkipLevels;
-      skipListWriter = _CLNEW DefaultSkipListWriter(skipInterval, maxSkipLevels, mergedDocs, freqOutput, proxOutput);
-      queue = _CLNEW SegmentMergeQueue(readers.size());
+  //Condition check to see if termInfosWriter points to a valid instance
+  CND_CONDITION(termInfosWriter != NULL,"Memory allocation for termInfosWriter failed")	;
 
-      //And merge the Term Infos
-      mergeTermInfos();
-    }_CLFINALLY(
-      if ( freqOutput != NULL ){
-        freqOutput->close();
-        _CLDELETE(freqOutput);
-      }
-      if ( proxOutput != NULL ){
-        proxOutput->close();
-        _CLDELETE(proxOutput);
-      }
-      if ( termInfosWriter != NULL ){
-        termInfosWriter->close();
-        _CLDELETE(termInfosWriter);
+  skipInterval = termInfosWriter->skipInterval;
+  maxSkipLevels = termInfosWriter->maxSkipLevels;
+  skipListWriter = _CLNEW DefaultSkipListWriter(skipInterval, maxSkipLevels, mergedDocs, freqOutput, proxOutput);
+  queue = _CLNEW SegmentMergeQueue(readers.size());
+}
+
+void SegmentMerger::closeTerms() {
+  if ( freqOutput != NULL ){
+    freqOutput->close();
+    _CLDELETE(freqOutput);
+  }
+  if ( proxOutput != NULL ){
+    proxOutput->close();
+    _CLDELETE(proxOutput);
+  }
+  if ( termInfosWriter != NULL ){
+    termInfosWriter->close();
+    _CLDELETE(termInfosWriter);
+  }
+  if ( queue != NULL ){
+    queue->close();
+    _CLDELETE(queue);
+  }
+}
+
+bool SegmentMerger::inPartition(const Term* term) const {
+  return term != NULL && (maxField == NULL || _tcscmp(term->field(), maxField) < 0);
+}
+
+void SegmentMerger::appendTermsPartition(SegmentMerger* partition) {
+  const char* name = partition->segment.c_str();
+  const int64_t freqBase = freqOutput->getFilePointer();
+  const int64_t proxBase = proxOutput->getFilePointer();
+
+  directory->copyFile( Misc::segmentname(name,".frq").c_str(), freqOutput );
+  directory->copyFile( Misc::segmentname(name,".prx").c_str(), proxOutput );
+
+  // the skip data is relative to the postings of its term, so only
+  // the pointers of the term dictionary move
+  TermInfosReader termInfosReader(directory, name, fieldInfos);
+  SegmentTermEnum* termEnum = termInfosReader.terms();
+  try {
+    TermInfo ti;
+    while (termEnum->next()) {
+      termEnum->getTermInfo(&ti);
+      ti.freqPointer += freqBase;
+      ti.proxPointer += proxBase;
+      termInfosWriter->add(termEnum->term(false), &ti);
+      if (checkAbort != NULL)
+        checkAbort->work(1);
+    }
+  }_CLFINALLY(
+    termEnum->close();
+    _CLDELETE(termEnum);
+    termInfosReader.close();
+  );
+
+  directory->deleteFile( Misc::segmentname(name,".frq").c_str() );
+  directory->deleteFile( Misc::segmentname(name,".prx").c_str() );
+  directory->deleteFile( Misc::segmentname(name,".tis").c_str() );
+  directory->deleteFile( Misc::segmentname(name,".tii").c_str() );
+}
+
+#ifndef _CL_DISABLE_MULTITHREADING
+/** The parts of a merge that do not depend on each other, which a pool of
+* threads takes one after the other. */
+class SegmentMerger::MergeTasks {
+public:
+  enum Type { POSTINGS, STORED_FIELDS, VECTORS, NORMS, DOC_VALUES };
+  struct Task {
+    Type type;
+    SegmentMerger* merger; // the merger of the task, for POSTINGS the one of the partition
+  };
+
+  std::vector<Task> tasks;
+  size_t next;
+  CLuceneError* error;
+  DEFINE_MUTEX(THIS_LOCK)
+
+  MergeTasks(): next(0), error(NULL) {}
+  ~MergeTasks() { _CLDELETE(error); }
+
+  void add(Type type, SegmentMerger* merger) {
+    Task task;
+    task.type = type;
+    task.merger = merger;
+    tasks.push_back(task);
+  }
+
+  /** Runs tasks until there are none left, or one of them failed */
+  void run() {
+    while (true) {
+      Task task;
+      {
+        SCOPED_LOCK_MUTEX(THIS_LOCK)
+        if (error != NULL || next == tasks.size())
+          return;
+        task = tasks[next++];
       }
-      if ( queue != NULL ){
-        queue->close();
-        _CLDELETE(queue);
+      try {
+        switch (task.type) {
+          case POSTINGS:
+            // the first partition is written to the open outputs
+            // of the merged segment
+            if (task.merger->parent == NULL)
+              task.merger->mergeTermInfos();
+            else
+              task.merger->mergeTerms();
+            break;
+          case STORED_FIELDS:
+            task.merger->mergeFields();
+            break;
+          case VECTORS:
+            task.merger->mergeVectors();
+            break;
+          case NORMS:
+            task.merger->mergeNorms();
+            break;
+          case DOC_VALUES:
+            task.merger->mergeDocValues();
+            break;
+        }
+      } catch (CLuceneError& err) {
+        setError(err);
+      } catch (...) {
+        setError(CLuceneError(CL_ERR_Runtime, "unknown error in merge task", false));
       }
-    );
+    }
+  }
+
+  /** Keeps the first error, the merging thread rethrows it */
+  void setError(const CLuceneError& err) {
+    SCOPED_LOCK_MUTEX(THIS_LOCK)
+    if (error == NULL)
+      error = _CLNEW CLuceneError(err);
+  }
+
+  static _LUCENE_THREAD_FUNC(worker, arg) {
+    ((MergeTasks*)arg)->run();
+    _ThreadLocal::UnregisterCurrentThread();
+    _LUCENE_THREAD_FUNC_RETURN(0);
+  }
+};
+
+/** Orders field names like the terms of the term dictionary */
+struct SegmentMergerFieldLess {
+  bool operator()(const TCHAR* a, const TCHAR* b) const {
+    return _tcscmp(a, b) < 0;
+  }
+};
+
+void SegmentMerger::mergeConcurrently() {
+  // The postings are split into partitions of whole fields, in the order
+  // of the term dictionary. The first partition is written to the files
+  // of the merged segment, the others to files of their own that are
+  // appended once all are done. Without sizes to balance the partitions
+  // by, there are more partitions than threads.
+  std::vector<const TCHAR*> fields;
+  for (size_t i = 0; i < fieldInfos->size(); i++) {
+    FieldInfo* fi = fieldInfos->fieldInfo(i);
+    if (fi->isIndexed)
+      fields.push_back(fi->name);
+  }
+  std::sort(fields.begin(), fields.end(), SegmentMergerFieldLess());
+  const size_t numPartitions = fields.size() <= 1 ? 1 : min(fields.size(), (size_t)threadCount * 2);
+
+  CLVector<SegmentMerger*, Deletor::Object<SegmentMerger> > partitions;
+  MergeTasks tasks;
+  try {
+    maxField = numPartitions > 1 ? fields[fields.size() / numPartitions] : NULL;
+    for (size_t i = 1; i < numPartitions; i++) {
+      const TCHAR* from = fields[i * fields.size() / numPartitions];
+      const TCHAR* to = i + 1 < numPartitions ? fields[(i + 1) * fields.size() / numPartitions] : NULL;
+      partitions.push_back(_CLNEW SegmentMerger(this, segment + "_p" + Misc::toString((int32_t)i), from, to));
+    }
+
+    openTerms();
+
+    // the larger parts first
+    tasks.add(MergeTasks::POSTINGS, this);
+    for (size_t i = 0; i < partitions.size(); i++)
+      tasks.add(MergeTasks::POSTINGS, partitions[i]);
+    if (mergeDocStores)
+      tasks.add(MergeTasks::STORED_FIELDS, this);
+    if (mergeDocStores && fieldInfos->hasVectors())
+      tasks.add(MergeTasks::VECTORS, this);
+    tasks.add(MergeTasks::NORMS, this);
+    tasks.add(MergeTasks::DOC_VALUES, this);
+
+    // this thread works on the tasks as well
+    ValueArray<_LUCENE_THREADID_TYPE> threads(min((size_t)threadCount, tasks.tasks.size()) - 1);
+    for (size_t i = 0; i < threads.length; i++)
+      threads.values[i] = _LUCENE_THREAD_CREATE(&MergeTasks::worker, &tasks);
+    tasks.run();
+    for (size_t i = 0; i < threads.length; i++)
+      _LUCENE_THREAD_JOIN(threads[i]);
+
+    if (tasks.error != NULL)
+      throw *tasks.error;
+
+    for (size_t i = 0; i < partitions.size(); i++)
+      appendTermsPartition(partitions[i]);
+  }_CLFINALLY(
+    closeTerms();
+    maxField = NULL;
+  );
 }
+#endif
 
 void SegmentMerger::mergeTermInfos(){
 //Func - Merges all TermInfos into a single segment
@@ -488,8 +847,16 @@ void SegmentMerger::mergeTermInfos(){
       //Condition check to see if reader points to a valid instance
       CND_CONDITION(reader != NULL, "No IndexReader found");
 
-      //Get the term enumeration of the reader
-      TermEnum* termEnum = reader->terms();
+      //Get the term enumeration of the reader, positioned before the
+      //first term, or at the first term of the partition
+      TermEnum* termEnum;
+      if (minField == NULL) {
+        termEnum = reader->terms();
+      } else {
+        Term* first = _CLNEW Term(minField, LUCENE_BLANK_STRING);
+        termEnum = reader->terms(first);
+        _CLDECDELETE(first);
+      }
       //Instantiate a new SegmentMerginfo for the current reader and enumeration
       smi = _CLNEW SegmentMergeInfo(base, termEnum, reader);
 
@@ -500,7 +867,7 @@ void SegmentMerger::mergeTermInfos(){
       //so base will contain a new value for the first document of the next iteration
       base += reader->numDocs();
 		  //Get the next current term
-		  if (smi->next()){
+		  if (minField == NULL ? smi->next() && inPartition(smi->term) : inPartition(smi->term)){
         //Store the SegmentMergeInfo smi with the initialized SegmentTermEnum TermEnum
         //into the queue
         queue->put(smi);
@@ -558,7 +925,7 @@ void SegmentMerger::mergeTermInfos(){
         CND_CONDITION(smi != NULL,"smi is NULL")	;
 
 			  //Move to the next term in the enumeration of SegmentMergeInfo smi
-			  if (smi->next()){
+			  if (smi->next() && inPartition(smi->term)){
           //There still are some terms so restore smi in the queue
           queue->put(smi);
 
@@ -591,7 +958,7 @@ int32_t SegmentMerger::mergeTermInfo( SegmentMergeInfo** smis, int32_t n){
   int64_t proxPointer = proxOutput->getFilePointer();
 
   //Process postings from multiple segments all positioned on the same term.
-  int32_t df = appendPostings(smis, n);
+  int32_t df = sortedDocMap != NULL ? appendSortedPostings(smis, n) : appendPostings(smis, n);
 
   int64_t skipPointer = skipListWriter->writeSkip(freqOutput);
 
@@ -640,13 +1007,19 @@ int32_t SegmentMerger::appendPostings(SegmentMergeInfo** smis, int32_t n){
     //Condition check to see if smi points to a valid instance
     CND_PRECONDITION(smi!=NULL,"	 is NULL");
 
+    //Get the docMap so we can see which documents have been deleted
+    int32_t* docMap = smi->getDocMap();
+    //Segments without deletions are copied without decoding their postings
+    if (docMap == NULL && smi->getFreqStream() != NULL) {
+      df = appendRawPostings(smi, storePayloads, df, lastDoc, lastPayloadLength);
+      continue;
+    }
+
     //Get the term positions
     TermPositions* postings = smi->getPositions();
     assert(postings != NULL);
     //Get the base of this segment
     int32_t base = smi->base;
-    //Get the docMap so we can see which documents have been deleted
-    int32_t* docMap = smi->getDocMap();
     //Seek the termpost
     postings->seek(smi->termEnum);
     while (postings->next()) {
@@ -723,11 +1096,193 @@ int32_t SegmentMerger::appendPostings(SegmentMergeInfo** smis, int32_t n){
   return df;
 }
 
+int32_t SegmentMerger::appendRawPostings(SegmentMergeInfo* smi, bool storePayloads, int32_t df,
+    int32_t& lastDoc, int32_t& lastPayloadLength){
+  IndexInput* freqInput = smi->getFreqStream();
+  IndexInput* proxInput = smi->getProxStream();
+  SegmentReader* reader = (SegmentReader*)smi->reader;
+  const bool readPayloads = reader->fieldInfos()->fieldInfo(smi->term->field())->storePayloads;
+
+  TermInfo ti;
+  ((SegmentTermEnum*)smi->termEnum)->getTermInfo(&ti);
+  freqInput->seek(ti.freqPointer);
+  proxInput->seek(ti.proxPointer);
+
+  int32_t doc = 0;
+  int32_t payloadLength = 0;  // the initial payload length of SegmentTermPositions
+  size_t proxUpto = 0;
+
+  for (int32_t i = 0; i < ti.docFreq; i++) {
+    const int32_t code = freqInput->readVInt();
+    doc += (int32_t)((uint32_t)code >> 1);
+    const int32_t freq = (code & 1) != 0 ? 1 : freqInput->readVInt();
+
+    const int32_t newDoc = doc + smi->base;  // convert to merged space
+    if (df > 0 && newDoc <= lastDoc)
+      _CLTHROWA(CL_ERR_CorruptIndex, (string("docs out of order (") + Misc::toString(newDoc) +
+          " <= " + Misc::toString(lastDoc) + " )").c_str());
+
+    df++;
+    if ((df % skipInterval) == 0) {
+      // the skip entry points behind the positions copied so far
+      if (proxUpto > 0)
+        proxOutput->writeBytes(proxBuffer.values, proxUpto);
+      proxUpto = 0;
+      skipListWriter->setSkipData(lastDoc, storePayloads, lastPayloadLength);
+      skipListWriter->bufferSkip(df);
+    }
+
+    // only the doc delta of the first document of the segment changes,
+    // the others encode the same way
+    const int32_t docCode = (newDoc - lastDoc) << 1;
+    lastDoc = newDoc;
+    if (freq == 1){
+      freqOutput->writeVInt(docCode | 1);
+    }else{
+      freqOutput->writeVInt(docCode);
+      freqOutput->writeVInt(freq);
+    }
+
+    if (!storePayloads) {
+      // the position deltas are copied as they are: count the last
+      // bytes of the freq vints
+      for (int32_t j = 0; j < freq; ) {
+        if (proxUpto == proxBuffer.length)
+          proxBuffer.resize(cl_max((size_t)1024, proxBuffer.length * 2));
+        const uint8_t b = proxInput->readByte();
+        proxBuffer.values[proxUpto++] = b;
+        if ((b & 0x80) == 0)
+          j++;
+      }
+    } else {
+      // the payload lengths are only written when they change, which
+      // depends on the postings merged before
+      for (int32_t j = 0; j < freq; j++) {
+        int32_t delta = proxInput->readVInt();
+        if (readPayloads) {
+          if ((delta & 1) != 0)
+            payloadLength = proxInput->readVInt();
+          delta = (int32_t)((uint32_t)delta >> 1);
+        }
+        if (payloadLength == lastPayloadLength) {
+          proxOutput->writeVInt(delta * 2);
+        } else {
+          proxOutput->writeVInt(delta * 2 + 1);
+          proxOutput->writeVInt(payloadLength);
+          lastPayloadLength = payloadLength;
+        }
+        if (payloadLength > 0)
+          proxOutput->copyBytes(proxInput, payloadLength);
+      }
+    }
+  }
+  if (proxUpto > 0)
+    proxOutput->writeBytes(proxBuffer.values, proxUpto);
+  return df;
+}
+
+int32_t SegmentMerger::appendSortedPostings(SegmentMergeInfo** smis, int32_t n){
+  CND_PRECONDITION(smis != NULL, "smis is NULL");
+  CND_PRECONDITION(freqOutput != NULL, "freqOutput is NULL");
+  CND_PRECONDITION(proxOutput != NULL, "proxOutput is NULL");
+
+  bool storePayloads = fieldInfos->fieldInfo(smis[0]->term->field())->storePayloads;
+  sortedPostings.clear();
+  sortedPositions.clear();
+  sortedPayloads.clear();
+
+  // read the postings of all segments, with their new document numbers
+  for ( int32_t i=0;i<n;i++ ){
+    SegmentMergeInfo* smi = smis[i];
+    TermPositions* postings = smi->getPositions();
+    assert(postings != NULL);
+    int32_t base = smi->base;
+    int32_t* docMap = smi->getDocMap();
+    postings->seek(smi->termEnum);
+    while (postings->next()) {
+      int32_t doc = postings->doc();
+      if (docMap != NULL)
+        doc = docMap[doc]; // map around deletions
+
+      SortedPosting posting;
+      posting.doc = sortedDocMap[doc + base];
+      posting.freq = postings->freq();
+      posting.positions = sortedPositions.size();
+      posting.payloads = sortedPayloads.size();
+      for (int32_t j = 0; j < posting.freq; j++) {
+        sortedPositions.push_back(postings->nextPosition());
+        if (storePayloads) {
+          int32_t payloadLength = postings->getPayloadLength();
+          sortedPositions.push_back(payloadLength);
+          if (payloadLength > 0) {
+            const size_t start = sortedPayloads.size();
+            sortedPayloads.resize(start + payloadLength);
+            postings->getPayload(&sortedPayloads[start]);
+          }
+        }
+      }
+      sortedPostings.push_back(posting);
+    }
+  }
+  std::sort(sortedPostings.begin(), sortedPostings.end());
+
+  // and write them like appendPostings does
+  int32_t lastDoc = 0;
+  int32_t df = 0;
+  int32_t lastPayloadLength = -1;
+  skipListWriter->resetSkip();
+  for (size_t i = 0; i < sortedPostings.size(); i++) {
+    const SortedPosting& posting = sortedPostings[i];
+    df++;
+
+    if ((df % skipInterval) == 0) {
+      skipListWriter->setSkipData(lastDoc, storePayloads, lastPayloadLength);
+      skipListWriter->bufferSkip(df);
+    }
+
+    int32_t docCode = (posting.doc - lastDoc) << 1;
+    lastDoc = posting.doc;
+    if (posting.freq == 1){
+      freqOutput->writeVInt(docCode | 1);
+    }else{
+      freqOutput->writeVInt(docCode);
+      freqOutput->writeVInt(posting.freq);
+    }
+
+    const int32_t* positions = &sortedPositions[posting.positions];
+    size_t payload = posting.payloads;
+    int32_t lastPosition = 0;
+    for (int32_t j = 0; j < posting.freq; j++) {
+      int32_t position = *positions++;
+      int32_t delta = position - lastPosition;
+      if (storePayloads) {
+        int32_t payloadLength = *positions++;
+        if (payloadLength == lastPayloadLength) {
+          proxOutput->writeVInt(delta * 2);
+        } else {
+          proxOutput->writeVInt(delta * 2 + 1);
+          proxOutput->writeVInt(payloadLength);
+          lastPayloadLength = payloadLength;
+        }
+        if (payloadLength > 0) {
+          proxOutput->writeBytes(&sortedPayloads[payload], payloadLength);
+          payload += payloadLength;
+        }
+      } else {
+        proxOutput->writeVInt(delta);
+      }
+      lastPosition = position;
+    }
+  }
+  return df;
+}
+
 void SegmentMerger::mergeNorms() {
 //Func - Merges the norms for all fields
 //Pre  - fieldInfos != NULL
 //Post - The norms for all fields have been merged
   ValueArray<uint8_t> normBuffer;
+  ValueArray<uint8_t> sortedNorms(sortedDocMap != NULL ? mergedDocs : 0);
 	IndexOutput*  output  = NULL;
   try {
 
@@ -750,6 +1305,9 @@ void SegmentMerger::mergeNorms() {
         //Condition check to see if output points to a valid instance
         CND_CONDITION(output != NULL, "No Outputstream retrieved");
 
+        //The merged number of the next document, when sorting
+        int32_t merged = 0;
+
 		    //Iterate through all IndexReaders
         for (uint32_t j = 0; j < readers.size(); j++) {
 			    //Get the i-th IndexReader
@@ -768,7 +1326,13 @@ void SegmentMerger::mergeNorms() {
 			    }
           reader->norms(fi->name, normBuffer.values);
 
-          if (!reader->hasDeletions()) {
+          if (sortedDocMap != NULL) {
+            // place the norms at the new document numbers
+            for(size_t k = 0; k < maxDoc; k++) {
+              if (!reader->isDeleted(k))
+                sortedNorms.values[sortedDocMap[merged++]] = normBuffer[k];
+            }
+          } else if (!reader->hasDeletions()) {
             //optimized case for segments without deleted docs
             output->writeBytes(normBuffer.values, maxDoc);
           } else {
@@ -786,6 +1350,8 @@ void SegmentMerger::mergeNorms() {
           if (checkAbort != NULL)
             checkAbort->work(maxDoc);
 		    }
+        if (sortedDocMap != NULL)
+          output->writeBytes(sortedNorms.values, mergedDocs);
 	    }
 	  }
   }_CLFINALLY(
@@ -796,6 +1362,200 @@ void SegmentMerger::mergeNorms() {
   );
 }
 
+void SegmentMerger::mergeDocValues() {
+//Func - Merges the doc values for all fields
+//Pre  - fieldInfos != NULL
+//Post - The doc values of all fields that have them have been merged
+  CND_PRECONDITION(fieldInfos != NULL, "fieldInfos is NULL");
+
+  // find the fields that have doc values, and the type of their values
+  ValueArray<int32_t> types(fieldInfos->size());
+  int32_t numFields = 0;
+  for (size_t i = 0; i < fieldInfos->size(); i++) {
+    FieldInfo* fi = fieldInfos->fieldInfo(i);
+    for (uint32_t j = 0; j < readers.size() && types[i] == 0; j++) {
+      DocValues* values = readers[j]->getDocValues(fi->name, false);
+      if (values != NULL) {
+        types.values[i] = values->getType();
+        numFields++;
+      }
+    }
+  }
+  if (numFields == 0)
+    return;
+
+  ValueArray<uint8_t> bytes;
+  IndexOutput* output = directory->createOutput( (segment + "." + IndexFileNames::DOCVALUES_EXTENSION).c_str() );
+  hasDocValues = true;
+  try {
+    output->writeBytes(DocValuesFormat::HEADER, DocValuesFormat::HEADER_length);
+    output->writeVInt(numFields);
+
+    for (size_t i = 0; i < fieldInfos->size(); i++) {
+      if (types[i] == 0)
+        continue;
+      FieldInfo* fi = fieldInfos->fieldInfo(i);
+      const DocValues::Type type = (DocValues::Type)types[i];
+      DocValuesBuffer buffer(type);
+
+      if (sortedDocMap != NULL) {
+        ValueArray<DocValues*> readerValues(readers.size());
+        for (uint32_t j = 0; j < readers.size(); j++)
+          readerValues.values[j] = readers[j]->getDocValues(fi->name, false);
+
+        for (size_t k = 0; k < sortedDocs.length; k++) {
+          DocValues* values = readerValues[sortedReaders[k]];
+          if (values == NULL || values->getType() != type) {
+            buffer.fill(k + 1);
+          } else if (type == DocValues::INTS) {
+            buffer.addInt(values->getInt(sortedDocs[k]));
+          } else {
+            const int32_t len = values->getBytes(sortedDocs[k], bytes);
+            buffer.addBytes(bytes.values, len);
+          }
+        }
+        if (checkAbort != NULL)
+          checkAbort->work(mergedDocs);
+      } else {
+        for (uint32_t j = 0; j < readers.size(); j++) {
+          IndexReader* reader = readers[j];
+          const int32_t maxDoc = reader->maxDoc();
+          DocValues* values = reader->getDocValues(fi->name, false);
+
+          // readers without values of this type read as empty
+          if (values == NULL || values->getType() != type) {
+            buffer.fill(buffer.size() + reader->numDocs());
+          } else {
+            for (int32_t k = 0; k < maxDoc; k++) {
+              if (reader->isDeleted(k))
+                continue;
+              if (type == DocValues::INTS) {
+                buffer.addInt(values->getInt(k));
+              } else {
+                const int32_t len = values->getBytes(k, bytes);
+                buffer.addBytes(bytes.values, len);
+              }
+            }
+          }
+          if (checkAbort != NULL)
+            checkAbort->work(maxDoc);
+        }
+      }
+      buffer.write(output, fi->number, mergedDocs);
+    }
+  }_CLFINALLY(
+    output->close();
+    _CLDELETE(output);
+  );
+}
+
+/** Orders merged documents by the value of the index sort */
+class IndexSortComparator {
+  const int32_t type;
+  const bool reverse;
+  const int32_t* ints;
+  const float_t* floats;
+  const TCHAR* const* strings;
+
+  int32_t compare(const int32_t a, const int32_t b) const{
+    switch (type) {
+      case SortField::INT:
+        return ints[a] < ints[b] ? -1 : (ints[a] > ints[b] ? 1 : 0);
+      case SortField::FLOAT:
+        return floats[a] < floats[b] ? -1 : (floats[a] > floats[b] ? 1 : 0);
+      default:
+        // documents without a value come first
+        if (strings[a] == NULL || strings[b] == NULL)
+          return strings[a] == NULL ? (strings[b] == NULL ? 0 : -1) : 1;
+        return _tcscmp(strings[a], strings[b]);
+    }
+  }
+public:
+  IndexSortComparator(const int32_t type, const bool reverse, const int32_t* ints,
+      const float_t* floats, const TCHAR* const* strings):
+    type(type), reverse(reverse), ints(ints), floats(floats), strings(strings)
+  {
+  }
+  bool operator()(const int32_t a, const int32_t b) const{
+    // equal values keep their merged order, like the hit queue
+    // orders equal hits by document number
+    return reverse ? compare(b, a) < 0 : compare(a, b) < 0;
+  }
+};
+
+void SegmentMerger::sortDocuments() {
+  const TCHAR* field = indexSort->getField();
+  const int32_t type = indexSort->getType();
+  if (type != SortField::INT && type != SortField::FLOAT && type != SortField::STRING)
+    _CLTHROWA(CL_ERR_IllegalArgument, "index sort must be by an INT, FLOAT or STRING field");
+
+  int32_t numDocs = 0;
+  for (size_t i = 0; i < readers.size(); i++)
+    numDocs += readers[i]->numDocs();
+
+  // the value of every merged document, and where it comes from
+  ValueArray<int32_t> ints(type == SortField::INT ? numDocs : 0);
+  ValueArray<float_t> floats(type == SortField::FLOAT ? numDocs : 0);
+  ValueArray<const TCHAR*> strings(type == SortField::STRING ? numDocs : 0);
+  ValueArray<int32_t> docReaders(numDocs);
+  ValueArray<int32_t> docNumbers(numDocs);
+  int32_t merged = 0;
+  for (size_t i = 0; i < readers.size(); i++) {
+    IndexReader* reader = readers[i];
+    FieldCacheAuto* fa;
+    if (type == SortField::INT)
+      fa = FieldCache::DEFAULT()->getInts(reader, field);
+    else if (type == SortField::FLOAT)
+      fa = FieldCache::DEFAULT()->getFloats(reader, field);
+    else
+      fa = FieldCache::DEFAULT()->getStrings(reader, field);
+
+    const int32_t maxDoc = reader->maxDoc();
+    for (int32_t j = 0; j < maxDoc; j++) {
+      if (reader->isDeleted(j))
+        continue;
+      if (type == SortField::INT)
+        ints.values[merged] = fa->intArray[j];
+      else if (type == SortField::FLOAT)
+        floats.values[merged] = fa->floatArray[j];
+      else
+        strings.values[merged] = fa->stringArray[j];
+      docReaders.values[merged] = i;
+      docNumbers.values[merged] = j;
+      merged++;
+    }
+    if (checkAbort != NULL)
+      checkAbort->work(maxDoc);
+  }
+
+  ValueArray<int32_t> order(numDocs);
+  for (int32_t i = 0; i < numDocs; i++)
+    order.values[i] = i;
+  std::stable_sort(order.values, order.values + numDocs,
+    IndexSortComparator(type, indexSort->getReverse(), ints.values, floats.values, strings.values));
+
+  sortedDocMap = _CL_NEWARRAY(int32_t, numDocs);
+  sortedReaders.resize(numDocs);
+  sortedDocs.resize(numDocs);
+  for (int32_t i = 0; i < numDocs; i++) {
+    sortedDocMap[order[i]] = i;
+    sortedReaders.values[i] = docReaders[order[i]];
+    sortedDocs.values[i] = docNumbers[order[i]];
+  }
+  isSorted = true;
+}
+
+void SegmentMerger::writeIndexSort() {
+  IndexOutput* output = directory->createOutput( (segment + "." + IndexFileNames::SORT_EXTENSION).c_str() );
+  try {
+    output->writeString(indexSort->getField(), _tcslen(indexSort->getField()));
+    output->writeVInt(indexSort->getType());
+    output->writeByte(indexSort->getReverse() ? 1 : 0);
+  }_CLFINALLY(
+    output->close();
+    _CLDELETE(output);
+  );
+}
 
 SegmentMerger::CheckAbort::CheckAbort(MergePolicy::OneMerge* merge, Directory* dir) {
   this->merge = merge;
@@ -804,6 +1564,7 @@ SegmentMerger::CheckAbort::CheckAbort(MergePolicy::OneMerge* merge, Directory* d
 }
 
 void SegmentMerger::CheckAbort::work(float_t units){
+  SCOPED_LOCK_MUTEX(THIS_LOCK)
   workCount += units;
   if (workCount >= 10000.0) {
     merge->checkAborted(dir);
@@ -14,9 +14,11 @@
 #include "_TermInfosReader.h"
 #include "Terms.h"
 #include "CLucene/search/Similarity.h"
+#include "CLucene/search/Sort.h"
 #include "CLucene/store/FSDirectory.h"
 #include "CLucene/util/PriorityQueue.h"
 #include "_SegmentMerger.h"
+#include "_DocValues.h"
 #include <assert.h>
 
 CL_NS_USE(util)
@@ -125,6 +127,9 @@ CL_NS_DEF(index)
     this->freqStream       = NULL;
     this->proxStream       = NULL;
     this->singleNormStream = NULL;
+    this->docValues = NULL;
+    this->skipLevelCache = LUCENE_SKIP_LEVEL_CACHE_SIZE > 0 ? _CLNEW SkipLevelCache(LUCENE_SKIP_LEVEL_CACHE_SIZE) : NULL;
+    this->indexSort = NULL;
     this->termVectorsReaderOrig = NULL;
     this->_fieldInfos = NULL;
     this->tis = NULL;
@@ -200,6 +205,25 @@ CL_NS_DEF(index)
       proxStream = cfsDir->openInput( (segment + ".prx").c_str(), readBufferSize);
       openNorms(cfsDir, readBufferSize);
 
+      const string docValuesFile = segment + "." + IndexFileNames::DOCVALUES_EXTENSION;
+      if (cfsDir->fileExists(docValuesFile.c_str()))
+        docValues = _CLNEW SegmentDocValues(cfsDir, docValuesFile.c_str(), _fieldInfos, si->docCount, readBufferSize);
+
+      const string sortFile = segment + "." + IndexFileNames::SORT_EXTENSION;
+      if (cfsDir->fileExists(sortFile.c_str())) {
+        IndexInput* input = cfsDir->openInput(sortFile.c_str(), readBufferSize);
+        try {
+          TCHAR* field = input->readString();
+          const int32_t type = input->readVInt();
+          const bool reverse = input->readByte() != 0;
+          indexSort = _CLNEW CL_NS(search)::SortField(field, type, reverse);
+          _CLDELETE_CARRAY(field);
+        } _CLFINALLY (
+          input->close();
+          _CLDELETE(input);
+        )
+      }
+
       if (doOpenStores && _fieldInfos->hasVectors()) { // open term vector files only as needed
         string vectorsSegment;
         if (si->getDocStoreOffset() != -1)
@@ -269,6 +293,7 @@ CL_NS_DEF(index)
       _CLDELETE_ARRAY(ones);
       _CLDELETE(termVectorsReaderOrig)
       _CLDECDELETE(cfsReader);
+      _CLDELETE(indexSort);
       //termVectorsLocal->unregister(this);
   }
 
@@ -344,6 +369,14 @@ CL_NS_DEF(index)
           _CLDELETE(termVectorsReaderOrig);
       }
 
+      if (docValues != NULL){
+        docValues->close();
+        _CLDELETE(docValues);
+      }
+
+      // every reader has its own cache, even if it shares the freqStream
+      _CLDELETE(skipLevelCache);
+
       if (cfsReader != NULL){
         cfsReader->close();
         _CLDECDELETE(cfsReader);
@@ -657,6 +690,17 @@ bool SegmentReader::hasNorms(const TCHAR* field){
     }
   }
 
+  DocValues* SegmentReader::getDocValues(const TCHAR* field, const bool inRAM){
+    ensureOpen();
+    if (docValues == NULL)
+      return NULL;
+    return docValues->get(field, inRAM);
+  }
+
+  const CL_NS(search)::SortField* SegmentReader::getIndexSort(){
+    return indexSort;
+  }
+
   uint8_t* SegmentReader::createFakeNorms(int32_t size) {
     uint8_t* ones = _CL_NEWARRAY(uint8_t,size);
     if ( size > 0 )
@@ -942,6 +986,8 @@ bool SegmentReader::hasNorms(const TCHAR* field){
       clone->freqStream = freqStream;
       clone->proxStream = proxStream;
       clone->termVectorsReaderOrig = termVectorsReaderOrig;
+      clone->docValues = docValues;
+      clone->indexSort = indexSort;
 
       // we have to open a new FieldsReader, because it is not thread-safe
       // and can thus not be shared among multiple SegmentReaders
@@ -1043,6 +1089,8 @@ bool SegmentReader::hasNorms(const TCHAR* field){
     this->termVectorsReaderOrig = NULL;
     this->cfsReader = NULL;
     this->storeCFSReader = NULL;
+    this->docValues = NULL;
+    this->indexSort = NULL;
     _CLDELETE( this->singleNormStream );
 
     return clone;
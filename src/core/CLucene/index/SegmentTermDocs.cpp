@@ -130,7 +130,7 @@ CL_NS_DEF(index)
     
     if (df >= skipInterval) {                      // optimized case
       if (skipListReader == NULL)
-		  skipListReader = _CLNEW DefaultSkipListReader(freqStream->clone(), maxSkipLevels, skipInterval); // lazily clone
+		  skipListReader = _CLNEW DefaultSkipListReader(freqStream->clone(), maxSkipLevels, skipInterval, parent->skipLevelCache); // lazily clone
 
 	  if (!haveSkipped) {                          // lazily initialize skip stream
 		  skipListReader->init(skipPointer, freqBasePointer, proxBasePointer, df, currentFieldStoresPayloads);
@@ -10,15 +10,81 @@
 CL_NS_USE(store)
 CL_NS_DEF(index)
 
+SkipLevelCache::Levels::Levels(const int32_t _numberOfSkipLevels):
+	numberOfSkipLevels(_numberOfSkipLevels),
+	skipPointer(_CL_NEWARRAY(int64_t,_numberOfSkipLevels)),
+	length(_CL_NEWARRAY(int32_t,_numberOfSkipLevels)),
+	dataPointer(0),
+	data(NULL)
+{
+	memset(skipPointer,0,sizeof(int64_t) * numberOfSkipLevels);
+	memset(length,0,sizeof(int32_t) * numberOfSkipLevels);
+}
+SkipLevelCache::Levels::~Levels(){
+	_CLDELETE_LARRAY(skipPointer);
+	_CLDELETE_LARRAY(length);
+	_CLDELETE_LARRAY(data);
+}
+const uint8_t* SkipLevelCache::Levels::levelData(const int32_t level) const{
+	return data + (skipPointer[level] - dataPointer);
+}
+int32_t SkipLevelCache::Levels::size() const{
+	return (int32_t)(skipPointer[0] - dataPointer);
+}
+
+SkipLevelCache::SkipLevelCache(const int64_t _maxBytes):
+	maxBytes(_maxBytes), bytes(0)
+{
+}
+SkipLevelCache::~SkipLevelCache(){
+	for ( LevelsType::iterator itr = levels.begin(); itr != levels.end(); itr++ )
+		_CLDECDELETE(itr->second);
+}
+
+SkipLevelCache::Levels* SkipLevelCache::get(const int64_t skipPointer){
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+	LevelsType::iterator itr = levels.find(skipPointer);
+	if ( itr == levels.end() )
+		return NULL;
+	return _CL_POINTER(itr->second);
+}
+
+void SkipLevelCache::put(const int64_t skipPointer, Levels* _levels){
+	const int32_t size = _levels->size();
+	if ( size > maxBytes )
+		return;
+
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+	if ( levels.find(skipPointer) != levels.end() )
+		return;
+	while ( bytes + size > maxBytes ){
+		LevelsType::iterator oldest = levels.find(order.front());
+		order.pop_front();
+		bytes -= oldest->second->size();
+		_CLDECDELETE(oldest->second);
+		levels.erase(oldest);
+	}
+	levels[skipPointer] = _CL_POINTER(_levels);
+	order.push_back(skipPointer);
+	bytes += size;
+}
+
+int64_t SkipLevelCache::getBytes(){
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+	return bytes;
+}
+
+
 MultiLevelSkipListReader::MultiLevelSkipListReader(IndexInput* _skipStream, const int32_t maxSkipLevels,
-												   const int32_t _skipInterval):
+												   const int32_t _skipInterval, SkipLevelCache* _levelCache):
 		maxNumberOfSkipLevels(maxSkipLevels),numberOfLevelsToBuffer(1),
 		skipStream(CL_NS(util)::ObjectArray<CL_NS(store)::IndexInput>(maxSkipLevels)),
 		skipPointer(_CL_NEWARRAY(int64_t,maxSkipLevels)),
 		skipInterval(_CL_NEWARRAY(int32_t,maxSkipLevels)),
 		numSkipped(_CL_NEWARRAY(int32_t,maxSkipLevels)),
 		skipDoc(_CL_NEWARRAY(int32_t,maxSkipLevels)),
-		childPointer(_CL_NEWARRAY(int64_t,maxSkipLevels))
+		childPointer(_CL_NEWARRAY(int64_t,maxSkipLevels)),
+		levelCache(_levelCache),levels(NULL)
 {
 	memset(this->skipPointer,0,sizeof(int64_t) * maxSkipLevels);
 	memset(this->skipInterval,0,sizeof(int32_t) * maxSkipLevels);
@@ -124,6 +190,9 @@ void MultiLevelSkipListReader::close() {
 			_CLDELETE(skipStream[i]); // ISH: We actually do need to nullify pointer here
 		}
 	}
+	// the buffers of the upper levels read from the cached levels
+	if (levels != NULL)
+		_CLDECDELETE(levels);
 }
 
 void MultiLevelSkipListReader::init(const int64_t _skipPointer, const int32_t df) {
@@ -132,11 +201,9 @@ void MultiLevelSkipListReader::init(const int64_t _skipPointer, const int32_t df
 	memset(skipDoc,0,sizeof(int32_t) * maxNumberOfSkipLevels);
 	memset(numSkipped,0,sizeof(int32_t) * maxNumberOfSkipLevels);
 	memset(childPointer,0,sizeof(int64_t) * maxNumberOfSkipLevels);
-    if ( numberOfSkipLevels > 1 )
-    {
-        for (int i=1;i<maxNumberOfSkipLevels;i++)
-          _CLDELETE(skipStream.values[i]);
-    }
+	// numberOfSkipLevels drops when the upper levels are exhausted, so
+	// every level's stream is released
+	close();
 	haveSkipped = false;
 }
 
@@ -146,6 +213,22 @@ void MultiLevelSkipListReader::loadSkipLevels() {
 		numberOfSkipLevels = maxNumberOfSkipLevels;
 	}
 
+	if (levelCache != NULL && numberOfSkipLevels > 1) {
+		// the upper levels of frequent terms are read once per segment
+		levels = levelCache->get(skipPointer[0]);
+		if (levels == NULL) {
+			levels = readLevels();
+			levelCache->put(skipPointer[0], levels);
+		}
+		for (int32_t i = numberOfSkipLevels - 1; i > 0; i--) {
+			skipPointer[i] = levels->skipPointer[i];
+			skipStream[i] = _CLNEW SkipBuffer(levels->levelData(i), levels->length[i], levels->skipPointer[i]);
+		}
+		skipPointer[0] = levels->skipPointer[0];
+		skipStream[0]->seek(skipPointer[0]);
+		return;
+	}
+
 	skipStream[0]->seek(skipPointer[0]);
 
 	int32_t toBuffer = numberOfLevelsToBuffer;
@@ -176,6 +259,27 @@ void MultiLevelSkipListReader::loadSkipLevels() {
 	skipPointer[0] = skipStream[0]->getFilePointer();
 }
 
+SkipLevelCache::Levels* MultiLevelSkipListReader::readLevels() {
+	SkipLevelCache::Levels* ret = _CLNEW SkipLevelCache::Levels(numberOfSkipLevels);
+	ret->dataPointer = skipPointer[0];
+
+	// find the levels first, then read them with a single read
+	skipStream[0]->seek(skipPointer[0]);
+	for (int32_t i = numberOfSkipLevels - 1; i > 0; i--) {
+		const int64_t length = skipStream[0]->readVLong();
+		ret->skipPointer[i] = skipStream[0]->getFilePointer();
+		ret->length[i] = (int32_t)length;
+		skipStream[0]->seek(ret->skipPointer[i] + length);
+	}
+	ret->skipPointer[0] = skipStream[0]->getFilePointer();
+
+	const int32_t size = ret->size();
+	ret->data = _CL_NEWARRAY(uint8_t, size);
+	skipStream[0]->seek(ret->dataPointer);
+	skipStream[0]->readBytes(ret->data, size);
+	return ret;
+}
+
 void MultiLevelSkipListReader::setLastSkipData(const int32_t level) {
 	lastDoc = skipDoc[level];
 	lastChildPointer = childPointer[level];
@@ -183,18 +287,24 @@ void MultiLevelSkipListReader::setLastSkipData(const int32_t level) {
 
 MultiLevelSkipListReader::SkipBuffer::SkipBuffer(IndexInput* input, const int32_t _length):pos(0)
 {
-	data = _CL_NEWARRAY(uint8_t,_length);
+	ownData = _CL_NEWARRAY(uint8_t,_length);
+	data = ownData;
 	this->_datalength = _length;
 	pointer = input->getFilePointer();
-	input->readBytes(data, _length);
+	input->readBytes(ownData, _length);
+}
+MultiLevelSkipListReader::SkipBuffer::SkipBuffer(const uint8_t* _data, const int32_t _length, const int64_t _pointer):
+	data(_data), ownData(NULL), pointer(_pointer), pos(0), _datalength(_length)
+{
 }
 MultiLevelSkipListReader::SkipBuffer::~SkipBuffer()
 {
-	_CLLDELETE(data);
+	_CLDELETE_LARRAY(ownData);
 }
 
 void MultiLevelSkipListReader::SkipBuffer::close() {
-	_CLDELETE(data);
+	_CLDELETE_LARRAY(ownData);
+	data = NULL;
 	_datalength=0;
 }
 
@@ -226,8 +336,9 @@ const char* MultiLevelSkipListReader::SkipBuffer::getDirectoryType() const{ retu
 MultiLevelSkipListReader::SkipBuffer::SkipBuffer(const SkipBuffer& other):
     IndexInput(other)
 {
-	data = _CL_NEWARRAY(uint8_t,other._datalength);
-	memcpy(data,other.data,other._datalength * sizeof(uint8_t));
+	ownData = _CL_NEWARRAY(uint8_t,other._datalength);
+	memcpy(ownData,other.data,other._datalength * sizeof(uint8_t));
+	data = ownData;
 	this->_datalength = other._datalength;
 	this->pointer = other.pointer;
 	this->pos = other.pos;
@@ -242,8 +353,9 @@ IndexInput* MultiLevelSkipListReader::SkipBuffer::clone() const{
 
 
 
-DefaultSkipListReader::DefaultSkipListReader(CL_NS(store)::IndexInput* _skipStream, const int32_t maxSkipLevels, const int32_t _skipInterval)
-		: MultiLevelSkipListReader(_skipStream, maxSkipLevels, _skipInterval)
+DefaultSkipListReader::DefaultSkipListReader(CL_NS(store)::IndexInput* _skipStream, const int32_t maxSkipLevels, const int32_t _skipInterval,
+											 SkipLevelCache* _levelCache)
+		: MultiLevelSkipListReader(_skipStream, maxSkipLevels, _skipInterval, _levelCache)
 {
 	freqPointer = _CL_NEWARRAY(int64_t,maxSkipLevels);
 	proxPointer = _CL_NEWARRAY(int64_t,maxSkipLevels);
@@ -152,6 +152,68 @@ int64_t TermVectorsReader::size() const{
     return _size;
 }
 
+bool TermVectorsReader::canReadRawDocs() const{
+	return tvx != NULL && tvdFormat == FORMAT_VERSION && tvfFormat == FORMAT_VERSION;
+}
+
+int64_t TermVectorsReader::readFirstTvfPointer(const int64_t tvdPosition){
+	tvd->seek(tvdPosition);
+	const int32_t fieldCount = tvd->readVInt();
+	if (fieldCount == 0)
+		return -1;
+	for (int32_t i = 0; i < fieldCount; ++i)
+		tvd->readVInt();
+	return tvd->readVLong();
+}
+
+void TermVectorsReader::rawDocs(int32_t* tvdLengths, int32_t* tvfLengths, const int32_t startDocID, const int32_t numDocs){
+	// the documents of the doc store, which may be shared with other segments
+	const int64_t numTotalDocs = tvx->length() >> 3;
+
+	tvx->seek(((startDocID + docStoreOffset) * 8L) + FORMAT_SIZE);
+	const int64_t tvdStart = tvx->readLong();
+	int64_t tvdPosition = tvdStart;
+
+	// The tvf data of a document ends where the data of the next document
+	// with vectors starts, so the length of the last document with vectors
+	// is only known once the next one was found
+	int64_t tvfStart = -1;
+	int64_t lastTvfPosition = -1;
+	int32_t lastDocWithVectors = -1;
+	for (int32_t count = 0; count < numDocs; count++) {
+		const int64_t docID = docStoreOffset + startDocID + count + 1;
+		CND_CONDITION(docID <= numTotalDocs, "invalid docID");
+		const int64_t next = docID < numTotalDocs ? tvx->readLong() : tvd->length();
+		tvdLengths[count] = static_cast<int32_t>(next - tvdPosition);
+		tvfLengths[count] = 0;
+
+		const int64_t tvfPosition = readFirstTvfPointer(tvdPosition);
+		if (tvfPosition != -1) {
+			if (lastDocWithVectors == -1)
+				tvfStart = tvfPosition;
+			else
+				tvfLengths[lastDocWithVectors] = static_cast<int32_t>(tvfPosition - lastTvfPosition);
+			lastDocWithVectors = count;
+			lastTvfPosition = tvfPosition;
+		}
+		tvdPosition = next;
+	}
+
+	if (lastDocWithVectors != -1) {
+		int64_t tvfEnd = -1;
+		for (int64_t docID = docStoreOffset + startDocID + numDocs; tvfEnd == -1 && docID < numTotalDocs; docID++) {
+			tvfEnd = readFirstTvfPointer(tvdPosition);
+			if (docID + 1 < numTotalDocs)
+				tvdPosition = tvx->readLong();
+		}
+		if (tvfEnd == -1)
+			tvfEnd = tvf->length();
+		tvfLengths[lastDocWithVectors] = static_cast<int32_t>(tvfEnd - lastTvfPosition);
+		tvf->seek(tvfStart);
+	}
+	tvd->seek(tvdStart);
+}
+
 void TermVectorsReader::get(const int32_t docNum, const TCHAR* field, TermVectorMapper* mapper){
 	if (tvx != NULL) {
 		int32_t fieldNumber = fieldInfos->fieldNumber(field);
@@ -227,4 +227,29 @@ CL_NS_DEF(index)
       tvd->writeVInt(0);
   }
 
+  void TermVectorsWriter::addRawDocuments(TermVectorsReader* reader, const int32_t* tvdLengths,
+    const int32_t* tvfLengths, const int32_t numDocs){
+    CL_NS(store)::IndexInput* rawTvd = reader->tvd;
+    int64_t tvfPosition = tvf->getFilePointer();
+    const int64_t tvfStart = tvfPosition;
+    for (int32_t i=0; i<numDocs; i++) {
+      tvx->writeLong(tvd->getFilePointer());
+      const int64_t docEnd = rawTvd->getFilePointer() + tvdLengths[i];
+
+      const int32_t numFields = rawTvd->readVInt();
+      tvd->writeVInt(numFields);
+      if (numFields > 0) {
+        for (int32_t j=0; j<numFields; j++)
+          tvd->writeVInt(rawTvd->readVInt());
+
+        // the pointer to the first field is absolute, the others are deltas
+        rawTvd->readVLong();
+        tvd->writeVLong(tvfPosition);
+        tvfPosition += tvfLengths[i];
+      }
+      tvd->copyBytes(rawTvd, docEnd - rawTvd->getFilePointer());
+    }
+    tvf->copyBytes(reader->tvf, tvfPosition - tvfStart);
+  }
+
 CL_NS_END
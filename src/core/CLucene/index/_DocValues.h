@@ -0,0 +1,144 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_index_DocValuesImpl_
+#define _lucene_index_DocValuesImpl_
+
+#include <vector>
+#include "DocValues.h"
+#include "CLucene/util/VoidMap.h"
+CL_CLASS_DEF(store,Directory)
+CL_CLASS_DEF(store,IndexInput)
+CL_CLASS_DEF(store,IndexOutput)
+
+CL_NS_DEF(index)
+class FieldInfos;
+class IndexReader;
+
+/**
+* The per document values of a segment are written to one file (.dv):
+*
+* DocValues --> Header, FieldCount, &lt;FieldNumber, Type, Values&gt;<sup>FieldCount</sup>
+* Header --> 'D','V','S',-1
+* FieldCount, FieldNumber --> VInt
+* Type --> Byte, a DocValues::Type
+* Values(INTS) --> Column of MaxDoc values
+* Values(BYTES) --> Column of MaxDoc+1 offsets, DataLength, Data
+* Column --> MinValue, Width, &lt;Value-MinValue&gt;<sup>Count</sup>
+* MinValue --> Long
+* Width --> Byte, the bytes per value: 0, 1, 2, 4 or 8
+* DataLength --> VLong
+*
+* Every value of a column has the same width, so a value is found without
+* reading the ones before it.
+*/
+class DocValuesFormat {
+public:
+	static const uint8_t HEADER[];
+	static const int HEADER_length;
+
+	/** Writes the column of count values */
+	static void writeColumn(CL_NS(store)::IndexOutput* out, const int64_t* values, const int32_t count);
+};
+
+/**
+* Buffers the values of one field in document order until they are written
+* to the .dv file of a new segment, by the DocumentsWriter or the
+* SegmentMerger.
+*/
+class DocValuesBuffer {
+	std::vector<int64_t> ints;   // the values, or for BYTES the end offset of each value
+	std::vector<uint8_t> bytes;
+public:
+	const DocValues::Type type;
+
+	DocValuesBuffer(DocValues::Type type);
+
+	/** The number of documents added */
+	int32_t size() const;
+	void addInt(const int64_t value);
+	void addBytes(const uint8_t* value, const int32_t length);
+	/** Adds empty values until there are values for docs documents */
+	void fill(const int32_t docs);
+
+	/** Writes the field number, type and values of docs documents */
+	void write(CL_NS(store)::IndexOutput* out, const int32_t fieldNumber, const int32_t docs);
+	void reset();
+};
+
+/**
+* The per document values of one segment. The columns are loaded into RAM,
+* or read from the file on every access, when they are first requested.
+* A SegmentReader that is reopened hands this object to its clone.
+*/
+class SegmentDocValues {
+	class Column;
+	class Ints;
+	class Bytes;
+	struct Entry {
+		DocValues::Type type;
+		int64_t pointer;
+		DocValues* inRAM;
+		DocValues* direct;
+		Entry(DocValues::Type type, int64_t pointer);
+		~Entry();
+	};
+	typedef CL_NS(util)::CLHashtable<TCHAR*,Entry*,
+		CL_NS(util)::Compare::TChar,
+		CL_NS(util)::Equals::TChar,
+		CL_NS(util)::Deletor::tcArray,
+		CL_NS(util)::Deletor::Object<Entry> > EntriesType;
+
+	CL_NS(store)::IndexInput* input;
+	const int32_t maxDoc;
+	EntriesType entries;
+	DEFINE_MUTEX(THIS_LOCK)
+public:
+	/** Reads the field directory of the file */
+	SegmentDocValues(CL_NS(store)::Directory* dir, const char* fileName, FieldInfos* fieldInfos,
+		const int32_t maxDoc, const int32_t readBufferSize);
+	~SegmentDocValues();
+
+	/** Returns the values of field, or NULL if the segment has none
+	* @param inRAM load the values, or read them from the file on every access */
+	DocValues* get(const TCHAR* field, const bool inRAM);
+	void close();
+};
+
+/**
+* The per document values of a composite reader, read from the values of
+* its sub readers. Sub readers without values of the field, or with values
+* of another type, read as empty.
+*/
+class MultiDocValues: public DocValues {
+	const Type type;
+	const int32_t maxDoc;
+	CL_NS(util)::ValueArray<DocValues*> subs;
+	CL_NS(util)::ValueArray<int32_t> starts;
+	int32_t subIndex(const int32_t doc) const;
+	MultiDocValues(Type type, int32_t maxDoc, int32_t numSubs);
+public:
+	~MultiDocValues();
+
+	/** Returns NULL if none of the sub readers has values of field */
+	static MultiDocValues* create(CL_NS(util)::ArrayBase<IndexReader*>* subReaders, const int32_t* starts,
+		const int32_t maxDoc, const TCHAR* field, const bool inRAM);
+
+	Type getType() const;
+	int32_t size() const;
+	int64_t getInt(const int32_t doc);
+	int32_t getBytes(const int32_t doc, CL_NS(util)::ValueArray<uint8_t>& buffer);
+};
+
+/** The DocValues a composite reader created, by field */
+typedef CL_NS(util)::CLHashtable<TCHAR*,DocValues*,
+	CL_NS(util)::Compare::TChar,
+	CL_NS(util)::Equals::TChar,
+	CL_NS(util)::Deletor::tcArray,
+	CL_NS(util)::Deletor::Object<DocValues> > DocValuesCacheType;
+
+CL_NS_END
+#endif
@@ -35,6 +35,7 @@ class Term;
 class FieldInfo;
 class Term_Compare;
 class Term_Equals;
+class DocValuesBuffer;
 
 /** Used only internally to DW to call abort "up the stack" */
 class AbortException{
@@ -329,6 +330,7 @@ private:
   bool allThreadsIdle();
 
   bool hasNorms;                       // Whether any norms were seen since last flush
+  bool hasDocValues;                   // Whether any doc values were seen since last flush
 
   DefaultSkipListWriter* skipListWriter;
 
@@ -443,7 +445,13 @@ private:
       bool doVectors;
       bool doVectorPositions;
       bool doVectorOffsets;
+      int32_t docValuesType;                 // Field::DOCVALUES_INTS or DOCVALUES_BYTES if this doc has a value, else 0
+      int64_t docValueInt;
+      CL_NS(util)::ValueArray<uint8_t> docValueBytes;
+      int32_t docValueLength;
       void resetPostingArrays();
+      /** Copies the doc value of field, to be buffered when the document is written */
+      void initDocValue(CL_NS(document)::Field* field);
 
       FieldData(DocumentsWriter* _parent, ThreadState* __threadState, FieldInfo* fieldInfo);
       ~FieldData();
@@ -734,6 +742,7 @@ private:
   int32_t abortCount;                         // Non-zero while abort is pending or running
 
   CL_NS(util)::ObjectArray<BufferedNorms> norms;   // Holds norms until we flush
+  CL_NS(util)::ObjectArray<DocValuesBuffer> docValues;   // Holds doc values until we flush, by field number
 
   /** Does the synchronized work to finish/flush the
    * inverted document. */
@@ -847,6 +856,9 @@ public:
   *  called only during commit, to create the .nrm file. */
   void writeNorms(const std::string& segmentName, int32_t totalNumDoc);
 
+  /** Write the doc values of all fields to the .dv file of the segment */
+  void writeDocValues(const std::string& segmentName, int32_t totalNumDoc);
+
   int32_t compareText(const TCHAR* text1, const TCHAR* text2);
 
   /* Walk through all unique text tokens (Posting
@@ -34,6 +34,8 @@ public:
 	static const char* PLAIN_NORMS_EXTENSION;
 	static const char* SEPARATE_NORMS_EXTENSION;
 	static const char* GEN_EXTENSION;
+	static const char* DOCVALUES_EXTENSION;
+	static const char* SORT_EXTENSION;
 	
 	LUCENE_STATIC_CONSTANT(int32_t,COMPOUND_EXTENSIONS_LENGTH=7);
 	LUCENE_STATIC_CONSTANT(int32_t,VECTOR_EXTENSIONS_LENGTH=3);
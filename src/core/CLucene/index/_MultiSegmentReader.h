@@ -13,6 +13,7 @@
 CL_CLASS_DEF(document,Document)
 //#include "Terms.h"
 #include "_SegmentHeader.h"
+#include "_DocValues.h"
 
 CL_NS_DEF(index)
 class SegmentMergeQueue;
@@ -36,6 +37,8 @@ private:
   bool _hasDeletions;
   uint8_t* ones;
   NormsCacheType normsCache;
+  DocValuesCacheType docValuesCache;
+  DocValuesCacheType directDocValuesCache;
   int32_t _maxDoc;
   int32_t _numDocs;
 
@@ -97,6 +100,9 @@ public:
 	uint8_t* norms(const TCHAR* field);
 	void norms(const TCHAR* field, uint8_t* result);
 
+	// synchronized
+	DocValues* getDocValues(const TCHAR* field, const bool inRAM=true);
+
 	TermEnum* terms();
 	TermEnum* terms(const Term* term);
 
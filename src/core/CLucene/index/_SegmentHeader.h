@@ -28,6 +28,7 @@
 
 CL_NS_DEF(index)
 class SegmentReader;
+class SegmentDocValues;
 
 class SegmentTermDocs:public virtual TermDocs {
 protected:
@@ -235,6 +236,15 @@ class SegmentReader: public DirectoryIndexReader {
   // optionally used for the .nrm file shared by multiple norms
   CL_NS(store)::IndexInput* singleNormStream;
 
+  // the .dv file, if any document of the segment had doc values
+  SegmentDocValues* docValues;
+
+  // the upper skip levels of frequent terms, shared by the SegmentTermDocs
+  SkipLevelCache* skipLevelCache;
+
+  // the sort of the .srt file, if the documents were sorted
+  CL_NS(search)::SortField* indexSort;
+
   // Compound File Reader when based on a compound file segment
   CompoundFileReader* cfsReader;
   CompoundFileReader* storeCFSReader;
@@ -357,6 +367,10 @@ public:
   ///Reads the Norms for field from disk
   void norms(const TCHAR* field, uint8_t* bytes);
 
+  DocValues* getDocValues(const TCHAR* field, const bool inRAM=true);
+
+  const CL_NS(search)::SortField* getIndexSort();
+
   ///concatenating segment with ext and x
   std::string SegmentName(const char* ext, const int32_t x=-1);
   ///Creates a filename in buffer by concatenating segment with ext and x
@@ -441,6 +455,8 @@ private:
   friend class MultiReader;
   friend class MultiSegmentReader;
   friend class SegmentMerger;
+  friend class SegmentMergeInfo;
+  friend class CheckIndex;
 };
 
 CL_NS_END
@@ -64,6 +64,9 @@ CL_NS_DEF(index)
 
 		int64_t _sizeInBytes;					  // total byte size of all of our files (computed on demand)
 
+		int32_t delCount;						  // number of deleted docs (computed on demand)
+		int64_t delCountGen;					  // delGen that delCount was read for; NO if not read yet
+
 		int32_t docStoreOffset;					  // if this segment shares stored fields & vectors, this
                                                   // offset is where in that file this segment's docs begin
     std::string docStoreSegment;					  // name used to derive fields/vectors file we share with
@@ -103,6 +106,10 @@ CL_NS_DEF(index)
     int64_t sizeInBytes();
 		bool hasDeletions() const;
 
+		/** Returns the number of deleted documents of this segment. The
+		* deletions file is only read again when delGen changed. */
+		int32_t getDelCount();
+
 		void advanceDelGen();
 		void clearDelGen();
 
@@ -12,6 +12,7 @@
 //#include "SegmentHeader.h"
 #include "Terms.h"
 
+CL_CLASS_DEF(store,IndexInput)
 CL_NS_DEF(index)
 class IndexReader;
 
@@ -19,6 +20,8 @@ class SegmentMergeInfo:LUCENE_BASE {
 private:
 	int32_t* docMap;				  // maps around deleted docs
 	TermPositions* postings;
+	CL_NS(store)::IndexInput* freqStream;
+	CL_NS(store)::IndexInput* proxStream;
 public:
 	TermEnum* termEnum;
 	Term* term;
@@ -42,6 +45,12 @@ public:
 	int32_t* getDocMap();
 
 	TermPositions* getPositions();
+
+	/** Clones of the .frq and .prx streams of the reader, for copying the
+	* postings without decoding them, or NULL if the reader is not a
+	* SegmentReader */
+	CL_NS(store)::IndexInput* getFreqStream();
+	CL_NS(store)::IndexInput* getProxStream();
 };
 CL_NS_END
 #endif
@@ -9,6 +9,7 @@
 
 
 CL_CLASS_DEF(store,Directory)
+CL_CLASS_DEF(search,SortField)
 #include "CLucene/store/_RAMDirectory.h"
 #include "_SegmentMergeInfo.h"
 #include "_SegmentMergeQueue.h"
@@ -19,6 +20,7 @@ CL_CLASS_DEF(store,Directory)
 
 CL_NS_DEF(index)
 class DefaultSkipListWriter;
+class SegmentReader;
 /**
 * The SegmentMerger class combines two or more Segments, represented by an IndexReader ({@link #add},
 * into a single Segment.  After adding the appropriate readers, call the merge method to combine the 
@@ -32,6 +34,8 @@ class DefaultSkipListWriter;
 */
 class SegmentMerger:LUCENE_BASE {
   CL_NS(util)::ValueArray<uint8_t> payloadBuffer;
+  // The raw positions appendRawPostings copies between two skip points
+  CL_NS(util)::ValueArray<uint8_t> proxBuffer;
 	
 	//Directory of the segment
 	CL_NS(store)::Directory* directory;     
@@ -50,10 +54,52 @@ class SegmentMerger:LUCENE_BASE {
   // to merge the doc stores.
   bool mergeDocStores;
 
+  // Whether a doc values file was written for the merged segment
+  bool hasDocValues;
+
+  // If not NULL, the merged documents are written in this order
+  const CL_NS(search)::SortField* indexSort;
+  // Whether the merged documents were sorted and a .srt file was written
+  bool isSorted;
+  // If sorting, the new number of every merged document, in the order of
+  // the readers with their deleted documents left out
+  int32_t* sortedDocMap;
+  // If sorting, the reader and document of every new document number
+  CL_NS(util)::ValueArray<int32_t> sortedReaders;
+  CL_NS(util)::ValueArray<int32_t> sortedDocs;
+
+  // The postings of one term, buffered by appendSortedPostings
+  struct SortedPosting {
+    int32_t doc;
+    int32_t freq;
+    size_t positions; // offset into sortedPositions
+    size_t payloads;  // offset into sortedPayloads
+    bool operator<(const SortedPosting& other) const{ return doc < other.doc; }
+  };
+  std::vector<SortedPosting> sortedPostings;
+  std::vector<int32_t> sortedPositions; // each position, followed by its payload length if the field stores payloads
+  std::vector<uint8_t> sortedPayloads;
+
   /** Maximum number of contiguous documents to bulk-copy
-  when merging stored fields */
+  when merging stored fields and term vectors */
   static int32_t MAX_RAW_MERGE_DOCS;
 
+  // The number of threads merge may use, see setThreadCount
+  int32_t threadCount;
+
+  // If this merger merges a partition of the postings of parent, the
+  // merger that owns the readers, fieldInfos and sort state it shares
+  SegmentMerger* parent;
+  // The postings of the fields from minField up to, but not including,
+  // maxField are merged. NULL leaves the range open at that end
+  const TCHAR* minField;
+  const TCHAR* maxField;
+
+  // If the i'th reader is a SegmentReader and has identical
+  // field name -> number mapping, then this array is non-NULL
+  // at position i, and its doc stores can be bulk-copied
+  CL_NS(util)::ValueArray<SegmentReader*> matchingSegmentReaders;
+
 	//The queue that holds SegmentMergeInfo instances
 	SegmentMergeQueue* queue;
 	//IndexOutput to the new Frequency File
@@ -100,6 +146,36 @@ public:
 	* @return The ith reader to be merged
 	*/
 	IndexReader* segmentReader(const int32_t i);
+
+	/**
+	* Writes the merged documents ordered by sort instead of in the order of
+	* the readers. Only INT, FLOAT and STRING sorts are supported, and the doc
+	* stores must be merged.
+	* @memory sort must remain valid until the merge is done
+	*/
+	void setIndexSort(const CL_NS(search)::SortField* sort);
+
+	/**
+	* Returns the new number of every merged document, in the order of the
+	* readers with their deleted documents left out, or NULL if the documents
+	* were not sorted.
+	* @memory the caller owns the returned array
+	*/
+	int32_t* releaseSortedDocMap();
+
+	/**
+	* Sets the number of threads merge may use. With more than one, the
+	* postings, stored fields, term vectors, norms and doc values are
+	* merged concurrently, and the postings are split into partitions of
+	* fields that are merged concurrently as well. The default is 1.
+	*/
+	void setThreadCount(const int32_t count);
+
+	/**
+	* Writes the merged files to dir instead of the directory of the writer.
+	* @memory dir must remain valid until the merger is deleted
+	*/
+	void setDirectory(CL_NS(store)::Directory* dir);
 	
   /**
    * Merges the readers specified by the {@link #add} method
@@ -136,6 +212,8 @@ public:
      * is up to ~ 1 second.
      */
     void work(float_t units);
+
+    DEFINE_MUTEX(THIS_LOCK)
   };
 	
 private:
@@ -146,13 +224,23 @@ private:
 		bool storeOffsetWithTermVector, bool storePayloads);
 
 	/**
-	* Merge the fields of all segments 
+	* Merges the field infos of all segments and writes them
+	* @return The number of documents of the merged segment
+	*/
+	int32_t mergeFieldInfos();
+
+	/**
+	* Merge the stored fields of all segments 
 	* @return The number of documents in all of the readers
   * @throws CorruptIndexException if the index is corrupt
   * @throws IOException if there is a low-level IO error
 	*/
 	int32_t mergeFields();
 
+	/** Finds the readers whose doc stores can be bulk-copied, see
+	*  matchingSegmentReaders */
+	void setMatchingSegmentReaders();
+
 	/**
 	* Merge the TermVectors from each of the segments into the new one.
 	* @throws IOException
@@ -162,6 +250,29 @@ private:
 	/** Merge the terms of all segments */
 	void mergeTerms();
 
+	/** Creates the outputs of the postings and term dictionary */
+	void openTerms();
+	void closeTerms();
+
+	/** Appends the postings and terms that partition wrote to its own
+	*  files to the outputs of this merger, and deletes the files. The
+	*  fields of partition must follow the fields merged so far. */
+	void appendTermsPartition(SegmentMerger* partition);
+
+	/** Whether the postings of term are merged by this merger */
+	bool inPartition(const Term* term) const;
+
+	class MergeTasks;
+	friend class MergeTasks;
+
+	/** Merges the postings in partitions of fields, and the other parts
+	*  of the segments, by up to threadCount threads */
+	void mergeConcurrently();
+
+	/** Creates a merger of the postings of the fields from minField up to,
+	*  but not including, maxField that writes them to the files of name */
+	SegmentMerger(SegmentMerger* parent, const std::string& name, const TCHAR* minField, const TCHAR* maxField);
+
 	/** Merges all TermInfos into a single segment */
 	void mergeTermInfos();
 
@@ -188,9 +299,34 @@ private:
 	*/
 	int32_t appendPostings(SegmentMergeInfo** smis, int32_t n);
 
+	/** Appends the postings of the current term of smi, a segment without
+	*  deletions, by reading its .frq and .prx streams directly instead of
+	*  decoding them through TermPositions. Only the doc deltas are rewritten
+	*  and positions without payloads are copied as raw bytes. The skip data
+	*  is generated like appendPostings does.
+	*
+	* @return the new number of documents the term was found in
+	*/
+	int32_t appendRawPostings(SegmentMergeInfo* smi, bool storePayloads, int32_t df,
+		int32_t& lastDoc, int32_t& lastPayloadLength);
+
+	/** Like appendPostings, but buffers the postings of the term and writes
+	*  them ordered by their new document numbers.
+	*/
+	int32_t appendSortedPostings(SegmentMergeInfo** smis, int32_t n);
+
+	/** Computes the order of the merged documents, by the index sort */
+	void sortDocuments();
+
+	/** Writes the index sort to the .srt file of the merged segment */
+	void writeIndexSort();
+
 	//Merges the norms for all fields 
 	void mergeNorms();
 
+	//Merges the doc values of all fields that have them
+	void mergeDocValues();
+
 	void createCompoundFile(const char* filename, std::vector<std::string>* files=NULL);
 	friend class IndexWriter; //allow IndexWriter to use createCompoundFile
 };
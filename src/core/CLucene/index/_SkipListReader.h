@@ -9,9 +9,65 @@
 
 #include "CLucene/store/IndexInput.h"
 #include "CLucene/util/Array.h"
+#include <map>
+#include <deque>
 
 CL_NS_DEF(index)
 
+/**
+ * Keeps the upper levels of the skip lists of a segment's frequent terms in
+ * memory, so that skipping on a term that was skipped on before does not
+ * read its upper levels from the .frq file again.
+ *
+ * The skip list readers of all threads share the cache. Cached levels
+ * never change and are reference counted, so an entry that is evicted
+ * stays valid for the readers that still use it. The cache holds at most
+ * maxBytes of skip data and evicts the oldest entries first.
+ */
+class CLUCENE_EXPORT SkipLevelCache: LUCENE_BASE {
+public:
+	/** The upper levels of one skip list, as they are stored in the file */
+	class CLUCENE_EXPORT Levels: LUCENE_REFBASE {
+	public:
+		int32_t numberOfSkipLevels;
+		int64_t* skipPointer;	// the start pointer of each level, level 0 follows the upper levels
+		int32_t* length;		// the length of each upper level
+		int64_t dataPointer;	// the file pointer of data
+		uint8_t* data;			// the upper levels, with their lengths
+
+		Levels(const int32_t numberOfSkipLevels);
+		~Levels();
+
+		/** Returns the bytes of the given level */
+		const uint8_t* levelData(const int32_t level) const;
+		int32_t size() const;
+	};
+
+private:
+	typedef std::map<int64_t, Levels*> LevelsType;
+	LevelsType levels;
+	std::deque<int64_t> order;	// the cached skip pointers, oldest first
+	const int64_t maxBytes;
+	int64_t bytes;
+	DEFINE_MUTEX(THIS_LOCK)
+
+public:
+	SkipLevelCache(const int64_t maxBytes);
+	~SkipLevelCache();
+
+	/** Returns the levels of the skip list at skipPointer, or NULL if they
+	* are not cached. The caller must release the levels with _CLDECDELETE. */
+	Levels* get(const int64_t skipPointer);
+
+	/** Caches the levels of the skip list at skipPointer, unless they are
+	* larger than the whole cache or were cached by another thread meanwhile.
+	* The caller keeps its reference to the levels. */
+	void put(const int64_t skipPointer, Levels* levels);
+
+	/** Returns the number of bytes of the cached levels */
+	int64_t getBytes();
+};
+
 /**
  * This abstract class reads skip lists with multiple levels.
  *
@@ -53,11 +109,16 @@ private:
 
 	bool inputIsBuffered;
 
+	SkipLevelCache* levelCache;		// shares the upper levels of frequent terms, may be NULL
+	SkipLevelCache::Levels* levels;	// the cached upper levels of the current skip list
+
 public:
   /**
   * @memory consumes _skipStream
+  * @param _levelCache the cache of the upper skip levels of the segment, or NULL
   */
-	MultiLevelSkipListReader(CL_NS(store)::IndexInput* _skipStream, const int32_t maxSkipLevels, const int32_t _skipInterval);
+	MultiLevelSkipListReader(CL_NS(store)::IndexInput* _skipStream, const int32_t maxSkipLevels, const int32_t _skipInterval,
+		SkipLevelCache* _levelCache = NULL);
 	virtual ~MultiLevelSkipListReader();
 
 	/** Returns the id of the doc to which the last call of {@link #skipTo(int)}
@@ -85,6 +146,9 @@ private:
 	/** Loads the skip levels  */
 	void loadSkipLevels();
 
+	/** Reads the upper levels of the current skip list into memory */
+	SkipLevelCache::Levels* readLevels();
+
 protected:
 	/**
 	* Subclasses must implement the actual skip data encoding in this method.
@@ -101,13 +165,16 @@ protected:
 	/** used to buffer the top skip levels */
 	class SkipBuffer : public CL_NS(store)::IndexInput {
 	private:
-		uint8_t* data;
+		const uint8_t* data;
+		uint8_t* ownData;
 		int64_t pointer;
 		int32_t pos;
 		size_t _datalength;
 
 	public:
 		SkipBuffer(CL_NS(store)::IndexInput* input, const int32_t length);
+		/** Reads a level that is kept in memory elsewhere, without copying it */
+		SkipBuffer(const uint8_t* data, const int32_t length, const int64_t pointer);
 		virtual ~SkipBuffer();
 
 	private:
@@ -151,7 +218,8 @@ private:
 	int32_t lastPayloadLength;
 
 public:
-	DefaultSkipListReader(CL_NS(store)::IndexInput* _skipStream, const int32_t maxSkipLevels, const int32_t _skipInterval);
+	DefaultSkipListReader(CL_NS(store)::IndexInput* _skipStream, const int32_t maxSkipLevels, const int32_t _skipInterval,
+		SkipLevelCache* _levelCache = NULL);
 	virtual ~DefaultSkipListReader();
 
 	void init(const int64_t _skipPointer, const int64_t freqBasePointer, const int64_t proxBasePointer, const int32_t df, const bool storesPayloads);
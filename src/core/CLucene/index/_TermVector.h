@@ -14,6 +14,8 @@
 
 CL_NS_DEF(index)
 
+class TermVectorsReader;
+
 class TermVectorsWriter:LUCENE_BASE {
 private:
 	CL_NS(store)::IndexOutput* tvx, *tvd, *tvf;
@@ -33,6 +35,13 @@ public:
   */
 	void addAllDocVectors(CL_NS(util)::ArrayBase<TermFreqVector*>* vectors);
 
+  /** Bulk write a contiguous series of documents, whose lengths were
+  *  retrieved by {@link TermVectorsReader#rawDocs}. The tvf data is copied
+  *  as is, and of the tvd records only the pointer to the first field of
+  *  each document is rewritten. */
+	void addRawDocuments(TermVectorsReader* reader, const int32_t* tvdLengths,
+		const int32_t* tvfLengths, const int32_t numDocs);
+
   /** Close all streams.
   * to suppress exceptions from being thrown, pass an error object to be filled in
   */
@@ -141,7 +150,21 @@ public:
 
 	void get(const int32_t docNumber, TermVectorMapper* mapper);
 
+	/** Returns true if the vectors files are in the current format, so that
+	*  {@link #rawDocs} can be used to bulk-copy them into a new segment. */
+	bool canReadRawDocs() const;
+
+	/** Retrieves the length in bytes of the .tvd record and of the .tvf
+	*  data of each document in a contiguous range of length numDocs starting
+	*  with startDocID. The tvd and tvf streams are left positioned at the
+	*  start of the range, for {@link TermVectorsWriter#addRawDocuments}. */
+	void rawDocs(int32_t* tvdLengths, int32_t* tvfLengths, const int32_t startDocID, const int32_t numDocs);
+
 private:
+	/** Returns the tvf pointer of the first field of the document whose
+	*  record starts at tvdPosition, or -1 if it has no vectors. */
+	int64_t readFirstTvfPointer(const int64_t tvdPosition);
+
 	CL_NS(util)::ObjectArray<SegmentTermVector>* readTermVectors(const int32_t docNum,
 		const TCHAR** fields, const int64_t* tvfPointers, const int32_t len);
 
@@ -162,6 +185,7 @@ private:
 	DEFINE_MUTEX(THIS_LOCK)
 	TermVectorsReader(const TermVectorsReader& copy);
 
+	friend class TermVectorsWriter;
 public:
 	TermVectorsReader* clone() const;
 };
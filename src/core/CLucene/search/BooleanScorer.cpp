@@ -60,12 +60,8 @@ CL_NS_DEF(search)
 	more = false;
 	end += BooleanScorer::BucketTable_SIZE;
 	for (SubScorer* sub = scorers; sub != NULL; sub = sub->next) {
-		Scorer* scorer = sub->scorer;
-			int32_t doc;
-			while (!sub->done && (doc=scorer->doc()) < end) {
-				sub->collector->collect(doc, scorer->score());
-			sub->done = !scorer->next();
-		}
+		if (!sub->done && sub->scorer->doc() < end)
+			sub->done = !sub->scorer->score(sub->collector, end);
 		if (!sub->done) {
 			more = true;
 		}
@@ -297,6 +293,11 @@ CL_NS_DEF(search)
     }
   }
 
+  void BooleanScorer::Collector::collectBatch(const int32_t* docs, const float_t* scores, const int32_t length){
+    for ( int32_t i = 0; i < length; i++ )
+      Collector::collect(docs[i], scores[i]);
+  }
+
 
 
 CL_NS_END
@@ -98,6 +98,10 @@ public:
 		return scorer->skipTo( docNr );
 	}
 
+	int32_t cost() const {
+		return scorer->cost();
+	}
+
 	virtual TCHAR* toString() {
 		return scorer->toString();
 	}
@@ -128,6 +132,7 @@ public:
 		return 0.0;
 	}
 	bool skipTo( int32_t /*target*/ ) { return false; }
+	int32_t cost() const { return 0; }
 	virtual TCHAR* toString() { return stringDuplicate(_T("NonMatchingScorer")); }
 
 	Explanation* explain( int32_t /*doc*/ ) {
@@ -208,6 +213,11 @@ public:
 		return reqScorer->skipTo( target );
 	}
 
+	/** The optional scorer does not add matches */
+	int32_t cost() const {
+		return reqScorer->cost();
+	}
+
 	virtual TCHAR* toString() {
 		return stringDuplicate(_T("ReqOptSumScorer"));
 	}
@@ -257,6 +267,10 @@ public:
 		return reqScorer->doc();
 	}
 
+	int32_t cost() const {
+		return reqScorer == NULL ? 0 : reqScorer->cost();
+	}
+
 	/** Returns the score of the current document matching the query.
 	* Initially invalid, until {@link #next()} is called the first time.
 	* @return The score of the required scorer.
@@ -561,6 +575,13 @@ public:
 	}
 	~Internal(){
 		_CLDELETE( coordinator );
+		if ( countingSumScorer == NULL ) {
+			// never iterated, e.g. a clause of a conjunction whose cheaper
+			// clause had no match, so the sub scorers were not handed over
+			requiredScorers.setDoDelete(true);
+			optionalScorers.setDoDelete(true);
+			prohibitedScorers.setDoDelete(true);
+		}
 		_CLDELETE( countingSumScorer );
 		/* TODO: these leak memory... haven't figure out how it should be fixed though...
 		requiredScorers.clear();
@@ -633,6 +654,22 @@ void BooleanScorer2::score( HitCollector* hc )
 	}
 }
 
+int32_t BooleanScorer2::cost() const
+{
+	// estimated from the clauses, so this can be used to plan the evaluation
+	// of an enclosing conjunction before any scorer is built
+	if ( _internal->requiredScorers.size() > 0 ) {
+		int32_t ret = LUCENE_INT32_MAX_SHOULDBE;
+		for ( Internal::ScorersType::const_iterator it = _internal->requiredScorers.begin(); it != _internal->requiredScorers.end(); it++ )
+			ret = cl_min( ret, (*it)->cost() );
+		return ret;
+	}
+	int64_t sum = 0;
+	for ( Internal::ScorersType::const_iterator it = _internal->optionalScorers.begin(); it != _internal->optionalScorers.end(); it++ )
+		sum += (*it)->cost();
+	return (int32_t)cl_min( sum, (int64_t)LUCENE_INT32_MAX_SHOULDBE );
+}
+
 int32_t BooleanScorer2::doc() const
 {
 	return _internal->countingSumScorer->doc();
@@ -98,6 +98,20 @@ TCHAR* CachingWrapperFilter::toString(){
 	_CLDELETE_CARRAY(fs);
 	return ret;
 }
+const char* CachingWrapperFilter::getObjectName() const{
+	return getClassName();
+}
+const char* CachingWrapperFilter::getClassName(){
+	return "CachingWrapperFilter";
+}
+bool CachingWrapperFilter::equals(Filter* other) const{
+	if ( !other->instanceOf(CachingWrapperFilter::getClassName()) )
+		return false;
+	return filter->equals(((CachingWrapperFilter*)other)->filter);
+}
+size_t CachingWrapperFilter::hashCode() const{
+	return filter->hashCode() ^ 0x1117BF07;
+}
 BitSet* CachingWrapperFilter::doBits(IndexReader* reader){
 	return filter->bits(reader);
 }
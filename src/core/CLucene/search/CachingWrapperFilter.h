@@ -60,6 +60,12 @@ public:
 
 	Filter *clone() const;
 	TCHAR *toString();
+
+	const char* getObjectName() const;
+	static const char* getClassName();
+	/** Equal if the wrapped filters are equal */
+	bool equals(Filter* other) const;
+	size_t hashCode() const;
 };
 
 CL_NS_END
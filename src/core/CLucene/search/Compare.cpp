@@ -70,6 +70,43 @@ int32_t ScoreDocComparators::String::sortType() {
 }
 
 
+/** A string sort value that owns its string */
+class PackedStringValue: public CL_NS(util)::Compare::TChar{
+	TCHAR* str;
+public:
+	PackedStringValue(TCHAR* str): CL_NS(util)::Compare::TChar(str){
+		this->str = str;
+	}
+	~PackedStringValue(){
+		_CLDELETE_CARRAY(str);
+	}
+};
+
+ScoreDocComparators::PackedString::PackedString(FieldCache::PackedStringIndex* index, int32_t len)
+{
+	this->length = len;
+	this->index = index;
+}
+
+int32_t ScoreDocComparators::PackedString::compare (struct ScoreDoc* i, struct ScoreDoc* j) {
+	CND_PRECONDITION(i->doc<length, "i->doc>=length")
+	CND_PRECONDITION(j->doc<length, "j->doc>=length")
+	const int32_t oi = index->getOrd(i->doc);
+	const int32_t oj = index->getOrd(j->doc);
+	if (oi < oj) return -1;
+	if (oi > oj) return 1;
+	return 0;
+}
+
+CL_NS(util)::Comparable* ScoreDocComparators::PackedString::sortValue (struct ScoreDoc* i) {
+	return _CLNEW PackedStringValue(index->lookup(index->getOrd(i->doc)));
+}
+
+int32_t ScoreDocComparators::PackedString::sortType() {
+	return SortField::STRING;
+}
+
+
 ScoreDocComparators::Int32::Int32(int32_t* fieldOrder, int32_t len)
 {
 	this->fieldOrder = fieldOrder;
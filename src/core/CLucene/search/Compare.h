@@ -48,6 +48,19 @@ public:
 		int32_t sortType();
 	};
 
+	/** Compares the ordinals of a FieldCache::PackedStringIndex. Only
+	* sortValue() decodes the term of a document. */
+	class CLUCENE_EXPORT PackedString: public ScoreDocComparator {
+		FieldCache::PackedStringIndex* index;
+		int32_t length;
+	public:
+		PackedString(FieldCache::PackedStringIndex* index, int32_t len);
+		int32_t compare (struct ScoreDoc* i, struct ScoreDoc* j);
+		CL_NS(util)::Comparable* sortValue (struct ScoreDoc* i);
+
+		int32_t sortType();
+	};
+
 	class CLUCENE_EXPORT Int32:public ScoreDocComparator{
 		int32_t* fieldOrder;
 		int32_t length;
@@ -49,73 +49,83 @@ CL_NS_DEF(search)
     return lastDoc;
   }
 
+  int32_t ConjunctionScorer::cost() const{
+    // the cheapest scorer bounds the number of matches
+    int32_t ret = scorers->length == 0 ? 0 : LUCENE_INT32_MAX_SHOULDBE;
+    for (size_t i = 0; i < scorers->length; i++)
+      ret = cl_min(ret, scorers->values[i]->cost());
+    return ret;
+  }
+
   bool ConjunctionScorer::next()  {
     if (firstTime) {
-      init(0);
+      return init(0);
     } else if (more) {
-      more = scorers->values[(scorers->length-1)]->next();
+      more = scorers->values[0]->next();
     }
-    return doNext();
+    return more && doNext();
   }
 
   bool ConjunctionScorer::doNext() {
-    int32_t first=0;
-    Scorer* lastScorer = scorers->values[scorers->length-1];
-    Scorer* firstScorer;
-    while (more && (firstScorer=scorers->values[first])->doc() < (lastDoc=lastScorer->doc())) {
-      more = firstScorer->skipTo(lastDoc);
-      lastScorer = firstScorer;
-      first = (first == (scorers->length-1)) ? 0 : first+1;
+    // the first (cheapest) scorer leads, the others are skipped to its
+    // document. When one of them skips past it, the lead is skipped to
+    // that document and the others are tried again.
+    Scorer* lead = scorers->values[0];
+    int32_t target = lead->doc();
+    size_t i = 1;
+    while (i < scorers->length) {
+      Scorer* other = scorers->values[i];
+      if (other->doc() < target && !other->skipTo(target))
+        return (more = false);
+      const int32_t otherDoc = other->doc();
+      if (otherDoc > target) {
+        if (!lead->skipTo(otherDoc))
+          return (more = false);
+        target = lead->doc();
+        i = 1;
+      } else {
+        i++;
+      }
     }
-    return more;
+    lastDoc = target;
+    return true;
   }
 
   bool ConjunctionScorer::skipTo(int32_t target) {
     if (firstTime)
       return init(target);
     else if (more)
-      more = scorers->values[(scorers->length-1)]->skipTo(target);
-    return doNext();
+      more = scorers->values[0]->skipTo(target);
+    return more && doNext();
   }
-  int ConjunctionScorer_sort(const void* _elem1, const void* _elem2){
-    const Scorer* elem1 = *(const Scorer**)_elem1;
-    const Scorer* elem2 = *(const Scorer**)_elem2;
-    return elem1->doc() - elem2->doc();
+
+  static bool ConjunctionScorer_costLess(const Scorer* elem1, const Scorer* elem2){
+    return elem1->cost() < elem2->cost();
   }
 
   bool ConjunctionScorer::init(int32_t target)  {
     firstTime = false;
-    more = scorers->length>1;
-
-
-    for (size_t i=0; i<scorers->length; i++) {
-      more = target==0 ? scorers->values[i]->next() : scorers->values[i]->skipTo(target);
-      if (!more)
-        return false;
+    if (scorers->length == 0)
+      return (more = false);
+
+    // Order the scorers by their estimated number of matches, so the
+    // iteration is driven by the rarest one and the expensive ones are
+    // only skipped to its candidates. Costs don't change while iterating,
+    // so this is done once.
+    std::stable_sort(scorers->values, scorers->values + scorers->length, ConjunctionScorer_costLess);
+
+    Scorer* lead = scorers->values[0];
+    more = target==0 ? lead->next() : lead->skipTo(target);
+    if (!more)
+      return false;
+
+    // position the others on or after the first candidate
+    const int32_t first = lead->doc();
+    for (size_t i=1; i<scorers->length; i++) {
+      if (!scorers->values[i]->skipTo(first))
+        return (more = false);
     }
-
-    // Sort the array the first time...
-    // We don't need to sort the array in any future calls because we know
-    // it will already start off sorted (all scorers on same doc).
-
-    // note that this comparator is not consistent with equals!
-    qsort(scorers->values,scorers->length, sizeof(Scorer*), ConjunctionScorer_sort);
-
-    doNext();
-
-    // If first-time skip distance is any predictor of
-    // scorer sparseness, then we should always try to skip first on
-    // those scorers.
-    // Keep last scorer in it's last place (it will be the first
-    // to be skipped on), but reverse all of the others so that
-    // they will be skipped on in order of original high skip.
-    int32_t end=(scorers->length-1)-1;
-    for (int32_t i=0; i<(end>>1); i++) {
-      Scorer* tmp = scorers->values[i];
-      scorers->values[i] = scorers->values[end-i];
-      scorers->values[end-i] = tmp;
-    }
-    return more;
+    return doNext();
   }
 
   float_t ConjunctionScorer::score(){
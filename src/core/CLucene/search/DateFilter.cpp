@@ -88,6 +88,22 @@ CL_NS_DEF(search)
   	return _CLNEW DateFilter(*this);	
   }
 
+  const char* DateFilter::getObjectName() const{
+	return getClassName();
+  }
+  const char* DateFilter::getClassName(){
+	return "DateFilter";
+  }
+  bool DateFilter::equals(Filter* other) const{
+	if ( !other->instanceOf(DateFilter::getClassName()) )
+		return false;
+	DateFilter* df = (DateFilter*)other;
+	return start->equals(df->start) && end->equals(df->end);
+  }
+  size_t DateFilter::hashCode() const{
+	return start->hashCode() ^ (end->hashCode() << 1);
+  }
+
   TCHAR* DateFilter::toString(){
 	size_t len = _tcslen(start->field()) + start->textLength() + end->textLength() + 8;
 	TCHAR* ret = _CL_NEWARRAY(TCHAR,len);
@@ -56,6 +56,11 @@ CL_NS_DEF(search)
 	Filter* clone() const;
 	
 	TCHAR* toString();
+
+	const char* getObjectName() const;
+	static const char* getClassName();
+	bool equals(Filter* other) const;
+	size_t hashCode() const;
   };
 CL_NS_END
 #endif
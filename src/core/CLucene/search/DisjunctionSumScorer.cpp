@@ -50,9 +50,14 @@ DisjunctionSumScorer::~DisjunctionSumScorer()
 
 void DisjunctionSumScorer::score( HitCollector* hc )
 {
-	while( next() ) {
-		hc->collect( currentDoc, currentScore );
-	}
+	int32_t docs[BATCH_SIZE];
+	float_t scores[BATCH_SIZE];
+	int32_t n;
+	do {
+		n = nextBatch( docs, scores, BATCH_SIZE );
+		if ( n > 0 )
+			hc->collectBatch( docs, scores, n );
+	} while ( n == BATCH_SIZE );
 }
 
 bool DisjunctionSumScorer::next()
@@ -72,6 +77,15 @@ int32_t DisjunctionSumScorer::doc() const
 	return currentDoc;
 }
 
+int32_t DisjunctionSumScorer::cost() const
+{
+	int64_t sum = 0;
+	for ( DisjunctionSumScorer::ScorersType::const_iterator itr = subScorers.begin(); itr != subScorers.end(); itr++ ) {
+		sum += (*itr)->cost();
+	}
+	return (int32_t)cl_min( sum, (int64_t)LUCENE_INT32_MAX_SHOULDBE );
+}
+
 int32_t DisjunctionSumScorer::nrMatchers() const
 {
 	return _nrMatchers;
@@ -145,13 +159,25 @@ Explanation* DisjunctionSumScorer::explain( int32_t doc ){
 
 bool DisjunctionSumScorer::score( HitCollector* hc, const int32_t max )
 {
+	int32_t docs[BATCH_SIZE];
+	float_t scores[BATCH_SIZE];
+	int32_t n = 0;
+	bool more = true;
 	while ( currentDoc < max ) {
-		hc->collect( currentDoc, currentScore );
+		docs[n] = currentDoc;
+		scores[n] = currentScore;
+		if ( ++n == BATCH_SIZE ) {
+			hc->collectBatch( docs, scores, n );
+			n = 0;
+		}
 		if ( !next() ) {
-			return false;
+			more = false;
+			break;
 		}
 	}
-	return true;
+	if ( n > 0 )
+		hc->collectBatch( docs, scores, n );
+	return more;
 }
 
 bool DisjunctionSumScorer::advanceAfterCurrent()
@@ -0,0 +1,151 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "CLucene/_ApiHeader.h"
+#include "EarlyTerminatingCollector.h"
+#include "Sort.h"
+#include "Scorer.h"
+#include "CLucene/index/IndexReader.h"
+#include "CLucene/index/MultiReader.h"
+#include "CLucene/index/_MultiSegmentReader.h"
+#include "CLucene/util/BitSet.h"
+#include <vector>
+
+CL_NS_USE(index)
+CL_NS_USE(util)
+CL_NS_DEF(search)
+
+/** Appends the leaf readers of reader to segments */
+static void earlyTerminatingAddSegments(IndexReader* reader, std::vector<IndexReader*>& segments) {
+	const ArrayBase<IndexReader*>* subReaders = NULL;
+	if (reader->instanceOf(MultiSegmentReader::getClassName()))
+		subReaders = ((MultiSegmentReader*)reader)->getSubReaders();
+	else if (reader->instanceOf(MultiReader::getClassName()))
+		subReaders = ((MultiReader*)reader)->getSubReaders();
+
+	if (subReaders == NULL) {
+		segments.push_back(reader);
+	} else {
+		for (size_t i = 0; i < subReaders->length; i++)
+			earlyTerminatingAddSegments((*subReaders)[i], segments);
+	}
+}
+
+EarlyTerminatingCollector::EarlyTerminatingCollector(IndexReader* reader, const Sort* sort,
+		const int32_t numHits, HitCollector* collector, const BitSet* bits):
+	bits(bits),
+	collector(collector),
+	numHits(numHits),
+	terminatedSegments(0)
+{
+	std::vector<IndexReader*> leaves;
+	earlyTerminatingAddSegments(reader, leaves);
+
+	const size_t numSegments = leaves.size();
+	starts.resize(numSegments + 1);
+	sorted.resize(numSegments);
+	hits.resize(numSegments);
+	for (size_t i = 0; i < numSegments; i++) {
+		starts.values[i + 1] = starts[i] + leaves[i]->maxDoc();
+		sorted.values[i] = canTerminate(leaves[i]->getIndexSort(), sort);
+	}
+
+	segment = -1;
+	segmentStart = segmentEnd = 0;
+}
+
+EarlyTerminatingCollector::~EarlyTerminatingCollector() {
+}
+
+void EarlyTerminatingCollector::setSegment(const int32_t doc) {
+	// the segment with the largest start that is not greater than doc
+	int32_t lo = 0;
+	int32_t hi = (int32_t)sorted.length - 1;
+	while (hi >= lo) {
+		int32_t mid = (lo + hi) >> 1;
+		if (doc < starts[mid])
+			hi = mid - 1;
+		else if (doc >= starts[mid + 1])
+			lo = mid + 1;
+		else {
+			lo = mid;
+			break;
+		}
+	}
+	segment = lo;
+	segmentStart = starts[segment];
+	segmentEnd = starts[segment + 1];
+}
+
+void EarlyTerminatingCollector::collect(const int32_t doc, const float_t score) {
+	if (score <= 0.0f ||                      // ignore zeroed buckets
+		(bits != NULL && !bits->get(doc)))      // skip docs not in bits
+		return;
+
+	if (doc < segmentStart || doc >= segmentEnd)
+		setSegment(doc);
+	if (hits[segment] >= numHits && sorted[segment])
+		return;
+
+	collector->collect(doc, score);
+	if (++hits.values[segment] == numHits && sorted[segment])
+		terminatedSegments++;
+}
+
+void EarlyTerminatingCollector::score(Scorer* scorer) {
+	const int32_t maxDoc = starts[sorted.length];
+	bool more = scorer->next();
+	while (more) {
+		const int32_t doc = scorer->doc();
+		if (doc < segmentStart || doc >= segmentEnd)
+			setSegment(doc);
+
+		if (hits[segment] >= numHits && sorted[segment]) {
+			// nothing else in this segment can be a top hit
+			more = segmentEnd < maxDoc && scorer->skipTo(segmentEnd);
+		} else {
+			collect(doc, scorer->score());
+			more = scorer->next();
+		}
+	}
+}
+
+int32_t EarlyTerminatingCollector::getTerminatedSegments() const {
+	return terminatedSegments;
+}
+
+bool EarlyTerminatingCollector::canTerminate(const SortField* indexSort, const Sort* sort) {
+	if (indexSort == NULL || sort == NULL)
+		return false;
+	SortField** fields = sort->getSort();
+	if (fields == NULL || fields[0] == NULL)
+		return false;
+
+	const SortField* first = fields[0];
+	if (first->getField() == NULL || _tcscmp(first->getField(), indexSort->getField()) != 0 ||
+		first->getType() != indexSort->getType() || first->getReverse() != indexSort->getReverse())
+		return false;
+
+	// equal values are ordered by document number, in the hit queue and in
+	// the segment
+	for (int32_t i = 1; fields[i] != NULL; i++) {
+		if (fields[i]->getType() != SortField::DOC || fields[i]->getReverse())
+			return false;
+	}
+	return true;
+}
+
+bool EarlyTerminatingCollector::canTerminate(IndexReader* reader, const Sort* sort) {
+	std::vector<IndexReader*> leaves;
+	earlyTerminatingAddSegments(reader, leaves);
+	for (size_t i = 0; i < leaves.size(); i++) {
+		if (canTerminate(leaves[i]->getIndexSort(), sort))
+			return true;
+	}
+	return false;
+}
+
+CL_NS_END
@@ -0,0 +1,85 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_search_EarlyTerminatingCollector_
+#define _lucene_search_EarlyTerminatingCollector_
+
+#include "SearchHeader.h"
+#include "CLucene/util/Array.h"
+CL_CLASS_DEF(index,IndexReader)
+CL_CLASS_DEF(util,BitSet)
+
+CL_NS_DEF(search)
+class Sort;
+class SortField;
+
+/**
+* Collects the hits of a search that is sorted like the documents of the
+* index, see {@link CL_NS(index)::IndexWriter#setIndexSort}.
+*
+* <p>In a segment whose documents are ordered by the sort, the first hits
+* are the best ones, so once numHits hits of a segment were collected the
+* rest of that segment can not make it into the top hits. They are not
+* passed to the wrapped collector, and {@link #score} skips the scorer to
+* the next segment without scoring them. Segments that are not sorted, for
+* example the ones flushed since the last merge, are collected completely.
+*
+* <p>Like the sorted searches of IndexSearcher, hits that are not in bits
+* and hits with a score of zero are dropped. Because the skipped hits are
+* never seen, the number of hits the wrapped collector sees is less than
+* the number of matching documents.
+*/
+class CLUCENE_EXPORT EarlyTerminatingCollector: public HitCollector {
+	CL_NS(util)::ValueArray<int32_t> starts;  // first doc of each segment, and maxDoc
+	CL_NS(util)::ValueArray<bool> sorted;     // whether the segment is ordered by the sort
+	CL_NS(util)::ValueArray<int32_t> hits;    // the hits collected of each segment
+	const CL_NS(util)::BitSet* bits;
+	HitCollector* collector;
+	const int32_t numHits;
+	int32_t terminatedSegments;
+
+	int32_t segment;   // the segment of the last hit
+	int32_t segmentStart;
+	int32_t segmentEnd;
+
+	void setSegment(const int32_t doc);
+public:
+	/**
+	* @param reader the reader that is searched
+	* @param sort the sort of the search
+	* @param numHits the number of top hits the search keeps
+	* @param collector receives the hits that may make it into the top hits
+	* @param bits if not NULL, only hits in bits are collected
+	*/
+	EarlyTerminatingCollector(CL_NS(index)::IndexReader* reader, const Sort* sort, const int32_t numHits,
+		HitCollector* collector, const CL_NS(util)::BitSet* bits=NULL);
+	~EarlyTerminatingCollector();
+
+	void collect(const int32_t doc, const float_t score);
+
+	/** Collects the hits of scorer, skipping the rest of every sorted
+	* segment that yielded numHits hits.
+	*/
+	void score(Scorer* scorer);
+
+	/** The number of segments whose remaining hits were skipped */
+	int32_t getTerminatedSegments() const;
+
+	/** Returns true if a search sorted by sort can stop collecting a
+	* segment whose documents are ordered by indexSort. This is the case
+	* if the first field of sort is indexSort, and it is only followed by
+	* the document order.
+	*/
+	static bool canTerminate(const SortField* indexSort, const Sort* sort);
+
+	/** Returns true if a search sorted by sort can stop collecting any
+	* segment of reader early.
+	*/
+	static bool canTerminate(CL_NS(index)::IndexReader* reader, const Sort* sort);
+};
+
+CL_NS_END
+#endif
@@ -0,0 +1,447 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "CLucene/_ApiHeader.h"
+#include "FacetCollector.h"
+#include "CLucene/index/IndexReader.h"
+#include "CLucene/index/MultiReader.h"
+#include "CLucene/index/_MultiSegmentReader.h"
+#include "CLucene/index/Term.h"
+#include "CLucene/index/Terms.h"
+#include "CLucene/util/_StringIntern.h"
+#include "CLucene/util/VoidMap.h"
+#include <algorithm>
+
+CL_NS_USE(index)
+CL_NS_USE(util)
+CL_NS_DEF(search)
+
+/**
+* The values of one field of a segment, as ordinals into the sorted terms
+* of the field.
+*/
+class FacetOrdinals {
+public:
+	int32_t numTerms;
+	TCHAR** terms;
+	int32_t* ords;      // the ordinal of each doc or -1, or the ordinals of all docs if docStarts is set
+	int32_t* docStarts; // NULL if no doc has more than one value, else maxDoc+1 offsets into ords
+
+	FacetOrdinals(IndexReader* reader, const TCHAR* field);
+	~FacetOrdinals();
+};
+
+FacetOrdinals::FacetOrdinals(IndexReader* reader, const TCHAR* field):
+	numTerms(0),
+	terms(NULL),
+	ords(NULL),
+	docStarts(NULL)
+{
+	const int32_t maxDoc = reader->maxDoc();
+	if (maxDoc < 0)
+		_CLTHROWA(CL_ERR_CorruptIndex, "maxDoc is negative");
+	const size_t numDocs = (size_t)maxDoc;
+	std::vector<TCHAR*> termList;
+	std::vector<int32_t> termEnds; // the end of the docs of each term
+	std::vector<int32_t> docs;     // the docs of all terms, in term order
+	int32_t* valuesPerDoc = _CL_NEWARRAY(int32_t, numDocs + 1);
+	memset(valuesPerDoc, 0, sizeof(int32_t) * (numDocs + 1));
+
+	field = CLStringIntern::intern(field);
+	Term* term = _CLNEW Term(field, LUCENE_BLANK_STRING, false);
+	TermEnum* termEnum = reader->terms(term);
+	_CLDECDELETE(term);
+	TermDocs* termDocs = reader->termDocs();
+	int32_t docBuffer[32];
+	int32_t freqBuffer[32];
+	try {
+		do {
+			Term* t = termEnum->term(false);
+			if (t == NULL || t->field() != field)
+				break;
+
+			termDocs->seek(termEnum);
+			int32_t n;
+			while ((n = termDocs->read(docBuffer, freqBuffer, 32)) > 0) {
+				for (int32_t i = 0; i < n; i++) {
+					docs.push_back(docBuffer[i]);
+					valuesPerDoc[docBuffer[i]]++;
+				}
+			}
+			termList.push_back(STRDUP_TtoT(t->text()));
+			termEnds.push_back((int32_t)docs.size());
+		} while (termEnum->next());
+	} _CLFINALLY(
+		termDocs->close();
+		_CLDELETE(termDocs);
+		termEnum->close();
+		_CLDELETE(termEnum);
+		CLStringIntern::unintern(field);
+	)
+
+	numTerms = (int32_t)termList.size();
+	terms = _CL_NEWARRAY(TCHAR*, numTerms + 1);
+	for (int32_t i = 0; i < numTerms; i++)
+		terms[i] = termList[i];
+	terms[numTerms] = NULL;
+
+	bool multiValued = false;
+	for (int32_t i = 0; i < maxDoc && !multiValued; i++)
+		multiValued = valuesPerDoc[i] > 1;
+
+	if (!multiValued) {
+		ords = _CL_NEWARRAY(int32_t, numDocs);
+		for (int32_t i = 0; i < maxDoc; i++)
+			ords[i] = -1;
+		int32_t p = 0;
+		for (int32_t ord = 0; ord < numTerms; ord++) {
+			for (; p < termEnds[ord]; p++)
+				ords[docs[p]] = ord;
+		}
+	} else {
+		// the terms are read in order, so the ordinals of each doc are sorted
+		docStarts = _CL_NEWARRAY(int32_t, numDocs + 1);
+		docStarts[0] = 0;
+		for (int32_t i = 0; i < maxDoc; i++) {
+			docStarts[i + 1] = docStarts[i] + valuesPerDoc[i];
+			valuesPerDoc[i] = docStarts[i]; // now the next free slot of the doc
+		}
+		ords = _CL_NEWARRAY(int32_t, docs.size() + 1);
+		int32_t p = 0;
+		for (int32_t ord = 0; ord < numTerms; ord++) {
+			for (; p < termEnds[ord]; p++)
+				ords[valuesPerDoc[docs[p]]++] = ord;
+		}
+	}
+	_CLDELETE_ARRAY(valuesPerDoc);
+}
+
+FacetOrdinals::~FacetOrdinals() {
+	for (int32_t i = 0; i < numTerms; i++)
+		_CLDELETE_CARRAY(terms[i]);
+	_CLDELETE_ARRAY(terms);
+	_CLDELETE_ARRAY(ords);
+	_CLDELETE_ARRAY(docStarts);
+}
+
+
+/** The ordinals of every reader and field that were counted */
+class FacetOrdinalsCache {
+	typedef CLHashMap<TCHAR*, FacetOrdinals*,
+		Compare::TChar,
+		Equals::TChar,
+		Deletor::tcArray,
+		Deletor::Object<FacetOrdinals> > FieldsType;
+	typedef CLHashMap<IndexReader*, FieldsType*,
+		Compare::Void<IndexReader>,
+		Equals::Void<IndexReader>,
+		Deletor::Object<IndexReader>,
+		Deletor::Object<FieldsType> > ReadersType;
+
+	ReadersType readers;
+	DEFINE_MUTEX(THIS_LOCK)
+
+	static void closeCallback(IndexReader* reader, void* cache);
+public:
+	FacetOrdinalsCache():
+		readers(false, true)
+	{
+	}
+
+	/** Returns the ordinals of field, mapping them on first use. The
+	* ordinals are deleted when reader is closed. */
+	FacetOrdinals* get(IndexReader* reader, const TCHAR* field);
+};
+
+static FacetOrdinalsCache* FacetOrdinalsCache_DEFAULT = NULL;
+
+void FacetOrdinalsCache::closeCallback(IndexReader* reader, void* cache) {
+	FacetOrdinalsCache* fc = (FacetOrdinalsCache*)cache;
+	SCOPED_LOCK_MUTEX(fc->THIS_LOCK)
+	fc->readers.remove(reader);
+}
+
+FacetOrdinals* FacetOrdinalsCache::get(IndexReader* reader, const TCHAR* field) {
+	{
+		SCOPED_LOCK_MUTEX(THIS_LOCK)
+		FieldsType* fields = readers.get(reader);
+		if (fields != NULL) {
+			FacetOrdinals* ret = fields->get((TCHAR*)field);
+			if (ret != NULL)
+				return ret;
+		}
+	}
+
+	// map the terms without holding the lock, like the FieldCache
+	FacetOrdinals* ordinals = _CLNEW FacetOrdinals(reader, field);
+
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+	FieldsType* fields = readers.get(reader);
+	if (fields == NULL) {
+		fields = _CLNEW FieldsType(true, true);
+		readers.put(reader, fields);
+		reader->addCloseCallback(closeCallback, this);
+	}
+	FacetOrdinals* ret = fields->get((TCHAR*)field);
+	if (ret != NULL) {
+		// another thread mapped the field first
+		_CLDELETE(ordinals);
+		return ret;
+	}
+	fields->put(STRDUP_TtoT(field), ordinals);
+	return ordinals;
+}
+
+
+FacetCounts::FacetCounts(const TCHAR* field):
+	field(STRDUP_TtoT(field))
+{
+}
+
+FacetCounts::~FacetCounts() {
+	for (size_t i = 0; i < values.size(); i++) {
+		TCHAR* term = (TCHAR*)values[i].term;
+		_CLDELETE_CARRAY(term);
+	}
+	_CLDELETE_CARRAY(field);
+}
+
+const TCHAR* FacetCounts::getField() const {
+	return field;
+}
+
+int32_t FacetCounts::size() const {
+	return (int32_t)values.size();
+}
+
+static bool facetValueTermLess(const FacetValue& a, const FacetValue& b) {
+	return _tcscmp(a.term, b.term) < 0;
+}
+
+static bool facetValueCountGreater(const FacetValue& a, const FacetValue& b) {
+	if (a.count != b.count)
+		return a.count > b.count;
+	return _tcscmp(a.term, b.term) < 0;
+}
+
+int32_t FacetCounts::getCount(const TCHAR* term) const {
+	FacetValue key;
+	key.term = term;
+	std::vector<FacetValue>::const_iterator itr = std::lower_bound(values.begin(), values.end(), key, facetValueTermLess);
+	if (itr != values.end() && _tcscmp(itr->term, term) == 0)
+		return itr->count;
+	return 0;
+}
+
+void FacetCounts::getTopValues(const int32_t k, std::vector<FacetValue>& results) const {
+	results.assign(values.begin(), values.end());
+	const size_t n = cl_min((size_t)cl_max(k, 0), results.size());
+	std::partial_sort(results.begin(), results.begin() + n, results.end(), facetValueCountGreater);
+	results.resize(n);
+}
+
+void FacetCounts::merge(const FacetCounts* other) {
+	std::vector<FacetValue> merged;
+	merged.reserve(values.size() + other->values.size());
+	size_t i = 0, j = 0;
+	while (i < values.size() || j < other->values.size()) {
+		int32_t c;
+		if (i == values.size())
+			c = 1;
+		else if (j == other->values.size())
+			c = -1;
+		else
+			c = _tcscmp(values[i].term, other->values[j].term);
+
+		if (c < 0) {
+			merged.push_back(values[i++]);
+		} else if (c > 0) {
+			FacetValue v;
+			v.term = STRDUP_TtoT(other->values[j].term);
+			v.count = other->values[j++].count;
+			merged.push_back(v);
+		} else {
+			FacetValue v = values[i++];
+			v.count += other->values[j++].count;
+			merged.push_back(v);
+		}
+	}
+	values.swap(merged);
+}
+
+
+FacetCollector::FacetCollector(IndexReader* reader, const TCHAR** fields, HitCollector* collector):
+	collector(collector)
+{
+	ValueArray<IndexReader*> readers(1);
+	readers.values[0] = reader;
+	init(&readers, fields);
+}
+
+FacetCollector::FacetCollector(const ArrayBase<IndexReader*>* readers, const TCHAR** fields, HitCollector* collector):
+	collector(collector)
+{
+	init(readers, fields);
+}
+
+/** Appends the leaf readers of reader to segments */
+static void facetAddSegments(IndexReader* reader, std::vector<IndexReader*>& segments) {
+	const ArrayBase<IndexReader*>* subReaders = NULL;
+	if (reader->instanceOf(MultiSegmentReader::getClassName()))
+		subReaders = ((MultiSegmentReader*)reader)->getSubReaders();
+	else if (reader->instanceOf(MultiReader::getClassName()))
+		subReaders = ((MultiReader*)reader)->getSubReaders();
+
+	if (subReaders == NULL) {
+		segments.push_back(reader);
+	} else {
+		for (size_t i = 0; i < subReaders->length; i++)
+			facetAddSegments((*subReaders)[i], segments);
+	}
+}
+
+void FacetCollector::init(const ArrayBase<IndexReader*>* readers, const TCHAR** _fields) {
+	std::vector<IndexReader*> leaves;
+	for (size_t i = 0; i < readers->length; i++)
+		facetAddSegments((*readers)[i], leaves);
+
+	size_t numFields = 0;
+	while (_fields[numFields] != NULL)
+		numFields++;
+	fields.resize(numFields);
+	for (size_t i = 0; i < numFields; i++)
+		fields.values[i] = STRDUP_TtoT(_fields[i]);
+
+	if (FacetOrdinalsCache_DEFAULT == NULL)
+		FacetOrdinalsCache_DEFAULT = _CLNEW FacetOrdinalsCache();
+
+	const size_t numSegments = leaves.size();
+	segments.resize(numSegments);
+	starts.resize(numSegments + 1);
+	ordinals.resize(numSegments * numFields);
+	counts.resize(numSegments * numFields);
+	for (size_t i = 0; i < numSegments; i++) {
+		segments.values[i] = leaves[i];
+		starts.values[i + 1] = starts[i] + leaves[i]->maxDoc();
+		for (size_t f = 0; f < numFields; f++) {
+			FacetOrdinals* o = FacetOrdinalsCache_DEFAULT->get(leaves[i], fields[f]);
+			ordinals.values[i * numFields + f] = o;
+			const size_t numCounts = (size_t)o->numTerms + 1;
+			int32_t* c = _CL_NEWARRAY(int32_t, numCounts);
+			memset(c, 0, sizeof(int32_t) * numCounts);
+			counts.values[i * numFields + f] = c;
+		}
+	}
+
+	segment = -1;
+	segmentStart = segmentEnd = 0;
+}
+
+FacetCollector::~FacetCollector() {
+	for (size_t i = 0; i < counts.length; i++)
+		_CLDELETE_ARRAY(counts.values[i]);
+	for (size_t i = 0; i < fields.length; i++)
+		_CLDELETE_CARRAY(fields.values[i]);
+}
+
+void FacetCollector::setSegment(const int32_t doc) {
+	// the segment with the largest start that is not greater than doc
+	int32_t lo = 0;
+	int32_t hi = (int32_t)segments.length - 1;
+	while (hi >= lo) {
+		int32_t mid = (lo + hi) >> 1;
+		if (doc < starts[mid])
+			hi = mid - 1;
+		else if (doc >= starts[mid + 1])
+			lo = mid + 1;
+		else {
+			lo = mid;
+			break;
+		}
+	}
+	segment = lo;
+	segmentStart = starts[segment];
+	segmentEnd = starts[segment + 1];
+}
+
+inline void FacetCollector::count(const int32_t doc) {
+	if (doc < segmentStart || doc >= segmentEnd)
+		setSegment(doc);
+	const int32_t local = doc - segmentStart;
+	const size_t numFields = fields.length;
+	FacetOrdinals** o = ordinals.values + segment * numFields;
+	int32_t** c = counts.values + segment * numFields;
+	for (size_t f = 0; f < numFields; f++) {
+		if (o[f]->docStarts == NULL) {
+			const int32_t ord = o[f]->ords[local];
+			if (ord >= 0)
+				c[f][ord]++;
+		} else {
+			const int32_t end = o[f]->docStarts[local + 1];
+			for (int32_t i = o[f]->docStarts[local]; i < end; i++)
+				c[f][o[f]->ords[i]]++;
+		}
+	}
+}
+
+void FacetCollector::collect(const int32_t doc, const float_t score) {
+	count(doc);
+	if (collector != NULL)
+		collector->collect(doc, score);
+}
+
+void FacetCollector::collectBatch(const int32_t* docs, const float_t* scores, const int32_t length) {
+	for (int32_t i = 0; i < length; i++)
+		count(docs[i]);
+	if (collector != NULL)
+		collector->collectBatch(docs, scores, length);
+}
+
+FacetCounts* FacetCollector::getCounts(const TCHAR* field) const {
+	int32_t f = -1;
+	for (size_t i = 0; i < fields.length && f < 0; i++) {
+		if (_tcscmp(fields[i], field) == 0)
+			f = (int32_t)i;
+	}
+	if (f < 0)
+		_CLTHROWA(CL_ERR_IllegalArgument, "field was not counted by this FacetCollector");
+
+	// the values that were hit in each segment, which are sorted by term
+	std::vector<FacetValue> hit;
+	for (size_t i = 0; i < segments.length; i++) {
+		const FacetOrdinals* o = ordinals[i * fields.length + f];
+		const int32_t* c = counts[i * fields.length + f];
+		for (int32_t ord = 0; ord < o->numTerms; ord++) {
+			if (c[ord] > 0) {
+				FacetValue v;
+				v.term = o->terms[ord];
+				v.count = c[ord];
+				hit.push_back(v);
+			}
+		}
+	}
+	if (segments.length > 1)
+		std::stable_sort(hit.begin(), hit.end(), facetValueTermLess);
+
+	FacetCounts* ret = _CLNEW FacetCounts(field);
+	for (size_t i = 0; i < hit.size(); i++) {
+		if (!ret->values.empty() && _tcscmp(ret->values.back().term, hit[i].term) == 0) {
+			ret->values.back().count += hit[i].count;
+		} else {
+			FacetValue v;
+			v.term = STRDUP_TtoT(hit[i].term);
+			v.count = hit[i].count;
+			ret->values.push_back(v);
+		}
+	}
+	return ret;
+}
+
+void FacetCollector::_shutdown() {
+	_CLDELETE(FacetOrdinalsCache_DEFAULT);
+}
+
+CL_NS_END
@@ -0,0 +1,124 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_search_FacetCollector_
+#define _lucene_search_FacetCollector_
+
+#include "SearchHeader.h"
+#include "CLucene/util/Array.h"
+#include <vector>
+CL_CLASS_DEF(index,IndexReader)
+
+CL_NS_DEF(search)
+class FacetOrdinals;
+
+/** A value of a facet field and the number of hits that have it. */
+struct CLUCENE_EXPORT FacetValue {
+	const TCHAR* term;
+	int32_t count;
+};
+
+/**
+* The hit counts of the values of one facet field, as collected by a
+* {@link FacetCollector}. Only the values of at least one hit are kept.
+*/
+class CLUCENE_EXPORT FacetCounts: LUCENE_BASE {
+	TCHAR* field;
+	std::vector<FacetValue> values; // sorted by term, the terms are owned
+public:
+	FacetCounts(const TCHAR* field);
+	~FacetCounts();
+
+	/** The field that was counted */
+	const TCHAR* getField() const;
+
+	/** The number of distinct values that were counted */
+	int32_t size() const;
+
+	/** Returns the number of hits that have the value term */
+	int32_t getCount(const TCHAR* term) const;
+
+	/** Fills results with the k values that have the most hits, most hits
+	* first, and values with the same count by term. The terms belong to
+	* this object.
+	*/
+	void getTopValues(const int32_t k, std::vector<FacetValue>& results) const;
+
+	/** Adds the counts of other, for example those of the same search on
+	* another index, to these counts.
+	*/
+	void merge(const FacetCounts* other);
+
+	friend class FacetCollector;
+};
+
+/**
+* Counts the values of one or more fields over the hits of a search, for
+* faceted navigation, without loading the stored documents.
+*
+* <p>On first use the terms of each field are mapped to ordinals for every
+* segment of the searched reader. The maps are cached until the segment's
+* reader is closed, so a reopened reader only maps its new segments. Hits
+* are counted in a dense array per segment, and {@link #getCounts} merges
+* the values that were hit across the segments.
+*
+* <p>A field may have several values per document. To count the hits of a
+* {@link MultiSearcher}, pass the readers of its IndexSearchers, in the
+* same order.
+*
+* <pre>
+*   const TCHAR* fields[] = {_T("category"), _T("author"), NULL};
+*   FacetCollector facets(searcher.getReader(), fields);
+*   searcher._search(query, NULL, &facets);
+*   FacetCounts* counts = facets.getCounts(_T("category"));
+* </pre>
+*/
+class CLUCENE_EXPORT FacetCollector: public HitCollector {
+	CL_NS(util)::ValueArray<CL_NS(index)::IndexReader*> segments;
+	CL_NS(util)::ValueArray<int32_t> starts;         // first doc of each segment, and maxDoc
+	CL_NS(util)::ValueArray<TCHAR*> fields;
+	CL_NS(util)::ValueArray<FacetOrdinals*> ordinals; // by segment and field, owned by the cache
+	CL_NS(util)::ValueArray<int32_t*> counts;         // by segment and field, by ordinal
+	HitCollector* collector;
+
+	int32_t segment;   // the segment of the last hit
+	int32_t segmentStart;
+	int32_t segmentEnd;
+
+	void init(const CL_NS(util)::ArrayBase<CL_NS(index)::IndexReader*>* readers, const TCHAR** fields);
+	void setSegment(const int32_t doc);
+	inline void count(const int32_t doc);
+public:
+	/**
+	* @param reader the reader that is searched
+	* @param fields the NULL terminated list of fields to count
+	* @param collector if not NULL, also receives every hit
+	*/
+	FacetCollector(CL_NS(index)::IndexReader* reader, const TCHAR** fields, HitCollector* collector=NULL);
+
+	/**
+	* @param readers the readers of the searchers of a MultiSearcher
+	* @param fields the NULL terminated list of fields to count
+	* @param collector if not NULL, also receives every hit
+	*/
+	FacetCollector(const CL_NS(util)::ArrayBase<CL_NS(index)::IndexReader*>* readers, const TCHAR** fields,
+		HitCollector* collector=NULL);
+	~FacetCollector();
+
+	void collect(const int32_t doc, const float_t score);
+	void collectBatch(const int32_t* docs, const float_t* scores, const int32_t length);
+
+	/** Returns the counts of field, which must be one of the counted
+	* fields. The caller owns the returned object.
+	*/
+	FacetCounts* getCounts(const TCHAR* field) const;
+
+	/** Frees the cached ordinal maps */
+	static void _shutdown();
+};
+
+CL_NS_END
+#endif
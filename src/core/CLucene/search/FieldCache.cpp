@@ -13,6 +13,7 @@ CL_NS_DEF(search)
 
 FieldCache* FieldCache_DEFAULT = NULL;
 int32_t FieldCache::STRING_INDEX = -1;
+int32_t FieldCache::PACKED_STRING_INDEX = -2;
     
 FieldCache* FieldCache::DEFAULT(){
     if ( FieldCache_DEFAULT == NULL )
@@ -35,6 +36,7 @@ FieldCacheAuto::FieldCacheAuto(int32_t len, int32_t type){
 	comparableArray=NULL;
 	sortComparator=NULL;
 	scoreDocComparator=NULL;
+	packedStringIndex=NULL;
 }
 FieldCacheAuto::~FieldCacheAuto(){
 	if ( contentType == FieldCacheAuto::INT_ARRAY ){
@@ -59,6 +61,8 @@ FieldCacheAuto::~FieldCacheAuto(){
 		_CLDELETE(sortComparator);
 	}else if ( contentType == FieldCacheAuto::SCOREDOC_COMPARATOR ){
 		_CLDELETE(scoreDocComparator);
+	}else if ( contentType == FieldCacheAuto::PACKED_STRING_INDEX ){
+		_CLDELETE(packedStringIndex);
 	}
 }
 
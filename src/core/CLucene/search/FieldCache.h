@@ -46,6 +46,69 @@ public:
         ~StringIndex();
 	};
 
+	/** Expert: A memory compact version of StringIndex, used for sorting by
+	* string. The ordinal of every document is stored in a bit packed array
+	* using as few bits as the number of unique terms needs. The terms are
+	* stored as UTF-8 in blocks of BLOCK_SIZE terms, where every term but the
+	* first of a block only stores the bytes that differ from its predecessor.
+	* Ordinal 0 is used for documents without a term, the terms are numbered
+	* from 1 in natural order.
+	*/
+	class CLUCENE_EXPORT PackedStringIndex:LUCENE_BASE {
+	private:
+		uint64_t* ords;
+		int32_t bitsPerOrd;
+		uint64_t ordMask;
+		int32_t maxDoc;
+
+		uint8_t* termBytes;
+		int64_t termBytesLen;
+		int64_t* blockOffsets;
+		int32_t count;
+		int32_t maxTermBytes;
+
+		void setOrd(int32_t doc, int32_t ord);
+		friend class FieldCacheImpl;
+	public:
+		/** The number of terms a block of prefix compressed terms holds */
+		LUCENE_STATIC_CONSTANT(int32_t, BLOCK_SIZE=16);
+
+		/** Creates an index for maxDoc documents and count ordinals, with the
+		* prefix compressed term blocks built by the field cache. All documents
+		* start out with ordinal 0.
+		* @param maxTermBytes the length of the longest term in UTF-8
+		* @memory Consumes termBytes and blockOffsets. */
+		PackedStringIndex(int32_t maxDoc, int32_t count, uint8_t* termBytes, int64_t termBytesLen,
+			int64_t* blockOffsets, int32_t maxTermBytes);
+		~PackedStringIndex();
+
+		/** Returns the ordinal of the term of doc, 0 if doc has none */
+		inline int32_t getOrd(const int32_t doc) const{
+			if ( bitsPerOrd == 0 )
+				return 0;
+			const int64_t bit = (int64_t)doc * bitsPerOrd;
+			const size_t word = (size_t)(bit >> 6);
+			const int32_t shift = (int32_t)(bit & 63);
+			uint64_t v = ords[word] >> shift;
+			if ( shift + bitsPerOrd > 64 )
+				v |= ords[word+1] << (64 - shift);
+			return (int32_t)(v & ordMask);
+		}
+
+		/** Returns a copy of the term with the given ordinal, or NULL for
+		* ordinal 0. The string must be deleted by the caller. */
+		TCHAR* lookup(int32_t ord) const;
+
+		/** The number of ordinals, including 0 */
+		int32_t getCount() const;
+
+		/** The number of bits used for each document */
+		int32_t getBitsPerOrd() const;
+
+		/** The approximate number of bytes used by this index */
+		int64_t getSizeInBytes() const;
+	};
+
 
   /** Indicator for FieldCache::StringIndex values in the cache.
   NOTE: the value assigned to this constant must not be
@@ -53,13 +116,20 @@ public:
   */
   static int32_t STRING_INDEX;
 
+  /** Indicator for FieldCache::PackedStringIndex values in the cache.
+  NOTE: the value assigned to this constant must not be
+        the same as any of those in SortField!!
+  */
+  static int32_t PACKED_STRING_INDEX;
+
   /** Expert: The cache used internally by sorting and range query classes. */
   static FieldCache* DEFAULT();
 
   /** Checks the internal cache for an appropriate entry, and if none is
    * found, reads the terms in <code>field</code> as integers and returns an array
    * of size <code>reader.maxDoc()</code> of the value each document
-   * has in the given field.
+   * has in the given field. If the field has INTS doc values, they are read
+   * instead of the terms.
    * @param reader  Used to get field values.
    * @param field   Which field contains the integers.
    * @return The values in the given field for each document.
@@ -70,7 +140,8 @@ public:
   /** Checks the internal cache for an appropriate entry, and if
    * none is found, reads the terms in <code>field</code> as floats and returns an array
    * of size <code>reader.maxDoc()</code> of the value each document
-   * has in the given field.
+   * has in the given field. If the field has INTS doc values, they are read
+   * instead of the terms.
    * @param reader  Used to get field values.
    * @param field   Which field contains the floats.
    * @return The values in the given field for each document.
@@ -100,15 +171,26 @@ public:
    */
    virtual FieldCacheAuto* getStringIndex (CL_NS(index)::IndexReader* reader, const TCHAR* field) = 0;
 
+  /** Checks the internal cache for an appropriate entry, and if none
+   * is found reads the term values in <code>field</code> into a
+   * FieldCache::PackedStringIndex. This is what sorting by string uses,
+   * it needs a fraction of the memory of getStringIndex().
+   * @param reader  Used to get field values.
+   * @param field   Which field contains the strings.
+   * @return Packed ordinals and the terms for each document.
+   * @throws IOException  If any error occurs.
+   */
+   virtual FieldCacheAuto* getPackedStringIndex (CL_NS(index)::IndexReader* reader, const TCHAR* field) = 0;
+
   /** Checks the internal cache for an appropriate entry, and if
    * none is found reads <code>field</code> to see if it contains integers, floats
    * or strings, and then calls one of the other methods in this class to get the
-   * values.  For string values, a FieldCache::StringIndex is returned.  After
+   * values.  For string values, a FieldCache::PackedStringIndex is returned.  After
    * calling this method, there is an entry in the cache for both
    * type <code>AUTO</code> and the actual found type.
    * @param reader  Used to get field values.
    * @param field   Which field contains the values.
-   * @return int32_t[], float_t[] or FieldCache::StringIndex.
+   * @return int32_t[], float_t[] or FieldCache::PackedStringIndex.
    * @throws IOException  If any error occurs.
    */
    virtual FieldCacheAuto* getAuto (CL_NS(index)::IndexReader* reader, const TCHAR* field) = 0;
@@ -136,6 +218,7 @@ public:
 	1 - integer array
 	2 - float array
 	3 - FieldCache::StringIndex object
+	8 - FieldCache::PackedStringIndex object
 	This class is also used when returning getInt, getFloat, etc
 	because we have no way of returning the size of the array and
 	this class can be used to determine the array size
@@ -149,7 +232,8 @@ public:
 		STRING_ARRAY=4,
 		COMPARABLE_ARRAY=5,
 		SORT_COMPARATOR=6,
-		SCOREDOC_COMPARATOR=7
+		SCOREDOC_COMPARATOR=7,
+		PACKED_STRING_INDEX=8
 	};
 
 	FieldCacheAuto(int32_t len, int32_t type);
@@ -165,6 +249,7 @@ public:
 	CL_NS(util)::Comparable** comparableArray; //item 5
 	SortComparator* sortComparator; //item 6
 	ScoreDocComparator* scoreDocComparator; //item 7
+	FieldCache::PackedStringIndex* packedStringIndex; //item 8
 
 };
 
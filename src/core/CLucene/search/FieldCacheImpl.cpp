@@ -9,6 +9,7 @@
 #include "CLucene/index/IndexReader.h"
 #include "CLucene/index/Term.h"
 #include "CLucene/index/Terms.h"
+#include "CLucene/index/DocValues.h"
 #include "CLucene/util/_StringIntern.h"
 #include "CLucene/util/Misc.h"
 #include "Sort.h"
@@ -76,6 +77,98 @@ FieldCache::StringIndex::~StringIndex(){
     _CLDELETE_ARRAY(lookup);
 }
 
+FieldCache::PackedStringIndex::PackedStringIndex(int32_t maxDoc, int32_t count, uint8_t* termBytes,
+	int64_t termBytesLen, int64_t* blockOffsets, int32_t maxTermBytes)
+{
+	this->maxDoc = maxDoc;
+	this->count = count;
+	this->termBytes = termBytes;
+	this->termBytesLen = termBytesLen;
+	this->blockOffsets = blockOffsets;
+	this->maxTermBytes = maxTermBytes;
+
+	bitsPerOrd = 0;
+	while ( ((int64_t)1 << bitsPerOrd) < count )
+		bitsPerOrd++;
+	ordMask = ((uint64_t)1 << bitsPerOrd) - 1;
+
+	//one extra word, so that getOrd never reads past the end
+	const size_t words = (size_t)(((int64_t)maxDoc * bitsPerOrd + 63) >> 6) + 1;
+	ords = _CL_NEWARRAY(uint64_t, words);
+	memset(ords, 0, sizeof(uint64_t) * words);
+}
+
+FieldCache::PackedStringIndex::~PackedStringIndex(){
+	_CLDELETE_ARRAY(ords);
+	_CLDELETE_ARRAY(termBytes);
+	_CLDELETE_ARRAY(blockOffsets);
+}
+
+void FieldCache::PackedStringIndex::setOrd(int32_t doc, int32_t ord){
+	if ( bitsPerOrd == 0 )
+		return;
+	const int64_t bit = (int64_t)doc * bitsPerOrd;
+	const size_t word = (size_t)(bit >> 6);
+	const int32_t shift = (int32_t)(bit & 63);
+	ords[word] = (ords[word] & ~(ordMask << shift)) | ((uint64_t)ord << shift);
+	if ( shift + bitsPerOrd > 64 ){
+		const int32_t written = 64 - shift;
+		ords[word+1] = (ords[word+1] & ~(ordMask >> written)) | ((uint64_t)ord >> written);
+	}
+}
+
+static int32_t PackedStringIndex_readVInt(const uint8_t*& p){
+	uint8_t b = *p++;
+	int32_t i = b & 0x7F;
+	for (int32_t shift = 7; (b & 0x80) != 0; shift += 7) {
+		b = *p++;
+		i |= (b & 0x7F) << shift;
+	}
+	return i;
+}
+
+TCHAR* FieldCache::PackedStringIndex::lookup(int32_t ord) const{
+	if ( ord <= 0 || ord >= count )
+		return NULL;
+
+	//decode the block up to the term, starting from its first, complete term
+	const int32_t t = ord - 1;
+	const uint8_t* p = termBytes + blockOffsets[t / BLOCK_SIZE];
+	uint8_t* buf = _CL_NEWARRAY(uint8_t, maxTermBytes + 1);
+	int32_t len = PackedStringIndex_readVInt(p);
+	memcpy(buf, p, len);
+	p += len;
+	for ( int32_t i = t - (t % BLOCK_SIZE); i < t; i++ ){
+		const int32_t prefix = PackedStringIndex_readVInt(p);
+		const int32_t suffix = PackedStringIndex_readVInt(p);
+		memcpy(buf + prefix, p, suffix);
+		p += suffix;
+		len = prefix + suffix;
+	}
+	buf[len] = 0;
+
+	TCHAR* ret = _CL_NEWARRAY(TCHAR, len + 1);
+#ifdef _UCS2
+	lucene_utf8towcs(ret, (const char*)buf, len + 1);
+#else
+	memcpy(ret, buf, len + 1);
+#endif
+	_CLDELETE_ARRAY(buf);
+	return ret;
+}
+
+int32_t FieldCache::PackedStringIndex::getCount() const{
+	return count;
+}
+int32_t FieldCache::PackedStringIndex::getBitsPerOrd() const{
+	return bitsPerOrd;
+}
+int64_t FieldCache::PackedStringIndex::getSizeInBytes() const{
+	return (((int64_t)maxDoc * bitsPerOrd + 63) >> 6) * sizeof(uint64_t)
+		+ termBytesLen
+		+ ((count + BLOCK_SIZE - 1) / BLOCK_SIZE) * sizeof(int64_t);
+}
+
 FieldCacheImpl::FieldCacheImpl()
 {
     cache = _CLNEW fieldcacheCacheType(false,true);
@@ -231,6 +324,15 @@ FieldCacheImpl::FileEntry::FileEntry (const TCHAR* field, int32_t type) {
 
 
 
+ DocValues* FieldCacheImpl::getIntDocValues (IndexReader* reader, const TCHAR* field) {
+   // the values are copied into the cache once, so they are read from the
+   // file rather than loaded a second time
+   DocValues* docValues = reader->getDocValues(field, false);
+   if (docValues != NULL && docValues->getType() == DocValues::INTS)
+     return docValues;
+   return NULL;
+ }
+
  // inherit javadocs
  FieldCacheAuto* FieldCacheImpl::getInts (IndexReader* reader, const TCHAR* field) {
     field = CLStringIntern::intern(field);
@@ -239,7 +341,12 @@ FieldCacheImpl::FileEntry::FileEntry (const TCHAR* field, int32_t type) {
       int32_t retLen = reader->maxDoc();
       int32_t* retArray = _CL_NEWARRAY(int32_t,retLen);
 	    memset(retArray,0,sizeof(int32_t)*retLen);
-      if (retLen > 0) {
+      DocValues* docValues = getIntDocValues(reader, field);
+      if (docValues != NULL) {
+        // the values were written at index time, no need to uninvert the field
+        for (int32_t i = 0; i < retLen; i++)
+          retArray[i] = (int32_t)docValues->getInt(i);
+      } else if (retLen > 0) {
         TermDocs* termDocs = reader->termDocs();
 
 	    Term* term = _CLNEW Term (field, LUCENE_BLANK_STRING, false);
@@ -287,7 +394,11 @@ FieldCacheImpl::FileEntry::FileEntry (const TCHAR* field, int32_t type) {
 	  int32_t retLen = reader->maxDoc();
       float_t* retArray = _CL_NEWARRAY(float_t,retLen);
 	  memset(retArray,0,sizeof(float_t)*retLen);
-      if (retLen > 0) {
+      DocValues* docValues = getIntDocValues(reader, field);
+      if (docValues != NULL) {
+        for (int32_t i = 0; i < retLen; i++)
+          retArray[i] = (float_t)docValues->getInt(i);
+      } else if (retLen > 0) {
         TermDocs* termDocs = reader->termDocs();
 
 		Term* term = _CLNEW Term (field, LUCENE_BLANK_STRING, false);
@@ -467,11 +578,221 @@ FieldCacheImpl::FileEntry::FileEntry (const TCHAR* field, int32_t type) {
     return ret;
   }
 
+  /** Appends the prefix compressed terms of a PackedStringIndex */
+  class PackedTermsWriter{
+    uint8_t* bytes;
+    int64_t bytesLen;
+    int64_t bytesSize;
+    int64_t* blocks;
+    int32_t blocksLen;
+    int32_t blocksSize;
+    char* last;
+    int32_t lastLen;
+    char* current;
+    size_t currentSize;
+    int32_t count;
+
+    void ensure(int64_t more){
+      if ( bytesLen + more > bytesSize ){
+        int64_t size = cl_max(bytesSize * 2, bytesLen + more);
+        uint8_t* tmp = _CL_NEWARRAY(uint8_t, (size_t)size);
+        memcpy(tmp, bytes, (size_t)bytesLen);
+        _CLDELETE_ARRAY(bytes);
+        bytes = tmp;
+        bytesSize = size;
+      }
+    }
+    void writeVInt(int32_t i){
+      ensure(5);
+      while ((i & ~0x7F) != 0) {
+        bytes[bytesLen++] = (uint8_t)((i & 0x7f) | 0x80);
+        i >>= 7;
+      }
+      bytes[bytesLen++] = (uint8_t)i;
+    }
+    void writeBytes(const char* b, int32_t len){
+      ensure(len);
+      memcpy(bytes + bytesLen, b, len);
+      bytesLen += len;
+    }
+  public:
+    int32_t maxTermBytes;
+
+    PackedTermsWriter():
+      bytesLen(0), bytesSize(1024), blocksLen(0), blocksSize(64),
+      lastLen(0), currentSize(64), count(0), maxTermBytes(0)
+    {
+      bytes = _CL_NEWARRAY(uint8_t, (size_t)bytesSize);
+      blocks = _CL_NEWARRAY(int64_t, blocksSize);
+      last = _CL_NEWARRAY(char, currentSize);
+      current = _CL_NEWARRAY(char, currentSize);
+    }
+    ~PackedTermsWriter(){
+      _CLDELETE_ARRAY(bytes);
+      _CLDELETE_ARRAY(blocks);
+      _CLDELETE_ARRAY(last);
+      _CLDELETE_ARRAY(current);
+    }
+
+    void add(const TCHAR* text, size_t textLen){
+#ifdef _UCS2
+      const size_t needed = textLen * 6 + 1; //worst case utf8 length
+#else
+      const size_t needed = textLen + 1;
+#endif
+      if ( needed > currentSize ){
+        _CLDELETE_ARRAY(current);
+        char* tmp = _CL_NEWARRAY(char, needed);
+        memcpy(tmp, last, lastLen);
+        _CLDELETE_ARRAY(last);
+        last = tmp;
+        current = _CL_NEWARRAY(char, needed);
+        currentSize = needed;
+      }
+#ifdef _UCS2
+      const int32_t len = (int32_t)lucene_wcstoutf8(current, text, currentSize);
+#else
+      const int32_t len = (int32_t)textLen;
+      memcpy(current, text, len);
+#endif
+      maxTermBytes = cl_max(maxTermBytes, len);
+
+      if ( (count % FieldCache::PackedStringIndex::BLOCK_SIZE) == 0 ){
+        //the first term of a block is stored in full
+        if ( blocksLen == blocksSize ){
+          int64_t* tmp = _CL_NEWARRAY(int64_t, blocksSize * 2);
+          memcpy(tmp, blocks, sizeof(int64_t) * blocksLen);
+          _CLDELETE_ARRAY(blocks);
+          blocks = tmp;
+          blocksSize *= 2;
+        }
+        blocks[blocksLen++] = bytesLen;
+        writeVInt(len);
+        writeBytes(current, len);
+      }else{
+        int32_t prefix = 0;
+        const int32_t limit = cl_min(len, lastLen);
+        while ( prefix < limit && current[prefix] == last[prefix] )
+          prefix++;
+        writeVInt(prefix);
+        writeVInt(len - prefix);
+        writeBytes(current + prefix, len - prefix);
+      }
+
+      char* tmp = last;
+      last = current;
+      current = tmp;
+      lastLen = len;
+      count++;
+    }
+
+    /** Returns the trimmed term bytes, and the block offsets */
+    uint8_t* takeBytes(int64_t& len){
+      uint8_t* ret = _CL_NEWARRAY(uint8_t, (size_t)cl_max(bytesLen, (int64_t)1));
+      memcpy(ret, bytes, (size_t)bytesLen);
+      len = bytesLen;
+      return ret;
+    }
+    int64_t* takeBlocks(){
+      int64_t* ret = _CL_NEWARRAY(int64_t, cl_max(blocksLen, 1));
+      memcpy(ret, blocks, sizeof(int64_t) * blocksLen);
+      return ret;
+    }
+  };
+
+  // inherit javadocs
+  FieldCacheAuto* FieldCacheImpl::getPackedStringIndex (IndexReader* reader, const TCHAR* field){
+    field = CLStringIntern::intern(field);
+    FieldCacheAuto* ret = lookup (reader, field, PACKED_STRING_INDEX);
+    if (ret == NULL) {
+      int32_t retLen = reader->maxDoc();
+      PackedTermsWriter writer;
+      int32_t t = 1;  // ordinal of the next term, 0 is for documents without a term
+
+      // the number of bits per ordinal is only known once all terms are
+      // read, so the first pass only collects the terms, and the second
+      // one writes the ordinals of the documents into the packed array
+      if ( retLen > 0 ) {
+        Term* term = _CLNEW Term (field, LUCENE_BLANK_STRING, false);
+        TermEnum* termEnum = reader->terms (term);
+        _CLDECDELETE(term);
+        try {
+          if (termEnum->term(false) == NULL) {
+            _CLTHROWA(CL_ERR_Runtime,"no terms in field");
+          }
+          do {
+            Term* term = termEnum->term(false);
+            if (term->field() != field)
+              break;
+
+            // we expect that there is at most one term per document
+            if (t >= retLen+1)
+              _CLTHROWA(CL_ERR_Runtime,"there are more terms than documents in field");
+            writer.add(term->text(), term->textLength());
+            t++;
+          } while (termEnum->next());
+        } _CLFINALLY (
+          termEnum->close();
+          _CLDELETE(termEnum);
+        );
+      }
+
+      int64_t bytesLen = 0;
+      uint8_t* bytes = writer.takeBytes(bytesLen);
+      FieldCache::PackedStringIndex* value = _CLNEW FieldCache::PackedStringIndex(retLen, t,
+        bytes, bytesLen, writer.takeBlocks(), writer.maxTermBytes);
+
+      if ( t > 1 ) {
+        TermDocs* termDocs = reader->termDocs();
+        Term* term = _CLNEW Term (field, LUCENE_BLANK_STRING, false);
+        TermEnum* termEnum = reader->terms (term);
+        _CLDECDELETE(term);
+
+        int32_t docs[32];
+        int32_t freqs[32];
+        try {
+          for ( int32_t ord = 1; ord < t; ord++ ) {
+            termDocs->seek (termEnum);
+            int32_t count;
+            while ( (count = termDocs->read(docs, freqs, 32)) > 0 ){
+              for ( int32_t i=0;i<count;i++ )
+                value->setOrd(docs[i], ord);
+            }
+            termEnum->next();
+          }
+        } catch(...) {
+          _CLDELETE(value);
+          termDocs->close();
+          _CLDELETE(termDocs);
+          termEnum->close();
+          _CLDELETE(termEnum);
+          throw;
+        }
+        termDocs->close();
+        _CLDELETE(termDocs);
+        termEnum->close();
+        _CLDELETE(termEnum);
+      }
+
+      FieldCacheAuto* fa = _CLNEW FieldCacheAuto(retLen,FieldCacheAuto::PACKED_STRING_INDEX);
+      fa->packedStringIndex = value;
+      fa->ownContents=true;
+      store (reader, field, PACKED_STRING_INDEX, fa);
+      CLStringIntern::unintern(field);
+      return fa;
+    }
+    CLStringIntern::unintern(field);
+    return ret;
+  }
+
   // inherit javadocs
   FieldCacheAuto* FieldCacheImpl::getAuto (IndexReader* reader, const TCHAR* field) {
 	  field = CLStringIntern::intern(field);
     FieldCacheAuto* ret = lookup (reader, field, SortField::AUTO);
-    if (ret == NULL) {
+    if (ret == NULL && getIntDocValues(reader, field) != NULL) {
+      ret = getInts (reader, field);
+      store (reader, field, SortField::AUTO, ret);
+    } else if (ret == NULL) {
 	    Term* term = _CLNEW Term (field, LUCENE_BLANK_STRING, false);
       TermEnum* enumerator = reader->terms (term);
 	    _CLDECDELETE(term);
@@ -509,7 +830,7 @@ FieldCacheImpl::FileEntry::FileEntry (const TCHAR* field, int32_t type) {
 			      if ( isfloat )
 				      ret = getFloats (reader, field);
 			      else{
-				      ret = getStringIndex (reader, field);
+				      ret = getPackedStringIndex (reader, field);
 			      }
 		      }
 
@@ -106,12 +106,11 @@ bool FieldSortedHitQueue::lessThan (FieldDoc* docA, FieldDoc* docB) {
 //static
 ScoreDocComparator* FieldSortedHitQueue::comparatorString (IndexReader* reader, const TCHAR* field) {
 	//const TCHAR* field = CLStringIntern::intern(fieldname);
-	FieldCacheAuto* fa = FieldCache::DEFAULT()->getStringIndex (reader, field);
+	FieldCacheAuto* fa = FieldCache::DEFAULT()->getPackedStringIndex (reader, field);
 	//CLStringIntern::unintern(field);
 
-	CND_PRECONDITION(fa->contentType==FieldCacheAuto::STRING_INDEX,"Content type is incorrect");
-	fa->ownContents = false;
-    return _CLNEW ScoreDocComparators::String(fa->stringIndex, fa->contentLen);
+	CND_PRECONDITION(fa->contentType==FieldCacheAuto::PACKED_STRING_INDEX,"Content type is incorrect");
+    return _CLNEW ScoreDocComparators::PackedString(fa->packedStringIndex, fa->contentLen);
 }
 
 //static 
@@ -139,7 +138,8 @@ ScoreDocComparator* FieldSortedHitQueue::comparatorInt (IndexReader* reader, con
     FieldCacheAuto* fa =  FieldCache::DEFAULT()->getAuto (reader, field);
 	//CLStringIntern::unintern(field);
 
-    if (fa->contentType == FieldCacheAuto::STRING_INDEX ) {
+    if (fa->contentType == FieldCacheAuto::PACKED_STRING_INDEX ||
+        fa->contentType == FieldCacheAuto::STRING_INDEX ) {
       return comparatorString (reader, field);
     } else if (fa->contentType == FieldCacheAuto::INT_ARRAY) {
       return comparatorInt (reader, field);
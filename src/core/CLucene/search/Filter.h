@@ -37,6 +37,24 @@ CL_NS_DEF(search)
 
 	//Creates a user-readable version of this query and returns it as as string
 	virtual TCHAR* toString()=0;
+
+	/**
+	* Returns true if other is a filter of the same class that permits the same
+	* documents of every reader. Results computed with one filter can then be
+	* reused for the other, see QueryResultCache. The default compares the
+	* addresses of the filters, so a clone does not equal its original.
+	*/
+	virtual bool equals(Filter* other) const;
+
+	/** Returns a hash code consistent with equals */
+	virtual size_t hashCode() const;
+
+	/** Returns the class name of the filter, used by equals to check the
+	* class of the other filter. The default returns NULL, the name of no class. */
+	virtual const char* getObjectName() const;
+
+	/** Returns true if the filter's class name is other */
+	bool instanceOf(const char* other) const;
   };
 CL_NS_END
 #endif
@@ -20,6 +20,8 @@
 #include "CLucene/util/BitSet.h"
 #include "FieldSortedHitQueue.h"
 #include "Explanation.h"
+#include "QueryResultCache.h"
+#include "EarlyTerminatingCollector.h"
 
 CL_NS_USE(index)
 CL_NS_USE(util)
@@ -56,6 +58,10 @@ CL_NS_DEF(search)
     			}
     		}
     	}
+		void collectBatch(const int32_t* docs, const float_t* scores, const int32_t length){
+			for ( int32_t i=0;i<length;i++ )
+				SimpleTopDocsCollector::collect(docs[i], scores[i]);
+		}
 	};
 
 	class SortedTopDocsCollector:public HitCollector{ 
@@ -116,6 +122,8 @@ CL_NS_DEF(search)
 
       reader = IndexReader::open(path);
       readerOwner = true;
+      queryResultCache = NULL;
+      earlyTermination = false;
   }
   
   IndexSearcher::IndexSearcher(CL_NS(store)::Directory* directory){
@@ -128,6 +136,8 @@ CL_NS_DEF(search)
 
       reader = IndexReader::open(directory);
       readerOwner = true;
+      queryResultCache = NULL;
+      earlyTermination = false;
   }
 
   IndexSearcher::IndexSearcher(IndexReader* r){
@@ -138,6 +148,8 @@ CL_NS_DEF(search)
 
       reader      = r;
       readerOwner = false;
+      queryResultCache = NULL;
+      earlyTermination = false;
   }
 
   IndexSearcher::~IndexSearcher(){
@@ -219,6 +231,12 @@ CL_NS_DEF(search)
       CND_PRECONDITION(reader != NULL, "reader is NULL");
       CND_PRECONDITION(query != NULL, "query is NULL");
 
+      if ( queryResultCache != NULL ){
+        TopDocs* cached = queryResultCache->get(reader, query, filter, NULL, nDocs);
+        if ( cached != NULL )
+          return cached;
+      }
+
       Weight* weight = query->weight(this);
       Scorer* scorer = weight->scorer(reader);
       if (scorer == NULL) {
@@ -260,7 +278,10 @@ CL_NS_DEF(search)
 			  _CLLDELETE(wq);
 		  _CLDELETE(weight);
 
-      return _CLNEW TopDocs(totalHitsInt, scoreDocs, scoreDocsLength);
+      TopDocs* ret = _CLNEW TopDocs(totalHitsInt, scoreDocs, scoreDocsLength);
+      if ( queryResultCache != NULL )
+        queryResultCache->put(reader, query, filter, NULL, nDocs, ret);
+      return ret;
   }
 
   // inherit javadoc
@@ -270,6 +291,26 @@ CL_NS_DEF(search)
       CND_PRECONDITION(reader != NULL, "reader is NULL");
       CND_PRECONDITION(query != NULL, "query is NULL");
 
+    // early terminated results only count the collected hits, keep them out
+    // of the cache so that they are not returned to searches that count all
+    const bool terminate = earlyTermination && EarlyTerminatingCollector::canTerminate(reader, sort);
+    if ( queryResultCache != NULL && !terminate ){
+      TopDocs* cached = queryResultCache->get(reader, query, filter, sort, nDocs);
+      if ( cached != NULL ){
+        // the cache only keeps document numbers and scores, fill in the sort
+        // values again from the comparators, which are cached per reader
+        FieldSortedHitQueue hq(reader, sort->getSort(), nDocs);
+        FieldDoc** fieldDocs = _CL_NEWARRAY(FieldDoc*,cached->scoreDocsLength);
+        for (int32_t i=0; i<cached->scoreDocsLength; i++)
+          fieldDocs[i] = hq.fillFields(_CLNEW FieldDoc(cached->scoreDocs[i].doc, cached->scoreDocs[i].score));
+        SortField** hqFields = hq.getFields();
+        hq.setFields(NULL);
+        TopFieldDocs* ret = _CLNEW TopFieldDocs(cached->totalHits, fieldDocs, cached->scoreDocsLength, hqFields);
+        _CLDELETE(cached);
+        return ret;
+      }
+    }
+
     Weight* weight = query->weight(this);
     Scorer* scorer = weight->scorer(reader);
     if (scorer == NULL){
@@ -282,7 +323,11 @@ CL_NS_DEF(search)
 	totalHits[0]=0;
     
 	SortedTopDocsCollector hitCol(bits,&hq,totalHits,nDocs);
-	scorer->score(&hitCol);
+	if ( terminate ){
+		EarlyTerminatingCollector earlyCol(reader, sort, nDocs, &hitCol, bits);
+		earlyCol.score(scorer);
+	}else
+		scorer->score(&hitCol);
     _CLLDELETE(scorer);
 
 	int32_t hqLen = hq.size();
@@ -302,7 +347,10 @@ CL_NS_DEF(search)
 	if ( bits != NULL && filter->shouldDeleteBitSet(bits) )
 		_CLLDELETE(bits);
     _CLDELETE_LARRAY(totalHits);
-    return _CLNEW TopFieldDocs(totalHits0, fieldDocs, hqLen, hqFields );
+    TopFieldDocs* ret = _CLNEW TopFieldDocs(totalHits0, fieldDocs, hqLen, hqFields );
+    if ( queryResultCache != NULL && !terminate )
+      queryResultCache->put(reader, query, filter, sort, nDocs, ret);
+    return ret;
   }
 
   void IndexSearcher::_search(Query* query, Filter* filter, HitCollector* results){
@@ -346,6 +394,22 @@ CL_NS_DEF(search)
 		_CLLDELETE(bits);
   }
 
+  void IndexSearcher::setQueryResultCache(QueryResultCache* cache){
+      queryResultCache = cache;
+  }
+
+  QueryResultCache* IndexSearcher::getQueryResultCache(){
+      return queryResultCache;
+  }
+
+  void IndexSearcher::setEarlyTermination(bool earlyTermination){
+      this->earlyTermination = earlyTermination;
+  }
+
+  bool IndexSearcher::getEarlyTermination() const{
+      return earlyTermination;
+  }
+
   Query* IndexSearcher::rewrite(Query* original) {
         Query* query = original;
 		Query* last = original;
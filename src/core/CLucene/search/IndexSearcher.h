@@ -19,6 +19,7 @@ CL_CLASS_DEF(search,Filter)
 CL_CLASS_DEF(search,Sort)
 CL_CLASS_DEF(search,HitCollector)
 CL_CLASS_DEF(search,Explanation)
+CL_CLASS_DEF(search,QueryResultCache)
 CL_CLASS_DEF(index,IndexReader)
 //#include "CLucene/index/IndexReader.h"
 //#include "CLucene/util/BitSet.h"
@@ -34,6 +35,8 @@ CL_NS_DEF(search)
 class CLUCENE_EXPORT IndexSearcher:public Searcher{
 	CL_NS(index)::IndexReader* reader;
 	bool readerOwner;
+	QueryResultCache* queryResultCache;
+	bool earlyTermination;
 
 public:
 	/** Creates a searcher searching the index in the named directory.
@@ -76,6 +79,30 @@ public:
 
 	CL_NS(index)::IndexReader* getReader();
 
+	/** Sets a cache that top hits searches consult before running a query,
+	* and that their results are added to. The same cache can be set on
+	* several searchers of the same index, for instance on the searchers of
+	* a reader and its reopened version. Pass NULL to stop caching.
+	* @memory the cache is not deleted by this searcher
+	* @see QueryResultCache
+	*/
+	void setQueryResultCache(QueryResultCache* cache);
+
+	/** Returns the cache set with setQueryResultCache, or NULL */
+	QueryResultCache* getQueryResultCache();
+
+	/** If true, searches sorted like the documents of the index stop
+	* collecting a sorted segment once it yielded the requested number of
+	* hits, see {@link EarlyTerminatingCollector}. The top hits are the
+	* same, but the total hits of the results only count the collected
+	* hits, so {@link Hits#length} is not the number of matching documents.
+	* Off by default.
+	*/
+	void setEarlyTermination(bool earlyTermination);
+
+	/** Returns the value set with setEarlyTermination */
+	bool getEarlyTermination() const;
+
 	Query* rewrite(Query* original);
 	void explain(Query* query, int32_t doc, Explanation* ret);
 
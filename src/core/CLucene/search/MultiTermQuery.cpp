@@ -9,6 +9,7 @@
 #include "BooleanQuery.h"
 #include "FilteredTermEnum.h"
 #include "TermQuery.h"
+#include "_MultiTermRewrite.h"
 #include "CLucene/index/Term.h"
 #include "CLucene/util/StringBuffer.h"
 
@@ -16,6 +17,10 @@ CL_NS_USE(index)
 CL_NS_USE(util)
 CL_NS_DEF(search)
 
+  static MultiTermQuery::RewriteMethod MultiTermQuery_defaultRewriteMethod = MultiTermQuery::SCORING_BOOLEAN_QUERY_REWRITE;
+  static int32_t MultiTermQuery_termCountCutoff = MultiTermQuery::DEFAULT_TERM_COUNT_CUTOFF;
+  static float_t MultiTermQuery_docCountPercent = 0.1f;
+
 /** Constructs a query for terms matching <code>term</code>. */
 
   MultiTermQuery::MultiTermQuery(Term* t){
@@ -26,10 +31,11 @@ CL_NS_DEF(search)
       CND_PRECONDITION(t != NULL, "t is NULL");
 
       term  = _CL_POINTER(t);
-
+      rewriteMethod = MultiTermQuery_defaultRewriteMethod;
   }
   MultiTermQuery::MultiTermQuery(const MultiTermQuery& clone):
-  	Query(clone)	
+  	Query(clone),
+	rewriteMethod(clone.rewriteMethod)
   {
 	term = _CLNEW Term(clone.getTerm(false),clone.getTerm(false)->text());
   }
@@ -49,35 +55,49 @@ CL_NS_DEF(search)
 		return term;
   }
 
-	Query* MultiTermQuery::rewrite(IndexReader* reader) {
+	void MultiTermQuery::collectTerms(IndexReader* reader, MultiTermRewrite* collector) {
 		FilteredTermEnum* enumerator = getEnum(reader);
-		BooleanQuery* query = _CLNEW BooleanQuery( true );
 		try {
             do {
                 Term* t = enumerator->term(false);
-                if (t != NULL) {
-                    TermQuery* tq = _CLNEW TermQuery(t);	// found a match
-                    tq->setBoost(getBoost() * enumerator->difference()); // set the boost
-                    query->add(tq,true, false, false);		// add to q
-                }
+                if (t != NULL && !collector->collect(t, enumerator->docFreq(), enumerator->difference())) // found a match
+                    break;
             } while (enumerator->next());
         } _CLFINALLY ( enumerator->close(); _CLDELETE(enumerator) );
+	}
+
+	Query* MultiTermQuery::rewrite(IndexReader* reader) {
+		MultiTermRewrite collector(reader, rewriteMethod, getBoost());
+		collectTerms(reader, &collector);
+		return collector.getQuery(this);
+	}
+
+	void MultiTermQuery::setRewriteMethod(RewriteMethod method){
+		rewriteMethod = method;
+	}
+	MultiTermQuery::RewriteMethod MultiTermQuery::getRewriteMethod() const{
+		return rewriteMethod;
+	}
 
-		//if we only added one clause and the clause is not prohibited then
-		//we can just return the query
-		if (query->getClauseCount() == 1) {                    // optimize 1-clause queries
-			BooleanClause* c=0;
-		    query->getClauses(&c);
+	void MultiTermQuery::setDefaultRewriteMethod(RewriteMethod method){
+		MultiTermQuery_defaultRewriteMethod = method;
+	}
+	MultiTermQuery::RewriteMethod MultiTermQuery::getDefaultRewriteMethod(){
+		return MultiTermQuery_defaultRewriteMethod;
+	}
 
-			if (!c->prohibited) {			  // just return clause
-				c->deleteQuery=false;
-				Query* ret = c->getQuery();
+	void MultiTermQuery::setAutoRewriteTermCountCutoff(int32_t count){
+		MultiTermQuery_termCountCutoff = count;
+	}
+	int32_t MultiTermQuery::getAutoRewriteTermCountCutoff(){
+		return MultiTermQuery_termCountCutoff;
+	}
 
-				_CLDELETE(query);
-				return ret;
-            }
-        }
-		return query;
+	void MultiTermQuery::setAutoRewriteDocCountPercent(float_t percent){
+		MultiTermQuery_docCountPercent = percent;
+	}
+	float_t MultiTermQuery::getAutoRewriteDocCountPercent(){
+		return MultiTermQuery_docCountPercent;
 	}
 	
 	Query* MultiTermQuery::combine(CL_NS(util)::ArrayBase<Query*>* queries) {
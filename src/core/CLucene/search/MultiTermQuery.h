@@ -13,6 +13,7 @@ CL_CLASS_DEF(util,StringBuffer)
 CL_CLASS_DEF(index,Term)
 CL_CLASS_DEF(search,FilteredTermEnum)
 CL_CLASS_DEF(index,IndexReader)
+CL_CLASS_DEF(search,MultiTermRewrite)
 //#include "CLucene/index/Terms.h"
 //#include "FilteredTermEnum.h"
 //#include "SearchHeader.h"
@@ -33,10 +34,47 @@ CL_NS_DEF(search)
      * For example, {@link WildcardQuery} and {@link FuzzyQuery} extend
      * <code>MultiTermQuery</code> to provide {@link WildcardTermEnum} and
      * {@link FuzzyTermEnum}, respectively.
+     * <P>
+     * How the matching terms are turned into a query is chosen by the
+     * {@link #setRewriteMethod rewrite method}. By default every matching
+     * term is expanded into a clause of a scoring BooleanQuery. The constant
+     * score methods fill a bitset with all matching documents instead, and
+     * score them as a {@link ConstantScoreQuery}.
      */
     class CLUCENE_EXPORT MultiTermQuery: public Query {
+    public:
+      /** How a multi term query (and PrefixQuery and RangeQuery) is rewritten */
+      enum RewriteMethod {
+        /** Expand to a BooleanQuery with a TermQuery for every matching term.
+        * The terms are scored individually. Throws TooManyClauses if more
+        * terms match than {@link BooleanQuery#getMaxClauseCount} */
+        SCORING_BOOLEAN_QUERY_REWRITE,
+        /** Fill a bitset with the documents of all matching terms and score
+        * them with a constant score, the boost of the query. Never throws
+        * TooManyClauses. */
+        CONSTANT_SCORE_FILTER_REWRITE,
+        /** Use SCORING_BOOLEAN_QUERY_REWRITE while few terms with few
+        * documents match, and switch to CONSTANT_SCORE_FILTER_REWRITE as
+        * soon as the enumeration passes {@link #getAutoRewriteTermCountCutoff}
+        * terms or {@link #getAutoRewriteDocCountPercent} percent of the
+        * documents in the index. */
+        CONSTANT_SCORE_AUTO_REWRITE
+      };
+
+      /** The default number of terms after which CONSTANT_SCORE_AUTO_REWRITE
+      * switches to a filter */
+      LUCENE_STATIC_CONSTANT(int32_t, DEFAULT_TERM_COUNT_CUTOFF=350);
+
+      /** CONSTANT_SCORE_AUTO_REWRITE never switches to a filter because of the
+      * number of documents before this many postings were visited */
+      LUCENE_STATIC_CONSTANT(int32_t, MIN_DOC_COUNT_CUTOFF=1000);
+
     private:
         CL_NS(index)::Term* term;
+        RewriteMethod rewriteMethod;
+
+        void collectTerms(CL_NS(index)::IndexReader* reader, MultiTermRewrite* collector);
+        friend class MultiTermFilter;
     protected:
         MultiTermQuery(const MultiTermQuery& clone);
 
@@ -57,6 +95,32 @@ CL_NS_DEF(search)
       TCHAR* toString(const TCHAR* field) const;
 
 		  virtual Query* rewrite(CL_NS(index)::IndexReader* reader);
+
+      /** Sets how this query is rewritten. FuzzyQuery always expands to
+      * a scoring BooleanQuery and ignores the rewrite method. */
+      void setRewriteMethod(RewriteMethod method);
+      /** Returns how this query is rewritten. */
+      RewriteMethod getRewriteMethod() const;
+
+      /** Sets the rewrite method given to new multi term queries, prefix
+      * queries and range queries. Defaults to SCORING_BOOLEAN_QUERY_REWRITE */
+      static void setDefaultRewriteMethod(RewriteMethod method);
+      /** Returns the rewrite method given to new queries */
+      static RewriteMethod getDefaultRewriteMethod();
+
+      /** Sets the number of matching terms after which
+      * CONSTANT_SCORE_AUTO_REWRITE switches to a filter. The number is
+      * capped by {@link BooleanQuery#getMaxClauseCount}.
+      * Defaults to DEFAULT_TERM_COUNT_CUTOFF. */
+      static void setAutoRewriteTermCountCutoff(int32_t count);
+      static int32_t getAutoRewriteTermCountCutoff();
+
+      /** Sets the percentage of maxDoc() which, once the document frequencies
+      * of the matching terms add up to it, makes CONSTANT_SCORE_AUTO_REWRITE
+      * switch to a filter. The cutoff is never lower than MIN_DOC_COUNT_CUTOFF.
+      * Defaults to 0.1 percent. */
+      static void setAutoRewriteDocCountPercent(float_t percent);
+      static float_t getAutoRewriteDocCountPercent();
     };
 CL_NS_END
 #endif
@@ -0,0 +1,204 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "CLucene/_ApiHeader.h"
+#include "_MultiTermRewrite.h"
+#include "BooleanQuery.h"
+#include "BooleanClause.h"
+#include "TermQuery.h"
+#include "ConstantScoreQuery.h"
+#include "PrefixQuery.h"
+#include "RangeQuery.h"
+#include "CLucene/index/Term.h"
+#include "CLucene/index/Terms.h"
+#include "CLucene/index/IndexReader.h"
+#include "CLucene/util/BitSet.h"
+#include "CLucene/util/StringBuffer.h"
+
+CL_NS_USE(index)
+CL_NS_USE(util)
+CL_NS_DEF(search)
+
+MultiTermRewrite::MultiTermRewrite(IndexReader* _reader, MultiTermQuery::RewriteMethod _method, float_t _boost):
+	reader(_reader),
+	method(_method),
+	boost(_boost),
+	query(NULL),
+	bits(NULL),
+	termDocs(NULL),
+	docCount(0)
+{
+	termCountCutoff = cl_min(MultiTermQuery::getAutoRewriteTermCountCutoff(),
+		(int32_t)cl_min(BooleanQuery::getMaxClauseCount(), (size_t)LUCENE_INT32_MAX_SHOULDBE));
+	docCountCutoff = cl_max((int64_t)(MultiTermQuery::getAutoRewriteDocCountPercent() / 100.0 * reader->maxDoc()),
+		(int64_t)MultiTermQuery::MIN_DOC_COUNT_CUTOFF);
+
+	if ( method == MultiTermQuery::SCORING_BOOLEAN_QUERY_REWRITE )
+		query = _CLNEW BooleanQuery(true);
+}
+
+MultiTermRewrite::MultiTermRewrite(IndexReader* _reader, BitSet* _bits):
+	reader(_reader),
+	method(MultiTermQuery::CONSTANT_SCORE_FILTER_REWRITE),
+	boost(1.0f),
+	query(NULL),
+	bits(_bits),
+	termDocs(_reader->termDocs()),
+	termCountCutoff(0),
+	docCountCutoff(0),
+	docCount(0)
+{
+}
+
+MultiTermRewrite::~MultiTermRewrite(){
+	for ( size_t i=0;i<pendingTerms.size();i++ ){
+		Term* t = pendingTerms[i];
+		_CLDECDELETE(t);
+	}
+	if ( termDocs != NULL ){
+		termDocs->close();
+		_CLDELETE(termDocs);
+	}
+	_CLDELETE(query);
+}
+
+void MultiTermRewrite::fill(TermDocs* termDocs, Term* t, BitSet* bits){
+	int32_t docs[32];
+	int32_t freqs[32];
+	termDocs->seek(t);
+	int32_t count;
+	while ( (count = termDocs->read(docs, freqs, 32)) > 0 ){
+		for ( int32_t i=0;i<count;i++ )
+			bits->set(docs[i]);
+	}
+}
+
+void MultiTermRewrite::addClause(Term* t, float_t termBoost){
+	TermQuery* tq = _CLNEW TermQuery(t);	// found a match
+	tq->setBoost(boost * termBoost);		// set the boost
+	query->add(tq, true, false, false);		// add to query
+}
+
+void MultiTermRewrite::switchToFilter(){
+	method = MultiTermQuery::CONSTANT_SCORE_FILTER_REWRITE;
+	for ( size_t i=0;i<pendingTerms.size();i++ ){
+		Term* t = pendingTerms[i];
+		_CLDECDELETE(t);
+	}
+	pendingTerms.clear();
+	pendingBoosts.clear();
+}
+
+bool MultiTermRewrite::collect(Term* t, int32_t docFreq, float_t termBoost){
+	switch ( method ){
+	case MultiTermQuery::CONSTANT_SCORE_FILTER_REWRITE:
+		//the filter does the expansion, unless this fills its bits
+		if ( bits == NULL )
+			return false;
+		fill(termDocs, t, bits);
+		return true;
+	case MultiTermQuery::SCORING_BOOLEAN_QUERY_REWRITE:
+		addClause(t, termBoost);
+		return true;
+	default:
+		pendingTerms.push_back(_CL_POINTER(t));
+		pendingBoosts.push_back(termBoost);
+		docCount += docFreq;
+		if ( (int32_t)pendingTerms.size() > termCountCutoff || docCount > docCountCutoff ){
+			switchToFilter();
+			return false;
+		}
+		return true;
+	}
+}
+
+Query* MultiTermRewrite::getQuery(const Query* source){
+	if ( method == MultiTermQuery::CONSTANT_SCORE_FILTER_REWRITE ){
+		Query* ret = _CLNEW ConstantScoreQuery(_CLNEW MultiTermFilter(source->clone()));
+		ret->setBoost(boost);
+		return ret;
+	}
+
+	if ( query == NULL ){
+		query = _CLNEW BooleanQuery(true);
+		for ( size_t i=0;i<pendingTerms.size();i++ )
+			addClause(pendingTerms[i], pendingBoosts[i]);
+	}
+	BooleanQuery* ret = query;
+	query = NULL;
+
+	//if we only added one clause and the clause is not prohibited then
+	//we can just return the query
+	if (ret->getClauseCount() == 1) {                    // optimize 1-clause queries
+		BooleanClause* c=0;
+		ret->getClauses(&c);
+
+		if (!c->prohibited) {			  // just return clause
+			c->deleteQuery=false;
+			Query* q = c->getQuery();
+
+			_CLDELETE(ret);
+			return q;
+		}
+	}
+	return ret;
+}
+
+
+MultiTermFilter::MultiTermFilter(Query* _source):
+	source(_source)
+{
+}
+MultiTermFilter::MultiTermFilter(const MultiTermFilter& copy):
+	source(copy.source->clone())
+{
+}
+MultiTermFilter::~MultiTermFilter(){
+	_CLDELETE(source);
+}
+
+Filter* MultiTermFilter::clone() const{
+	return _CLNEW MultiTermFilter(*this);
+}
+
+BitSet* MultiTermFilter::bits(IndexReader* reader){
+	BitSet* ret = _CLNEW BitSet(reader->maxDoc());
+	try{
+		MultiTermRewrite collector(reader, ret);
+		//only the queries that rewrite through a MultiTermRewrite create this filter
+		if ( source->instanceOf(PrefixQuery::getClassName()) )
+			((PrefixQuery*)source)->collectTerms(reader, &collector);
+		else if ( source->instanceOf(RangeQuery::getClassName()) )
+			((RangeQuery*)source)->collectTerms(reader, &collector);
+		else
+			((MultiTermQuery*)source)->collectTerms(reader, &collector);
+	}catch(CLuceneError& err){
+		_CLDELETE(ret);
+		throw err;
+	}
+	return ret;
+}
+
+TCHAR* MultiTermFilter::toString(){
+	return source->toString(NULL);
+}
+
+const char* MultiTermFilter::getObjectName() const{
+	return getClassName();
+}
+const char* MultiTermFilter::getClassName(){
+	return "MultiTermFilter";
+}
+bool MultiTermFilter::equals(Filter* other) const{
+	if ( !other->instanceOf(MultiTermFilter::getClassName()) )
+		return false;
+	return source->equals(((MultiTermFilter*)other)->source);
+}
+size_t MultiTermFilter::hashCode() const{
+	return source->hashCode() ^ 0x3C6EF372;
+}
+
+CL_NS_END
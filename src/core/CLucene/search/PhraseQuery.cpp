@@ -19,10 +19,13 @@
 #include "CLucene/index/Term.h"
 #include "CLucene/index/Terms.h"
 #include "CLucene/index/IndexReader.h"
+#include "CLucene/analysis/AnalysisHeader.h"
+#include "CLucene/analysis/Analyzers.h"
 
 #include "CLucene/util/StringBuffer.h"
 #include "CLucene/util/VoidList.h"
 #include "CLucene/util/_Arrays.h"
+#include "CLucene/util/Misc.h"
 
 #include "_ExactPhraseScorer.h"
 #include "_SloppyPhraseScorer.h"
@@ -62,7 +65,8 @@ CL_NS_DEF(search)
 
   PhraseQuery::PhraseQuery():
 	field(NULL), terms(_CLNEW CL_NS(util)::CLVector<CL_NS(index)::Term*>(false) ),
-		positions(_CLNEW CL_NS(util)::CLVector<int32_t,CL_NS(util)::Deletor::DummyInt32>), slop(0)
+		positions(_CLNEW CL_NS(util)::CLVector<int32_t,CL_NS(util)::Deletor::DummyInt32>), slop(0),
+		gramsField(NULL), commonWords(NULL)
   {
   }
 
@@ -73,6 +77,8 @@ CL_NS_DEF(search)
   {
       slop  = clone.slop;
 	  field = clone.field;
+	  gramsField = clone.gramsField == NULL ? NULL : STRDUP_TtoT(clone.gramsField);
+	  commonWords = clone.commonWords;
 	  int32_t size=clone.positions->size();
 	  { //msvc6 scope fix
 		  for ( int32_t i=0;i<size;i++ ){
@@ -116,6 +122,13 @@ CL_NS_DEF(search)
 			  const CL_NS(util)::CLVector<int32_t,CL_NS(util)::Deletor::DummyInt32> > comp;
 		  ret = comp.equals(this->positions,pq->positions);
 	  }
+
+	  if ( ret ){
+		  if ( this->gramsField == NULL || pq->gramsField == NULL )
+			  ret = this->gramsField == pq->gramsField;
+		  else
+			  ret = _tcscmp(this->gramsField, pq->gramsField) == 0;
+	  }
 	  return ret;
   }
 
@@ -131,6 +144,7 @@ CL_NS_DEF(search)
       }
 	  _CLLDELETE(terms);
 	  _CLLDELETE(positions);
+	  _CLDELETE_CARRAY(gramsField);
   }
 
   size_t PhraseQuery::hashCode() const {
@@ -145,6 +159,8 @@ CL_NS_DEF(search)
 			for ( size_t i=0;i<positions->size();i++ )
 				ret = 31 * ret + (*positions)[i];
 		}
+		if ( gramsField != NULL )
+			ret = 31 * ret + Misc::thashCode(gramsField);
 		return ret;
 	}
 
@@ -158,6 +174,87 @@ CL_NS_DEF(search)
     return getClassName();
   }
 
+  void PhraseQuery::setCommonGrams(const TCHAR* _gramsField, const TCHAR** _commonWords){
+	  _CLDELETE_CARRAY(gramsField);
+	  gramsField = _gramsField == NULL ? NULL : STRDUP_TtoT(_gramsField);
+	  commonWords = _commonWords;
+  }
+
+  const TCHAR* PhraseQuery::getCommonGramsField() const{
+	  return gramsField;
+  }
+
+  bool PhraseQuery::isCommonWord(const TCHAR* word) const{
+	  for ( int32_t i=0; commonWords[i]!=NULL; i++ ){
+		  if ( _tcscmp(commonWords[i], word) == 0 )
+			  return true;
+	  }
+	  return false;
+  }
+
+  Query* PhraseQuery::rewrite(IndexReader* reader){
+	  const size_t size = terms->size();
+	  if ( gramsField == NULL || commonWords == NULL || slop != 0 || size < 2 )
+		  return this;
+
+	  // CommonGramsFilter only pairs words at consecutive positions, so
+	  // every common word needs a neighbour at the position next to it
+	  bool* common = _CL_NEWARRAY(bool, size);
+	  bool anyCommon = false;
+	  bool rewritable = true;
+	  for ( size_t i=0; i<size && rewritable; i++ ){
+		  if ( i > 0 && (*positions)[i] <= (*positions)[i-1] )
+			  rewritable = false;
+		  common[i] = isCommonWord((*terms)[i]->text());
+		  anyCommon |= common[i];
+	  }
+	  for ( size_t i=0; i<size && rewritable && anyCommon; i++ ){
+		  if ( common[i] &&
+			  !(i > 0 && (*positions)[i-1] == (*positions)[i] - 1) &&
+			  !(i+1 < size && (*positions)[i+1] == (*positions)[i] + 1) )
+			  rewritable = false;
+	  }
+
+	  if ( rewritable && anyCommon ){
+		  // only use the shadow field if it was indexed
+		  Term probe(gramsField, LUCENE_BLANK_STRING);
+		  TermEnum* te = reader->terms(&probe);
+		  Term* first = te->term(false);
+		  rewritable = first != NULL && _tcscmp(first->field(), gramsField) == 0;
+		  te->close();
+		  _CLDELETE(te);
+	  }
+
+	  Query* ret = NULL;
+	  if ( rewritable && anyCommon ){
+		  PhraseQuery* phrase = _CLNEW PhraseQuery();
+		  for ( size_t i=0; i<size; i++ ){
+			  const int32_t position = (*positions)[i];
+			  if ( !common[i] ){
+				  Term* t = _CLNEW Term(gramsField, (*terms)[i]->text());
+				  phrase->add(t, position);
+				  _CLDECDELETE(t);
+			  }
+			  if ( i+1 < size && (*positions)[i+1] == position + 1 && (common[i] || common[i+1]) ){
+				  TCHAR* gram = CL_NS(analysis)::CommonGramsFilter::makeGram((*terms)[i]->text(), (*terms)[i+1]->text());
+				  Term* t = _CLNEW Term(gramsField, gram);
+				  phrase->add(t, position);
+				  _CLDECDELETE(t);
+				  _CLDELETE_CARRAY(gram);
+			  }
+		  }
+		  if ( phrase->terms->size() == 1 ){
+			  // a phrase of two common words is a single bigram
+			  ret = _CLNEW TermQuery((*phrase->terms)[0]);
+			  _CLDELETE(phrase);
+		  }else
+			  ret = phrase;
+		  ret->setBoost(getBoost());
+	  }
+	  _CLDELETE_ARRAY(common);
+	  return ret == NULL ? this : ret;
+  }
+
   void PhraseQuery::add(Term* term) {
 	  CND_PRECONDITION(term != NULL,"term is NULL");
 
@@ -266,6 +363,12 @@ CL_NS_DEF(search)
 
 	  buffer.appendBoost(getBoost());
 
+	  if ( gramsField != NULL ){
+		  buffer.append(_T(" (grams:"));
+		  buffer.append(gramsField);
+		  buffer.appendChar(_T(')'));
+	  }
+
 	  return buffer.giveBuffer();
   }
 
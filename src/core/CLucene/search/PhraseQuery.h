@@ -26,6 +26,11 @@ CL_NS_DEF(search)
 		CL_NS(util)::CLVector<int32_t,CL_NS(util)::Deletor::DummyInt32>* positions;
 		int32_t slop;
 
+		TCHAR* gramsField;
+		const TCHAR** commonWords;
+
+		bool isCommonWord(const TCHAR* word) const;
+
     	friend class PhraseWeight;
 	protected:
 		Weight* _createWeight(Searcher* searcher);
@@ -54,6 +59,29 @@ CL_NS_DEF(search)
 		/** Returns the slop.  See setSlop(). */
         int32_t getSlop() const;
 
+		/**
+		* Expert: lets rewrite() run this phrase against a shadow field that was
+		* indexed with a {@link CL_NS(analysis)::CommonGramsFilter} using the same
+		* common words. An exact phrase which contains a common word is then
+		* rewritten to a phrase of the rarer bigrams (and the words that are not
+		* common) in gramsField, or to a single bigram term, which matches the
+		* same documents but reads far fewer positions. If the index has no gramsField, or the phrase is
+		* sloppy, the phrase runs unchanged.
+		*
+		* <p>Every document with the phrase field must also have gramsField.
+		* The scores of a rewritten phrase come from the bigram statistics.</p>
+		*
+		* @param gramsField the shadow field, or NULL to disable the rewrite
+		* @param commonWords NULL terminated array of the common words. It is not
+		* copied and must stay valid as long as this query and its clones are used.
+		*/
+		void setCommonGrams(const TCHAR* gramsField, const TCHAR** commonWords);
+
+		/** Returns the shadow field set with setCommonGrams(), or NULL */
+		const TCHAR* getCommonGramsField() const;
+
+		Query* rewrite(CL_NS(index)::IndexReader* reader);
+
 		/**
 		* Adds a term to the end of the query phrase.
 		* The relative position of the term is the one immediately after the last term added.
@@ -13,6 +13,7 @@
 #include "BooleanClause.h"
 #include "BooleanQuery.h"
 #include "TermQuery.h"
+#include "_MultiTermRewrite.h"
 #include "CLucene/util/BitSet.h"
 #include "CLucene/util/StringBuffer.h"
 
@@ -28,10 +29,12 @@ CL_NS_DEF(search)
 
       //Get a pointer to Prefix
       prefix = _CL_POINTER(Prefix);
+      rewriteMethod = MultiTermQuery::getDefaultRewriteMethod();
   }
 
   PrefixQuery::PrefixQuery(const PrefixQuery& clone):Query(clone){
 	prefix = _CL_POINTER(clone.prefix);
+	rewriteMethod = clone.rewriteMethod;
   }
   Query* PrefixQuery::clone() const{
 	  return _CLNEW PrefixQuery(*this);
@@ -80,13 +83,13 @@ CL_NS_DEF(search)
 
         PrefixQuery* rq = (PrefixQuery*)other;
 		bool ret = (this->getBoost() == rq->getBoost())
+			&& (this->rewriteMethod == rq->rewriteMethod)
 			&& (this->prefix->equals(rq->prefix));
 
 		return ret;
   }
 
-   Query* PrefixQuery::rewrite(IndexReader* reader){
-    BooleanQuery* query = _CLNEW BooleanQuery( true );
+  void PrefixQuery::collectTerms(IndexReader* reader, MultiTermRewrite* collector){
     TermEnum* enumerator = reader->terms(prefix);
     Term* lastTerm = NULL;
     try {
@@ -118,9 +121,8 @@ CL_NS_DEF(search)
           if ( tmp == NULL )
               break;
 
-          TermQuery* tq = _CLNEW TermQuery(lastTerm);	  // found a match
-          tq->setBoost(getBoost());                // set the boost
-          query->add(tq,true,false, false);		  // add to query
+          if ( !collector->collect(lastTerm, enumerator->docFreq()) ) // found a match
+            break;
         } else
           break;
 		_CLDECDELETE(lastTerm);
@@ -130,25 +132,19 @@ CL_NS_DEF(search)
 	  _CLDELETE(enumerator);
 	  _CLDECDELETE(lastTerm);
 	);
-	_CLDECDELETE(lastTerm);
-
-
-	//if we only added one clause and the clause is not prohibited then
-	//we can just return the query
-	if (query->getClauseCount() == 1) {                    // optimize 1-clause queries
-		BooleanClause* c=0;
-		query->getClauses(&c);
-
-		if (!c->prohibited) {			  // just return clause
-			c->deleteQuery=false;
-			Query* ret = c->getQuery();
+  }
 
-			_CLDELETE(query);
-			return ret;
-        }
-	}
+  Query* PrefixQuery::rewrite(IndexReader* reader){
+    MultiTermRewrite collector(reader, rewriteMethod, getBoost());
+    collectTerms(reader, &collector);
+    return collector.getQuery(this);
+  }
 
-    return query;
+  void PrefixQuery::setRewriteMethod(MultiTermQuery::RewriteMethod method){
+	  rewriteMethod = method;
+  }
+  MultiTermQuery::RewriteMethod PrefixQuery::getRewriteMethod() const{
+	  return rewriteMethod;
   }
 
   Query* PrefixQuery::combine(CL_NS(util)::ArrayBase<Query*>* queries) {
@@ -284,6 +280,21 @@ Filter* PrefixFilter::clone() const {
 	return _CLNEW PrefixFilter(*this );
 }
 
+const char* PrefixFilter::getObjectName() const{
+	return getClassName();
+}
+const char* PrefixFilter::getClassName(){
+	return "PrefixFilter";
+}
+bool PrefixFilter::equals( Filter* other ) const{
+	if ( !other->instanceOf(PrefixFilter::getClassName()) )
+		return false;
+	return prefix->equals( ((PrefixFilter*)other)->prefix );
+}
+size_t PrefixFilter::hashCode() const{
+	return prefix->hashCode() ^ 0x6F8B4AC3;
+}
+
 TCHAR* PrefixFilter::toString()
 {
 	//Instantiate a stringbuffer buffer to store the readable version temporarily
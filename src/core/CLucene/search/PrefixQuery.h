@@ -15,6 +15,7 @@ CL_CLASS_DEF(index,Term)
 //#include "TermQuery.h"
 #include "Query.h"
 #include "Filter.h"
+#include "MultiTermQuery.h"
 CL_CLASS_DEF(util,StringBuffer)
 
 CL_NS_DEF(search) 
@@ -23,6 +24,10 @@ CL_NS_DEF(search)
 	class CLUCENE_EXPORT PrefixQuery: public Query {
 	private:
 		CL_NS(index)::Term* prefix;
+		MultiTermQuery::RewriteMethod rewriteMethod;
+
+		void collectTerms(CL_NS(index)::IndexReader* reader, MultiTermRewrite* collector);
+		friend class MultiTermFilter;
 	protected:
 		PrefixQuery(const PrefixQuery& clone);
 	public:
@@ -40,6 +45,10 @@ CL_NS_DEF(search)
 		/** Returns the prefix of this query. */
 		CL_NS(index)::Term* getPrefix(bool pointer=true);
 
+		/** Sets how this query is rewritten, see MultiTermQuery::RewriteMethod */
+		void setRewriteMethod(MultiTermQuery::RewriteMethod method);
+		MultiTermQuery::RewriteMethod getRewriteMethod() const;
+
     Query* combine(CL_NS(util)::ArrayBase<Query*>* queries);
 		Query* rewrite(CL_NS(index)::IndexReader* reader);
 		Query* clone() const;
@@ -75,6 +84,11 @@ CL_NS_DEF(search)
 
 		// Returns a reference of internal prefix
 		CL_NS(index)::Term* getPrefix() const;
+
+		const char* getObjectName() const;
+		static const char* getClassName();
+		bool equals(Filter* other) const;
+		size_t hashCode() const;
     };
 CL_NS_END
 #endif
@@ -59,6 +59,21 @@ Filter* QueryFilter::clone() const {
 	return _CLNEW QueryFilter(*this );
 }
 
+const char* QueryFilter::getObjectName() const{
+	return getClassName();
+}
+const char* QueryFilter::getClassName(){
+	return "QueryFilter";
+}
+bool QueryFilter::equals( Filter* other ) const{
+	if ( !other->instanceOf(QueryFilter::getClassName()) )
+		return false;
+	return query->equals( ((QueryFilter*)other)->query );
+}
+size_t QueryFilter::hashCode() const{
+	return query->hashCode() ^ 0x923F64B9;
+}
+
 
 TCHAR* QueryFilter::toString()
 {
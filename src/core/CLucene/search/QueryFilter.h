@@ -34,6 +34,11 @@ public:
 	Filter *clone() const;
 	
 	TCHAR *toString();
+
+	const char* getObjectName() const;
+	static const char* getClassName();
+	bool equals(Filter* other) const;
+	size_t hashCode() const;
 };
 
 CL_NS_END
@@ -0,0 +1,375 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "CLucene/_ApiHeader.h"
+#include "QueryResultCache.h"
+#include "SearchHeader.h"
+#include "Query.h"
+#include "Filter.h"
+#include "Sort.h"
+#include "CLucene/index/IndexReader.h"
+
+#include <map>
+
+CL_NS_USE(index)
+CL_NS_USE(util)
+CL_NS_DEF(search)
+
+// Rough per-entry cost of the cloned query, on top of its string length
+#define QUERY_RESULT_CACHE_QUERY_OVERHEAD 64
+// Rough cost of a copied filter or sort
+#define QUERY_RESULT_CACHE_KEY_OVERHEAD 64
+
+/** The state of a reader that cached results are valid for */
+struct QueryResultCacheReaderState {
+	int64_t version;
+	int32_t maxDoc;
+	int32_t numDocs;
+
+	bool equals(const QueryResultCacheReaderState& other) const{
+		return version == other.version && maxDoc == other.maxDoc && numDocs == other.numDocs;
+	}
+};
+
+/** One cached search, also a node of the LRU list */
+struct QueryResultCacheEntry {
+	size_t hash;
+	Query* query;
+	Filter* filter;
+	Sort* sort;
+	QueryResultCacheReaderState state;
+
+	int32_t nDocs;            ///< number of hits that were requested
+	int32_t totalHits;
+	ScoreDoc* scoreDocs;
+	int32_t scoreDocsLength;
+	size_t bytes;
+
+	QueryResultCacheEntry* prev; ///< more recently used
+	QueryResultCacheEntry* next; ///< less recently used
+
+	QueryResultCacheEntry():
+		query(NULL),
+		filter(NULL),
+		sort(NULL),
+		scoreDocs(NULL),
+		prev(NULL),
+		next(NULL)
+	{
+	}
+	~QueryResultCacheEntry(){
+		_CLLDELETE(query);
+		_CLLDELETE(filter);
+		_CLLDELETE(sort);
+		delete[] scoreDocs;
+	}
+};
+
+static bool queryResultCacheFilterEquals(Filter* cached, Filter* filter){
+	if ( cached == NULL || filter == NULL )
+		return cached == filter;
+	return cached->equals(filter);
+}
+static bool queryResultCacheSortEquals(const Sort* cached, const Sort* sort){
+	if ( cached == NULL || sort == NULL )
+		return cached == sort;
+	return cached->equals(sort);
+}
+
+class QueryResultCache::Internal{
+public:
+	typedef std::multimap<size_t, QueryResultCacheEntry*> EntriesType;
+
+	EntriesType entries;
+	QueryResultCacheEntry* head; ///< most recently used
+	QueryResultCacheEntry* tail; ///< least recently used
+	size_t maxBytes;
+	int32_t maxDocsPerEntry;
+	size_t bytes;
+	int64_t hitCount;
+	int64_t missCount;
+	int64_t evictionCount;
+	DEFINE_MUTEX(THIS_LOCK)
+
+	Internal(size_t maxBytes, int32_t maxDocsPerEntry):
+		head(NULL),
+		tail(NULL),
+		maxBytes(maxBytes),
+		maxDocsPerEntry(maxDocsPerEntry),
+		bytes(0),
+		hitCount(0),
+		missCount(0),
+		evictionCount(0)
+	{
+	}
+	~Internal(){
+		clear();
+	}
+
+	/** Reads the state of reader, returns false if the reader can't tell
+	* its version, in which case its results are not cached */
+	static bool getState(IndexReader* reader, QueryResultCacheReaderState& state){
+		try{
+			state.version = reader->getVersion();
+		}catch(CLuceneError& err){
+			if ( err.number() != CL_ERR_UnsupportedOperation )
+				throw err;
+			return false;
+		}
+		state.maxDoc = reader->maxDoc();
+		state.numDocs = reader->numDocs();
+		return true;
+	}
+
+	static size_t hashCode(Query* query, Filter* filter, const Sort* sort, const QueryResultCacheReaderState& state){
+		size_t hash = query->hashCode();
+		if ( filter != NULL )
+			hash = 31 * hash + filter->hashCode();
+		if ( sort != NULL )
+			hash = 31 * hash + sort->hashCode();
+		return hash ^ (size_t)state.version;
+	}
+
+	/** Copies filter to key an entry with. Returns false if the results
+	* of filter can't be cached, because it does not equal its clone. */
+	static bool copyFilter(Filter* filter, Filter*& copy){
+		copy = NULL;
+		if ( filter == NULL )
+			return true;
+		copy = filter->clone();
+		if ( copy->equals(filter) )
+			return true;
+		_CLDELETE(copy);
+		return false;
+	}
+
+	/** Copies sort to key an entry with. Returns false for sorts with a
+	* custom comparator, which is only known by its address. */
+	static bool copySort(const Sort* sort, Sort*& copy){
+		copy = NULL;
+		if ( sort == NULL )
+			return true;
+		SortField** fields = sort->getSort();
+		int32_t n = 0;
+		for ( ; fields[n] != NULL; n++ ){
+			if ( fields[n]->getType() == SortField::CUSTOM )
+				return false;
+		}
+		SortField** copied = _CL_NEWARRAY(SortField*, n + 1);
+		for ( int32_t i = 0; i < n; i++ )
+			copied[i] = fields[i]->clone();
+		copied[n] = NULL;
+		copy = _CLNEW Sort(copied);
+		_CLDELETE_ARRAY(copied);
+		return true;
+	}
+
+	QueryResultCacheEntry* find(size_t hash, Query* query, Filter* filter, const Sort* sort,
+		const QueryResultCacheReaderState& state)
+	{
+		std::pair<EntriesType::iterator, EntriesType::iterator> range = entries.equal_range(hash);
+		for ( EntriesType::iterator itr = range.first; itr != range.second; ++itr ){
+			QueryResultCacheEntry* entry = itr->second;
+			if ( entry->state.equals(state) &&
+				queryResultCacheFilterEquals(entry->filter, filter) &&
+				queryResultCacheSortEquals(entry->sort, sort) &&
+				entry->query->equals(query) )
+				return entry;
+		}
+		return NULL;
+	}
+
+	void unlink(QueryResultCacheEntry* entry){
+		if ( entry->prev != NULL )
+			entry->prev->next = entry->next;
+		else
+			head = entry->next;
+		if ( entry->next != NULL )
+			entry->next->prev = entry->prev;
+		else
+			tail = entry->prev;
+		entry->prev = entry->next = NULL;
+	}
+
+	void linkFirst(QueryResultCacheEntry* entry){
+		entry->prev = NULL;
+		entry->next = head;
+		if ( head != NULL )
+			head->prev = entry;
+		head = entry;
+		if ( tail == NULL )
+			tail = entry;
+	}
+
+	void remove(QueryResultCacheEntry* entry){
+		std::pair<EntriesType::iterator, EntriesType::iterator> range = entries.equal_range(entry->hash);
+		for ( EntriesType::iterator itr = range.first; itr != range.second; ++itr ){
+			if ( itr->second == entry ){
+				entries.erase(itr);
+				break;
+			}
+		}
+		unlink(entry);
+		bytes -= entry->bytes;
+		_CLDELETE(entry);
+	}
+
+	void clear(){
+		while ( head != NULL )
+			remove(head);
+	}
+};
+
+
+QueryResultCache::QueryResultCache(size_t maxBytes, int32_t maxDocsPerEntry):
+	_internal(_CLNEW Internal(maxBytes, maxDocsPerEntry))
+{
+}
+
+QueryResultCache::~QueryResultCache(){
+	_CLDELETE(_internal);
+}
+
+TopDocs* QueryResultCache::get(IndexReader* reader, Query* query, Filter* filter, const Sort* sort, int32_t nDocs){
+	QueryResultCacheReaderState state;
+	if ( nDocs > _internal->maxDocsPerEntry || !Internal::getState(reader, state) )
+		return NULL;
+
+	const size_t hash = Internal::hashCode(query, filter, sort, state);
+
+	TopDocs* ret = NULL;
+	{
+		SCOPED_LOCK_MUTEX(_internal->THIS_LOCK)
+		QueryResultCacheEntry* entry = _internal->find(hash, query, filter, sort, state);
+
+		// an entry answers smaller requests, and any request if it holds all hits
+		if ( entry != NULL && (nDocs <= entry->nDocs || entry->scoreDocsLength >= entry->totalHits) ){
+			_internal->hitCount++;
+			_internal->unlink(entry);
+			_internal->linkFirst(entry);
+
+			const int32_t len = cl_min(nDocs, entry->scoreDocsLength);
+			ScoreDoc* scoreDocs = new ScoreDoc[len];
+			memcpy(scoreDocs, entry->scoreDocs, len * sizeof(ScoreDoc));
+			ret = _CLNEW TopDocs(entry->totalHits, scoreDocs, len);
+		}else
+			_internal->missCount++;
+	}
+	return ret;
+}
+
+void QueryResultCache::put(IndexReader* reader, Query* query, Filter* filter, const Sort* sort,
+	int32_t nDocs, const TopDocs* topDocs)
+{
+	QueryResultCacheReaderState state;
+	if ( nDocs > _internal->maxDocsPerEntry || topDocs->scoreDocsLength > nDocs ||
+		!Internal::getState(reader, state) )
+		return;
+
+	Filter* filterKey;
+	if ( !Internal::copyFilter(filter, filterKey) )
+		return;
+	Sort* sortKey;
+	if ( !Internal::copySort(sort, sortKey) ){
+		_CLDELETE(filterKey);
+		return;
+	}
+
+	QueryResultCacheEntry* entry = _CLNEW QueryResultCacheEntry();
+	entry->filter = filterKey;
+	entry->sort = sortKey;
+	entry->state = state;
+	entry->hash = Internal::hashCode(query, filter, sort, state);
+	entry->nDocs = nDocs;
+	entry->totalHits = topDocs->totalHits;
+	entry->scoreDocsLength = topDocs->scoreDocsLength;
+	entry->scoreDocs = new ScoreDoc[entry->scoreDocsLength];
+	memcpy(entry->scoreDocs, topDocs->scoreDocs, entry->scoreDocsLength * sizeof(ScoreDoc));
+
+	TCHAR* queryString = query->toString();
+	entry->bytes = sizeof(QueryResultCacheEntry) + entry->scoreDocsLength * sizeof(ScoreDoc) +
+		_tcslen(queryString) * sizeof(TCHAR) + QUERY_RESULT_CACHE_QUERY_OVERHEAD;
+	_CLDELETE_CARRAY(queryString);
+	if ( entry->filter != NULL )
+		entry->bytes += QUERY_RESULT_CACHE_KEY_OVERHEAD;
+	if ( entry->sort != NULL )
+		entry->bytes += QUERY_RESULT_CACHE_KEY_OVERHEAD;
+
+	if ( entry->bytes > _internal->maxBytes ){
+		_CLDELETE(entry);
+		return;
+	}
+
+	SCOPED_LOCK_MUTEX(_internal->THIS_LOCK)
+	QueryResultCacheEntry* existing = _internal->find(entry->hash, query, filter, sort, state);
+	if ( existing != NULL ){
+		if ( existing->nDocs >= nDocs ){
+			_CLDELETE(entry);
+			return;
+		}
+		_internal->remove(existing);
+	}
+
+	entry->query = query->clone();
+	_internal->entries.insert(Internal::EntriesType::value_type(entry->hash, entry));
+	_internal->linkFirst(entry);
+	_internal->bytes += entry->bytes;
+
+	while ( _internal->bytes > _internal->maxBytes ){
+		_internal->remove(_internal->tail);
+		_internal->evictionCount++;
+	}
+}
+
+void QueryResultCache::purge(IndexReader* reader){
+	QueryResultCacheReaderState state;
+	const bool known = Internal::getState(reader, state);
+
+	SCOPED_LOCK_MUTEX(_internal->THIS_LOCK)
+	QueryResultCacheEntry* entry = _internal->head;
+	while ( entry != NULL ){
+		QueryResultCacheEntry* next = entry->next;
+		if ( !known || !entry->state.equals(state) )
+			_internal->remove(entry);
+		entry = next;
+	}
+}
+
+void QueryResultCache::clear(){
+	SCOPED_LOCK_MUTEX(_internal->THIS_LOCK)
+	_internal->clear();
+}
+
+int64_t QueryResultCache::getHitCount() const{
+	SCOPED_LOCK_MUTEX(_internal->THIS_LOCK)
+	return _internal->hitCount;
+}
+
+int64_t QueryResultCache::getMissCount() const{
+	SCOPED_LOCK_MUTEX(_internal->THIS_LOCK)
+	return _internal->missCount;
+}
+
+int64_t QueryResultCache::getEvictionCount() const{
+	SCOPED_LOCK_MUTEX(_internal->THIS_LOCK)
+	return _internal->evictionCount;
+}
+
+size_t QueryResultCache::size() const{
+	SCOPED_LOCK_MUTEX(_internal->THIS_LOCK)
+	return _internal->entries.size();
+}
+
+size_t QueryResultCache::getSizeInBytes() const{
+	SCOPED_LOCK_MUTEX(_internal->THIS_LOCK)
+	return _internal->bytes;
+}
+
+size_t QueryResultCache::getMaxBytes() const{
+	return _internal->maxBytes;
+}
+
+CL_NS_END
@@ -0,0 +1,98 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_search_QueryResultCache_
+#define _lucene_search_QueryResultCache_
+
+CL_CLASS_DEF(index,IndexReader)
+CL_CLASS_DEF(search,Query)
+CL_CLASS_DEF(search,Filter)
+CL_CLASS_DEF(search,Sort)
+CL_CLASS_DEF(search,TopDocs)
+
+CL_NS_DEF(search)
+
+/**
+* A bounded cache of top hits, which an {@link IndexSearcher} consults before
+* running a query. See IndexSearcher::setQueryResultCache.
+*
+* <p>Entries are keyed on the query (using Query::hashCode and Query::equals),
+* the filter (using Filter::hashCode and Filter::equals), the sort (using
+* Sort::hashCode and Sort::equals), and the version, maxDoc and numDocs of the
+* IndexReader. Searches are not cached if their filter does not equal its own
+* clone, which is the default for filters, or if they are sorted with a
+* SortComparatorSource. A reopened reader that has changed
+* therefore never sees stale results, while a searcher on an unchanged reader
+* keeps using the cached entries. An entry of the top N hits also answers
+* requests for fewer hits, so the growing requests made by {@link Hits} are
+* served from a single entry.</p>
+*
+* <p>Only the document numbers and scores are stored. Entries are evicted in
+* least recently used order once the estimated memory use exceeds the
+* budget. The cache may be shared by several searchers on the same index
+* (for example by the old and new searcher around a reopen) and is thread
+* safe. The searchers must use the same Similarity.</p>
+*/
+class CLUCENE_EXPORT QueryResultCache:LUCENE_BASE {
+	class Internal;
+	Internal* _internal;
+public:
+	/** Default memory budget: 16MB */
+	LUCENE_STATIC_CONSTANT(size_t, DEFAULT_MAX_BYTES=16*1024*1024);
+
+	/** Requests for more hits than this are not cached by default */
+	LUCENE_STATIC_CONSTANT(int32_t, DEFAULT_MAX_DOCS_PER_ENTRY=1000);
+
+	/**
+	* @param maxBytes the memory budget of the cache, in bytes
+	* @param maxDocsPerEntry requests for more hits than this are not cached
+	*/
+	QueryResultCache(size_t maxBytes=DEFAULT_MAX_BYTES, int32_t maxDocsPerEntry=DEFAULT_MAX_DOCS_PER_ENTRY);
+	virtual ~QueryResultCache();
+
+	/** Expert: looks up the top nDocs hits of a search.
+	* @return a new TopDocs holding at most nDocs hits, or NULL if the search
+	* is not cached. The caller owns the returned object. For sorted searches
+	* only the scoreDocs are filled in.
+	*/
+	TopDocs* get(CL_NS(index)::IndexReader* reader, Query* query, Filter* filter,
+		const Sort* sort, int32_t nDocs);
+
+	/** Expert: stores the top nDocs hits of a search. Only the scoreDocs of
+	* topDocs are copied, the caller keeps ownership of all arguments. */
+	void put(CL_NS(index)::IndexReader* reader, Query* query, Filter* filter,
+		const Sort* sort, int32_t nDocs, const TopDocs* topDocs);
+
+	/** Removes all entries that were not created for the current state of
+	* reader. Call this after a reopen, once the old reader is no longer
+	* searched, to free the memory of its entries straight away instead of
+	* waiting for them to be evicted. */
+	void purge(CL_NS(index)::IndexReader* reader);
+
+	/** Removes all entries */
+	void clear();
+
+	/** Number of lookups that were answered from the cache */
+	int64_t getHitCount() const;
+
+	/** Number of lookups that were not answered from the cache */
+	int64_t getMissCount() const;
+
+	/** Number of entries removed to stay within the memory budget */
+	int64_t getEvictionCount() const;
+
+	/** Number of entries currently cached */
+	size_t size() const;
+
+	/** Estimated memory used by the cached entries, in bytes */
+	size_t getSizeInBytes() const;
+
+	/** The memory budget, in bytes */
+	size_t getMaxBytes() const;
+};
+
+CL_NS_END
+#endif
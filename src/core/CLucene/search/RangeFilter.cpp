@@ -9,6 +9,7 @@
 #include "CLucene/index/Terms.h"
 #include "CLucene/index/IndexReader.h"
 #include "CLucene/util/BitSet.h"
+#include "CLucene/util/Misc.h"
 #include "RangeFilter.h"
 
 CL_NS_DEF(search)
@@ -55,6 +56,38 @@ RangeFilter::~RangeFilter()
 	_CLDELETE_LCARRAY( upperTerm );
 }
 
+const char* RangeFilter::getObjectName() const{
+	return getClassName();
+}
+const char* RangeFilter::getClassName(){
+	return "RangeFilter";
+}
+
+static bool RangeFilter_termEquals( const TCHAR* a, const TCHAR* b ){
+	if ( a == NULL || b == NULL )
+		return a == b;
+	return _tcscmp( a, b ) == 0;
+}
+
+bool RangeFilter::equals( Filter* other ) const{
+	if ( !other->instanceOf(RangeFilter::getClassName()) )
+		return false;
+	RangeFilter* rf = (RangeFilter*)other;
+	return includeLower == rf->includeLower && includeUpper == rf->includeUpper
+		&& _tcscmp( fieldName, rf->fieldName ) == 0
+		&& RangeFilter_termEquals( lowerTerm, rf->lowerTerm )
+		&& RangeFilter_termEquals( upperTerm, rf->upperTerm );
+}
+
+size_t RangeFilter::hashCode() const{
+	size_t h = Misc::thashCode( fieldName );
+	h ^= lowerTerm != NULL ? Misc::thashCode( lowerTerm ) : 0x965A965A;
+	h = (h << 1) | (h >> 31);
+	h ^= upperTerm != NULL ? Misc::thashCode( upperTerm ) : 0x5A695A69;
+	h ^= (includeLower ? 0x665599AA : 0) ^ (includeUpper ? 0x99AA5566 : 0);
+	return h;
+}
+
 RangeFilter* RangeFilter::Less( const TCHAR* _fieldName, const TCHAR* _upperTerm ) {
 	return _CLNEW RangeFilter( _fieldName, NULL, _upperTerm, false, true );
 }
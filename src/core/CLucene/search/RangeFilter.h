@@ -67,6 +67,11 @@ public:
 	
 	TCHAR* toString();
 
+	const char* getObjectName() const;
+	static const char* getClassName();
+	bool equals(Filter* other) const;
+	size_t hashCode() const;
+
 protected:
 	RangeFilter( const RangeFilter& copy );
 };
@@ -12,6 +12,7 @@
 #include "BooleanQuery.h"
 #include "TermQuery.h"
 #include "Similarity.h"
+#include "_MultiTermRewrite.h"
 
 #include "CLucene/index/Term.h"
 #include "CLucene/index/Terms.h"
@@ -47,10 +48,12 @@ CL_NS_DEF(search)
         }
         this->upperTerm = (upperTerm != NULL ? _CL_POINTER(upperTerm) : NULL);
         this->inclusive = Inclusive;
+        this->rewriteMethod = MultiTermQuery::getDefaultRewriteMethod();
     }
 	RangeQuery::RangeQuery(const RangeQuery& clone):
 		Query(clone){
 		this->inclusive = clone.inclusive;
+		this->rewriteMethod = clone.rewriteMethod;
 		this->upperTerm = (clone.upperTerm != NULL ? _CL_POINTER(clone.upperTerm) : NULL );
 		this->lowerTerm = (clone.lowerTerm != NULL ? _CL_POINTER(clone.lowerTerm) : NULL );
 	}
@@ -93,6 +96,7 @@ CL_NS_DEF(search)
         RangeQuery* rq = (RangeQuery*)other;
 		bool ret = (this->getBoost() == rq->getBoost())
 			&& (this->isInclusive() == rq->isInclusive())
+			&& (this->rewriteMethod == rq->rewriteMethod)
 			&& (this->getLowerTerm()->equals(rq->getLowerTerm()))
 			&& (this->getUpperTerm()->equals(rq->getUpperTerm()));
 
@@ -100,9 +104,7 @@ CL_NS_DEF(search)
 	}
 
 
-    Query* RangeQuery::rewrite(IndexReader* reader){
-
-        BooleanQuery* query = _CLNEW BooleanQuery( true );
+    void RangeQuery::collectTerms(IndexReader* reader, MultiTermRewrite* collector){
         TermEnum* enumerator = reader->terms(lowerTerm);
 		Term* lastTerm = NULL;
         try {
@@ -123,9 +125,8 @@ CL_NS_DEF(search)
                             if ((compare < 0) || (!inclusive && compare == 0))
                                 break;
                         }
-                        TermQuery* tq = _CLNEW TermQuery(lastTerm); // found a match
-                        tq->setBoost(getBoost()); // set the boost
-                        query->add(tq, true, false, false); // add to query
+                        if ( !collector->collect(lastTerm, enumerator->docFreq()) ) // found a match
+                            break;
                     }
                 }else {
                     break;
@@ -133,18 +134,24 @@ CL_NS_DEF(search)
 				_CLDECDELETE(lastTerm);
             }
             while (enumerator->next());
-		}catch(...){
+		}_CLFINALLY(
 			_CLDECDELETE(lastTerm); //always need to delete this
-			_CLDELETE(query); //in case of error, delete the query
             enumerator->close();
 			_CLDELETE(enumerator);
-			throw; //rethrow
-		}
-		_CLDECDELETE(lastTerm); //always need to delete this
-		enumerator->close();
-		_CLDELETE(enumerator);
+		);
+    }
 
-        return query;
+    Query* RangeQuery::rewrite(IndexReader* reader){
+        MultiTermRewrite collector(reader, rewriteMethod, getBoost());
+        collectTerms(reader, &collector);
+        return collector.getQuery(this);
+    }
+
+    void RangeQuery::setRewriteMethod(MultiTermQuery::RewriteMethod method){
+        rewriteMethod = method;
+    }
+    MultiTermQuery::RewriteMethod RangeQuery::getRewriteMethod() const{
+        return rewriteMethod;
     }
 
     TCHAR* RangeQuery::toString(const TCHAR* field) const
@@ -11,6 +11,7 @@
 //#include "Scorer.h"
 //#include "TermQuery.h"
 #include "Query.h"
+#include "MultiTermQuery.h"
 
 CL_CLASS_DEF(index,Term)
 //#include "CLucene/index/Terms.h"
@@ -43,6 +44,10 @@ private:
   CL_NS(index)::Term* lowerTerm;
   CL_NS(index)::Term* upperTerm;
   bool inclusive;
+  MultiTermQuery::RewriteMethod rewriteMethod;
+
+  void collectTerms(CL_NS(index)::IndexReader* reader, MultiTermRewrite* collector);
+  friend class MultiTermFilter;
 protected:
   RangeQuery(const RangeQuery& clone);
 
@@ -85,6 +90,10 @@ public:
   /** Returns <code>true</code> if the range query is inclusive */
   const TCHAR* getField() const;
 
+  /** Sets how this query is rewritten, see MultiTermQuery::RewriteMethod */
+  void setRewriteMethod(MultiTermQuery::RewriteMethod method);
+  MultiTermQuery::RewriteMethod getRewriteMethod() const;
+
   size_t hashCode() const;
 };
 
@@ -21,9 +21,14 @@ Similarity* Scorer::getSimilarity()  const{
 }
 
 void Scorer::score(HitCollector* hc) {
-	while (next()) {
-		hc->collect(doc(), score());
-	}
+	int32_t docs[BATCH_SIZE];
+	float_t scores[BATCH_SIZE];
+	int32_t n;
+	do {
+		n = nextBatch(docs, scores, BATCH_SIZE);
+		if ( n > 0 )
+			hc->collectBatch(docs, scores, n);
+	} while ( n == BATCH_SIZE );
 }
 
 bool Scorer::score( HitCollector* results, const int32_t maxDoc ) {
@@ -34,6 +39,20 @@ bool Scorer::score( HitCollector* results, const int32_t maxDoc ) {
 	}
 	return true;
 }
+int32_t Scorer::nextBatch(int32_t* docs, float_t* scores, const int32_t length) {
+	int32_t n = 0;
+	while ( n < length && next() ) {
+		docs[n] = doc();
+		scores[n] = score();
+		n++;
+	}
+	return n;
+}
+
+int32_t Scorer::cost() const {
+	return LUCENE_INT32_MAX_SHOULDBE;
+}
+
 bool Scorer::sort(const Scorer* elem1, const Scorer* elem2){
 	return elem1->doc() < elem2->doc();
 }
@@ -30,6 +30,10 @@ CL_NS_DEF(search)
 class CLUCENE_EXPORT Scorer {
 private:
 	Similarity* similarity;
+public:
+	/** The number of documents that are scored and collected at once by
+	* {@link #score(HitCollector*)} */
+	LUCENE_STATIC_CONSTANT(int32_t, BATCH_SIZE=32);
 protected:
 	/** Constructs a Scorer.
 	* @param similarity The <code>Similarity</code> implementation used by this scorer.
@@ -59,6 +63,21 @@ public:
 	*/
 	virtual bool score( HitCollector* results, const int32_t maxDoc );
 
+	/** Expert: Advances over up to length matching documents at once, as if
+	* {@link #next()} was called up to length times, and stores their numbers
+	* and scores. Afterwards {@link #doc()} is the last document that was
+	* stored. Scorers that can compute the scores of a block of documents in
+	* one pass override this, the default implementation calls next() and
+	* score() for every document.
+	* @param docs receives the document numbers, in increasing order
+	* @param scores receives the score of each document
+	* @param length the size of the arrays
+	* @return the number of documents stored. Fewer than length means that
+	* there are no more matches, and nextBatch must not be called again.
+	* Otherwise doc() returns the last document stored.
+	*/
+	virtual int32_t nextBatch(int32_t* docs, float_t* scores, const int32_t length);
+
 	/**
 	* Advances to the document matching this Scorer with the lowest doc Id
 	* greater than the current value of {@link #doc()} (or to the matching
@@ -128,6 +147,14 @@ public:
 	/** Returns a string which explains the object */
 	virtual TCHAR* toString() = 0;
 
+	/** Expert: Returns an estimate of the number of documents this Scorer
+	* matches, for example the document frequency of a term. Conjunctions use
+	* it to drive iteration from their cheapest clause. The estimate does not
+	* change while iterating. The default implementation returns
+	* LUCENE_INT32_MAX_SHOULDBE, meaning unknown.
+	*/
+	virtual int32_t cost() const;
+
 	static bool sort(const Scorer* elem1, const Scorer* elem2);
 };
 CL_NS_END
@@ -10,6 +10,7 @@
 #include "Similarity.h"
 #include "BooleanQuery.h"
 #include "Searchable.h"
+#include "Filter.h"
 #include "Hits.h"
 #include "_FieldDocSortedHitQueue.h"
 #include <assert.h>
@@ -17,6 +18,11 @@
 CL_NS_USE(index)
 CL_NS_DEF(search)
 
+void HitCollector::collectBatch(const int32_t* docs, const float_t* scores, const int32_t length){
+	for ( int32_t i=0;i<length;i++ )
+		collect(docs[i], scores[i]);
+}
+
 CL_NS(document)::Document* Searchable::doc(const int32_t i){
     CL_NS(document)::Document* ret = _CLNEW CL_NS(document)::Document;
     if (!doc(i,ret) )
@@ -63,6 +69,20 @@ Query::~Query(){
 }
 
 const char* Query::getQueryName() const{ return getObjectName(); }
+
+bool Filter::equals(Filter* other) const{
+	return this == other;
+}
+size_t Filter::hashCode() const{
+	return (size_t)this;
+}
+const char* Filter::getObjectName() const{
+	return NULL;
+}
+bool Filter::instanceOf(const char* other) const{
+	const char* t = getObjectName();
+	return t != NULL && (t == other || strcmp(t, other) == 0);
+}
 /** Expert: called to re-write queries into primitive queries. */
 Query* Query::rewrite(CL_NS(index)::IndexReader* /*reader*/){
    return this;
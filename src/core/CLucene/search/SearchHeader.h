@@ -95,6 +95,13 @@ CL_NS_DEF(search)
       * between 0 and 1.
       */
       virtual void collect(const int32_t doc, const float_t score) = 0;
+
+      /** Expert: Called with a block of non-zero scoring documents, in increasing
+      * order of document number, by scorers that score several documents at once.
+      * The default implementation calls {@link #collect(int32_t, float_t)} for
+      * each of them; collectors can override this to avoid a virtual call per hit.
+      */
+      virtual void collectBatch(const int32_t* docs, const float_t* scores, const int32_t length);
       virtual ~HitCollector(){}
     };
 
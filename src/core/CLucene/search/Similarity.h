@@ -91,6 +91,12 @@ public:
    * @see #encodeNorm(float_t)
    */
    static float_t decodeNorm(uint8_t b);
+
+   /** Returns the table of the 256 decoded normalization factors, indexed
+   * by the encoded byte. Useful for decoding many norms in a loop.
+   * @see #decodeNorm(uint8_t)
+   */
+   static const float_t* getNormDecoder();
    
    static uint8_t floatToByte(float_t f);
    static float_t byteToFloat(uint8_t b);
@@ -10,6 +10,7 @@
 #include "SearchHeader.h"
 #include "CLucene/util/_StringIntern.h"
 #include "CLucene/util/StringBuffer.h"
+#include "CLucene/util/Misc.h"
 
 CL_NS_USE(util)
 CL_NS_DEF(search)
@@ -139,6 +140,18 @@ CL_NS_DEF(search)
   SortField::~SortField(){
 	  CLStringIntern::unintern(field);
   }
+
+  bool SortField::equals(const SortField* other) const{
+	  // fields are interned
+	  return field == other->field && type == other->type
+		  && reverse == other->reverse && factory == other->factory;
+  }
+  size_t SortField::hashCode() const{
+	  size_t h = (field != NULL ? Misc::thashCode(field) : 0) ^ (type * 0x9E3779B9) ^ (reverse ? 0x2F6A2F6A : 0);
+	  if ( factory != NULL )
+		  h ^= factory->hashCode();
+	  return h;
+  }
   
   TCHAR* SortField::toString() const {
 	CL_NS(util)::StringBuffer buffer;
@@ -271,6 +284,21 @@ CL_NS_DEF(search)
             this->fields[i]=fields[i];
 	}
 
+	bool Sort::equals(const Sort* other) const{
+		int32_t i = 0;
+		for ( ; fields[i] != NULL && other->fields[i] != NULL; i++ ){
+			if ( !fields[i]->equals(other->fields[i]) )
+				return false;
+		}
+		return fields[i] == NULL && other->fields[i] == NULL;
+	}
+	size_t Sort::hashCode() const{
+		size_t h = 0;
+		for ( int32_t i = 0; fields[i] != NULL; i++ )
+			h = 31 * h + fields[i]->hashCode();
+		return h;
+	}
+
 	TCHAR* Sort::toString() const {
 		CL_NS(util)::StringBuffer buffer;
 
@@ -275,6 +275,11 @@ public:
   SortComparatorSource* getFactory() const;
 
   TCHAR* toString() const;
+
+  /** Returns true if other sorts by the same field, type and direction,
+  * with the same SortComparatorSource object */
+  bool equals(const SortField* other) const;
+  size_t hashCode() const;
 };
 
 
@@ -410,6 +415,10 @@ public:
 	void setSort (SortField** fields);
 
     TCHAR* toString() const;
+
+    /** Returns true if other has equal sort fields, in the same order */
+    bool equals(const Sort* other) const;
+    size_t hashCode() const;
  
     /**
     * Representation of the sort criteria.
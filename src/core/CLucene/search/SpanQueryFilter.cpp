@@ -44,6 +44,28 @@ Filter* SpanQueryFilter::clone() const
 	return _CLNEW SpanQueryFilter( *this );
 }
 
+const char* SpanQueryFilter::getObjectName() const
+{
+    return getClassName();
+}
+
+const char* SpanQueryFilter::getClassName()
+{
+    return "SpanQueryFilter";
+}
+
+bool SpanQueryFilter::equals( Filter* other ) const
+{
+    if( ! other->instanceOf( SpanQueryFilter::getClassName() ))
+        return false;
+    return query->equals( ((SpanQueryFilter*)other)->query );
+}
+
+size_t SpanQueryFilter::hashCode() const
+{
+    return query->hashCode() ^ 0x923F64B9;
+}
+
 CL_NS(util)::BitSet * SpanQueryFilter::bits( CL_NS(index)::IndexReader * reader )
 {
     SpanFilterResult *    result = bitSpans( reader );
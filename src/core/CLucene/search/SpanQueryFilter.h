@@ -55,14 +55,10 @@ public:
 
     virtual TCHAR* toString();
 
-
-//     public boolean equals( Object o ) {
-//         return o instanceof SpanQueryFilter && this.query.equals(((SpanQueryFilter) o).query);
-//     }
-// 
-//     public int hashCode() {
-//         return query.hashCode() ^ 0x923F64B9;
-//     }
+    const char* getObjectName() const;
+    static const char* getClassName();
+    bool equals( Filter* other ) const;
+    size_t hashCode() const;
 };
 
 inline CL_NS2(search,spans)::SpanQuery * SpanQueryFilter::getQuery()
@@ -30,6 +30,7 @@ CL_NS_DEF(search)
 		Similarity* similarity; // ISH: was Searcher*, for no apparent reason
 		float_t value;
 		float_t idf;
+		int32_t docFreq;
 		float_t queryNorm;
 		float_t queryWeight;
 
@@ -114,7 +115,8 @@ CL_NS_DEF(search)
    TermWeight::TermWeight(Searcher* _searcher, TermQuery* _parentQuery, Term* term):similarity(_searcher->getSimilarity()),
 	   value(0), queryNorm(0),queryWeight(0), parentQuery(_parentQuery),_term(term)
    {
-		   idf = similarity->idf(term, _searcher); // compute idf
+		   docFreq = _searcher->docFreq(term);
+		   idf = similarity->idf(docFreq, _searcher->maxDoc()); // compute idf
    }
 
    TermWeight::~TermWeight(){
@@ -146,8 +148,10 @@ CL_NS_DEF(search)
 		if (termDocs == NULL)
 			return NULL;
 
+		// the docFreq of the searcher is the cost, so that the term
+		// dictionary is not read a second time
 		return _CLNEW TermScorer(this, termDocs, similarity,
-								reader->norms(_term->field()));
+								reader->norms(_term->field()), docFreq);
 	}
 
 	Explanation* TermWeight::explain(IndexReader* reader, int32_t doc){
@@ -18,7 +18,7 @@ CL_NS_USE(index)
 CL_NS_DEF(search)
 
 	TermScorer::TermScorer(Weight* w, CL_NS(index)::TermDocs* td, 
-			Similarity* similarity,uint8_t* _norms):
+			Similarity* similarity,uint8_t* _norms, int32_t _docFreq):
 	    Scorer(similarity),
 	    termDocs(td),
 	    norms(_norms),
@@ -26,7 +26,9 @@ CL_NS_DEF(search)
 	    weightValue(w->getValue()),
 	    _doc(0),
 	    pointer(0),
-	    pointerMax(0)
+	    pointerMax(0),
+	    docFreq(_docFreq),
+	    normDecoder(Similarity::getNormDecoder())
 	{
 		memset(docs,0,32*sizeof(int32_t));
 		memset(freqs,0,32*sizeof(int32_t));
@@ -55,13 +57,35 @@ CL_NS_DEF(search)
   }
 
   bool TermScorer::skipTo(int32_t target) {
-    // first scan in cache
-    for (pointer++; pointer < pointerMax; pointer++) {
-      if (docs[pointer] >= target) {
-        _doc = docs[pointer];
-        return true;
+    // first search the cache, galloping from the current position
+    pointer++;
+    if (pointer < pointerMax && docs[pointerMax - 1] >= target) {
+      int32_t lo = pointer;
+      int32_t step = 1;
+      while (docs[lo] < target) {
+        // docs[lo] < target <= docs[pointerMax-1]
+        const int32_t hi = cl_min(lo + step, pointerMax - 1);
+        if (docs[hi] < target) {
+          lo = hi + 1;
+          step <<= 1;
+        } else {
+          // binary search the first docs[i] >= target in lo+1..hi
+          int32_t l = lo + 1, h = hi;
+          while (l < h) {
+            const int32_t mid = (l + h) >> 1;
+            if (docs[mid] < target)
+              l = mid + 1;
+            else
+              h = mid;
+          }
+          lo = l;
+        }
       }
+      pointer = lo;
+      _doc = docs[pointer];
+      return true;
     }
+    pointer = pointerMax;
 
     // not found in cache, seek underlying stream
     bool result = termDocs->skipTo(target);
@@ -119,9 +143,88 @@ CL_NS_DEF(search)
       ? scoreCache[f]                             // cache hit
       : getSimilarity()->tf(f) * weightValue;        // cache miss
 
-      return raw * Similarity::decodeNorm(norms[_doc]); // normalize for field
+      return raw * normDecoder[norms[_doc]]; // normalize for field
+  }
+
+  void TermScorer::scoreBuffered(int32_t from, int32_t to, float_t* scores){
+    const float_t* decoder = normDecoder;
+    for ( int32_t i = from; i < to; i++ ){
+      const int32_t f = freqs[i];
+      const float_t raw = f < LUCENE_SCORE_CACHE_SIZE ? scoreCache[f] : getSimilarity()->tf(f) * weightValue;
+      *scores++ = raw * decoder[norms[docs[i]]];
+    }
+  }
+
+  int32_t TermScorer::nextBatch(int32_t* docsOut, float_t* scoresOut, const int32_t length){
+    int32_t n = 0;
+    while ( n < length ){
+      pointer++;
+      if (pointer >= pointerMax) {
+        pointerMax = termDocs->read(docs, freqs, 32);    // refill buffer
+        if (pointerMax == 0) {
+          termDocs->close();			  // close stream
+          _doc = LUCENE_INT32_MAX_SHOULDBE;		  // set to sentinel value
+          return n;
+        }
+        pointer = 0;
+      }
+      const int32_t count = cl_min(pointerMax - pointer, length - n);
+      memcpy(docsOut + n, docs + pointer, count * sizeof(int32_t));
+      scoreBuffered(pointer, pointer + count, scoresOut + n);
+      pointer += count - 1;
+      n += count;
+    }
+    _doc = docs[pointer];
+    return n;
+  }
+
+  void TermScorer::score(HitCollector* hc){
+    float_t scores[32];
+    int32_t from = pointer + 1;  // rest of the buffer, if next() was already called
+    for (;;) {
+      if (from < pointerMax) {
+        scoreBuffered(from, pointerMax, scores);
+        hc->collectBatch(docs + from, scores, pointerMax - from);
+      }
+      pointerMax = termDocs->read(docs, freqs, 32);    // refill buffer
+      if (pointerMax == 0)
+        break;
+      from = 0;
+    }
+    termDocs->close();
+    pointer = 0;
+    _doc = LUCENE_INT32_MAX_SHOULDBE;
+  }
+
+  bool TermScorer::score(HitCollector* hc, const int32_t max){
+    float_t scores[32];
+    while (_doc < max) {
+      // collect the rest of the buffer, up to max
+      int32_t end = pointer;
+      while (end < pointerMax && docs[end] < max)
+        end++;
+      scoreBuffered(pointer, end, scores);
+      hc->collectBatch(docs + pointer, scores, end - pointer);
+      if (end < pointerMax) {
+        pointer = end;
+        _doc = docs[pointer];
+        return true;
+      }
+
+      pointerMax = termDocs->read(docs, freqs, 32);    // refill buffer
+      if (pointerMax == 0) {
+        termDocs->close();			  // close stream
+        _doc = LUCENE_INT32_MAX_SHOULDBE;		  // set to sentinel value
+        return false;
+      }
+      pointer = 0;
+      _doc = docs[0];
+    }
+    return true;
   }
 
   int32_t TermScorer::doc() const { return _doc; }
+
+  int32_t TermScorer::cost() const { return docFreq; }
 	
 CL_NS_END
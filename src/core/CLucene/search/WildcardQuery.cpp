@@ -51,7 +51,8 @@ FilteredTermEnum* WildcardQuery::getEnum(IndexReader* reader) {
 }
 
 WildcardQuery::WildcardQuery(const WildcardQuery& clone):
-MultiTermQuery(clone)
+MultiTermQuery(clone),
+termContainsWildcard(clone.termContainsWildcard)
 {
 }
 
@@ -69,6 +70,7 @@ bool WildcardQuery::equals(Query* other) const{
 
 	WildcardQuery* tq = (WildcardQuery*)other;
 	return (this->getBoost() == tq->getBoost())
+		&& (this->getRewriteMethod() == tq->getRewriteMethod())
 		&& getTerm()->equals(tq->getTerm());
 }
 
@@ -100,6 +102,21 @@ Filter* WildcardFilter::clone() const {
 	return _CLNEW WildcardFilter(*this );
 }
 
+const char* WildcardFilter::getObjectName() const{
+	return getClassName();
+}
+const char* WildcardFilter::getClassName(){
+	return "WildcardFilter";
+}
+bool WildcardFilter::equals( Filter* other ) const{
+	if ( !other->instanceOf(WildcardFilter::getClassName()) )
+		return false;
+	return term->equals( ((WildcardFilter*)other)->term );
+}
+size_t WildcardFilter::hashCode() const{
+	return term->hashCode() ^ 0x2B7E1516;
+}
+
 
 TCHAR* WildcardFilter::toString()
 {
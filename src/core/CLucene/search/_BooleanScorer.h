@@ -62,6 +62,7 @@ CL_NS_DEF(search)
 			Collector(const int32_t mask, BucketTable* bucketTable);
 			
 			void collect(const int32_t doc, const float_t score);
+			void collectBatch(const int32_t* docs, const float_t* scores, const int32_t length);
 		};
 
 		SubScorer* scorers;
@@ -40,6 +40,10 @@ CL_NS_DEF(search)
 		bool skipTo( int32_t target );
 		Explanation* explain( int32_t doc );
 		virtual TCHAR* toString();
+
+		/** Returns the cost of the cheapest required clause, or the summed
+		* cost of the optional clauses if none is required */
+		int32_t cost() const;
 	};
 
 CL_NS_END
@@ -11,7 +11,12 @@
 #include "CLucene/util/Array.h"
 CL_NS_DEF(search)
 
-/** Scorer for conjunctions, sets of queries, all of which are required. */
+/** Scorer for conjunctions, sets of queries, all of which are required.
+* <p>The sub scorers are ordered by their {@link Scorer#cost()}. The cheapest
+* one leads the iteration and the others are only skipped to its matches,
+* so a rare term combined with a common one costs about as much as the rare
+* term alone.</p>
+*/
 class ConjunctionScorer: public Scorer {
 private:
   CL_NS(util)::ArrayBase<Scorer*>* scorers;
@@ -35,6 +40,9 @@ public:
   bool skipTo(int32_t target);
   virtual float_t score();
   virtual Explanation* explain(int32_t doc);
+
+  /** Returns the cost of the cheapest sub scorer */
+  virtual int32_t cost() const;
 };
 
 CL_NS_END
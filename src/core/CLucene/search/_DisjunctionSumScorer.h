@@ -131,6 +131,9 @@ public:
 
 	virtual TCHAR* toString();
 
+	/** Returns the summed cost of the subscorers */
+	int32_t cost() const;
+
 	/** @return An explanation for the score of a given document. */
 	Explanation* explain( int32_t doc );
 };
@@ -8,6 +8,7 @@
 #define _lucene_search_FieldCacheImpl_
 
 CL_CLASS_DEF(index,IndexReader)
+CL_CLASS_DEF(index,DocValues)
 CL_CLASS_DEF(search,SortComparator)
 CL_CLASS_DEF(search,SortComparatorSource)
 #include "FieldCache.h"
@@ -85,6 +86,9 @@ private:
 
   /** Put a custom object into the cache. */
   void store (CL_NS(index)::IndexReader* reader, const TCHAR* field, SortComparatorSource* comparer, FieldCacheAuto* value);
+
+  /** Returns the INTS doc values of field, or NULL if the reader has none. */
+  CL_NS(index)::DocValues* getIntDocValues (CL_NS(index)::IndexReader* reader, const TCHAR* field);
   
 public:
 
@@ -100,6 +104,9 @@ public:
   // inherit javadocs
   FieldCacheAuto* getStringIndex (CL_NS(index)::IndexReader* reader, const TCHAR* field);
 
+  // inherit javadocs
+  FieldCacheAuto* getPackedStringIndex (CL_NS(index)::IndexReader* reader, const TCHAR* field);
+
   // inherit javadocs
   FieldCacheAuto* getAuto (CL_NS(index)::IndexReader* reader, const TCHAR* field);
 
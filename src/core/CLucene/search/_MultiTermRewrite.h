@@ -0,0 +1,104 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_search_MultiTermRewrite_
+#define _lucene_search_MultiTermRewrite_
+
+#include <vector>
+#include "MultiTermQuery.h"
+#include "Filter.h"
+CL_CLASS_DEF(index,Term)
+CL_CLASS_DEF(index,TermDocs)
+CL_CLASS_DEF(index,IndexReader)
+CL_CLASS_DEF(util,BitSet)
+CL_CLASS_DEF(search,BooleanQuery)
+
+CL_NS_DEF(search)
+
+/**
+* Collects the terms a MultiTermQuery, PrefixQuery or RangeQuery expands to
+* and builds the rewritten query according to a
+* {@link MultiTermQuery::RewriteMethod}.
+*
+* With CONSTANT_SCORE_AUTO_REWRITE the terms are held back until the cutoffs
+* are passed. From then on no more terms are needed: the query is answered
+* by a MultiTermFilter, which expands the source query again for the reader
+* it is asked for.
+*/
+class MultiTermRewrite {
+private:
+	CL_NS(index)::IndexReader* reader;
+	MultiTermQuery::RewriteMethod method;
+	const float_t boost;
+
+	BooleanQuery* query;
+	CL_NS(util)::BitSet* bits;
+	CL_NS(index)::TermDocs* termDocs;
+
+	std::vector<CL_NS(index)::Term*> pendingTerms;
+	std::vector<float_t> pendingBoosts;
+
+	int32_t termCountCutoff;
+	int64_t docCountCutoff;
+	int64_t docCount;
+
+	void addClause(CL_NS(index)::Term* t, float_t termBoost);
+	void switchToFilter();
+public:
+	/**
+	* @param reader the reader the query is rewritten for
+	* @param method how to rewrite the query
+	* @param boost the boost of the query being rewritten
+	*/
+	MultiTermRewrite(CL_NS(index)::IndexReader* reader, MultiTermQuery::RewriteMethod method, float_t boost);
+	/**
+	* Sets the documents of every collected term in bits, instead of building a query.
+	* @memory bits is not consumed
+	*/
+	MultiTermRewrite(CL_NS(index)::IndexReader* reader, CL_NS(util)::BitSet* bits);
+	~MultiTermRewrite();
+
+	/** Adds a matching term.
+	* @param docFreq the document frequency of t, as returned by the enumeration
+	* @param termBoost multiplied with the boost of the query for a scoring clause
+	* @return false if the rewrite is decided and no more terms are needed
+	* @memory the term is not consumed */
+	bool collect(CL_NS(index)::Term* t, int32_t docFreq, float_t termBoost=1.0f);
+
+	/** Returns the rewritten query. Called once, after all terms were collected.
+	* @param source the query being rewritten, cloned if the result is constant scoring */
+	Query* getQuery(const Query* source);
+
+	/** Sets every document containing t in bits, reading the postings in blocks */
+	static void fill(CL_NS(index)::TermDocs* termDocs, CL_NS(index)::Term* t, CL_NS(util)::BitSet* bits);
+};
+
+/**
+* The filter of a constant score rewrite. It holds no state for a reader:
+* every call to bits() expands the source query for the reader given.
+*/
+class MultiTermFilter: public Filter {
+private:
+	Query* source;
+	MultiTermFilter(const MultiTermFilter& copy);
+public:
+	/** @memory consumes source */
+	MultiTermFilter(Query* source);
+	~MultiTermFilter();
+
+	CL_NS(util)::BitSet* bits(CL_NS(index)::IndexReader* reader);
+	Filter* clone() const;
+	TCHAR* toString();
+
+	const char* getObjectName() const;
+	static const char* getClassName();
+	/** Equal if the source queries are equal */
+	bool equals(Filter* other) const;
+	size_t hashCode() const;
+};
+
+CL_NS_END
+#endif
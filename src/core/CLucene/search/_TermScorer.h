@@ -29,8 +29,13 @@ private:
 	int32_t freqs[32];	  // buffered term freqs
 	int32_t pointer;
 	int32_t pointerMax;
+	const int32_t docFreq;
 
 	float_t scoreCache[LUCENE_SCORE_CACHE_SIZE];
+	const float_t* normDecoder;
+
+	/** Scores the buffered documents from..to-1 into scores */
+	void scoreBuffered(int32_t from, int32_t to, float_t* scores);
 public:
 
 	/** Construct a <code>TermScorer</code>.
@@ -38,10 +43,11 @@ public:
 	* @param td An iterator over the documents matching the <code>Term</code>.
 	* @param similarity The </code>Similarity</code> implementation to be used for score computations.
 	* @param norms The field norms of the document fields for the <code>Term</code>.
+	* @param docFreq The number of documents containing the <code>Term</code>, returned by cost()
 	*
 	* @memory TermScorer takes TermDocs and deletes it when TermScorer is cleaned up */
 	TermScorer(Weight* weight, CL_NS(index)::TermDocs* td, 
-		Similarity* similarity, uint8_t* _norms);
+		Similarity* similarity, uint8_t* _norms, int32_t docFreq=LUCENE_INT32_MAX_SHOULDBE);
 
 	virtual ~TermScorer();
 
@@ -60,6 +66,15 @@ public:
 
 	float_t score();
 
+	/** Returns the document frequency of the term */
+	int32_t cost() const;
+
+	/** Scores a whole block of buffered documents at a time */
+	int32_t nextBatch(int32_t* docs, float_t* scores, const int32_t length);
+
+	void score(HitCollector* hc);
+	bool score(HitCollector* hc, const int32_t max);
+
 	/** Skips to the first match beyond the current whose document number is
 	* greater than or equal to a given target. 
 	* <br>The implementation uses {@link TermDocs#skipTo(int)}.
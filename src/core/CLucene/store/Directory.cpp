@@ -8,6 +8,8 @@
 
 #include "Directory.h"
 #include "LockFactory.h"
+#include "IndexInput.h"
+#include "IndexOutput.h"
 #include "CLucene/util/Misc.h"
 
 CL_NS_DEF(store)
@@ -75,4 +77,27 @@ char** Directory::list() const{
 bool Directory::list(std::vector<std::string>& names) const{
   return list(&names);
 }
+void Directory::sync(const std::vector<std::string>& /*names*/){
+}
+IndexOutput* Directory::createMergeOutput(const char* name){
+  return createOutput(name);
+}
+bool Directory::openMergeInput(const char* name, IndexInput*& ret, CLuceneError& error, int32_t bufferSize){
+  return openInput(name, ret, error, bufferSize);
+}
+int64_t Directory::copyFile(const char* name, IndexOutput* out){
+  IndexInput* in = NULL;
+  CLuceneError err;
+  if ( !openMergeInput(name, in, err) )
+    throw err;
+  int64_t length = 0;
+  try{
+    length = in->length();
+    out->copyBytes(in, length);
+  }_CLFINALLY(
+    in->close();
+    _CLDELETE(in);
+  )
+  return length;
+}
 CL_NS_END
@@ -79,6 +79,29 @@ class CLUCENE_EXPORT Directory: LUCENE_REFBASE, public CL_NS(util)::NamedObject
 		//	Returns a stream writing this file.
 		virtual IndexOutput* createOutput(const char* name) = 0;
 
+		// Creates a file that is written by a merge. Merged files are only
+		//	read again once the merge is committed, so directories may keep
+		//	them out of their caches. The default calls createOutput.
+		virtual IndexOutput* createMergeOutput(const char* name);
+
+		// Opens a file that is read from start to end by a merge. The
+		//	default calls openInput.
+		virtual bool openMergeInput(const char* name, IndexInput*& ret, CLuceneError& error, int32_t bufferSize = -1);
+
+		// Appends the whole named file to out, which may belong to another
+		//	directory, and returns the number of bytes that were copied.
+		//	The default reads the file with openMergeInput and copies it with
+		//	IndexOutput::copyBytes, so outputs that can copy files in the
+		//	kernel do so.
+		virtual int64_t copyFile(const char* name, IndexOutput* out);
+
+		// Makes sure that the named files, which must be closed, and the
+		//	directory entries that name them are on stable storage, so that
+		//	they survive a crash of the machine. The files may be synced
+		//	concurrently. The default does nothing, for directories that do
+		//	not keep their files on disk.
+		virtual void sync(const std::vector<std::string>& names);
+
 		// Construct a {@link Lock}.
 		// @param name the name of the lock file
 		virtual LuceneLock* makeLock(const char* name);
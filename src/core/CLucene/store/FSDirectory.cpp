@@ -19,6 +19,9 @@
 #ifdef _CL_HAVE_DIRECT_H
 	#include <direct.h>
 #endif
+#if defined(_CL_HAVE_FUNCTION_SENDFILE) && defined(_CL_HAVE_SYS_SENDFILE_H)
+	#include <sys/sendfile.h>
+#endif
 #include <errno.h>
 
 #include <assert.h>
@@ -29,6 +32,7 @@
 #include "CLucene/index/IndexWriter.h"
 #include "CLucene/util/Misc.h"
 #include "CLucene/util/_MD5Digester.h"
+#include "CLucene/config/_threads.h"
 
 #ifdef LUCENE_FS_MMAP
     #include "_MMapIndexInput.h"
@@ -66,6 +70,7 @@ CL_NS_USE(util)
 		};
 		SharedHandle* handle;
 		int64_t _pos;
+		friend class FSDirectory::FSIndexOutput;
 		FSIndexInput(SharedHandle* handle, int32_t __bufferSize):
 			BufferedIndexInput(__bufferSize)
 		{
@@ -75,7 +80,7 @@ CL_NS_USE(util)
 	protected:
 		FSIndexInput(const FSIndexInput& clone);
 	public:
-		static bool open(const char* path, IndexInput*& ret, CLuceneError& error, int32_t bufferSize=-1);
+		static bool open(const char* path, IndexInput*& ret, CLuceneError& error, int32_t bufferSize=-1, bool sequential=false);
 		~FSIndexInput();
 
 		IndexInput* clone() const;
@@ -92,14 +97,20 @@ CL_NS_USE(util)
 		void readInternal(uint8_t* b, const int32_t len);
 	};
 
+	/** How many bytes an output that drops its pages from the cache writes between drops */
+	#define LUCENE_FS_DROP_CACHE_BYTES (1024*1024)
+
 	class FSDirectory::FSIndexOutput: public BufferedIndexOutput {
 	private:
 		int32_t fhandle;
+		bool dropCache;
+		int64_t cachedBytes;
+		void dropCachedPages();
 	protected:
 		// output methods:
 		void flushBuffer(const uint8_t* b, const int32_t size);
 	public:
-		FSIndexOutput(const char* path, int filemode);
+		FSIndexOutput(const char* path, int filemode, bool dropCache=false);
 		~FSIndexOutput();
 
 		// output methods:
@@ -108,9 +119,44 @@ CL_NS_USE(util)
 		// Random-access methods
 		void seek(const int64_t pos);
 		int64_t length() const;
+
+		/** Copies the bytes of an FSIndexInput without reading them */
+		void copyBytes(IndexInput* input, int64_t numBytes);
 	};
 
-	bool FSDirectory::FSIndexInput::open(const char* path, IndexInput*& ret, CLuceneError& error, int32_t __bufferSize )    {
+	/**
+	* Copies numBytes bytes of the file in, starting at inPos, to the current
+	* position of the file out, in the kernel. copy_file_range lets file systems
+	* that support it share the blocks of the two files. Returns the number of
+	* bytes copied, which is less than numBytes if the kernel can not copy
+	* these files.
+	*/
+	static int64_t FSDirectory_kernelCopy(int32_t in, int64_t inPos, int32_t out, int64_t numBytes){
+	  int64_t copied = 0;
+	  //copy at most 1GB at a time, the calls may not take more
+	  const int64_t maxChunk = 1 << 30;
+#ifdef _CL_HAVE_FUNCTION_COPY_FILE_RANGE
+	  while ( copied < numBytes ){
+	    off_t off = (off_t)(inPos + copied);
+	    ssize_t n = copy_file_range(in, &off, out, NULL, (size_t)cl_min(numBytes - copied, maxChunk), 0);
+	    if ( n <= 0 )
+	      break; //not supported for these files (or the file ended), try the next way
+	    copied += n;
+	  }
+#endif
+#if defined(_CL_HAVE_FUNCTION_SENDFILE) && defined(_CL_HAVE_SYS_SENDFILE_H)
+	  while ( copied < numBytes ){
+	    off_t off = (off_t)(inPos + copied);
+	    ssize_t n = sendfile(out, in, &off, (size_t)cl_min(numBytes - copied, maxChunk));
+	    if ( n <= 0 )
+	      break;
+	    copied += n;
+	  }
+#endif
+	  return copied;
+	}
+
+	bool FSDirectory::FSIndexInput::open(const char* path, IndexInput*& ret, CLuceneError& error, int32_t __bufferSize, bool sequential )    {
 	//Func - Constructor.
 	//       Opens the file named path
 	//Pre  - path != NULL
@@ -132,6 +178,11 @@ CL_NS_USE(util)
 		  if ( handle->_length == -1 )
 	  		error.set( CL_ERR_IO,"fileStat error" );
 		  else{
+#ifdef _CL_HAVE_FUNCTION_POSIX_FADVISE
+			  //read ahead further, the file is read from start to end
+			  if ( sequential )
+				  posix_fadvise(handle->fhandle, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
 			  handle->_fpos = 0;
 			  ret = _CLNEW FSIndexInput(handle, __bufferSize);
 			  return true;
@@ -164,7 +215,8 @@ CL_NS_USE(util)
 
 	  SCOPED_LOCK_MUTEX(*other.handle->SHARED_LOCK)
 	  handle = _CL_POINTER(other.handle);
-	  _pos = other.handle->_fpos; //note where we are currently...
+	  _pos = other._pos; //continue after the buffer that was copied from other, the
+	                     //shared handle may have been moved by other clones since
   }
 
   FSDirectory::FSIndexInput::SharedHandle::SharedHandle(const char* path){
@@ -231,7 +283,7 @@ CL_NS_USE(util)
   }
 
   void FSDirectory::FSIndexInput::seekInternal(const int64_t position)  {
-	CND_PRECONDITION(position>=0 &&position<handle->_length,"Seeking out of range")
+	CND_PRECONDITION(position>=0 &&position<=handle->_length,"Seeking out of range")
 	_pos = position;
   }
 
@@ -262,7 +314,10 @@ void FSDirectory::FSIndexInput::readInternal(uint8_t* b, const int32_t len) {
 	handle->_fpos=_pos;
 }
 
-  FSDirectory::FSIndexOutput::FSIndexOutput(const char* path, int filemode){
+  FSDirectory::FSIndexOutput::FSIndexOutput(const char* path, int filemode, bool dropCache):
+    dropCache(dropCache),
+    cachedBytes(0)
+  {
 	//O_BINARY - Opens file in binary (untranslated) mode
 	//O_CREAT - Creates and opens new file for writing. Has no effect if file specified by filename exists
 	//O_RANDOM - Specifies that caching is optimized for, but not restricted to, random access from disk.
@@ -302,6 +357,19 @@ void FSDirectory::FSIndexInput::readInternal(uint8_t* b, const int32_t len) {
 	  CND_PRECONDITION(fhandle>=0,"file is not open");
       if ( size > 0 && _write(fhandle,b,size) != size )
         _CLTHROWA(CL_ERR_IO, "File IO Write error");
+      if ( dropCache ){
+        cachedBytes += size;
+        if ( cachedBytes >= LUCENE_FS_DROP_CACHE_BYTES )
+          dropCachedPages();
+      }
+  }
+  void FSDirectory::FSIndexOutput::dropCachedPages() {
+#ifdef _CL_HAVE_FUNCTION_POSIX_FADVISE
+    //starts writing the dirty pages back, and drops the pages that were
+    //written back already. The rest is dropped by the next call.
+    posix_fadvise(fhandle, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    cachedBytes = 0;
   }
   void FSDirectory::FSIndexOutput::close() {
     try{
@@ -311,6 +379,8 @@ void FSDirectory::FSIndexInput::readInternal(uint8_t* b, const int32_t len) {
 	    if ( err.number() != CL_ERR_IO )
 	        throw;
     }
+    if ( dropCache )
+      dropCachedPages();
 
     if ( ::_close(fhandle) != 0 )
       _CLTHROWA(CL_ERR_IO, "File IO Close error");
@@ -326,6 +396,32 @@ void FSDirectory::FSIndexInput::readInternal(uint8_t* b, const int32_t len) {
       _CLTHROWA(CL_ERR_IO, "File IO Seek error");
 	}
   }
+  void FSDirectory::FSIndexOutput::copyBytes(IndexInput* input, int64_t numBytes) {
+    if ( strcmp(input->getObjectName(), FSIndexInput::getClassName()) != 0 ){
+      IndexOutput::copyBytes(input, numBytes);
+      return;
+    }
+    CND_PRECONDITION(fhandle>=0,"file is not open");
+    FSIndexInput* in = (FSIndexInput*)input;
+
+    //the kernel writes at the position of the file, after our buffer
+    flush();
+    const int64_t inPos = in->getFilePointer();
+    const int64_t outPos = getFilePointer();
+    const int64_t copied = FSDirectory_kernelCopy(in->handle->fhandle, inPos, fhandle, numBytes);
+    if ( copied > 0 ){
+      in->seek(inPos + copied);
+      //the file is at outPos + copied already
+      BufferedIndexOutput::seek(outPos + copied);
+      if ( dropCache ){
+        cachedBytes += copied;
+        if ( cachedBytes >= LUCENE_FS_DROP_CACHE_BYTES )
+          dropCachedPages();
+      }
+    }
+    if ( copied < numBytes )
+      IndexOutput::copyBytes(input, numBytes - copied);
+  }
   int64_t FSDirectory::FSIndexOutput::length() const {
 	  CND_PRECONDITION(fhandle>=0,"file is not open");
 	  return fileSize(fhandle);
@@ -362,6 +458,7 @@ void FSDirectory::FSIndexInput::readInternal(uint8_t* b, const int32_t len) {
    useMMap(LUCENE_USE_MMAP)
   {
     filemode = 0644;
+    syncThreadCount = 4;
     this->lockFactory = NULL;
   }
 
@@ -579,6 +676,15 @@ void FSDirectory::FSIndexInput::readInternal(uint8_t* b, const int32_t len) {
 	return FSIndexInput::open( fl, ret, error, bufferSize );
   }
 
+  bool FSDirectory::openMergeInput(const char * name, IndexInput *& ret, CLuceneError& error, int32_t bufferSize)
+  {
+	CND_PRECONDITION(directory[0]!=0,"directory is not open")
+    char fl[CL_MAX_DIR];
+    priv_getFN(fl, name);
+    //not mapped, so that the read ahead hint applies
+	return FSIndexInput::open( fl, ret, error, bufferSize, true );
+  }
+
   void FSDirectory::close(){
     SCOPED_LOCK_MUTEX(DIRECTORIES_LOCK)
     {
@@ -686,6 +792,108 @@ void FSDirectory::FSIndexInput::readInternal(uint8_t* b, const int32_t len) {
     return _CLNEW FSIndexOutput( fl, this->filemode );
   }
 
+  IndexOutput* FSDirectory::createMergeOutput(const char* name) {
+	CND_PRECONDITION(directory[0]!=0,"directory is not open");
+    char fl[CL_MAX_DIR];
+    priv_getFN(fl, name);
+	  if ( Misc::dir_Exists(fl) && Misc::file_Unlink( fl, 1 ) == -1 ) {
+		  char tmp[1024];
+		  strcpy(tmp, "Cannot overwrite: ");
+		  strcat(tmp, name);
+		  _CLTHROWA(CL_ERR_IO, tmp);
+	  }
+    return _CLNEW FSIndexOutput( fl, this->filemode, true );
+  }
+
+  /** The files that sync flushes, shared by the threads that flush them */
+  class FSDirectory::SyncTasks {
+  public:
+    const FSDirectory* dir;
+    const vector<string>& names;
+    size_t next;
+    CLuceneError* error;
+    DEFINE_MUTEX(THIS_LOCK)
+
+    SyncTasks(const FSDirectory* dir, const vector<string>& names):
+      dir(dir), names(names), next(0), error(NULL) {}
+    ~SyncTasks() { _CLDELETE(error); }
+
+    /** Flushes files until there are none left, or one of them failed */
+    void run() {
+      while (true) {
+        const char* name;
+        {
+          SCOPED_LOCK_MUTEX(THIS_LOCK)
+          if (error != NULL || next == names.size())
+            return;
+          name = names[next++].c_str();
+        }
+        char path[CL_MAX_DIR];
+        dir->priv_getFN(path, name);
+        int32_t fhandle = _cl_open(path, _O_BINARY | O_RDWR, dir->filemode);
+        const bool synced = fhandle >= 0 && _fsync(fhandle) == 0;
+        if (fhandle >= 0)
+          ::_close(fhandle);
+        if (!synced) {
+          SCOPED_LOCK_MUTEX(THIS_LOCK)
+          if (error == NULL) {
+            char buffer[20+CL_MAX_PATH];
+            strcpy(buffer, "couldn't sync ");
+            strcat(buffer, name);
+            error = _CLNEW CLuceneError(CL_ERR_IO, buffer, false);
+          }
+        }
+      }
+    }
+
+    static _LUCENE_THREAD_FUNC(worker, arg) {
+      ((SyncTasks*)arg)->run();
+      _LUCENE_THREAD_FUNC_RETURN(0);
+    }
+  };
+
+  void FSDirectory::sync(const vector<string>& names) {
+	CND_PRECONDITION(directory[0]!=0,"directory is not open");
+    if (names.empty())
+      return;
+
+    SyncTasks tasks(this, names);
+#ifndef _CL_DISABLE_MULTITHREADING
+    // this thread flushes files as well
+    ValueArray<_LUCENE_THREADID_TYPE> threads(min((size_t)syncThreadCount, names.size()) - 1);
+    for (size_t i = 0; i < threads.length; i++)
+      threads.values[i] = _LUCENE_THREAD_CREATE(&SyncTasks::worker, &tasks);
+    tasks.run();
+    for (size_t i = 0; i < threads.length; i++)
+      _LUCENE_THREAD_JOIN(threads[i]);
+#else
+    tasks.run();
+#endif
+    if (tasks.error != NULL)
+      throw *tasks.error;
+
+#if defined(_CL_HAVE_FUNCTION_FSYNC)
+    // the new files are only found after a crash once their directory
+    // entries are on the disk. Some file systems can not sync directories,
+    // they keep their entries on the disk anyway
+    int32_t dhandle = _cl_open(directory.c_str(), O_RDONLY, 0);
+    if (dhandle >= 0) {
+      _fsync(dhandle);
+      ::_close(dhandle);
+    }
+#endif
+  }
+
+  void FSDirectory::setSyncThreadCount(int32_t count) {
+    if (count < 1)
+      _CLTHROWA(CL_ERR_IllegalArgument, "sync thread count must be at least 1");
+    syncThreadCount = count;
+  }
+
+  int32_t FSDirectory::getSyncThreadCount() const {
+    return syncThreadCount;
+  }
+
   string FSDirectory::toString() const{
 	  return string("FSDirectory@") + this->directory;
   }
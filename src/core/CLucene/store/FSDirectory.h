@@ -30,8 +30,11 @@ CL_CLASS_DEF(util,StringBuffer)
 		class FSIndexInput;
 		friend class FSDirectory::FSIndexOutput;
 		friend class FSDirectory::FSIndexInput;
+		class SyncTasks;
+		friend class FSDirectory::SyncTasks;
 
     int filemode;
+    int32_t syncThreadCount;
 	protected:
     FSDirectory();
     virtual void init(const char* path, LockFactory* lockFactory = NULL);
@@ -114,7 +117,38 @@ CL_CLASS_DEF(util,StringBuffer)
 		/// Creates a new, empty file in the directory with the given name.
 		///	Returns a stream writing this file.
     virtual IndexOutput* createOutput(const char* name);
-  
+
+    /**
+    * Creates a file written by a merge. Its pages are dropped from the
+    * operating system's cache while it is written, so that a merge does
+    * not push out the pages of the files that searches read.
+    */
+    virtual IndexOutput* createMergeOutput(const char* name);
+
+    /**
+    * Opens a file read by a merge. It is read without mmap and the operating
+    * system is told that the file is read sequentially.
+    */
+    virtual bool openMergeInput(const char* name, IndexInput*& ret, CLuceneError& error, int32_t bufferSize = -1);
+
+    /**
+    * Flushes the named files to the disk, and then the directory, so that
+    * the new files can be found after a crash. Up to getSyncThreadCount()
+    * files are flushed at the same time, which lets the operating system
+    * and the disk combine their writes.
+    * @throws CLuceneError (CL_ERR_IO) if a file could not be flushed
+    */
+    virtual void sync(const std::vector<std::string>& names);
+
+    /**
+    * Sets the number of threads that sync flushes files with. The default
+    * is 4.
+    */
+    void setSyncThreadCount(int32_t count);
+
+    /** Gets the number of threads that sync flushes files with */
+    int32_t getSyncThreadCount() const;
+
     ///Decrease the ref-count to the directory by one. If
     ///the object is no longer needed, then the object is
     ///removed from the directory pool.
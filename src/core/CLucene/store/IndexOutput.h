@@ -104,8 +104,9 @@ private:
 	uint8_t* copyBuffer;
 
 public:
-	/** Copy numBytes bytes from input to ourself. */
-	void copyBytes(CL_NS(store)::IndexInput* input, int64_t numBytes);
+	/** Copy numBytes bytes from input to ourself. Outputs that can copy
+	* the bytes of some inputs without reading them override this. */
+	virtual void copyBytes(CL_NS(store)::IndexInput* input, int64_t numBytes);
 };
 
 /** Base implementation class for buffered {@link IndexOutput}. */
@@ -0,0 +1,201 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "CLucene/_ApiHeader.h"
+#include "_MergeDirectory.h"
+#include "IndexInput.h"
+#include "IndexOutput.h"
+#include "RateLimiter.h"
+
+CL_NS_DEF(store)
+
+/** Pauses before every read of the wrapped stream, which is read unbuffered */
+class MergeDirectory::LimitedIndexInput: public BufferedIndexInput {
+	IndexInput* delegate;
+	RateLimiter* limiter;
+	friend class MergeDirectory::LimitedIndexOutput;
+protected:
+	LimitedIndexInput(const LimitedIndexInput& other):
+		BufferedIndexInput(other),
+		delegate(other.delegate->clone()),
+		limiter(other.limiter)
+	{
+	}
+	void readInternal(uint8_t* b, const int32_t len){
+		limiter->pause(len);
+		// clones share nothing but the file, so always seek
+		delegate->seek(getFilePointer());
+		delegate->readBytes(b, len, false);
+	}
+	void seekInternal(const int64_t /*pos*/){
+	}
+public:
+	LimitedIndexInput(IndexInput* delegate, RateLimiter* limiter, int32_t bufferSize):
+		BufferedIndexInput(bufferSize),
+		delegate(delegate),
+		limiter(limiter)
+	{
+	}
+	~LimitedIndexInput(){
+		LimitedIndexInput::close();
+	}
+	IndexInput* clone() const{
+		return _CLNEW LimitedIndexInput(*this);
+	}
+	void close(){
+		BufferedIndexInput::close();
+		if ( delegate != NULL ){
+			delegate->close();
+			_CLDELETE(delegate);
+		}
+	}
+	int64_t length() const{ return delegate->length(); }
+	const char* getDirectoryType() const{ return delegate->getDirectoryType(); }
+	const char* getObjectName() const{ return getClassName(); }
+	static const char* getClassName(){ return "LimitedIndexInput"; }
+};
+
+/** Pauses before every flush of the buffer to the wrapped stream */
+class MergeDirectory::LimitedIndexOutput: public BufferedIndexOutput {
+	IndexOutput* delegate;
+	RateLimiter* limiter;
+protected:
+	void flushBuffer(const uint8_t* b, const int32_t len){
+		if ( len > 0 ){
+			limiter->pause(len);
+			delegate->writeBytes(b, len);
+		}
+	}
+public:
+	LimitedIndexOutput(IndexOutput* delegate, RateLimiter* limiter):
+		delegate(delegate),
+		limiter(limiter)
+	{
+	}
+	~LimitedIndexOutput(){
+		if ( delegate != NULL ){
+			try{
+				LimitedIndexOutput::close();
+			}catch(CLuceneError& err){
+				//ignore IO errors...
+				if ( err.number() != CL_ERR_IO )
+					throw;
+			}
+		}
+	}
+	void close(){
+		try{
+			BufferedIndexOutput::close();
+			delegate->close();
+		}_CLFINALLY(
+			_CLDELETE(delegate);
+		)
+	}
+	void seek(const int64_t pos){
+		BufferedIndexOutput::seek(pos);
+		delegate->seek(pos);
+	}
+	/** Lets the wrapped output copy the bytes of the wrapped input, which
+	* may be done in the kernel, pausing before every chunk */
+	void copyBytes(IndexInput* input, int64_t numBytes){
+		if ( strcmp(input->getObjectName(), LimitedIndexInput::getClassName()) != 0 ){
+			IndexOutput::copyBytes(input, numBytes);
+			return;
+		}
+		LimitedIndexInput* in = (LimitedIndexInput*)input;
+		flush();
+		const int64_t chunk = 1024 * 1024;
+		while ( numBytes > 0 ){
+			const int64_t len = cl_min(numBytes, chunk);
+			const int64_t inPos = in->getFilePointer();
+			const int64_t outPos = getFilePointer();
+			// the bytes are read and written
+			limiter->pause(2 * len);
+			in->delegate->seek(inPos);
+			delegate->copyBytes(in->delegate, len);
+			in->seek(inPos + len);
+			BufferedIndexOutput::seek(outPos + len);
+			numBytes -= len;
+		}
+	}
+	int64_t length() const{
+		const int64_t written = getFilePointer();
+		const int64_t len = delegate->length();
+		return len > written ? len : written;
+	}
+};
+
+MergeDirectory::MergeDirectory(Directory* dir, RateLimiter* limiter):
+	dir(_CL_POINTER(dir)),
+	limiter(limiter)
+{
+}
+MergeDirectory::~MergeDirectory(){
+	_CLDECDELETE(dir);
+}
+
+bool MergeDirectory::list(std::vector<std::string>* names) const{
+	return dir->list(names);
+}
+bool MergeDirectory::fileExists(const char* name) const{
+	return dir->fileExists(name);
+}
+int64_t MergeDirectory::fileModified(const char* name) const{
+	return dir->fileModified(name);
+}
+int64_t MergeDirectory::fileLength(const char* name) const{
+	return dir->fileLength(name);
+}
+bool MergeDirectory::openInput(const char* name, IndexInput*& ret, CLuceneError& error, int32_t bufferSize){
+	if ( bufferSize == -1 )
+		bufferSize = BufferedIndexOutput::BUFFER_SIZE;
+	IndexInput* input = NULL;
+	if ( !dir->openMergeInput(name, input, error, bufferSize) )
+		return false;
+	ret = _CLNEW LimitedIndexInput(input, limiter, bufferSize);
+	return true;
+}
+void MergeDirectory::touchFile(const char* name){
+	dir->touchFile(name);
+}
+bool MergeDirectory::deleteFile(const char* name, const bool throwError){
+	return dir->deleteFile(name, throwError);
+}
+bool MergeDirectory::doDeleteFile(const char* name){
+	return dir->deleteFile(name, false);
+}
+void MergeDirectory::renameFile(const char* from, const char* to){
+	dir->renameFile(from, to);
+}
+IndexOutput* MergeDirectory::createOutput(const char* name){
+	return _CLNEW LimitedIndexOutput(dir->createMergeOutput(name), limiter);
+}
+void MergeDirectory::sync(const std::vector<std::string>& names){
+	dir->sync(names);
+}
+LuceneLock* MergeDirectory::makeLock(const char* name){
+	return dir->makeLock(name);
+}
+void MergeDirectory::clearLock(const char* name){
+	dir->clearLock(name);
+}
+std::string MergeDirectory::getLockID(){
+	return dir->getLockID();
+}
+void MergeDirectory::close(){
+}
+
+std::string MergeDirectory::toString() const{
+	return std::string("MergeDirectory@") + dir->toString();
+}
+const char* MergeDirectory::getClassName(){
+	return "MergeDirectory";
+}
+const char* MergeDirectory::getObjectName() const{
+	return getClassName();
+}
+
+CL_NS_END
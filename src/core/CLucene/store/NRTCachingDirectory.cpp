@@ -0,0 +1,515 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "CLucene/_ApiHeader.h"
+#include "NRTCachingDirectory.h"
+#include "IndexInput.h"
+#include "IndexOutput.h"
+#include "_RAMDirectory.h"
+#include "CLucene/util/Misc.h"
+#include <algorithm>
+
+CL_NS_USE(util)
+CL_NS_DEF(store)
+
+/**
+* A file in the cache. It is referenced by the cache and by the streams
+* that read or write it, so that it can be evicted or deleted while it is
+* still being read.
+*/
+class NRTCachingDirectory::CachedFile: LUCENE_REFBASE {
+public:
+	std::string name;
+	RAMFile file;
+	int64_t size;        // guarded by cache_LOCK
+	int64_t sequence;
+	bool writing;        // guarded by cache_LOCK
+	bool persisted;      // guarded by PERSIST_LOCK
+
+	CachedFile(const char* name, int64_t sequence):
+		name(name),
+		size(0),
+		sequence(sequence),
+		writing(true),
+		persisted(false)
+	{
+	}
+};
+
+class NRTCachingDirectory::CachedIndexInput: public RAMInputStream {
+	CachedFile* cached;
+protected:
+	CachedIndexInput(const CachedIndexInput& other):
+		RAMInputStream(other),
+		cached(_CL_POINTER(other.cached))
+	{
+	}
+public:
+	CachedIndexInput(CachedFile* cached):
+		RAMInputStream(&cached->file),
+		cached(_CL_POINTER(cached))
+	{
+	}
+	~CachedIndexInput(){
+		_CLDECDELETE(cached);
+	}
+	IndexInput* clone() const{
+		return _CLNEW CachedIndexInput(*this);
+	}
+	const char* getDirectoryType() const{ return NRTCachingDirectory::getClassName(); }
+	const char* getObjectName() const{ return getClassName(); }
+	static const char* getClassName(){ return "CachedIndexInput"; }
+};
+
+/**
+* Writes a cached file, until it grows larger than the maximum file size.
+* The file is then removed from the cache and written to the delegate.
+*/
+class NRTCachingDirectory::CachedIndexOutput: public BufferedIndexOutput {
+	NRTCachingDirectory* dir;
+	CachedFile* cached;
+	RAMOutputStream* ram;
+	IndexOutput* out;
+	bool merge;
+
+	void spill(){
+		out = merge ? dir->delegate->createMergeOutput(cached->name.c_str())
+		            : dir->delegate->createOutput(cached->name.c_str());
+		const int64_t pos = ram->getFilePointer();
+		ram->writeTo(out);
+		if ( pos != ram->length() )
+			out->seek(pos);
+		_CLDELETE(ram);
+		dir->remove(cached);
+	}
+protected:
+	void flushBuffer(const uint8_t* b, const int32_t len){
+		if ( ram == NULL ){
+			out->writeBytes(b, len);
+			return;
+		}
+		ram->writeBytes(b, len);
+		bool tooLarge;
+		{
+			SCOPED_LOCK_MUTEX(dir->cache_LOCK)
+			const int64_t grown = ram->getFilePointer() - cached->size;
+			if ( grown > 0 ){
+				CacheType::iterator itr = dir->cache.find(cached->name);
+				if ( itr != dir->cache.end() && itr->second == cached )
+					dir->cachedBytes += grown;
+				cached->size += grown;
+			}
+			tooLarge = cached->size > dir->maxFileSize;
+		}
+		if ( tooLarge )
+			spill();
+	}
+public:
+	CachedIndexOutput(NRTCachingDirectory* dir, CachedFile* cached, bool merge):
+		dir(dir),
+		cached(_CL_POINTER(cached)),
+		ram(_CLNEW RAMOutputStream(&cached->file)),
+		out(NULL),
+		merge(merge)
+	{
+	}
+	~CachedIndexOutput(){
+		if ( cached != NULL ){
+			try{
+				CachedIndexOutput::close();
+			}catch(CLuceneError& err){
+				//ignore IO errors...
+				if ( err.number() != CL_ERR_IO )
+					throw;
+			}
+		}
+	}
+	void close(){
+		try{
+			BufferedIndexOutput::close();
+			if ( ram != NULL )
+				ram->close();
+			else
+				out->close();
+		}_CLFINALLY(
+			_CLDELETE(ram);
+			_CLDELETE(out);
+			{
+				SCOPED_LOCK_MUTEX(dir->cache_LOCK)
+				cached->writing = false;
+			}
+			_CLDECDELETE(cached);
+		)
+	}
+	void seek(const int64_t pos){
+		BufferedIndexOutput::seek(pos);
+		if ( ram != NULL )
+			ram->seek(pos);
+		else
+			out->seek(pos);
+	}
+	int64_t length() const{
+		const int64_t written = getFilePointer();
+		const int64_t len = ram != NULL ? ram->length() : out->length();
+		return len > written ? len : written;
+	}
+};
+
+
+NRTCachingDirectory::NRTCachingDirectory(Directory* delegate, double maxFileSizeMB, double maxCachedMB):
+	delegate(_CL_POINTER(delegate)),
+	maxFileSize((int64_t)(maxFileSizeMB * 1024 * 1024)),
+	maxCachedBytes((int64_t)(maxCachedMB * 1024 * 1024)),
+	cachedBytes(0),
+	cacheSequence(0)
+{
+}
+
+NRTCachingDirectory::~NRTCachingDirectory(){
+	for ( CacheType::iterator itr = cache.begin(); itr != cache.end(); itr++ ){
+		CachedFile* f = itr->second;
+		_CLDECDELETE(f);
+	}
+	cache.clear();
+	_CLDECDELETE(delegate);
+}
+
+Directory* NRTCachingDirectory::getDelegate(){
+	return delegate;
+}
+
+int64_t NRTCachingDirectory::getCachedBytes(){
+	SCOPED_LOCK_MUTEX(cache_LOCK)
+	return cachedBytes;
+}
+
+void NRTCachingDirectory::listCachedFiles(std::vector<std::string>& names){
+	SCOPED_LOCK_MUTEX(cache_LOCK)
+	for ( CacheType::iterator itr = cache.begin(); itr != cache.end(); itr++ )
+		names.push_back(itr->first);
+}
+
+bool NRTCachingDirectory::doCache(const char* name){
+	// the segments files must be found by other processes
+	return maxCachedBytes > 0 && strncmp(name, "segments", 8) != 0;
+}
+
+/** Removes the named file from the cache. The caller owns the returned reference */
+NRTCachingDirectory::CachedFile* NRTCachingDirectory::uncache(const char* name){
+	SCOPED_LOCK_MUTEX(cache_LOCK)
+	CacheType::iterator itr = cache.find(name);
+	if ( itr == cache.end() )
+		return NULL;
+	CachedFile* f = itr->second;
+	cache.erase(itr);
+	cachedBytes -= f->size;
+	return f;
+}
+
+/** Removes a file from the cache, unless its name was reused since */
+void NRTCachingDirectory::remove(CachedFile* f){
+	SCOPED_LOCK_MUTEX(cache_LOCK)
+	CacheType::iterator itr = cache.find(f->name);
+	if ( itr != cache.end() && itr->second == f ){
+		cache.erase(itr);
+		cachedBytes -= f->size;
+		_CLDECDELETE(f);
+	}
+}
+
+/** Writes a cached file to the delegate and removes it from the cache */
+void NRTCachingDirectory::evict(CachedFile* f){
+	persist(f);
+	remove(f);
+}
+
+/** Writes a cached file to the delegate, unless it was written already or
+* was deleted or replaced since the caller found it in the cache */
+void NRTCachingDirectory::persist(CachedFile* f){
+	SCOPED_LOCK_MUTEX(PERSIST_LOCK)
+	if ( f->persisted )
+		return;
+	{
+		// doDeleteFile waits for PERSIST_LOCK, so the file stays cached
+		// until it was written
+		SCOPED_LOCK_MUTEX(cache_LOCK)
+		CacheType::iterator itr = cache.find(f->name);
+		if ( itr == cache.end() || itr->second != f )
+			return;
+	}
+
+	// the file is read from the cache, so it need not stay in the delegate's cache
+	IndexOutput* out = delegate->createMergeOutput(f->name.c_str());
+	try{
+		const int64_t length = f->file.getLength();
+		int64_t pos = 0;
+		for ( int32_t i = 0; pos < length; i++ ){
+			int64_t len = f->file.getBufferLen(i);
+			if ( len > length - pos )
+				len = length - pos;
+			out->writeBytes(f->file.getBuffer(i), (int32_t)len);
+			pos += len;
+		}
+		out->close();
+	}_CLFINALLY(
+		_CLDELETE(out);
+	)
+	f->persisted = true;
+}
+
+/** Evicts the oldest files that are not being written until the cache is below its maximum */
+void NRTCachingDirectory::makeRoom(){
+	while ( true ){
+		CachedFile* victim = NULL;
+		{
+			SCOPED_LOCK_MUTEX(cache_LOCK)
+			if ( cachedBytes < maxCachedBytes )
+				return;
+			for ( CacheType::iterator itr = cache.begin(); itr != cache.end(); itr++ ){
+				CachedFile* f = itr->second;
+				if ( !f->writing && (victim == NULL || f->sequence < victim->sequence) )
+					victim = f;
+			}
+			if ( victim == NULL )
+				return;
+			victim = _CL_POINTER(victim);
+		}
+
+		try{
+			evict(victim);
+		}_CLFINALLY(
+			_CLDECDELETE(victim);
+		)
+	}
+}
+
+/** Writes the cached files that are complete to the delegate, they stay cached */
+void NRTCachingDirectory::persistFinished(){
+	std::vector<CachedFile*> files;
+	{
+		SCOPED_LOCK_MUTEX(cache_LOCK)
+		for ( CacheType::iterator itr = cache.begin(); itr != cache.end(); itr++ ){
+			if ( !itr->second->writing )
+				files.push_back(_CL_POINTER(itr->second));
+		}
+	}
+	size_t i = 0;
+	try{
+		for ( ; i < files.size(); i++ ){
+			persist(files[i]);
+			_CLDECDELETE(files[i]);
+		}
+	}catch(...){
+		for ( ; i < files.size(); i++ )
+			_CLDECDELETE(files[i]);
+		throw;
+	}
+}
+
+IndexOutput* NRTCachingDirectory::newOutput(const char* name, bool merge){
+	CachedFile* old = uncache(name);
+	_CLDECDELETE(old);
+
+	// A segments file that is written without a sync, like the checkpoints
+	// of an IndexWriter with autoCommit=true, may reference any of the
+	// cached files. They are written through first, so that the commit
+	// can be opened from the delegate.
+	if ( strncmp(name, "segments_", 9) == 0 )
+		persistFinished();
+
+	if ( doCache(name) ){
+		makeRoom();
+		CachedFile* f = NULL;
+		{
+			SCOPED_LOCK_MUTEX(cache_LOCK)
+			if ( cachedBytes < maxCachedBytes ){
+				f = _CLNEW CachedFile(name, cacheSequence++);
+				cache[name] = f;
+			}
+		}
+		if ( f != NULL ){
+			// an older version of the file must not be found in the delegate
+			if ( delegate->fileExists(name) )
+				delegate->deleteFile(name);
+			return _CLNEW CachedIndexOutput(this, f, merge);
+		}
+	}
+	return merge ? delegate->createMergeOutput(name) : delegate->createOutput(name);
+}
+
+IndexOutput* NRTCachingDirectory::createOutput(const char* name){
+	return newOutput(name, false);
+}
+
+IndexOutput* NRTCachingDirectory::createMergeOutput(const char* name){
+	return newOutput(name, true);
+}
+
+bool NRTCachingDirectory::openInput(const char* name, IndexInput*& ret, CLuceneError& error, int32_t bufferSize){
+	{
+		SCOPED_LOCK_MUTEX(cache_LOCK)
+		CacheType::iterator itr = cache.find(name);
+		if ( itr != cache.end() ){
+			ret = _CLNEW CachedIndexInput(itr->second);
+			return true;
+		}
+	}
+	return delegate->openInput(name, ret, error, bufferSize);
+}
+
+bool NRTCachingDirectory::openMergeInput(const char* name, IndexInput*& ret, CLuceneError& error, int32_t bufferSize){
+	{
+		SCOPED_LOCK_MUTEX(cache_LOCK)
+		CacheType::iterator itr = cache.find(name);
+		if ( itr != cache.end() ){
+			ret = _CLNEW CachedIndexInput(itr->second);
+			return true;
+		}
+	}
+	return delegate->openMergeInput(name, ret, error, bufferSize);
+}
+
+bool NRTCachingDirectory::list(std::vector<std::string>* names) const{
+	if ( !delegate->list(names) )
+		return false;
+	SCOPED_LOCK_MUTEX(cache_LOCK)
+	const size_t numDelegateFiles = names->size();
+	for ( CacheType::const_iterator itr = cache.begin(); itr != cache.end(); itr++ ){
+		if ( std::find(names->begin(), names->begin() + numDelegateFiles, itr->first) == names->begin() + numDelegateFiles )
+			names->push_back(itr->first);
+	}
+	return true;
+}
+
+bool NRTCachingDirectory::fileExists(const char* name) const{
+	{
+		SCOPED_LOCK_MUTEX(cache_LOCK)
+		if ( cache.find(name) != cache.end() )
+			return true;
+	}
+	return delegate->fileExists(name);
+}
+
+int64_t NRTCachingDirectory::fileModified(const char* name) const{
+	{
+		SCOPED_LOCK_MUTEX(cache_LOCK)
+		CacheType::const_iterator itr = cache.find(name);
+		if ( itr != cache.end() )
+			return itr->second->file.getLastModified();
+	}
+	return delegate->fileModified(name);
+}
+
+int64_t NRTCachingDirectory::fileLength(const char* name) const{
+	{
+		SCOPED_LOCK_MUTEX(cache_LOCK)
+		CacheType::const_iterator itr = cache.find(name);
+		if ( itr != cache.end() )
+			return itr->second->file.getLength();
+	}
+	return delegate->fileLength(name);
+}
+
+void NRTCachingDirectory::touchFile(const char* name){
+	{
+		SCOPED_LOCK_MUTEX(cache_LOCK)
+		CacheType::iterator itr = cache.find(name);
+		if ( itr != cache.end() ){
+			itr->second->file.setLastModified(Misc::currentTimeMillis());
+			return;
+		}
+	}
+	delegate->touchFile(name);
+}
+
+bool NRTCachingDirectory::doDeleteFile(const char* name){
+	// not while the file is written to the delegate, which would leave it there
+	SCOPED_LOCK_MUTEX(PERSIST_LOCK)
+	CachedFile* f = uncache(name);
+	bool deleted = f != NULL;
+	_CLDECDELETE(f);
+	if ( delegate->fileExists(name) && delegate->deleteFile(name, false) )
+		deleted = true;
+	return deleted;
+}
+
+/** Returns a reference to the named cached file, or NULL */
+NRTCachingDirectory::CachedFile* NRTCachingDirectory::getCached(const std::string& name){
+	SCOPED_LOCK_MUTEX(cache_LOCK)
+	CacheType::iterator itr = cache.find(name);
+	return itr == cache.end() ? NULL : _CL_POINTER(itr->second);
+}
+
+void NRTCachingDirectory::renameFile(const char* from, const char* to){
+	// renamed files are moved to the delegate
+	CachedFile* f = getCached(from);
+	if ( f != NULL ){
+		try{
+			evict(f);
+		}_CLFINALLY(
+			_CLDECDELETE(f);
+		)
+	}
+	f = uncache(to);
+	_CLDECDELETE(f);
+	delegate->renameFile(from, to);
+}
+
+void NRTCachingDirectory::sync(const std::vector<std::string>& names){
+	for ( size_t i = 0; i < names.size(); i++ ){
+		CachedFile* f = getCached(names[i]);
+		if ( f != NULL ){
+			try{
+				persist(f);
+			}_CLFINALLY(
+				_CLDECDELETE(f);
+			)
+		}
+	}
+	delegate->sync(names);
+}
+
+LuceneLock* NRTCachingDirectory::makeLock(const char* name){
+	return delegate->makeLock(name);
+}
+
+void NRTCachingDirectory::clearLock(const char* name){
+	delegate->clearLock(name);
+}
+
+std::string NRTCachingDirectory::getLockID(){
+	return delegate->getLockID();
+}
+
+void NRTCachingDirectory::close(){
+	std::vector<std::string> names;
+	listCachedFiles(names);
+	for ( size_t i = 0; i < names.size(); i++ ){
+		CachedFile* f = getCached(names[i]);
+		if ( f != NULL ){
+			try{
+				evict(f);
+			}_CLFINALLY(
+				_CLDECDELETE(f);
+			)
+		}
+	}
+	delegate->close();
+}
+
+std::string NRTCachingDirectory::toString() const{
+	return std::string("NRTCachingDirectory@") + delegate->toString();
+}
+
+const char* NRTCachingDirectory::getClassName(){
+	return "NRTCachingDirectory";
+}
+
+const char* NRTCachingDirectory::getObjectName() const{
+	return getClassName();
+}
+
+CL_NS_END
@@ -0,0 +1,129 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_store_NRTCachingDirectory_
+#define _lucene_store_NRTCachingDirectory_
+
+#include "Directory.h"
+#include <map>
+
+CL_NS_DEF(store)
+
+/**
+* A {@link Directory} that keeps small new files in RAM, in front of
+* another directory, usually an {@link FSDirectory}.
+*
+* <p>When an index is flushed often, most of its segments are small and are
+* merged away soon after they were written. This directory creates new
+* files in RAM as long as they stay below the maximum file size and the
+* cache holds less than the maximum cached size. A file that grows too
+* large while it is written is moved to the wrapped directory. Reads of
+* cached files are served from RAM.
+*
+* <p>A cached file is written to the wrapped directory by {@link #sync},
+* that is when the IndexWriter commits, when the cache is full and the
+* file is evicted to make room for new files, and when this directory is
+* closed. After the sync, the file stays in the cache for reading until it
+* is evicted or deleted. Files that are deleted before they were synced,
+* like most small segments that are merged away, are never written to the
+* wrapped directory at all.
+*
+* <p>The segments files are not cached, so that other processes always
+* find the segments of the last commit in the wrapped directory. Before a
+* segments file is created, the cached files that are complete are written
+* through, so that a segments file written without a sync, as with
+* autoCommit=true, never references files that are only in RAM. As the
+* IndexWriter writes a segments file whenever it flushes when autoCommit is
+* true, which is its default, every flushed file is then written to the
+* wrapped directory anyway and the cache saves nothing. Use an IndexWriter
+* with autoCommit=false with this directory. Locks are made by the wrapped
+* directory.
+*/
+class CLUCENE_EXPORT NRTCachingDirectory: public Directory {
+private:
+	class CachedFile;
+	class CachedIndexInput;
+	class CachedIndexOutput;
+	friend class NRTCachingDirectory::CachedIndexOutput;
+
+	typedef std::map<std::string, CachedFile*> CacheType;
+
+	Directory* delegate;
+	CacheType cache;
+	int64_t maxFileSize;
+	int64_t maxCachedBytes;
+	int64_t cachedBytes;
+	int64_t cacheSequence;
+
+	// guards the cache and cachedBytes
+	DEFINE_MUTABLE_MUTEX(cache_LOCK)
+	// serializes writing cached files to the delegate, taken before cache_LOCK
+	DEFINE_MUTEX(PERSIST_LOCK)
+
+	bool doCache(const char* name);
+	CachedFile* uncache(const char* name);
+	CachedFile* getCached(const std::string& name);
+	void remove(CachedFile* file);
+	void persist(CachedFile* file);
+	void persistFinished();
+	void evict(CachedFile* file);
+	void makeRoom();
+	IndexOutput* newOutput(const char* name, bool merge);
+protected:
+	bool doDeleteFile(const char* name);
+public:
+	/**
+	* @param delegate the directory that cached files are written to. It is
+	* closed when this directory is closed.
+	* @param maxFileSizeMB files that grow larger than this are not cached
+	* @param maxCachedMB new files are not cached while the cache holds more
+	*/
+	NRTCachingDirectory(Directory* delegate, double maxFileSizeMB, double maxCachedMB);
+	virtual ~NRTCachingDirectory();
+
+	/** Returns the directory that cached files are written to */
+	Directory* getDelegate();
+
+	/** Returns the number of bytes that cached files take */
+	int64_t getCachedBytes();
+
+	/** Lists the files that are in the cache */
+	void listCachedFiles(std::vector<std::string>& names);
+
+	bool list(std::vector<std::string>* names) const;
+	bool fileExists(const char* name) const;
+	int64_t fileModified(const char* name) const;
+	int64_t fileLength(const char* name) const;
+	bool openInput(const char* name, IndexInput*& ret, CLuceneError& error, int32_t bufferSize = -1);
+	bool openMergeInput(const char* name, IndexInput*& ret, CLuceneError& error, int32_t bufferSize = -1);
+	void touchFile(const char* name);
+	void renameFile(const char* from, const char* to);
+	IndexOutput* createOutput(const char* name);
+	IndexOutput* createMergeOutput(const char* name);
+
+	/**
+	* Writes the named files that are only cached to the wrapped directory,
+	* and then syncs them there.
+	*/
+	void sync(const std::vector<std::string>& names);
+
+	LuceneLock* makeLock(const char* name);
+	void clearLock(const char* name);
+	std::string getLockID();
+
+	/**
+	* Writes the files that are only cached to the wrapped directory, empties
+	* the cache and closes the wrapped directory.
+	*/
+	void close();
+
+	std::string toString() const;
+	static const char* getClassName();
+	const char* getObjectName() const;
+};
+
+CL_NS_END
+#endif
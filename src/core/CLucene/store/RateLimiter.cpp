@@ -0,0 +1,64 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "CLucene/_ApiHeader.h"
+#include "RateLimiter.h"
+#include "CLucene/util/Misc.h"
+
+CL_NS_USE(util)
+CL_NS_DEF(store)
+
+RateLimiter::RateLimiter(double mbPerSec):
+	mbPerSec(mbPerSec > 0 ? mbPerSec : 0),
+	nextMillis(0),
+	totalBytes(0),
+	totalPauseMillis(0)
+{
+}
+RateLimiter::~RateLimiter(){
+}
+
+void RateLimiter::setMbPerSec(double mbPerSec){
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+	this->mbPerSec = mbPerSec > 0 ? mbPerSec : 0;
+}
+double RateLimiter::getMbPerSec(){
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+	return mbPerSec;
+}
+
+int64_t RateLimiter::pause(int64_t bytes){
+	int64_t pauseMillis = 0;
+	{
+		SCOPED_LOCK_MUTEX(THIS_LOCK)
+		totalBytes += bytes;
+		if ( mbPerSec <= 0 )
+			return 0;
+
+		// the bytes are transferred after the bytes of the earlier calls,
+		// but time that nobody used is not saved up for later bursts
+		const double now = (double)Misc::currentTimeMillis();
+		if ( nextMillis < now )
+			nextMillis = now;
+		nextMillis += bytes * 1000.0 / (mbPerSec * 1024 * 1024);
+		pauseMillis = (int64_t)(nextMillis - now);
+		totalPauseMillis += pauseMillis;
+	}
+	if ( pauseMillis > 0 )
+		_LUCENE_SLEEP((int32_t)pauseMillis);
+	return pauseMillis;
+}
+
+int64_t RateLimiter::getTotalBytes(){
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+	return totalBytes;
+}
+int64_t RateLimiter::getTotalPauseMillis(){
+	SCOPED_LOCK_MUTEX(THIS_LOCK)
+	return totalPauseMillis;
+}
+
+CL_NS_END
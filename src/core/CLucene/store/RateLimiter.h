@@ -0,0 +1,55 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_store_RateLimiter_
+#define _lucene_store_RateLimiter_
+
+#include "CLucene/LuceneThreads.h"
+
+CL_NS_DEF(store)
+
+/**
+* Limits the rate at which streams read or write bytes. Every stream that
+* shares a RateLimiter calls {@link #pause} with the number of bytes it is
+* about to transfer, and is put to sleep for as long as it takes to keep
+* the sum of the bytes of all the streams below the limit.
+*
+* <p>The limit can be changed at any time, for example to slow merges down
+* while there are many searches and to speed them up again afterwards. It
+* applies to the bytes that are transferred after the change.
+*/
+class CLUCENE_EXPORT RateLimiter {
+private:
+	double mbPerSec;
+	double nextMillis;
+	int64_t totalBytes;
+	int64_t totalPauseMillis;
+	DEFINE_MUTEX(THIS_LOCK)
+public:
+	/** @param mbPerSec the limit in megabytes per second, 0 for no limit */
+	RateLimiter(double mbPerSec = 0);
+	~RateLimiter();
+
+	/** Sets the limit in megabytes per second, 0 for no limit */
+	void setMbPerSec(double mbPerSec);
+	/** Gets the limit in megabytes per second, 0 for no limit */
+	double getMbPerSec();
+
+	/**
+	* Sleeps until bytes more bytes can be transferred without exceeding
+	* the limit. Can be called by several threads at the same time.
+	* @return the number of milliseconds the caller slept
+	*/
+	int64_t pause(int64_t bytes);
+
+	/** The number of bytes that were passed to pause */
+	int64_t getTotalBytes();
+	/** The number of milliseconds that pause slept, summed over all threads */
+	int64_t getTotalPauseMillis();
+};
+
+CL_NS_END
+#endif
@@ -0,0 +1,60 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#ifndef _lucene_store_intl_MergeDirectory_
+#define _lucene_store_intl_MergeDirectory_
+
+#include "Directory.h"
+
+CL_NS_DEF(store)
+class RateLimiter;
+
+/**
+* The directory a merge reads and writes its files through. The files are
+* opened with {@link Directory#openMergeInput} and created with
+* {@link Directory#createMergeOutput} of the wrapped directory, and all
+* their bytes pass the RateLimiter of the IndexWriter, so that merges do not
+* take the disk and the page cache away from searches. Everything else is
+* passed on to the wrapped directory.
+*/
+class MergeDirectory: public Directory {
+private:
+	class LimitedIndexInput;
+	class LimitedIndexOutput;
+
+	Directory* dir;
+	RateLimiter* limiter;
+protected:
+	bool doDeleteFile(const char* name);
+public:
+	/** @memory limiter must remain valid until the directory is deleted */
+	MergeDirectory(Directory* dir, RateLimiter* limiter);
+	virtual ~MergeDirectory();
+
+	bool list(std::vector<std::string>* names) const;
+	bool fileExists(const char* name) const;
+	int64_t fileModified(const char* name) const;
+	int64_t fileLength(const char* name) const;
+	bool openInput(const char* name, IndexInput*& ret, CLuceneError& error, int32_t bufferSize = -1);
+	void touchFile(const char* name);
+	bool deleteFile(const char* name, const bool throwError=true);
+	void renameFile(const char* from, const char* to);
+	IndexOutput* createOutput(const char* name);
+	void sync(const std::vector<std::string>& names);
+	LuceneLock* makeLock(const char* name);
+	void clearLock(const char* name);
+	std::string getLockID();
+
+	/** Does not close the wrapped directory */
+	void close();
+
+	std::string toString() const;
+	static const char* getClassName();
+	const char* getObjectName() const;
+};
+
+CL_NS_END
+#endif
@@ -86,6 +86,21 @@ BitSet::BitSet(CL_NS(store)::Directory* d, const char* name)
 	);
 }
 	
+int32_t BitSet::readCount(CL_NS(store)::Directory* d, const char* name)
+{
+	int32_t count = 0;
+	CL_NS(store)::IndexInput* input = d->openInput( name );
+	try {
+		if (input->readInt() == -1)  // d-gaps, the size follows
+			input->readInt();
+		count = input->readInt();
+	} _CLFINALLY (
+	    input->close();
+	    _CLDELETE(input );
+	);
+	return count;
+}
+
 void BitSet::write(CL_NS(store)::Directory* d, const char* name) {
 	CL_NS(store)::IndexOutput* output = d->createOutput(name);
 	try {
@@ -48,6 +48,10 @@ public:
 	BitSet ( int32_t size );
 	BitSet(CL_NS(store)::Directory* d, const char* name);
 	void write(CL_NS(store)::Directory* d, const char* name);
+
+	/// Returns the number of one bits of the bitset in the named file,
+	///	which is read from its header, without reading the bits.
+	static int32_t readCount(CL_NS(store)::Directory* d, const char* name);
 	
 	///Destructor for the bit set
 	~BitSet();
@@ -288,6 +288,37 @@ public:
 	virtual ~FileReader();
 };
 
+/**
+* An InputStream over a file that is mapped into memory. read returns
+* pointers straight into the mapping, so the bytes of the file are never
+* copied into a buffer. Where mmap is not available the whole file is read
+* into memory when the stream is opened.
+*/
+class CLUCENE_EXPORT MMapInputStream: public BufferedInputStream {
+	class Internal;
+	Internal* _internal;
+public:
+	MMapInputStream ( const char* path );
+	virtual ~MMapInputStream ();
+	int32_t read(const signed char*& start, int32_t min, int32_t max);
+	int64_t position();
+	int64_t reset(int64_t);
+	int64_t skip(int64_t ntoskip);
+	size_t size();
+	void setMinBufSize(int32_t minbufsize);
+};
+
+/**
+* A FileReader which decodes the file from a MMapInputStream. Use this
+* for large files, which are then decoded straight from the page cache.
+*/
+class CLUCENE_EXPORT MMapFileReader: public SimpleInputStreamReader{
+public:
+	MMapFileReader(const char* path, int encoding);
+	MMapFileReader(const char* path, const char* encoding);
+	virtual ~MMapFileReader();
+};
+
 CL_NS_END
 
 #define jstreams CL_NS(util)
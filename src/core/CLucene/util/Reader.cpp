@@ -21,6 +21,9 @@
 #ifdef _CL_HAVE_DIRECT_H
 	#include <direct.h>
 #endif
+#ifdef _CL_HAVE_SYS_MMAN_H
+	#include <sys/mman.h>
+#endif
 #include <errno.h>
 
 #include "_bufferedstream.h"
@@ -269,20 +272,22 @@ void FileInputStream::setMinBufSize(int32_t minbufsize){
 }
 
 
-FileReader::FileReader(const char *path, const char *enc, int32_t buflen)
-{
-	int encoding;
+/** Converts the name of a simple encoding to its SimpleInputStreamReader constant */
+static int simpleEncoding(const char* enc){
 	if ( strcmp(enc,"ASCII")==0 )
-		encoding = ASCII;
+		return SimpleInputStreamReader::ASCII;
 #ifdef _UCS2
 	else if ( strcmp(enc,"UTF-8")==0 )
-		encoding = UTF8;
+		return SimpleInputStreamReader::UTF8;
 	else if ( strcmp(enc,"UCS-2LE")==0 )
-		encoding = UCS2_LE;
+		return SimpleInputStreamReader::UCS2_LE;
 #endif
-	else
-		_CLTHROWA(CL_ERR_IllegalArgument,"Unsupported encoding, use jstreams iconv based instead");
-	init( _CLNEW FileInputStream(path, buflen), encoding);
+	_CLTHROWA(CL_ERR_IllegalArgument,"Unsupported encoding, use jstreams iconv based instead");
+}
+
+FileReader::FileReader(const char *path, const char *enc, int32_t buflen)
+{
+	init( _CLNEW FileInputStream(path, buflen), simpleEncoding(enc));
 }
 FileReader::FileReader(const char *path, int encoding, int32_t buflen)
 {
@@ -291,80 +296,284 @@ FileReader::FileReader(const char *path, int encoding, int32_t buflen)
 FileReader::~FileReader(){
 }
 
+
+class MMapInputStream::Internal{
+public:
+	signed char* data;
+	int64_t length;
+	int64_t pos;
+	bool mapped;
+
+	Internal(const char* path):
+		data(NULL),
+		length(0),
+		pos(0),
+		mapped(false)
+	{
+		int32_t fhandle = _cl_open(path, _O_BINARY | O_RDONLY | _O_RANDOM, _S_IREAD );
+		if (fhandle < 0){
+			int err = errno;
+			if ( err == ENOENT )
+				_CLTHROWA(CL_ERR_IO, "File does not exist");
+			else if ( err == EACCES )
+				_CLTHROWA(CL_ERR_IO, "File Access denied");
+			else if ( err == EMFILE )
+				_CLTHROWA(CL_ERR_IO, "Too many open files");
+			else
+				_CLTHROWA(CL_ERR_IO, "Could not open file");
+		}
+		length = fileSize(fhandle);
+		if ( length > 0 ){
+#if defined(_CL_HAVE_FUNCTION_MMAP)
+			void* address = ::mmap(0, (size_t)length, PROT_READ, MAP_SHARED, fhandle, 0);
+			if ( address != MAP_FAILED ){
+				data = (signed char*)address;
+				mapped = true;
+			}
+#endif
+			if ( !mapped ){
+				//no mmap, read the whole file instead
+				data = _CL_NEWARRAY(signed char, (size_t)length);
+				int64_t done = 0;
+				while ( done < length ){
+					int32_t r = ::_read(fhandle, data + done, (int32_t)cl_min(length - done, (int64_t)LUCENE_INT32_MAX_SHOULDBE));
+					if ( r <= 0 ){
+						_CLDELETE_ARRAY(data);
+						::_close(fhandle);
+						_CLTHROWA(CL_ERR_IO, "Could not read from file");
+					}
+					done += r;
+				}
+			}
+		}
+		::_close(fhandle);
+	}
+	~Internal(){
+#if defined(_CL_HAVE_FUNCTION_MMAP)
+		if ( mapped ){
+			::munmap(data, (size_t)length);
+			data = NULL;
+		}
+#endif
+		if ( data != NULL )
+			_CLDELETE_ARRAY(data);
+	}
+};
+
+MMapInputStream::MMapInputStream(const char* path):
+	_internal(new Internal(path))
+{
+}
+MMapInputStream::~MMapInputStream(){
+	delete _internal;
+}
+int32_t MMapInputStream::read(const signed char*& start, int32_t min, int32_t max){
+	if ( _internal->pos >= _internal->length )
+		return -1;
+	start = _internal->data + _internal->pos;
+	int32_t r = (int32_t)cl_min((int64_t)cl_max(min,max), _internal->length - _internal->pos);
+	_internal->pos += r;
+	return r;
+}
+int64_t MMapInputStream::position(){
+	return _internal->pos;
+}
+int64_t MMapInputStream::reset(int64_t pos){
+	if ( pos >= 0 && pos <= _internal->length )
+		_internal->pos = pos;
+	return _internal->pos;
+}
+int64_t MMapInputStream::skip(int64_t ntoskip){
+	int64_t s = cl_min(ntoskip, _internal->length - _internal->pos);
+	_internal->pos += s;
+	return s;
+}
+size_t MMapInputStream::size(){
+	return (size_t)_internal->length;
+}
+void MMapInputStream::setMinBufSize(int32_t /*minbufsize*/){
+}
+
+
+MMapFileReader::MMapFileReader(const char* path, const char* enc){
+	init(_CLNEW MMapInputStream(path), simpleEncoding(enc));
+}
+MMapFileReader::MMapFileReader(const char* path, int encoding){
+	init(_CLNEW MMapInputStream(path), encoding);
+}
+MMapFileReader::~MMapFileReader(){
+}
+
+/** Returns the number of bytes of the utf8 sequence starting with c,
+* or 0 if c can't start a sequence */
+static inline int32_t utf8SequenceLength(const uint8_t c){
+	if ( c < 0x80 )
+		return 1;
+	else if ( c < 0xC2 ) //continuation byte, or overlong 2 byte sequence
+		return 0;
+	else if ( c < 0xE0 )
+		return 2;
+	else if ( c < 0xF0 )
+		return 3;
+	else if ( c < 0xF5 )
+		return 4;
+	return 0;
+}
+
+/** Decodes a multibyte utf8 sequence of len bytes, returns false if it is invalid */
+static inline bool utf8DecodeSequence(const uint8_t* p, const int32_t len, int32_t& ret){
+	int32_t c = p[0] & (0x7F >> len);
+	for ( int32_t i=1;i<len;i++ ){
+		if ( (p[i] & 0xC0) != 0x80 )
+			return false;
+		c = (c << 6) | (p[i] & 0x3F);
+	}
+	//reject overlong sequences, surrogates and characters beyond unicode
+	if ( (len == 3 && c < 0x800) || (len == 4 && (c < 0x10000 || c > 0x10FFFF)) ||
+		(c >= 0xD800 && c <= 0xDFFF) )
+		return false;
+	ret = c;
+	return true;
+}
+
+/** True if none of the 16 bytes at p has its high bit set */
+static inline bool isAsciiBlock(const uint8_t* p){
+	uint32_t w[4];
+	memcpy(w, p, sizeof(w));
+	return ((w[0] | w[1] | w[2] | w[3]) & 0x80808080) == 0;
+}
+
 class SimpleInputStreamReader::Internal{
 public:
 
+	/**
+	* Decodes the input a block at a time: the bytes returned by one read of
+	* the input are converted in a single pass, with runs of ascii widened
+	* 16 bytes at a time. A multibyte character that is split across two reads
+	* is kept in pending until the rest of it is read.
+	*/
 	class JStreamsBuffer: public BufferedReaderImpl{
 		InputStream* input;
-		char utf8buf[6]; //< buffer used for converting utf8 characters
-	protected:
-		int readChar(){
-			const signed char* buf;
-			if ( encoding == ASCII ){
-				int32_t ret = this->input->read(buf, 1, 1) ;
-				if ( ret == 1 ){
-					return buf[0];
-				}else
-					return -1;
+		uint8_t pending[4]; //< start of a character that was split across reads
+		int32_t pendingLength;
+
+		int32_t decodeAscii(const uint8_t* p, const uint8_t* end, TCHAR* out){
+			TCHAR* o = out;
+			while ( end - p >= 16 ){
+				for ( int32_t i=0;i<16;i++ )
+					o[i] = p[i];
+				p += 16;
+				o += 16;
+			}
+			while ( p < end )
+				*o++ = *p++;
+			return (int32_t)(o - out);
+		}
 
-			}else if ( encoding == UCS2_LE ){
-				int32_t ret = this->input->read(buf, 2, 2);
-				if ( ret < 0 )
+		/** @return the number of characters decoded, or -1 if the input is invalid */
+		int32_t decodeUTF8(const uint8_t* p, const uint8_t* end, TCHAR* out){
+			TCHAR* o = out;
+			int32_t c;
+			if ( pendingLength > 0 ){
+				const int32_t len = utf8SequenceLength(pending[0]);
+				while ( pendingLength < len && p < end )
+					pending[pendingLength++] = *p++;
+				if ( pendingLength < len )
+					return 0;
+				if ( !utf8DecodeSequence(pending, len, c) )
 					return -1;
-				else if ( ret == 1 ){
-					return buf[0];
-				}else{
-					uint8_t c1 = *buf;
-					uint8_t c2 = *(buf+1);
-					return c1 | (c2<<8);
+				*o++ = c;
+				pendingLength = 0;
+			}
+			while ( p < end ){
+				if ( end - p >= 16 && isAsciiBlock(p) ){
+					for ( int32_t i=0;i<16;i++ )
+						o[i] = p[i];
+					p += 16;
+					o += 16;
+					continue;
 				}
-			}else if ( encoding == UTF8 ){
-				int32_t ret = this->input->read(buf, 1, 1);
-
-				if ( ret == 1 ){
-					int len = lucene_utf8charlen(buf[0]);
-					if ( len > 1 ){
-						*utf8buf = buf[0];
-						ret = this->input->read(buf, len-1, len-1);
-					}else
-						return buf[0];
-
-					if ( ret >= 0 ){
-						if ( ret == len-1 ){
-							memcpy(utf8buf+1,buf,ret);
-							wchar_t wcbuf=0;
-							lucene_utf8towc(wcbuf, utf8buf);
-							return wcbuf;
-						}
-					}
-				}else if ( ret == -1 )
+				if ( *p < 0x80 ){
+					*o++ = *p++;
+					continue;
+				}
+				const int32_t len = utf8SequenceLength(*p);
+				if ( len == 0 )
+					return -1;
+				if ( end - p < len ){
+					//the rest of this character is in the next read
+					pendingLength = (int32_t)(end - p);
+					memcpy(pending, p, pendingLength);
+					break;
+				}
+				if ( !utf8DecodeSequence(p, len, c) )
 					return -1;
-				this->m_error = "Invalid multibyte sequence.";
-				this->m_status = CL_NS(util)::Error;
-			}else{
-				this->m_error = "Unexpected encoding";
-				this->m_status = CL_NS(util)::Error;
+				*o++ = c;
+				p += len;
+			}
+			return (int32_t)(o - out);
+		}
+
+		int32_t decodeUCS2(const uint8_t* p, const uint8_t* end, TCHAR* out){
+			TCHAR* o = out;
+			if ( pendingLength > 0 && p < end ){
+				*o++ = pending[0] | (*p++ << 8);
+				pendingLength = 0;
+			}
+			while ( end - p >= 2 ){
+				*o++ = p[0] | (p[1] << 8);
+				p += 2;
+			}
+			if ( p < end ){
+				pending[0] = *p;
+				pendingLength = 1;
 			}
-			return -1;
+			return (int32_t)(o - out);
 		}
+	protected:
 		int32_t fillBuffer(TCHAR* start, int32_t space){
 			if ( input == NULL ) return -1;
 
-			int c;
-			int32_t i;
-			for(i=0;i<space;i++){
-				c = readChar();
-				if ( c == -1 ){
-					if ( this->m_status == CL_NS(util)::Ok ){
-						if ( i == 0 )
-							return -1;
-						break;
+			//every character takes at least one byte (two for ucs2), so a read
+			//of this many bytes never decodes to more than space characters
+			const int32_t maxBytes = encoding == UCS2_LE ? space * 2 - pendingLength : space;
+			int32_t n = 0;
+			while ( n == 0 ){
+				const signed char* buf;
+				const int32_t r = input->read(buf, 1, maxBytes);
+				if ( r <= 0 ){
+					if ( pendingLength > 0 ){
+						if ( encoding == UCS2_LE ){
+							//an odd trailing byte is returned as is
+							pendingLength = 0;
+							start[0] = pending[0];
+							return 1;
+						}
+						this->m_error = "Invalid multibyte sequence.";
+						this->m_status = CL_NS(util)::Error;
 					}
 					return -1;
 				}
-				start[i] = c;
+
+				const uint8_t* p = (const uint8_t*)buf;
+				if ( encoding == ASCII )
+					n = decodeAscii(p, p + r, start);
+				else if ( encoding == UTF8 )
+					n = decodeUTF8(p, p + r, start);
+				else if ( encoding == UCS2_LE )
+					n = decodeUCS2(p, p + r, start);
+				else{
+					this->m_error = "Unexpected encoding";
+					this->m_status = CL_NS(util)::Error;
+					return -1;
+				}
+				if ( n < 0 ){
+					this->m_error = "Invalid multibyte sequence.";
+					this->m_status = CL_NS(util)::Error;
+					return -1;
+				}
 			}
-			return i;
+			return n;
 		}
 	public:
 		int encoding;
@@ -372,6 +581,7 @@ public:
 		JStreamsBuffer(InputStream* input, int encoding){
 			this->input = input;
 			this->encoding = encoding;
+			this->pendingLength = 0;
 		   setMinBufSize(1024);
 		}
 		virtual ~JStreamsBuffer(){
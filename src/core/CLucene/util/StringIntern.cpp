@@ -6,39 +6,230 @@
 ------------------------------------------------------------------------------*/
 #include "CLucene/_ApiHeader.h"
 #include "_StringIntern.h"
+#include <vector>
 CL_NS_DEF(util)
 
-typedef CL_NS(util)::CLHashMap<TCHAR*,int,CL_NS(util)::Compare::TChar,CL_NS(util)::Equals::TChar,CL_NS(util)::Deletor::tcArray, CL_NS(util)::Deletor::DummyInt32 > __wcsintrntype;
-typedef CL_NS(util)::CLHashMap<char*,int,CL_NS(util)::Compare::Char,CL_NS(util)::Equals::Char,CL_NS(util)::Deletor::acArray, CL_NS(util)::Deletor::DummyInt32 > __strintrntype;
-__wcsintrntype StringIntern_stringPool(true);
-__strintrntype StringIntern_stringaPool(true);
+#define STRINGINTERN_SHARDS 16  //must be a power of 2
+#define STRINGINTERN_SLOTS 16   //pinned strings per shard, must be a power of 2
 
-bool StringIntern_blanksinitd=false;
-__wcsintrntype::iterator StringIntern_wblank;
+/** Reads a pinned slot that may be written by another thread */
+template<typename _entry>
+inline _entry* StringIntern_loadSlot(_entry* const* slot){
+#if defined(__ATOMIC_ACQUIRE)
+	return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+#else
+	return *(_entry* const volatile*)slot;
+#endif
+}
+
+/** Publishes a fully constructed entry to readers that do not lock */
+template<typename _entry>
+inline void StringIntern_publishSlot(_entry** slot, _entry* entry){
+#if defined(__ATOMIC_RELEASE)
+	__atomic_store_n(slot, entry, __ATOMIC_RELEASE);
+#else
+	#if defined(_CL_HAVE_GCC_ATOMIC_FUNCTIONS)
+	__sync_synchronize();
+	#endif
+	*(_entry* volatile*)slot = entry;
+#endif
+}
+
+/**
+* A pool of intern'd strings, split into shards by the hash of the string so
+* that threads interning different strings do not wait for each other.
+*
+* The first strings of every shard are pinned: they live in a small open
+* addressed table whose slots are only ever filled, and they are not freed
+* before the pool is. Looking them up takes no lock and their reference
+* counts are atomic, so the few field names every Term, Field and
+* FieldInfo interns over and over never wait for a lock. Strings that do not
+* fit into the table are kept in a hash map that is guarded by the lock of
+* the shard, and are freed once they are no longer referenced.
+*/
+template<typename T, typename _Hasher, typename _Equals, typename _Deletor>
+class StringInternPool{
+	struct Entry{
+		T* str;
+		_LUCENE_ATOMIC_INT refs;
+	};
+	typedef CLHashMap<T*,int32_t,_Hasher,_Equals,_Deletor,Deletor::DummyInt32> OverflowMap;
+
+	struct Shard{
+		Entry* pinned[STRINGINTERN_SLOTS];
+		OverflowMap overflow;
+		DEFINE_MUTEX(THIS_LOCK)
+
+		Shard(): overflow(true){
+			memset(pinned, 0, sizeof(pinned));
+		}
+	};
+	Shard shards[STRINGINTERN_SHARDS];
+
+	static size_t shardOf(const size_t hash){
+		return (hash ^ (hash >> 16)) & (STRINGINTERN_SHARDS - 1);
+	}
+	static size_t slotOf(const size_t hash, const int32_t probe){
+		return ((hash >> 4) + probe) & (STRINGINTERN_SLOTS - 1);
+	}
+
+	/** Finds a pinned string without locking. Slots are filled in probe
+	* order and never emptied, so the first empty slot ends the search */
+	static Entry* findPinned(Shard& shard, const T* str, const size_t hash){
+		_Equals equals;
+		for ( int32_t i=0;i<STRINGINTERN_SLOTS;i++ ){
+			Entry* entry = StringIntern_loadSlot(&shard.pinned[slotOf(hash, i)]);
+			if ( entry == NULL )
+				break;
+			if ( equals(entry->str, str) )
+				return entry;
+		}
+		return NULL;
+	}
+
+	static void addRefs(Entry* entry, int32_t count){
+		while ( count-- > 0 )
+			_LUCENE_ATOMIC_INC(&entry->refs);
+	}
+
+	static T* duplicate(const T* str){
+		size_t len = 0;
+		while ( str[len] != 0 )
+			len++;
+		T* ret = (T*)malloc((len + 1) * sizeof(T));
+		memcpy(ret, str, (len + 1) * sizeof(T));
+		return ret;
+	}
+
+public:
+	~StringInternPool(){
+		for ( int32_t s=0;s<STRINGINTERN_SHARDS;s++ ){
+			for ( int32_t i=0;i<STRINGINTERN_SLOTS;i++ ){
+				Entry* entry = shards[s].pinned[i];
+				if ( entry != NULL ){
+					_Deletor::doDelete(entry->str);
+					delete entry;
+				}
+			}
+		}
+	}
+
+	const T* intern(const T* str, const int32_t count, const bool use_provided){
+		const size_t hash = _Hasher()(str);
+		Shard& shard = shards[shardOf(hash)];
+
+		// fast path for strings that are intern'd already
+		Entry* entry = findPinned(shard, str, hash);
+		if ( entry != NULL ){
+			addRefs(entry, count);
+			if ( use_provided && entry->str != str )
+				_Deletor::doDelete((T*)str); // delete the provided string if already exists
+			return entry->str;
+		}
+
+		SCOPED_LOCK_MUTEX(shard.THIS_LOCK)
+
+		// the string may have been pinned since we looked
+		_Equals equals;
+		Entry** freeSlot = NULL;
+		for ( int32_t i=0;i<STRINGINTERN_SLOTS;i++ ){
+			Entry** slot = &shard.pinned[slotOf(hash, i)];
+			if ( *slot == NULL ){
+				freeSlot = slot;
+				break;
+			}
+			if ( equals((*slot)->str, str) ){
+				addRefs(*slot, count);
+				if ( use_provided && (*slot)->str != str )
+					_Deletor::doDelete((T*)str);
+				return (*slot)->str;
+			}
+		}
+
+		typename OverflowMap::iterator itr = shard.overflow.find((T*)str);
+		if ( itr != shard.overflow.end() ){
+			if ( use_provided && itr->first != str )
+				_Deletor::doDelete((T*)str);
+			itr->second += count;
+			return itr->first;
+		}
+
+		T* ret = use_provided ? const_cast<T*>(str) : duplicate(str);
+		if ( freeSlot != NULL ){
+			entry = new Entry;
+			entry->str = ret;
+			_LUCENE_ATOMIC_INT_SET(entry->refs, count);
+			StringIntern_publishSlot(freeSlot, entry);
+		}else
+			shard.overflow[ret] = count;
+		return ret;
+	}
+
+	bool unintern(const T* str, const int32_t count){
+		const size_t hash = _Hasher()(str);
+		Shard& shard = shards[shardOf(hash)];
+
+		// pinned strings are kept when they are no longer referenced
+		Entry* entry = findPinned(shard, str, hash);
+		if ( entry != NULL ){
+			for ( int32_t i=0;i<count;i++ )
+				_LUCENE_ATOMIC_DEC(&entry->refs);
+			return false;
+		}
+
+		SCOPED_LOCK_MUTEX(shard.THIS_LOCK)
+		typename OverflowMap::iterator itr = shard.overflow.find((T*)str);
+		if ( itr != shard.overflow.end() ){
+			if ( itr->second == count ){
+				shard.overflow.removeitr(itr);
+				return true;
+			}else
+				itr->second -= count;
+		}
+		return false;
+	}
+
+	/** Lists the strings that are still referenced, with their reference counts */
+	void getReferenced(std::vector<std::pair<const T*,int32_t> >& ret){
+		for ( int32_t s=0;s<STRINGINTERN_SHARDS;s++ ){
+			Shard& shard = shards[s];
+			SCOPED_LOCK_MUTEX(shard.THIS_LOCK)
+			for ( int32_t i=0;i<STRINGINTERN_SLOTS;i++ ){
+				Entry* entry = shard.pinned[i];
+				if ( entry != NULL && (int32_t)_LUCENE_ATOMIC_INT_GET(entry->refs) > 0 )
+					ret.push_back(std::pair<const T*,int32_t>(entry->str, (int32_t)_LUCENE_ATOMIC_INT_GET(entry->refs)));
+			}
+			typename OverflowMap::iterator itr = shard.overflow.begin();
+			while ( itr != shard.overflow.end() ){
+				ret.push_back(std::pair<const T*,int32_t>(itr->first, itr->second));
+				++itr;
+			}
+		}
+	}
+};
+
+typedef StringInternPool<TCHAR,CL_NS(util)::Compare::TChar,CL_NS(util)::Equals::TChar,CL_NS(util)::Deletor::tcArray> __wcsintrntype;
+typedef StringInternPool<char,CL_NS(util)::Compare::Char,CL_NS(util)::Equals::Char,CL_NS(util)::Deletor::acArray> __strintrntype;
+__wcsintrntype StringIntern_stringPool;
+__strintrntype StringIntern_stringaPool;
 
-//STATIC_DEFINE_MUTEX(StringIntern_THIS_LOCK);
-DEFINE_MUTEX(StringIntern_THIS_LOCK)
-	  
 
     void CLStringIntern::_shutdown(){
     #ifdef _DEBUG
-		SCOPED_LOCK_MUTEX(StringIntern_THIS_LOCK)
-        if ( StringIntern_stringaPool.size() > 0 ){
+        std::vector<std::pair<const char*,int32_t> > astrings;
+        StringIntern_stringaPool.getReferenced(astrings);
+        if ( astrings.size() > 0 ){
             printf("WARNING: stringaPool still contains intern'd strings (refcounts):\n");
-            __strintrntype::iterator itr = StringIntern_stringaPool.begin();
-            while ( itr != StringIntern_stringaPool.end() ){
-                printf(" %s (%d)\n",(itr->first), (itr->second));
-                ++itr;
-            }
+            for ( size_t i=0;i<astrings.size();i++ )
+                printf(" %s (%d)\n",astrings[i].first, astrings[i].second);
         }
-        
-        if ( StringIntern_stringPool.size() > 0 ){
+
+        std::vector<std::pair<const TCHAR*,int32_t> > strings;
+        StringIntern_stringPool.getReferenced(strings);
+        if ( strings.size() > 0 ){
             printf("WARNING: stringPool still contains intern'd strings (refcounts):\n");
-            __wcsintrntype::iterator itr = StringIntern_stringPool.begin();
-            while ( itr != StringIntern_stringPool.end() ){
-                _tprintf(_T(" %s (%d)\n"),(itr->first), (itr->second));
-                ++itr;
-            }
+            for ( size_t i=0;i<strings.size();i++ )
+                _tprintf(_T(" %s (%d)\n"),strings[i].first, strings[i].second);
         }
     #endif
     }
@@ -49,17 +240,7 @@ DEFINE_MUTEX(StringIntern_THIS_LOCK)
 		if ( str[0] == 0 )
 			return LUCENE_BLANK_STRING;
 
-		SCOPED_LOCK_MUTEX(StringIntern_THIS_LOCK)
-
-		__wcsintrntype::iterator itr = StringIntern_stringPool.find((TCHAR*)str);
-		if ( itr==StringIntern_stringPool.end() ){
-			TCHAR* ret = STRDUP_TtoT(str);
-			StringIntern_stringPool[ret]= 1;
-			return ret;
-		}else{
-			(itr->second)++;
-			return itr->first;
-		}
+		return StringIntern_stringPool.intern(str, 1, false);
 	}
 
 	bool CLStringIntern::unintern(const TCHAR* str){
@@ -68,55 +249,24 @@ DEFINE_MUTEX(StringIntern_THIS_LOCK)
 		if ( str[0] == 0 )
 			return false; // warning: a possible memory leak, since str may be never freed!
 
-		SCOPED_LOCK_MUTEX(StringIntern_THIS_LOCK)
-
-		__wcsintrntype::iterator itr = StringIntern_stringPool.find((TCHAR*)str);
-		if ( itr != StringIntern_stringPool.end() ){
-			if ( (itr->second) == 1 ){
-				StringIntern_stringPool.removeitr(itr);
-				return true;
-			}else
-				(itr->second)--;
-		}
-		return false;
+		return StringIntern_stringPool.unintern(str, 1);
 	}
-	
+
 	const char* CLStringIntern::internA(const char* str, const int8_t count, const bool use_provided){
 		if ( str == NULL )
 			return NULL;
 		if ( str[0] == 0 )
 			return _LUCENE_BLANK_ASTRING;
 
-		SCOPED_LOCK_MUTEX(StringIntern_THIS_LOCK)
-
-		__strintrntype::iterator itr = StringIntern_stringaPool.find((char*)str);
-		if ( itr==StringIntern_stringaPool.end() ){
-			char* ret = (use_provided) ? const_cast<char*>(str) : STRDUP_AtoA(str);
-			StringIntern_stringaPool[ret] = count;
-			return ret;
-		}else{
-			if (use_provided) _CLDELETE_LCaARRAY((char*)str); // delete the provided string if already exists
-			(itr->second) = (itr->second) + count;
-			return itr->first;
-		}
+		return StringIntern_stringaPool.intern(str, count, use_provided);
 	}
-	
+
 	bool CLStringIntern::uninternA(const char* str, const int8_t count){
 		if ( str == NULL )
 			return false;
 		if ( str[0] == 0 )
 			return false; // warning: a possible memory leak, since str may be never freed!
 
-		SCOPED_LOCK_MUTEX(StringIntern_THIS_LOCK)
-
-		__strintrntype::iterator itr = StringIntern_stringaPool.find((char*)str);
-		if ( itr!=StringIntern_stringaPool.end() ){
-			if ( (itr->second) == count ){
-				StringIntern_stringaPool.removeitr(itr);
-				return true;
-			}else
-				(itr->second) = (itr->second) - count;
-		}
-		return false;
+		return StringIntern_stringaPool.unintern(str, count);
 	}
 CL_NS_END
@@ -11,6 +11,8 @@
 #include "_ThreadLocal.h"
 #include "CLucene/config/_threads.h"
 #include <assert.h>
+#include <set>
+#include <vector>
 
 CL_NS_DEF ( util )
 
@@ -18,21 +20,35 @@ CL_NS_DEF ( util )
 * The concept of ThreadLocal is that a ThreadLocal class stores specific values for each unique thread.
 * Several thread-end detection techniques are used to delete the thread data if the thread dies before the ThreadLocal class is shut.
 *
-* The class->thread data mapping is stored in the _ThreadLocal class.
-* The thread->datas mapping is in ThreadData.
+* Every _ThreadLocal owns a slot number. Every thread keeps the values of all the _ThreadLocals in a
+* ThreadLocals array, indexed by slot, which it finds through native thread local storage. So get() and
+* set() only lock when a thread stores its first value. The list of all ThreadLocals is kept so that
+* the values of a _ThreadLocal can be deleted in every thread when it is destroyed.
 */
 
+class ThreadLocals;
+static void UnregisterThreadLocals(ThreadLocals* threadLocals);
 
 //predefine for the shared code...
-#if defined(_CL_HAVE_WIN32_THREADS)
-	#define INIT_THREAD(ret) ret=true
+#if defined(_CL_DISABLE_MULTITHREADING)
+	static ThreadLocals* currentThreadLocals = NULL;
+	#define GET_THREADLOCALS() currentThreadLocals
+	#define SET_THREADLOCALS(locals) currentThreadLocals = locals
+#elif defined(_CL_HAVE_WIN32_THREADS)
+	#if defined(_MSC_VER)
+		static __declspec(thread) ThreadLocals* currentThreadLocals = NULL;
+	#else
+		static __thread ThreadLocals* currentThreadLocals = NULL;
+	#endif
+	#define GET_THREADLOCALS() currentThreadLocals
+	#define SET_THREADLOCALS(locals) currentThreadLocals = locals
     extern "C"{
 
         //todo: move this to StdHeader and make it usable by other functions...
         bool __stdcall DllMain( unsigned short hinstDLL,     // DLL module handle
                                 _cl_dword_t fdwReason,  // reason called
                                 void*)                  // reserved
-        { 
+        {
 			if ( fdwReason == 3 )
             			_ThreadLocal::UnregisterCurrentThread();
 
@@ -42,14 +58,14 @@ CL_NS_DEF ( util )
 #elif defined(_CL_HAVE_PTHREAD)
     pthread_key_t pthread_threadlocal_key;
     pthread_once_t pthread_threadlocal_key_once = PTHREAD_ONCE_INIT;
-    #define INIT_THREAD(ret) \
-	pthread_once(&pthread_threadlocal_key_once, pthread_threadlocal_make_key); \
-	if (pthread_getspecific(pthread_threadlocal_key) == NULL) { pthread_setspecific(pthread_threadlocal_key, (void*)1); } \
-	ret = true;
+	#define GET_THREADLOCALS() \
+	( pthread_once(&pthread_threadlocal_key_once, pthread_threadlocal_make_key), \
+	  (ThreadLocals*)pthread_getspecific(pthread_threadlocal_key) )
+	#define SET_THREADLOCALS(locals) pthread_setspecific(pthread_threadlocal_key, locals)
 
     //the function that is called when the thread shutsdown
-    void pthread_threadlocal_destructor(void* /*_holder*/){
-        _ThreadLocal::UnregisterCurrentThread();
+    void pthread_threadlocal_destructor(void* _holder){
+        UnregisterThreadLocals((ThreadLocals*)_holder);
     }
     //the key initialiser function
     void pthread_threadlocal_make_key()
@@ -58,61 +74,55 @@ CL_NS_DEF ( util )
     }
 #endif
 
-class _ThreadLocal;
-
 /**
-* List that holds the list of ThreadLocals that this thread has data in.
+* The values that a thread holds in the ThreadLocals, indexed by their slots.
+* Only its own thread resizes values, other threads only clear the
+* values of a _ThreadLocal that is destroyed. Both happen under THIS_LOCK.
 */
-class ThreadLocals : private std::set<_ThreadLocal*>
+class ThreadLocals
 {
 public:
+	std::vector<void*> values;
+	DEFINE_MUTEX ( THIS_LOCK )
+
 	void UnregisterThread();
-	void add(_ThreadLocal* thread);
-    void remove(_ThreadLocal* thread);
 };
 
-//map of thread<>ThreadLocals
-typedef CL_NS ( util ) ::CLMultiMap<_LUCENE_THREADID_TYPE, ThreadLocals*,
-	CL_NS ( util ) ::CLuceneThreadIdCompare,
-	CL_NS ( util ) ::Deletor::ConstNullVal<_LUCENE_THREADID_TYPE>,
-	CL_NS ( util ) ::Deletor::Object<ThreadLocals> > ThreadDataType;
-static ThreadDataType*  threadData = NULL; 
+//all threads that have ThreadLocals
+typedef std::set<ThreadLocals*> ThreadDataType;
+static ThreadDataType*  threadData = NULL;
+
+//the ThreadLocal that owns each slot, NULL for free slots
+static std::vector<_ThreadLocal*>* threadLocalSlots = NULL;
 
 #ifndef _CL_DISABLE_MULTITHREADING
 	//the lock for locking ThreadData
 	//we don't use STATIC_DEFINE_MUTEX, because then the initialization order will be undefined.
 	static _LUCENE_THREADMUTEX *threadData_LOCK = NULL;
+
+	//slightly un-usual way of initialising mutex,
+	//because otherwise our initialisation order would be undefined
+	#define LOCK_THREADDATA() \
+		if ( threadData_LOCK == NULL ) \
+			threadData_LOCK = _CLNEW _LUCENE_THREADMUTEX; \
+		SCOPED_LOCK_MUTEX ( *threadData_LOCK );
+#else
+	#define LOCK_THREADDATA()
 #endif
 
 
 class _ThreadLocal::Internal
 {
 	public:
-		typedef CL_NS ( util ) ::CLSet<_LUCENE_THREADID_TYPE, void*,
-			CL_NS ( util ) ::CLuceneThreadIdCompare,
-			CL_NS ( util ) ::Deletor::ConstNullVal<_LUCENE_THREADID_TYPE>,
-			CL_NS ( util ) ::Deletor::ConstNullVal<void*> > LocalsType;
-		LocalsType locals;
-		DEFINE_MUTEX ( locals_LOCK )
 		AbstractDeletor* _deletor;
+		size_t slot;
 
-		Internal ( AbstractDeletor* _deletor ) :
-			locals ( false,false )
+		Internal ( AbstractDeletor* _deletor )
 		{
 			this->_deletor = _deletor;
 		}
 		~Internal()
 		{
-			//remove all the thread local data for this object
-			LocalsType::iterator itr = locals.begin();
-			while ( itr != locals.end() )
-			{
-				void* val = itr->second;
-				locals.removeitr ( itr );
-				_deletor->Delete ( val );
-				itr = locals.begin();
-			}
-
 			delete _deletor;
 		}
 };
@@ -120,13 +130,21 @@ class _ThreadLocal::Internal
 _ThreadLocal::_ThreadLocal ( CL_NS ( util ) ::AbstractDeletor* _deletor ) :
 		_internal ( _CLNEW Internal ( _deletor ) )
 {
-
+	LOCK_THREADDATA()
+	if ( threadLocalSlots == NULL )
+		threadLocalSlots = _CLNEW std::vector<_ThreadLocal*>;
+
+	//reuse the first free slot, its values were cleared in all threads
+	std::vector<_ThreadLocal*>::iterator itr = std::find(threadLocalSlots->begin(), threadLocalSlots->end(), (_ThreadLocal*)NULL);
+	_internal->slot = itr - threadLocalSlots->begin();
+	if ( itr == threadLocalSlots->end() )
+		threadLocalSlots->push_back(this);
+	else
+		*itr = this;
 }
 
 _ThreadLocal::~_ThreadLocal()
 {
-	setNull();
-	UnregisterCurrentThread();
     RemoveThreadLocal( this );
 	delete _internal;
 }
@@ -134,22 +152,29 @@ _ThreadLocal::~_ThreadLocal()
 
 void* _ThreadLocal::get()
 {
-	SCOPED_LOCK_MUTEX(_internal->locals_LOCK)
-	return _internal->locals.get ( _LUCENE_CURRTHREADID );
+	ThreadLocals* threadLocals = GET_THREADLOCALS();
+	if ( threadLocals == NULL || _internal->slot >= threadLocals->values.size() )
+		return NULL;
+	return threadLocals->values[_internal->slot];
 }
 
 void _ThreadLocal::setNull()
 {
-	//just delete this thread from the locals list
-	_LUCENE_THREADID_TYPE id = _LUCENE_CURRTHREADID;
-	SCOPED_LOCK_MUTEX(_internal->locals_LOCK)
-	Internal::LocalsType::iterator itr = _internal->locals.find ( id );
-	if ( itr != _internal->locals.end() )
+	//just delete this thread's value
+	ThreadLocals* threadLocals = GET_THREADLOCALS();
+	if ( threadLocals == NULL )
+		return;
+
+	void* val = NULL;
 	{
-		void* val = itr->second;
-		_internal->locals.removeitr ( itr );
-		_internal->_deletor->Delete ( val );
+		SCOPED_LOCK_MUTEX(threadLocals->THIS_LOCK)
+		if ( _internal->slot < threadLocals->values.size() ){
+			val = threadLocals->values[_internal->slot];
+			threadLocals->values[_internal->slot] = NULL;
+		}
 	}
+	if ( val != NULL )
+		_internal->_deletor->Delete ( val );
 }
 
 void _ThreadLocal::set ( void* t )
@@ -158,109 +183,113 @@ void _ThreadLocal::set ( void* t )
 		setNull();
 		return;
 	}
-	//make sure we have a threadlocal context (for cleanup)
-	bool ret;
-	INIT_THREAD(ret);
-	assert(ret);
-
-	_LUCENE_THREADID_TYPE id = _LUCENE_CURRTHREADID;
 
-	//drop a reference to this ThreadLocal in ThreadData
-	{
-#ifndef _CL_DISABLE_MULTITHREADING
-		//slightly un-usual way of initialising mutex, 
-		//because otherwise our initialisation order would be undefined
-		if ( threadData_LOCK == NULL )
-			threadData_LOCK = _CLNEW _LUCENE_THREADMUTEX;
-		SCOPED_LOCK_MUTEX ( *threadData_LOCK );
-#endif
+	//make sure we have a threadlocal context (for cleanup)
+	ThreadLocals* threadLocals = GET_THREADLOCALS();
+	if ( threadLocals == NULL ){
+		threadLocals = _CLNEW ThreadLocals;
+		SET_THREADLOCALS(threadLocals);
 
+		LOCK_THREADDATA()
 		if ( threadData == NULL )
-			threadData = _CLNEW ThreadDataType ( false, true );
-
-		ThreadLocals* threadLocals = threadData->get(id);
-		if ( threadLocals == NULL ){
-			threadLocals = _CLNEW ThreadLocals;
-      threadData->insert( std::pair<const _LUCENE_THREADID_TYPE, ThreadLocals*>(id,threadLocals));
-		}
-		threadLocals->add(this);
+			threadData = _CLNEW ThreadDataType;
+		threadData->insert(threadLocals);
 	}
 
+	void* val = NULL;
 	{
-		SCOPED_LOCK_MUTEX(_internal->locals_LOCK)
-		Internal::LocalsType::iterator itr = _internal->locals.find ( id );
-		if ( itr != _internal->locals.end() )
-		{
-			void* val = itr->second;
-			_internal->locals.removeitr ( itr );
-			_internal->_deletor->Delete ( val );
-		}
-	
-		if ( t != NULL )
-			_internal->locals.put ( id, t );
+		SCOPED_LOCK_MUTEX(threadLocals->THIS_LOCK)
+		if ( _internal->slot >= threadLocals->values.size() )
+			threadLocals->values.resize(_internal->slot + 1, NULL);
+		val = threadLocals->values[_internal->slot];
+		threadLocals->values[_internal->slot] = t;
 	}
-
+	if ( val != NULL && val != t )
+		_internal->_deletor->Delete ( val );
 }
 
 void _ThreadLocal::UnregisterCurrentThread()
 {
 	if ( threadData == NULL )
 		return;
-	_LUCENE_THREADID_TYPE id = _LUCENE_CURRTHREADID;
-	SCOPED_LOCK_MUTEX ( *threadData_LOCK );
-
-	ThreadDataType::iterator itr = threadData->find(id);
-	if ( itr != threadData->end() ){
-		ThreadLocals* threadLocals = itr->second;
-		threadLocals->UnregisterThread();
-		threadData->removeitr(itr);
-	}
+	ThreadLocals* threadLocals = GET_THREADLOCALS();
+	if ( threadLocals == NULL )
+		return;
+	SET_THREADLOCALS(NULL);
+	UnregisterThreadLocals(threadLocals);
 }
 
-void _ThreadLocal::RemoveThreadLocal( _ThreadLocal * tl )
+/** Deletes the values of a thread that ends or asked to be unregistered */
+static void UnregisterThreadLocals(ThreadLocals* threadLocals)
 {
+	//after _shutdown, threadLocals was deleted already
 	if ( threadData == NULL )
 		return;
 
-    SCOPED_LOCK_MUTEX ( *threadData_LOCK );
+	LOCK_THREADDATA()
+	threadData->erase(threadLocals);
+	threadLocals->UnregisterThread();
+	_CLDELETE(threadLocals);
+}
+
+void _ThreadLocal::RemoveThreadLocal( _ThreadLocal * tl )
+{
+	if ( threadLocalSlots == NULL )
+		return;
 
-	ThreadDataType::iterator itr = threadData->begin();
-    for( ThreadDataType::iterator itr = threadData->begin(); itr != threadData->end(); itr++ )
-    {
-		ThreadLocals* threadLocals = itr->second;
-        threadLocals->remove( tl );
-        // Remove empty threadLocals
+	LOCK_THREADDATA()
+	const size_t slot = tl->_internal->slot;
+	if ( threadData != NULL ){
+		for( ThreadDataType::iterator itr = threadData->begin(); itr != threadData->end(); itr++ )
+		{
+			ThreadLocals* threadLocals = *itr;
+			void* val = NULL;
+			{
+				SCOPED_LOCK_MUTEX(threadLocals->THIS_LOCK)
+				if ( slot < threadLocals->values.size() ){
+					val = threadLocals->values[slot];
+					threadLocals->values[slot] = NULL;
+				}
+			}
+			if ( val != NULL )
+				tl->_internal->_deletor->Delete ( val );
+		}
 	}
+	(*threadLocalSlots)[slot] = NULL;
 }
 
 void _ThreadLocal::_shutdown()
 {
+	if ( threadData != NULL ){
+		ThreadLocals* current = GET_THREADLOCALS();
+		if ( current != NULL )
+			SET_THREADLOCALS(NULL);
+		//the values of _ThreadLocals that outlive the shutdown, like those
+		//of static analyzers, are deleted here, their slots are gone after
+		for( ThreadDataType::iterator itr = threadData->begin(); itr != threadData->end(); itr++ ){
+			(*itr)->UnregisterThread();
+			delete *itr;
+		}
+	}
+	_CLDELETE(threadData);
+	_CLDELETE(threadLocalSlots);
 #ifndef _CL_DISABLE_MULTITHREADING
 	_CLDELETE(threadData_LOCK);
 #endif
-	_CLDELETE(threadData);
 }
 
 
 
 void ThreadLocals::UnregisterThread()
 {
-	//this should only be accessed from its own thread... if this changes, then this access has to be locked.
-    for( ThreadLocals::iterator iTLocal = begin(); iTLocal != end(); iTLocal++ )
-        (*iTLocal)->setNull();
-    clear();
-}
-void ThreadLocals::add(_ThreadLocal* thread)
-{
-	//this should only be accessed from its own thread... if this changes, then this access has to be locked.
-    if( end() == find( thread ) )
-        insert( thread );
-}
-void ThreadLocals::remove(_ThreadLocal* thread)
-{    
-    ThreadLocals::iterator iTLocal = find( thread );
-    if( iTLocal != end() )
-        erase( iTLocal );
+	//the values were not cleared yet, so their _ThreadLocals still exist
+	for ( size_t slot = 0; slot < values.size(); slot++ ){
+		if ( values[slot] != NULL ){
+			void* val = values[slot];
+			values[slot] = NULL;
+			(*threadLocalSlots)[slot]->_internal->_deletor->Delete ( val );
+		}
+	}
 }
 
 CL_NS_END
@@ -16,6 +16,11 @@ CL_NS_DEF(util)
   * and furthermore allows intern'd strings to be directly
   * compared:
   * string1==string2, rather than _tcscmp(string1,string2)
+  *
+  * The pool is thread safe. It is sharded by the hash of the
+  * strings, and the strings that are intern'd first (the field
+  * names, in practice) are found and reference counted without
+  * locking. Those strings stay in the pool until shutdown.
   */
   class CLStringIntern{
   public:
@@ -43,7 +48,8 @@ CL_NS_DEF(util)
 	/** 
 	* Uninternalise the specified string. Decreases
 	* the reference count and frees the string if 
-	* reference count is zero
+	* reference count is zero, unless the string is
+	* one of the strings the pool keeps
 	* \returns true if string was destroyed, otherwise false
 	*/
 	static bool unintern(const TCHAR* str);
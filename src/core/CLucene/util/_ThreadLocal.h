@@ -8,17 +8,21 @@
 #define _lucene_util_ThreadLocal_H
 
 CL_NS_DEF ( util )
-
+class ThreadLocals;
 
 /**
 * A class which holds thread specific data. Calls to get() or set() or to the data kept in the _ThreadLocal
 * is invalid after _ThreadLocal has been destroyed.
+*
+* The data is found through native thread local storage, so get() and set() do not lock, except
+* for the first set() of a thread.
 */
-class _ThreadLocal
+class CLUCENE_EXPORT _ThreadLocal
 {
 	private:
 		class Internal;
 		Internal* _internal;
+		friend class ThreadLocals;
 	public:
 		_ThreadLocal ( CL_NS ( util ) ::AbstractDeletor* _deletor );
 		void* get();
@@ -0,0 +1,95 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CLucene/StdHeader.h"
+#include "CLucene/_clucene-config.h"
+
+#include "CLucene.h"
+#include "CLucene/index/CheckIndex.h"
+#include "CLucene/util/Misc.h"
+
+using namespace std;
+using namespace lucene::index;
+using namespace lucene::store;
+using namespace lucene::util;
+
+static void usage(){
+	printf("Usage: cl_checkindex <index> [-fix] [-threads N] [-segment X]\n\n");
+	printf("  -fix: write a new segments file that leaves out the broken segments.\n");
+	printf("        The documents of the broken segments are lost! Make a backup\n");
+	printf("        copy of the index first, and do not run this while an\n");
+	printf("        IndexWriter is open on the index.\n");
+	printf("  -threads N: check with N threads, the default is 4\n");
+	printf("  -segment X: check only segment X, can be given more than once.\n");
+	printf("        -fix can not be used with -segment.\n\n");
+	printf("Returns 0 if the index is intact, 1 if problems were found.\n");
+}
+
+int main( int32_t argc, char** argv ){
+	const char* indexPath = NULL;
+	bool doFix = false;
+	int32_t threads = 4;
+	vector<string> onlySegments;
+
+	for (int32_t i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-fix") == 0) {
+			doFix = true;
+		} else if (strcmp(argv[i], "-threads") == 0 && i + 1 < argc) {
+			threads = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "-segment") == 0 && i + 1 < argc) {
+			onlySegments.push_back(argv[++i]);
+		} else if (indexPath == NULL && argv[i][0] != '-') {
+			indexPath = argv[i];
+		} else {
+			usage();
+			return 1;
+		}
+	}
+	if (indexPath == NULL || threads < 1 || (doFix && !onlySegments.empty())) {
+		usage();
+		return 1;
+	}
+
+	int ret = 1;
+	try{
+		FSDirectory* dir = FSDirectory::getDirectory(indexPath);
+		CheckIndex checker(dir);
+		checker.setInfoStream(&cout);
+		checker.setThreadCount(threads);
+
+		uint64_t start = Misc::currentTimeMillis();
+		CheckIndex::Status* status = checker.checkIndex(onlySegments.empty() ? NULL : &onlySegments);
+		printf("Checked in %d ms\n", (int32_t)(Misc::currentTimeMillis() - start));
+
+		if (status->missingSegments) {
+			// nothing to do
+		} else if (status->clean) {
+			ret = 0;
+		} else if (doFix) {
+			checker.fixIndex(status);
+			printf("%d documents were lost\n", status->totLoseDocCount);
+		} else {
+			printf("WARNING: %d documents would be lost if -fix were specified\n", status->totLoseDocCount);
+		}
+		_CLDELETE(status);
+		dir->close();
+		_CLDECDELETE(dir);
+	}catch(CLuceneError& err){
+		printf(" caught a exception: %s\n", err.what());
+		ret = 1;
+	}catch(...){
+		printf(" caught an unknown exception\n");
+		ret = 1;
+	}
+
+	_lucene_shutdown(); //clears all static memory
+	return ret;
+}
@@ -32,12 +32,16 @@
 #cmakedefine _CL_HAVE_FUNCTION_PRINTF  1 
 #cmakedefine _CL_HAVE_FUNCTION_SNPRINTF  1 
 #cmakedefine _CL_HAVE_FUNCTION_MMAP  1 
+#cmakedefine _CL_HAVE_FUNCTION_POSIX_FADVISE 1
+#cmakedefine _CL_HAVE_FUNCTION_COPY_FILE_RANGE 1
+#cmakedefine _CL_HAVE_FUNCTION_SENDFILE 1
 #cmakedefine _CL_HAVE_FUNCTION_STRLWR 1
 #cmakedefine _CL_HAVE_FUNCTION_STRTOLL 1
 #cmakedefine _CL_HAVE_FUNCTION_STRUPR 1
 #cmakedefine _CL_HAVE_FUNCTION_GETPAGESIZE 1
 #cmakedefine _CL_HAVE_FUNCTION_USLEEP 1
 #cmakedefine _CL_HAVE_FUNCTION_SLEEP 1
+#cmakedefine _CL_HAVE_FUNCTION_FSYNC 1
 
 ${SYMBOL_CL_MAX_PATH}
 //this is the max filename... for now its just the same,
@@ -71,6 +75,7 @@ ${FUNCTION__WRITE}
 ${FUNCTION__SNPRINTF}
 ${FUNCTION__MKDIR}
 ${FUNCTION__UNLINK}
+${FUNCTION__FSYNC}
 ${FUNCTION__FTIME}
 ${FUNCTION_SLEEPFUNCTION}
 
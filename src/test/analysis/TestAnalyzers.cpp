@@ -485,6 +485,39 @@
       _CLLDELETE(reader);
   }
 
+  void testCommonGramsFilter(CuTest *tc){
+    const TCHAR* commonWords[] = { _T("the"), _T("over"), NULL };
+    StringReader reader(_T("the quick fox jumps over the lazy dog"));
+    WhitespaceTokenizer tokenizer(&reader);
+    CommonGramsFilter filter(&tokenizer, false, commonWords);
+
+    const TCHAR* expected[] = { _T("the_quick"), _T("quick"), _T("fox"), _T("jumps"),
+      _T("jumps_over"), _T("over_the"), _T("the_lazy"), _T("lazy"), _T("dog"), NULL };
+    // the position of each token in the main field
+    const int32_t expectedPositions[] = { 0, 1, 2, 3, 3, 4, 5, 6, 7 };
+
+    Token t;
+    int32_t position = -1;
+    for ( int32_t i=0; expected[i]!=NULL; i++ ){
+      CLUCENE_ASSERT(filter.next(&t) != NULL);
+      CuAssertStrEquals(tc, _T("term"), expected[i], t.termBuffer());
+      position += t.getPositionIncrement();
+      CuAssertIntEquals(tc, _T("position"), expectedPositions[i], position);
+    }
+    CLUCENE_ASSERT(filter.next(&t) == NULL);
+
+    // a gram of two words carries the offsets of both
+    StringReader reader2(_T("to be"));
+    WhitespaceTokenizer tokenizer2(&reader2);
+    const TCHAR* commonWords2[] = { _T("to"), _T("be"), NULL };
+    CommonGramsFilter filter2(&tokenizer2, false, commonWords2);
+    CLUCENE_ASSERT(filter2.next(&t) != NULL);
+    CuAssertStrEquals(tc, _T("term"), _T("to_be"), t.termBuffer());
+    CuAssertIntEquals(tc, _T("start"), 0, t.startOffset());
+    CuAssertIntEquals(tc, _T("end"), 5, t.endOffset());
+    CLUCENE_ASSERT(filter2.next(&t) == NULL);
+  }
+
 CuSuite *testanalyzers(void)
 {
 	CuSuite *suite = CuSuiteNew(_T("CLucene Analyzers Test"));
@@ -510,6 +543,7 @@ CuSuite *testanalyzers(void)
 
     SUITE_ADD_TEST(suite, testWordlistLoader);
     SUITE_ADD_TEST(suite, testEmptyStopList);
+    SUITE_ADD_TEST(suite, testCommonGramsFilter);
     
     // TODO: Remove testStandardAnalyzer and port TestStandardAnalyzer.java as a whole
 
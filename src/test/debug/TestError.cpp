@@ -5,7 +5,7 @@
 * the GNU Lesser General Public License, as specified in the COPYING file.
 ------------------------------------------------------------------------------*/
 #include "test.h"
-//#include "CLucene/util/_ThreadLocal.h"
+#include "CLucene/util/_ThreadLocal.h"
 #include "CLucene/util/Equators.h"
 
 void testError ( CuTest *tc )
@@ -33,67 +33,86 @@ void testError ( CuTest *tc )
 	}
 }
 
-/*
-typedef CL_NS(util)::ThreadLocal<char*, CL_NS(util)::Deletor::acArray> tlTest;
+// counts the thread local values that were deleted
+static int32_t threadLocalDeleted = 0;
+DEFINE_MUTEX(threadLocalDeleted_LOCK)
+class ThreadLocalCountingDeletor: public CL_NS(util)::AbstractDeletor{
+public:
+	void Delete(void* val){
+		SCOPED_LOCK_MUTEX(threadLocalDeleted_LOCK)
+		threadLocalDeleted++;
+		free(val);
+	}
+};
+
+typedef CL_NS(util)::ThreadLocal<char*, ThreadLocalCountingDeletor> tlTest;
 struct Data{
 	tlTest* tl;
 	CuTest *tc;
+	bool ok;
 };
 _LUCENE_THREAD_FUNC ( threadLocalTest, arg )
 {
 	Data* data = (Data*)arg;
-	CuTest *tc = data->tc;
 	tlTest* tl = data->tl;
 
-	char* val = tl->get();
-
-	CLUCENE_ASSERT(val == NULL);
+	//every thread starts without a value
+	if ( tl->get() != NULL )
+		data->ok = false;
 
 	tl->set(STRDUP_AtoA("test"));
 	tl->setNull();
+	if ( tl->get() != NULL )
+		data->ok = false;
 
-	val = _CL_NEWARRAY(char, 50);
-	_snprintf(val, 50, "hello from thread %d", (int)_LUCENE_CURRTHREADID);
-
+	char* val = STRDUP_AtoA("hello from thread");
 	tl->set(val);
+	if ( tl->get() != val )
+		data->ok = false;
 
-	CLUCENE_ASSERT(tl->get() != NULL);
-
-	//wait a bit until thread local deleted our data...
-	Misc::sleep(1000);
-
-	CLUCENE_ASSERT(tl->get() == NULL);
+	//the value is deleted when the thread ends
+	_LUCENE_THREAD_FUNC_RETURN(0);
 }
 void testThreadLocal ( CuTest *tc )
 {
-
 	const int threadsCount = 10;
-
-	//read using multiple threads...
 	_LUCENE_THREADID_TYPE threads[threadsCount];
 
+	threadLocalDeleted = 0;
 	Data data;
 	data.tc = tc;
+	data.ok = true;
 	data.tl = _CLNEW tlTest;
+	data.tl->set(STRDUP_AtoA("main"));
 
 	int i;
 	for ( i=0;i<threadsCount;i++ )
 		threads[i] = _LUCENE_THREAD_CREATE ( &threadLocalTest, &data );
+	for ( i=0;i<threadsCount;i++ )
+		_LUCENE_THREAD_JOIN ( threads[i] );
+	CLUCENE_ASSERT(data.ok);
+	//setNull and the ended threads deleted their values
+	CuAssertIntEquals(tc, _T("deleted values"), threadsCount * 2, threadLocalDeleted);
+	CLUCENE_ASSERT(strcmp(data.tl->get(), "main") == 0);
 
-	CL_NS ( util ) ::Misc::sleep ( 500 );
-
+	//destroying the ThreadLocal deletes the values of the live threads
 	_CLDELETE (data.tl);
+	CuAssertIntEquals(tc, _T("deleted values"), threadsCount * 2 + 1, threadLocalDeleted);
 
-	for ( i=0;i<threadsCount;i++ )
-		_LUCENE_THREAD_JOIN ( threads[i] );
+	//a new ThreadLocal does not see the values of a destroyed one
+	tlTest* tl = _CLNEW tlTest;
+	CLUCENE_ASSERT(tl->get() == NULL);
+	tl->set(STRDUP_AtoA("again"));
+	CLUCENE_ASSERT(strcmp(tl->get(), "again") == 0);
+	_CLDELETE(tl);
+	CuAssertIntEquals(tc, _T("deleted values"), threadsCount * 2 + 2, threadLocalDeleted);
 }
-*/
 CuSuite *testdebug ( void )
 {
 	CuSuite *suite = CuSuiteNew ( _T ( "CLucene Debug Test" ) );
 
 	SUITE_ADD_TEST ( suite, testError );
-	//SUITE_ADD_TEST ( suite, testThreadLocal );
+	SUITE_ADD_TEST ( suite, testThreadLocal );
 
 	return suite;
 }
@@ -9,6 +9,7 @@
 #include "CLucene/index/_SegmentHeader.h"
 #include "CLucene/index/_MultiSegmentReader.h"
 #include "CLucene/index/MultiReader.h"
+#include "CLucene/index/CheckIndex.h"
 
 typedef IndexReader* (*TestIRModifyIndex)(CuTest* tc, IndexReader* reader, int modify);
 DEFINE_MUTEX(createReaderMutex)
@@ -298,11 +299,175 @@ void testMultiReaderReopen(CuTest *tc){
   //_CLDELETE(index2B);
 }
 
+void testSkipLevelCache(CuTest* tc) {
+  // the cache keeps the newest levels that fit, evicted levels stay
+  // valid for the readers that still use them
+  SkipLevelCache cache(100);
+  SkipLevelCache::Levels* levels[3];
+  for (int32_t i = 0; i < 3; i++) {
+    levels[i] = _CLNEW SkipLevelCache::Levels(2);
+    levels[i]->dataPointer = i * 1000;
+    levels[i]->skipPointer[1] = i * 1000 + 1;
+    levels[i]->length[1] = 39;
+    levels[i]->skipPointer[0] = i * 1000 + 40;
+    levels[i]->data = _CL_NEWARRAY(uint8_t, 40);
+    memset(levels[i]->data, i, 40);
+    cache.put(i * 1000, levels[i]);
+  }
+  CuAssertIntEquals(tc, _T("cached bytes"), 80, (int32_t)cache.getBytes());
+  CLUCENE_ASSERT(cache.get(0) == NULL);
+  SkipLevelCache::Levels* cached = cache.get(2000);
+  CLUCENE_ASSERT(cached == levels[2]);
+  CuAssertIntEquals(tc, _T("level data"), 2, cached->levelData(1)[38]);
+  _CLDECDELETE(cached);
+  for (int32_t i = 0; i < 3; i++) {
+    CuAssertIntEquals(tc, _T("kept data"), i, levels[i]->levelData(1)[0]);
+    _CLDECDELETE(levels[i]);
+  }
+
+  // a term frequent enough for three skip levels, and one with two levels
+  RAMDirectory dir;
+  WhitespaceAnalyzer a;
+  IndexWriter w(&dir, &a, true);
+  w.setMaxBufferedDocs(1000);
+  for (int32_t i = 0; i < 5000; i++) {
+    Document doc;
+    doc.add(*_CLNEW Field(_T("content"), (i % 7) == 0 ? _T("all seventh") : _T("all"), Field::STORE_NO | Field::INDEX_TOKENIZED));
+    w.addDocument(&doc);
+  }
+  w.optimize();
+  w.close();
+
+  IndexReader* reader = IndexReader::open(&dir);
+  Term* all = _CLNEW Term(_T("content"), _T("all"));
+  Term* seventh = _CLNEW Term(_T("content"), _T("seventh"));
+  TermDocs* td1 = reader->termDocs();
+  TermDocs* td2 = reader->termDocs();
+
+  // the second round skips on the cached levels, interleaved with
+  // another TermDocs of the same segment
+  for (int32_t round = 0; round < 2; round++) {
+    for (int32_t target = 3; target < 5000; target += 611) {
+      td1->seek(all);
+      CLUCENE_ASSERT(td1->skipTo(target));
+      CuAssertIntEquals(tc, _T("all"), target, td1->doc());
+
+      td2->seek(seventh);
+      CLUCENE_ASSERT(td2->skipTo(target));
+      CuAssertIntEquals(tc, _T("seventh"), (target + 6) / 7 * 7, td2->doc());
+      CLUCENE_ASSERT(td2->skipTo(target + 1000) == (target + 1000 <= 4998));
+
+      CLUCENE_ASSERT(td1->skipTo(target + 2000) == (target + 2000 < 5000));
+      if (target + 2000 < 5000)
+        CuAssertIntEquals(tc, _T("all again"), target + 2000, td1->doc());
+    }
+  }
+
+  td1->close();
+  _CLDELETE(td1);
+  td2->close();
+  _CLDELETE(td2);
+  _CLDECDELETE(all);
+  _CLDECDELETE(seventh);
+  reader->close();
+  _CLDELETE(reader);
+}
+
+void testCheckIndex(CuTest* tc) {
+  // three segments of their own files, the first one with deletions
+  RAMDirectory dir;
+  WhitespaceAnalyzer a;
+  IndexWriter* w = _CLNEW IndexWriter(&dir, &a, true);
+  w->setUseCompoundFile(false);
+  w->setMaxBufferedDocs(100);
+  w->setMergeFactor(1000);
+  for (int32_t i = 0; i < 300; i++) {
+    Document doc;
+    TCHAR buf[40];
+    _sntprintf(buf, 40, _T("all id%d mod%d"), i, i % 7);
+    doc.add(*_CLNEW Field(_T("content"), buf, Field::STORE_YES | Field::INDEX_TOKENIZED | Field::TERMVECTOR_YES));
+    doc.add(*_CLNEW Field(_T("tag"), _T("x"), Field::STORE_NO | Field::INDEX_UNTOKENIZED));
+    w->addDocument(&doc);
+  }
+  w->close();
+  _CLDELETE(w);
+  IndexReader* reader = IndexReader::open(&dir);
+  reader->deleteDocument(5);
+  reader->deleteDocument(50);
+  reader->close();
+  _CLDELETE(reader);
+
+  CheckIndex checker(&dir);
+  checker.setThreadCount(3);
+  CheckIndex::Status* status = checker.checkIndex();
+  CLUCENE_ASSERT(status->clean);
+  CuAssertIntEquals(tc, _T("numSegments"), 3, status->numSegments);
+  CuAssertIntEquals(tc, _T("checked segments"), 3, (int32_t)status->segments.size());
+  const CheckIndex::SegmentStatus& first = status->segments[0];
+  CuAssertIntEquals(tc, _T("docCount"), 100, first.docCount);
+  CuAssertIntEquals(tc, _T("numDeleted"), 2, first.numDeleted);
+  CuAssertIntEquals(tc, _T("normCount"), 2, first.normCount);
+  // "all", 100 ids, 7 mods and "x"
+  CuAssertIntEquals(tc, _T("termCount"), 109, (int32_t)first.termCount);
+  CuAssertIntEquals(tc, _T("totFreq"), 98 * 4, (int32_t)first.totFreq);
+  CuAssertIntEquals(tc, _T("storedFieldCount"), 98, (int32_t)first.storedFieldCount);
+  CuAssertIntEquals(tc, _T("termVectorCount"), 98, (int32_t)first.termVectorCount);
+  // deletions, norms, postings, stored fields and term vectors
+  CuAssertIntEquals(tc, _T("parts"), 5, (int32_t)first.parts.size());
+  for (size_t i = 0; i < first.parts.size(); i++)
+    CLUCENE_ASSERT(!first.parts[i].files.empty() && first.parts[i].bytes > 0);
+  std::string frqName = status->segments[1].name + ".frq";
+  _CLDELETE(status);
+
+  // truncate the postings of the second segment
+  int64_t frqLength = dir.fileLength(frqName.c_str());
+  dir.deleteFile(frqName.c_str());
+  IndexOutput* out = dir.createOutput(frqName.c_str());
+  for (int64_t i = 0; i < frqLength / 2; i++)
+    out->writeByte(0x7f);
+  out->close();
+  _CLDELETE(out);
+
+  status = checker.checkIndex();
+  CLUCENE_ASSERT(!status->clean);
+  CuAssertIntEquals(tc, _T("numBadSegments"), 1, status->numBadSegments);
+  CuAssertIntEquals(tc, _T("totLoseDocCount"), 100, status->totLoseDocCount);
+  CLUCENE_ASSERT(status->segments[0].errors.empty());
+  CLUCENE_ASSERT(!status->segments[1].errors.empty());
+  CLUCENE_ASSERT(status->segments[2].errors.empty());
+
+  std::vector<std::string> only;
+  only.push_back(status->segments[2].name);
+  CheckIndex::Status* partial = checker.checkIndex(&only);
+  CLUCENE_ASSERT(partial->partial && partial->clean);
+  CuAssertIntEquals(tc, _T("partial segments"), 1, (int32_t)partial->segments.size());
+  try {
+    checker.fixIndex(partial);
+    CuFail(tc, _T("fixing a partial check should fail"));
+  } catch (CLuceneError& err) {
+    CuAssertIntEquals(tc, _T("error"), CL_ERR_IllegalArgument, err.number());
+  }
+  _CLDELETE(partial);
+
+  checker.fixIndex(status);
+  _CLDELETE(status);
+  reader = IndexReader::open(&dir);
+  CuAssertIntEquals(tc, _T("numDocs after fix"), 198, reader->numDocs());
+  reader->close();
+  _CLDELETE(reader);
+  status = checker.checkIndex();
+  CLUCENE_ASSERT(status->clean);
+  CuAssertIntEquals(tc, _T("numSegments after fix"), 2, status->numSegments);
+  _CLDELETE(status);
+}
+
 CuSuite *testindexreader(void)
 {
 	CuSuite *suite = CuSuiteNew(_T("CLucene IndexReader Test"));
   SUITE_ADD_TEST(suite, testIndexReaderReopen);
   SUITE_ADD_TEST(suite, testMultiReaderReopen);
+  SUITE_ADD_TEST(suite, testSkipLevelCache);
+  SUITE_ADD_TEST(suite, testCheckIndex);
 
   return suite;
 }
@@ -6,7 +6,12 @@
 ------------------------------------------------------------------------------*/
 #include "test.h"
 #include <CLucene/search/MatchAllDocsQuery.h>
+#include <CLucene/index/IndexingPipeline.h>
+#include <CLucene/index/DocValues.h>
+#include <CLucene/index/MergeScheduler.h>
+#include <CLucene/store/RateLimiter.h>
 #include <stdio.h>
+#include "IndexWriter4Test.h"
 
 //checks if a merged index finds phrases correctly
 void testIWmergePhraseSegments(CuTest *tc){
@@ -647,6 +652,773 @@ void testMergeIndex(CuTest* tc) {
   _CLLDELETE( dir );
 }
 
+void testIndexingPipeline(CuTest* tc) {
+    const int size = 500;
+    RAMDirectory* dir = _CLNEW RAMDirectory();
+    WhitespaceAnalyzer a;
+    IndexWriter* writer = _CLNEW IndexWriter(dir, &a, true);
+    writer->setMaxBufferedDocs(50);
+
+    // documents are analyzed by 3 threads and inverted by 2 threads
+    IndexingPipeline pipeline(writer, 3, 2, 8);
+    TCHAR buf[20];
+    for (int i = 0; i < size; i++) {
+        Document* doc = _CLNEW Document();
+        _i64tot(i, buf, 10);
+        doc->add(* _CLNEW Field(_T("id"), buf, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+        _tcscat(buf, (i % 2 == 0) ? _T(" even all") : _T(" odd all"));
+        doc->add(* _CLNEW Field(_T("content"), buf, Field::STORE_YES | Field::INDEX_TOKENIZED));
+        pipeline.addDocument(doc);
+    }
+    pipeline.close();
+    pipeline.close(); //no-op
+    CuAssertIntEquals(tc, _T("getNumDocsIndexed"), size, pipeline.getNumDocsIndexed());
+
+    // replace one of the documents
+    Term* t = _CLNEW Term(_T("id"), _T("7"));
+    Document* doc = _CLNEW Document();
+    doc->add(* _CLNEW Field(_T("id"), _T("7"), Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+    doc->add(* _CLNEW Field(_T("content"), _T("seven replaced"), Field::STORE_YES | Field::INDEX_TOKENIZED));
+    IndexingPipeline pipeline2(writer, 1, 1);
+    pipeline2.updateDocument(t, doc);
+    pipeline2.close();
+    _CLDECDELETE(t);
+
+    // expunge the replaced document, so that docFreq is exact
+    writer->optimize();
+    writer->close();
+    _CLLDELETE(writer);
+
+    IndexReader* reader = IndexReader::open(dir);
+    CuAssertIntEquals(tc, _T("numDocs"), size, reader->numDocs());
+
+    Term* all = _CLNEW Term(_T("content"), _T("all"));
+    Term* even = _CLNEW Term(_T("content"), _T("even"));
+    Term* replaced = _CLNEW Term(_T("content"), _T("replaced"));
+    CuAssertIntEquals(tc, _T("docFreq(all)"), size - 1, reader->docFreq(all));
+    CuAssertIntEquals(tc, _T("docFreq(even)"), size / 2, reader->docFreq(even));
+    CuAssertIntEquals(tc, _T("docFreq(replaced)"), 1, reader->docFreq(replaced));
+
+    // stored values are kept for pre-analyzed fields
+    TermDocs* td = reader->termDocs(replaced);
+    CLUCENE_ASSERT(td->next());
+    Document stored;
+    CLUCENE_ASSERT(reader->document(td->doc(), stored));
+    CuAssertStrEquals(tc, _T("stored content"), _T("seven replaced"), stored.get(_T("content")));
+    _CLLDELETE(td);
+
+    _CLDECDELETE(all);
+    _CLDECDELETE(even);
+    _CLDECDELETE(replaced);
+    reader->close();
+    _CLLDELETE(reader);
+    dir->close();
+    _CLLDELETE(dir);
+}
+
+void testDocValues(CuTest* tc) {
+    const int size = 35;
+    RAMDirectory* dir = _CLNEW RAMDirectory();
+    WhitespaceAnalyzer a;
+    IndexWriter* writer = _CLNEW IndexWriter(dir, &a, true);
+    writer->setMaxBufferedDocs(10);
+
+    // num holds values that sort in reverse id order, tag is only set on even docs
+    TCHAR buf[20];
+    for (int i = 0; i < size; i++) {
+        Document doc;
+        _i64tot(i, buf, 10);
+        doc.add(* _CLNEW Field(_T("id"), buf, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+        _i64tot((int64_t)(size - i) * 100000, buf, 10);
+        doc.add(* _CLNEW Field(_T("num"), buf, Field::STORE_NO | Field::INDEX_NO | Field::DOCVALUES_INTS));
+        if (i % 2 == 0) {
+            _sntprintf(buf, 20, _T("tag%d"), i);
+            doc.add(* _CLNEW Field(_T("tag"), buf, Field::STORE_NO | Field::INDEX_NO | Field::DOCVALUES_BYTES));
+        }
+        writer->addDocument(&doc);
+    }
+    writer->close();
+    _CLLDELETE(writer);
+
+    ValueArray<uint8_t> bytes;
+    IndexReader* reader = IndexReader::open(dir);
+    CLUCENE_ASSERT(reader->getDocValues(_T("id")) == NULL);
+    for (int pass = 0; pass < 2; pass++) {
+        const bool inRAM = pass == 0;
+        DocValues* num = reader->getDocValues(_T("num"), inRAM);
+        DocValues* tag = reader->getDocValues(_T("tag"), inRAM);
+        CLUCENE_ASSERT(num != NULL && tag != NULL);
+        CuAssertIntEquals(tc, _T("num type"), DocValues::INTS, num->getType());
+        CuAssertIntEquals(tc, _T("tag type"), DocValues::BYTES, tag->getType());
+        CuAssertIntEquals(tc, _T("num size"), size, num->size());
+        for (int i = 0; i < size; i++) {
+            CLUCENE_ASSERT(num->getInt(i) == (int64_t)(size - i) * 100000);
+            const int32_t len = tag->getBytes(i, bytes);
+            if (i % 2 == 0) {
+                char expected[20];
+                _snprintf(expected, 20, "tag%d", i);
+                CuAssertIntEquals(tc, _T("tag length"), (int32_t)strlen(expected), len);
+                CLUCENE_ASSERT(memcmp(expected, bytes.values, len) == 0);
+            } else {
+                CuAssertIntEquals(tc, _T("missing tag"), 0, len);
+            }
+        }
+    }
+    reader->close();
+    _CLLDELETE(reader);
+
+    // merge the segments, dropping a deleted document
+    writer = _CLNEW IndexWriter(dir, &a, false);
+    Term* t = _CLNEW Term(_T("id"), _T("3"));
+    writer->deleteDocuments(t);
+    _CLDECDELETE(t);
+    writer->optimize();
+    writer->close();
+    _CLLDELETE(writer);
+
+    reader = IndexReader::open(dir);
+    CuAssertIntEquals(tc, _T("maxDoc"), size - 1, reader->maxDoc());
+    DocValues* num = reader->getDocValues(_T("num"));
+    DocValues* tag = reader->getDocValues(_T("tag"));
+    CLUCENE_ASSERT(num != NULL && tag != NULL);
+    for (int i = 0; i < size - 1; i++) {
+        const int id = i < 3 ? i : i + 1;
+        CLUCENE_ASSERT(num->getInt(i) == (int64_t)(size - id) * 100000);
+        CuAssertIntEquals(tc, _T("merged tag length"), id % 2 == 0 ? (id < 10 ? 4 : 5) : 0, tag->getBytes(i, bytes));
+    }
+
+    // num is not indexed, so sorting by it reads the doc values
+    IndexSearcher searcher(reader);
+    MatchAllDocsQuery query;
+    Sort sort(_CLNEW SortField(_T("num"), SortField::INT, false));
+    Hits* hits = searcher.search(&query, &sort);
+    CuAssertIntEquals(tc, _T("hits"), size - 1, hits->length());
+    CuAssertStrEquals(tc, _T("first hit"), _T("34"), hits->doc(0).get(_T("id")));
+    CuAssertStrEquals(tc, _T("last hit"), _T("0"), hits->doc(size - 2).get(_T("id")));
+    _CLLDELETE(hits);
+
+    searcher.close();
+    reader->close();
+    _CLLDELETE(reader);
+    dir->close();
+    _CLLDELETE(dir);
+}
+
+// gives the token at position p a payload of p % 3 bytes
+class PositionPayloadFilter: public TokenFilter {
+    int32_t position;
+    ValueArray<uint8_t> data;
+public:
+    PositionPayloadFilter(TokenStream* in): TokenFilter(in, true), position(0), data(3) {}
+    Token* next(Token* t) {
+        if (input->next(t) == NULL)
+            return NULL;
+        const int32_t length = position % 3;
+        if (length > 0) {
+            memset(data.values, 'a' + position, length);
+            t->setPayload(_CLNEW Payload(data, 0, length));
+        } else
+            t->setPayload(NULL);
+        position++;
+        return t;
+    }
+};
+class PositionPayloadAnalyzer: public Analyzer {
+    TokenStream* lastStream;
+public:
+    PositionPayloadAnalyzer() { lastStream = NULL; }
+    virtual ~PositionPayloadAnalyzer() { _CLDELETE( lastStream ); }
+    TokenStream* tokenStream(const TCHAR* fieldName, Reader* reader) {
+        if (_tcscmp(fieldName, _T("payloads")) == 0)
+            return _CLNEW PositionPayloadFilter(_CLNEW WhitespaceTokenizer(reader));
+        return _CLNEW WhitespaceTokenizer(reader);
+    }
+    // the writer does not delete the streams it gets from here
+    TokenStream* reusableTokenStream(const TCHAR* fieldName, Reader* reader) {
+        _CLDELETE( lastStream );
+        lastStream = tokenStream(fieldName, reader);
+        return lastStream;
+    }
+};
+
+// checks the postings of "common" in field, which is at position 0 and 2 of
+// every document
+static void checkMergedPostings(CuTest* tc, IndexReader* reader, const TCHAR* field, bool payloads) {
+    uint8_t payload[3];
+    Term* t = _CLNEW Term(field, _T("common"));
+    TermPositions* tp = reader->termPositions(t);
+    for (int32_t d = 0; d < reader->maxDoc(); d++) {
+        CLUCENE_ASSERT(tp->next());
+        CuAssertIntEquals(tc, _T("doc"), d, tp->doc());
+        CuAssertIntEquals(tc, _T("freq"), 2, tp->freq());
+        CuAssertIntEquals(tc, _T("position"), 0, tp->nextPosition());
+        CuAssertIntEquals(tc, _T("payload length"), 0, tp->getPayloadLength());
+        CuAssertIntEquals(tc, _T("position"), 2, tp->nextPosition());
+        CuAssertIntEquals(tc, _T("payload length"), payloads ? 2 : 0, tp->getPayloadLength());
+        if (payloads) {
+            tp->getPayload(payload);
+            CLUCENE_ASSERT(payload[0] == 'c' && payload[1] == 'c');
+        }
+    }
+    CLUCENE_ASSERT(!tp->next());
+
+    // the skip data points at the right postings
+    for (int32_t target = 5; target < reader->maxDoc(); target += 37) {
+        tp->seek(t);
+        CLUCENE_ASSERT(tp->skipTo(target));
+        CuAssertIntEquals(tc, _T("skipped to"), target, tp->doc());
+        CuAssertIntEquals(tc, _T("position"), 0, tp->nextPosition());
+        CuAssertIntEquals(tc, _T("position"), 2, tp->nextPosition());
+        CuAssertIntEquals(tc, _T("payload length"), payloads ? 2 : 0, tp->getPayloadLength());
+    }
+    tp->close();
+    _CLLDELETE(tp);
+    _CLDECDELETE(t);
+}
+
+void testMergePostings(CuTest* tc) {
+    RAMDirectory dir;
+    PositionPayloadAnalyzer a;
+    IndexWriter* writer = _CLNEW IndexWriter(&dir, &a, true);
+    writer->setMaxBufferedDocs(7);
+    TCHAR buf[20];
+    const int32_t size = 300;
+    for (int32_t i = 0; i < size; i++) {
+        Document doc;
+        _sntprintf(buf, 20, _T("%d"), i);
+        doc.add(*_CLNEW Field(_T("id"), buf, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+        _sntprintf(buf, 20, _T("common w%d common"), i % 5);
+        doc.add(*_CLNEW Field(_T("payloads"), buf, Field::STORE_NO | Field::INDEX_TOKENIZED));
+        doc.add(*_CLNEW Field(_T("plain"), buf, Field::STORE_NO | Field::INDEX_TOKENIZED));
+        writer->addDocument(&doc);
+    }
+    writer->close();
+    _CLLDELETE(writer);
+
+    // merges of segments without deletions copied the postings
+    IndexReader* reader = IndexReader::open(&dir);
+    checkMergedPostings(tc, reader, _T("payloads"), true);
+    checkMergedPostings(tc, reader, _T("plain"), false);
+    reader->close();
+    _CLLDELETE(reader);
+
+    // some segments have deletions now, the others are still copied
+    writer = _CLNEW IndexWriter(&dir, &a, false);
+    Term* t = _CLNEW Term(_T("id"), _T("3"));
+    writer->deleteDocuments(t);
+    _CLDECDELETE(t);
+    writer->optimize();
+    writer->close();
+    _CLLDELETE(writer);
+
+    reader = IndexReader::open(&dir);
+    CuAssertIntEquals(tc, _T("docs"), size - 1, reader->numDocs());
+    checkMergedPostings(tc, reader, _T("payloads"), true);
+    checkMergedPostings(tc, reader, _T("plain"), false);
+    Term* w = _CLNEW Term(_T("plain"), _T("w3"));
+    CuAssertIntEquals(tc, _T("w3"), size / 5 - 1, reader->docFreq(w));
+    _CLDECDELETE(w);
+    reader->close();
+    _CLLDELETE(reader);
+    dir.close();
+}
+
+// the vectors of doc id: "vectors" has positions and offsets and is left
+// out of every third doc, "tf" only has terms and is in the even docs
+static void checkMergedVectors(CuTest* tc, IndexReader* reader) {
+    TCHAR buf[20];
+    for (int32_t d = 0; d < reader->maxDoc(); d++) {
+        if (reader->isDeleted(d))
+            continue;
+        Document doc;
+        reader->document(d, doc);
+        const int32_t id = _ttoi(doc.get(_T("id")));
+
+        TermFreqVector* vector = reader->getTermFreqVector(d, _T("vectors"));
+        if (id % 3 == 0) {
+            CLUCENE_ASSERT(vector == NULL);
+        } else {
+            CLUCENE_ASSERT(vector != NULL);
+            TermPositionVector* tpv = vector->__asTermPositionVector();
+            CLUCENE_ASSERT(tpv != NULL);
+            CuAssertIntEquals(tc, _T("vector size"), 2, tpv->size());
+            CuAssertStrEquals(tc, _T("first term"), _T("common"), (*tpv->getTerms())[0]);
+            _sntprintf(buf, 20, _T("v%d"), id % 7);
+            CuAssertStrEquals(tc, _T("second term"), buf, (*tpv->getTerms())[1]);
+            CuAssertIntEquals(tc, _T("common freq"), 2, (*tpv->getTermFrequencies())[0]);
+
+            const ArrayBase<int32_t>* positions = tpv->getTermPositions(0);
+            CuAssertIntEquals(tc, _T("positions"), 2, positions->length);
+            CuAssertIntEquals(tc, _T("position"), 0, (*positions)[0]);
+            CuAssertIntEquals(tc, _T("position"), 2, (*positions)[1]);
+            const ArrayBase<TermVectorOffsetInfo*>* offsets = tpv->getOffsets(0);
+            CuAssertIntEquals(tc, _T("offsets"), 2, offsets->length);
+            CuAssertIntEquals(tc, _T("start offset"), 10, (*offsets)[1]->getStartOffset());
+            CuAssertIntEquals(tc, _T("end offset"), 16, (*offsets)[1]->getEndOffset());
+            positions = tpv->getTermPositions(1);
+            CuAssertIntEquals(tc, _T("position"), 1, (*positions)[0]);
+            _CLLDELETE(vector);
+        }
+
+        vector = reader->getTermFreqVector(d, _T("tf"));
+        if (id % 2 != 0) {
+            CLUCENE_ASSERT(vector == NULL);
+        } else {
+            CLUCENE_ASSERT(vector != NULL);
+            CLUCENE_ASSERT(vector->__asTermPositionVector() == NULL ||
+                vector->__asTermPositionVector()->getTermPositions(0) == NULL);
+            CuAssertIntEquals(tc, _T("vector size"), 1, vector->size());
+            _sntprintf(buf, 20, _T("t%d"), id);
+            CuAssertStrEquals(tc, _T("tf term"), buf, (*vector->getTerms())[0]);
+            _CLLDELETE(vector);
+        }
+    }
+}
+
+void testMergeVectors(CuTest* tc) {
+    RAMDirectory dir;
+    WhitespaceAnalyzer a;
+    IndexWriter* writer = _CLNEW IndexWriter(&dir, &a, true);
+    writer->setMaxBufferedDocs(7);
+    TCHAR buf[20];
+    const int32_t size = 200;
+    for (int32_t i = 0; i < size; i++) {
+        Document doc;
+        _sntprintf(buf, 20, _T("%d"), i);
+        doc.add(*_CLNEW Field(_T("id"), buf, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+        if (i % 3 != 0) {
+            _sntprintf(buf, 20, _T("common v%d common"), i % 7);
+            doc.add(*_CLNEW Field(_T("vectors"), buf,
+                Field::STORE_NO | Field::INDEX_TOKENIZED | Field::TERMVECTOR_WITH_POSITIONS_OFFSETS));
+        }
+        if (i % 2 == 0) {
+            _sntprintf(buf, 20, _T("t%d"), i);
+            doc.add(*_CLNEW Field(_T("tf"), buf, Field::STORE_NO | Field::INDEX_TOKENIZED | Field::TERMVECTOR_YES));
+        }
+        writer->addDocument(&doc);
+    }
+    writer->close();
+    _CLLDELETE(writer);
+
+    // merges of segments without deletions copied the vectors
+    IndexReader* reader = IndexReader::open(&dir);
+    checkMergedVectors(tc, reader);
+    reader->close();
+    _CLLDELETE(reader);
+
+    // the runs of documents between deletions are still copied
+    writer = _CLNEW IndexWriter(&dir, &a, false);
+    for (int32_t i = 5; i < size; i += 40) {
+        _sntprintf(buf, 20, _T("%d"), i);
+        Term* t = _CLNEW Term(_T("id"), buf);
+        writer->deleteDocuments(t);
+        _CLDECDELETE(t);
+    }
+    writer->optimize();
+    writer->close();
+    _CLLDELETE(writer);
+
+    reader = IndexReader::open(&dir);
+    CuAssertIntEquals(tc, _T("docs"), size - 5, reader->numDocs());
+    CLUCENE_ASSERT(!reader->hasDeletions());
+    checkMergedVectors(tc, reader);
+    reader->close();
+    _CLLDELETE(reader);
+    dir.close();
+}
+
+// adds the same documents to dir, merging them with up to threads threads
+static void addConcurrentMergeDocs(Directory* dir, int32_t threads) {
+    PositionPayloadAnalyzer a;
+    IndexWriter* writer = _CLNEW IndexWriter(dir, &a, true);
+    writer->setMaxBufferedDocs(9);
+    ((SerialMergeScheduler*)writer->getMergeScheduler())->setMaxThreadCount(threads);
+    TCHAR buf[40];
+    TCHAR field[10];
+    const int32_t size = 250;
+    for (int32_t i = 0; i < size; i++) {
+        Document doc;
+        _sntprintf(buf, 40, _T("%d"), i);
+        doc.add(*_CLNEW Field(_T("id"), buf, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+        doc.add(*_CLNEW Field(_T("num"), buf, Field::STORE_NO | Field::INDEX_NO | Field::DOCVALUES_INTS));
+        _sntprintf(buf, 40, _T("common w%d common"), i % 5);
+        doc.add(*_CLNEW Field(_T("payloads"), buf, Field::STORE_YES | Field::INDEX_TOKENIZED));
+        doc.add(*_CLNEW Field(_T("plain"), buf,
+            Field::STORE_NO | Field::INDEX_TOKENIZED | Field::TERMVECTOR_WITH_POSITIONS_OFFSETS));
+        // fields that only some documents have
+        _sntprintf(field, 10, _T("f%d"), i % 7);
+        _sntprintf(buf, 40, _T("x%d y%d x%d"), i % 11, i % 3, i % 13);
+        doc.add(*_CLNEW Field(field, buf, Field::STORE_NO | Field::INDEX_TOKENIZED));
+        writer->addDocument(&doc);
+    }
+    for (int32_t i = 3; i < size; i += 17) {
+        _sntprintf(buf, 40, _T("%d"), i);
+        Term* t = _CLNEW Term(_T("id"), buf);
+        writer->deleteDocuments(t);
+        _CLDECDELETE(t);
+    }
+    writer->optimize();
+    writer->close();
+    _CLLDELETE(writer);
+}
+
+void testConcurrentMerge(CuTest* tc) {
+    RAMDirectory serialDir;
+    RAMDirectory concurrentDir;
+    addConcurrentMergeDocs(&serialDir, 1);
+    addConcurrentMergeDocs(&concurrentDir, 4);
+
+    // the files of the postings partitions were removed
+    vector<string> files;
+    concurrentDir.list(&files);
+    for (size_t i = 0; i < files.size(); i++)
+        CLUCENE_ASSERT(files[i].find("_p") == string::npos);
+
+    IndexReader* expected = IndexReader::open(&serialDir);
+    IndexReader* reader = IndexReader::open(&concurrentDir);
+    CuAssertIntEquals(tc, _T("maxDoc"), expected->maxDoc(), reader->maxDoc());
+    CuAssertIntEquals(tc, _T("numDocs"), expected->numDocs(), reader->numDocs());
+
+    // the same terms, with the same postings
+    TermEnum* expectedTerms = expected->terms();
+    TermEnum* terms = reader->terms();
+    int32_t numTerms = 0;
+    while (expectedTerms->next()) {
+        CLUCENE_ASSERT(terms->next());
+        CLUCENE_ASSERT(expectedTerms->term(false)->equals(terms->term(false)));
+        CuAssertIntEquals(tc, _T("docFreq"), expectedTerms->docFreq(), terms->docFreq());
+
+        TermPositions* expectedPositions = expected->termPositions(expectedTerms->term(false));
+        TermPositions* positions = reader->termPositions(terms->term(false));
+        while (expectedPositions->next()) {
+            CLUCENE_ASSERT(positions->next());
+            CuAssertIntEquals(tc, _T("doc"), expectedPositions->doc(), positions->doc());
+            CuAssertIntEquals(tc, _T("freq"), expectedPositions->freq(), positions->freq());
+            for (int32_t j = 0; j < expectedPositions->freq(); j++) {
+                CuAssertIntEquals(tc, _T("position"), expectedPositions->nextPosition(), positions->nextPosition());
+                CuAssertIntEquals(tc, _T("payload length"), expectedPositions->getPayloadLength(), positions->getPayloadLength());
+            }
+        }
+        CLUCENE_ASSERT(!positions->next());
+        _CLLDELETE(expectedPositions);
+        _CLLDELETE(positions);
+        numTerms++;
+    }
+    CLUCENE_ASSERT(!terms->next());
+    CLUCENE_ASSERT(numTerms > 50);
+    _CLLDELETE(expectedTerms);
+    _CLLDELETE(terms);
+
+    // the same stored fields, vectors, norms and doc values
+    checkMergedPostings(tc, reader, _T("payloads"), true);
+    DocValues* expectedValues = expected->getDocValues(_T("num"));
+    DocValues* values = reader->getDocValues(_T("num"));
+    CLUCENE_ASSERT(values != NULL);
+    uint8_t* expectedNorms = expected->norms(_T("f3"));
+    uint8_t* norms = reader->norms(_T("f3"));
+    for (int32_t d = 0; d < reader->maxDoc(); d++) {
+        Document expectedDoc;
+        Document doc;
+        expected->document(d, expectedDoc);
+        reader->document(d, doc);
+        CuAssertStrEquals(tc, _T("id"), expectedDoc.get(_T("id")), doc.get(_T("id")));
+        CuAssertStrEquals(tc, _T("stored"), expectedDoc.get(_T("payloads")), doc.get(_T("payloads")));
+        CuAssertIntEquals(tc, _T("doc value"), _ttoi(doc.get(_T("id"))), (int32_t)values->getInt(d));
+        CuAssertIntEquals(tc, _T("doc value"), (int32_t)expectedValues->getInt(d), (int32_t)values->getInt(d));
+        CuAssertIntEquals(tc, _T("norm"), expectedNorms[d], norms[d]);
+
+        TermFreqVector* expectedVector = expected->getTermFreqVector(d, _T("plain"));
+        TermFreqVector* vector = reader->getTermFreqVector(d, _T("plain"));
+        CuAssertIntEquals(tc, _T("vector size"), expectedVector->size(), vector->size());
+        for (int32_t j = 0; j < vector->size(); j++) {
+            CuAssertStrEquals(tc, _T("vector term"), (*expectedVector->getTerms())[j], (*vector->getTerms())[j]);
+            const ArrayBase<int32_t>* expectedTermPositions = expectedVector->__asTermPositionVector()->getTermPositions(j);
+            const ArrayBase<int32_t>* termPositions = vector->__asTermPositionVector()->getTermPositions(j);
+            CuAssertIntEquals(tc, _T("vector positions"), expectedTermPositions->length, termPositions->length);
+            for (size_t k = 0; k < termPositions->length; k++)
+                CuAssertIntEquals(tc, _T("vector position"), (*expectedTermPositions)[k], (*termPositions)[k]);
+        }
+        _CLLDELETE(expectedVector);
+        _CLLDELETE(vector);
+    }
+
+    reader->close();
+    _CLLDELETE(reader);
+    expected->close();
+    _CLLDELETE(expected);
+}
+
+/** Records the files that are synced */
+class SyncRecordingDirectory: public RAMDirectory {
+public:
+    vector<string> synced;
+    int32_t delay;
+    DEFINE_MUTEX(SYNC_LOCK)
+
+    SyncRecordingDirectory(): delay(0) {}
+    void sync(const vector<string>& names) {
+        if (delay > 0 && !names.empty())
+            _LUCENE_SLEEP(delay);
+        SCOPED_LOCK_MUTEX(SYNC_LOCK)
+        synced.insert(synced.end(), names.begin(), names.end());
+    }
+    int32_t countSynced(const char* prefix) {
+        int32_t count = 0;
+        for (size_t i = 0; i < synced.size(); i++)
+            if (synced[i].compare(0, strlen(prefix), prefix) == 0)
+                count++;
+        return count;
+    }
+};
+
+static void addCommitDocs(IndexWriter* writer, int32_t count) {
+    for (int32_t i = 0; i < count; i++) {
+        Document doc;
+        doc.add(*_CLNEW Field(_T("content"), _T("aaa bbb"), Field::STORE_YES | Field::INDEX_TOKENIZED));
+        writer->addDocument(&doc);
+    }
+}
+
+static int32_t committedDocs(Directory* dir) {
+    IndexReader* reader = IndexReader::open(dir);
+    int32_t ret = reader->numDocs();
+    reader->close();
+    _CLLDELETE(reader);
+    return ret;
+}
+
+void testCommitSync(CuTest* tc) {
+    SyncRecordingDirectory dir;
+    WhitespaceAnalyzer a;
+    IndexWriter writer(&dir, false, &a, true);
+    writer.setMaxBufferedDocs(10);
+    addCommitDocs(&writer, 25);
+    CuAssertIntEquals(tc, _T("docs before commit"), 0, committedDocs(&dir));
+    writer.commit();
+    CuAssertIntEquals(tc, _T("docs after commit"), 25, committedDocs(&dir));
+
+    // the files of the commit were synced before its segments file
+    CuAssertIntEquals(tc, _T("segments files"), 2, dir.countSynced("segments_"));
+    CLUCENE_ASSERT(dir.synced.size() > 2);
+    CLUCENE_ASSERT(dir.synced.back().compare(0, 9, "segments_") == 0);
+    for (size_t i = 1; i + 1 < dir.synced.size(); i++)
+        CLUCENE_ASSERT(dir.fileExists(dir.synced[i].c_str()));
+
+    // only the new files are synced by the next commit
+    addCommitDocs(&writer, 5);
+    writer.commit();
+    CuAssertIntEquals(tc, _T("docs after second commit"), 30, committedDocs(&dir));
+    for (size_t i = 0; i < dir.synced.size(); i++)
+        for (size_t j = i + 1; j < dir.synced.size(); j++)
+            CLUCENE_ASSERT(dir.synced[i] != dir.synced[j]);
+
+    // a commit without changes does not write a segments file
+    const size_t numSynced = dir.synced.size();
+    writer.commit();
+    CuAssertIntEquals(tc, _T("synced files"), (int32_t)numSynced, (int32_t)dir.synced.size());
+
+    writer.close();
+}
+
+#ifndef _CL_DISABLE_MULTITHREADING
+struct GroupCommitArgs {
+    IndexWriter* writer;
+    CLuceneError* error;
+};
+
+_LUCENE_THREAD_FUNC(groupCommitThread, _args) {
+    GroupCommitArgs* args = (GroupCommitArgs*)_args;
+    try {
+        for (int32_t i = 0; i < 5; i++) {
+            addCommitDocs(args->writer, 1);
+            args->writer->commit();
+        }
+    } catch (CLuceneError& err) {
+        args->error = _CLNEW CLuceneError(err);
+    }
+    _LUCENE_THREAD_FUNC_RETURN(0);
+}
+
+void testGroupCommit(CuTest* tc) {
+    SyncRecordingDirectory dir;
+    dir.delay = 20;
+    WhitespaceAnalyzer a;
+    IndexWriter writer(&dir, false, &a, true);
+    writer.setMaxBufferedDocs(100);
+    const int32_t numSegmentsFiles = dir.countSynced("segments_");
+
+    const int32_t numThreads = 4;
+    GroupCommitArgs args[numThreads];
+    _LUCENE_THREADID_TYPE threads[numThreads];
+    for (int32_t i = 0; i < numThreads; i++) {
+        args[i].writer = &writer;
+        args[i].error = NULL;
+        threads[i] = _LUCENE_THREAD_CREATE(&groupCommitThread, &args[i]);
+    }
+    for (int32_t i = 0; i < numThreads; i++) {
+        _LUCENE_THREAD_JOIN(threads[i]);
+        if (args[i].error != NULL) {
+            CuFail(tc, *args[i].error);
+            _CLDELETE(args[i].error);
+        }
+    }
+
+    // every commit returned after its documents were committed, and the
+    // commits that waited for a sync were grouped
+    CuAssertIntEquals(tc, _T("committed docs"), 20, committedDocs(&dir));
+    const int32_t commits = dir.countSynced("segments_") - numSegmentsFiles;
+    CLUCENE_ASSERT(commits > 0);
+    CLUCENE_ASSERT(commits < 20);
+    writer.close();
+}
+#endif
+
+void testMergeRateLimit(CuTest* tc) {
+    // a limiter shares its rate between the callers, and does not save up
+    // the time nobody used
+    RateLimiter limiter(1);
+    CuAssertIntEquals(tc, _T("unlimited pause"), 0, (int32_t)RateLimiter().pause(1024 * 1024));
+    limiter.pause(50 * 1024);
+    limiter.pause(50 * 1024);
+    CLUCENE_ASSERT(limiter.getTotalPauseMillis() >= 40);
+    CuAssertIntEquals(tc, _T("limited bytes"), 100 * 1024, (int32_t)limiter.getTotalBytes());
+
+    RAMDirectory dir;
+    WhitespaceAnalyzer a;
+    IndexWriter writer(&dir, &a, true);
+    writer.setMaxBufferedDocs(10);
+    addCommitDocs(&writer, 50);
+    RateLimiter* mergeLimiter = writer.getMergeRateLimiter();
+    CLUCENE_ASSERT(mergeLimiter->getMbPerSec() == 0);
+    CuAssertIntEquals(tc, _T("unlimited merge pauses"), 0, (int32_t)mergeLimiter->getTotalPauseMillis());
+
+    // the merge reads and writes every byte through the limiter
+    mergeLimiter->setMbPerSec(0.05);
+    const int64_t bytesBefore = mergeLimiter->getTotalBytes();
+    writer.optimize();
+    CLUCENE_ASSERT(mergeLimiter->getTotalBytes() > bytesBefore);
+    CLUCENE_ASSERT(mergeLimiter->getTotalPauseMillis() > 0);
+    writer.close();
+
+    IndexReader* reader = IndexReader::open(&dir);
+    CuAssertIntEquals(tc, _T("merged docs"), 50, reader->numDocs());
+    Term* t = _CLNEW Term(_T("content"), _T("bbb"));
+    CuAssertIntEquals(tc, _T("doc freq"), 50, reader->docFreq(t));
+    _CLDECDELETE(t);
+    reader->close();
+    _CLLDELETE(reader);
+}
+
+static void addIdDocs(IndexWriter* writer, int32_t start, int32_t count) {
+    TCHAR id[20];
+    for (int32_t i = start; i < start + count; i++) {
+        _i64tot(i, id, 10);
+        Document doc;
+        doc.add(*_CLNEW Field(_T("id"), id, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+        doc.add(*_CLNEW Field(_T("content"), _T("aaa bbb"), Field::STORE_YES | Field::INDEX_TOKENIZED));
+        writer->addDocument(&doc);
+    }
+}
+
+static void deleteIdDocs(IndexWriter* writer, int32_t start, int32_t count, int32_t step) {
+    TCHAR id[20];
+    for (int32_t i = start; i < start + count; i += step) {
+        _i64tot(i, id, 10);
+        Term* t = _CLNEW Term(_T("id"), id);
+        writer->deleteDocuments(t);
+        _CLDECDELETE(t);
+    }
+}
+
+void testTieredMergePolicy(CuTest* tc) {
+    TieredMergePolicy tmp;
+    try {
+        tmp.setSegmentsPerTier(1);
+        CuFail(tc, _T("segmentsPerTier < 2 was accepted"));
+    } catch (CLuceneError& err) {
+        CuAssertIntEquals(tc, _T("error"), CL_ERR_IllegalArgument, err.number());
+    }
+
+    RAMDirectory dir;
+    WhitespaceAnalyzer a;
+    IndexWriter4Test writer(&dir, &a, true);
+    TieredMergePolicy* policy = _CLNEW TieredMergePolicy();
+    policy->setMaxMergeAtOnce(3);
+    policy->setSegmentsPerTier(3);
+    writer.setMergePolicy(policy);
+    writer.setMaxBufferedDocs(10);
+
+    // many small flushes are merged into a few tiers
+    for (int32_t i = 0; i < 30; i++) {
+        addIdDocs(&writer, i * 10, 10);
+        writer.flush();
+        CLUCENE_ASSERT(writer.getSegmentCount() <= 10);
+    }
+    CuAssertIntEquals(tc, _T("docs"), 300, writer.docCount());
+
+    // optimize merges everything into a single segment
+    writer.optimize();
+    CuAssertIntEquals(tc, _T("optimized segments"), 1, writer.getSegmentCount());
+    writer.close();
+    CuAssertIntEquals(tc, _T("committed docs"), 300, committedDocs(&dir));
+}
+
+void testExpungeDeletes(CuTest* tc) {
+    RAMDirectory dir;
+    WhitespaceAnalyzer a;
+
+    const char* policies[] = { "LogDocMergePolicy", "TieredMergePolicy" };
+    for (int32_t p = 0; p < 2; p++) {
+        IndexWriter4Test writer(&dir, &a, true);
+        if (p == 0) {
+            LogDocMergePolicy* policy = _CLNEW LogDocMergePolicy();
+            policy->setMergeFactor(100);
+            writer.setMergePolicy(policy);
+        } else
+            writer.setMergePolicy(_CLNEW TieredMergePolicy());
+        CLUCENE_ASSERT(strcmp(policies[p], writer.getMergePolicy()->getObjectName()) == 0);
+        writer.setMaxBufferedDocs(10);
+        for (int32_t i = 0; i < 5; i++) {
+            addIdDocs(&writer, i * 10, 10);
+            writer.flush();
+        }
+        // deletes in the first, third and last segment only
+        deleteIdDocs(&writer, 0, 10, 2);
+        deleteIdDocs(&writer, 20, 10, 3);
+        deleteIdDocs(&writer, 40, 5, 1);
+        writer.commit();
+        CuAssertIntEquals(tc, _T("deletes of last segment"), 5, writer.numDeletedDocs(writer.newestSegment()));
+        // the cached count is read again for the new deletions generation
+        deleteIdDocs(&writer, 45, 5, 1);
+        writer.commit();
+        CuAssertIntEquals(tc, _T("more deletes of last segment"), 10, writer.numDeletedDocs(writer.newestSegment()));
+        CuAssertIntEquals(tc, _T("segments"), 5, writer.getSegmentCount());
+
+        IndexReader* reader = IndexReader::open(&dir);
+        CuAssertIntEquals(tc, _T("maxDoc before"), 50, reader->maxDoc());
+        CuAssertIntEquals(tc, _T("numDocs before"), 31, reader->numDocs());
+        reader->close();
+        _CLLDELETE(reader);
+
+        // the segments without deletes are left alone: the log policy
+        // rewrites the three segments with deletes one by one, the tiered
+        // policy merges them together
+        writer.expungeDeletes();
+        CuAssertIntEquals(tc, _T("segments after"), p == 0 ? 5 : 3, writer.getSegmentCount());
+        writer.close();
+
+        reader = IndexReader::open(&dir);
+        CuAssertIntEquals(tc, _T("maxDoc after"), 31, reader->maxDoc());
+        CuAssertIntEquals(tc, _T("numDocs after"), 31, reader->numDocs());
+        CLUCENE_ASSERT(!reader->hasDeletions());
+        Term* t = _CLNEW Term(_T("id"), _T("13"));
+        CuAssertIntEquals(tc, _T("kept doc"), 1, reader->docFreq(t));
+        _CLDECDELETE(t);
+        reader->close();
+        _CLLDELETE(reader);
+    }
+}
+
 CuSuite *testindexwriter(void)
 {
     CuSuite *suite = CuSuiteNew(_T("CLucene IndexWriter Test"));
@@ -664,6 +1436,18 @@ CuSuite *testindexwriter(void)
     SUITE_ADD_TEST(suite, testExceptionFromTokenStream);
     SUITE_ADD_TEST(suite, testDeleteDocument);
     SUITE_ADD_TEST(suite, testMergeIndex);
+    SUITE_ADD_TEST(suite, testIndexingPipeline);
+    SUITE_ADD_TEST(suite, testDocValues);
+    SUITE_ADD_TEST(suite, testMergePostings);
+    SUITE_ADD_TEST(suite, testMergeVectors);
+    SUITE_ADD_TEST(suite, testConcurrentMerge);
+    SUITE_ADD_TEST(suite, testCommitSync);
+#ifndef _CL_DISABLE_MULTITHREADING
+    SUITE_ADD_TEST(suite, testGroupCommit);
+#endif
+    SUITE_ADD_TEST(suite, testMergeRateLimit);
+    SUITE_ADD_TEST(suite, testTieredMergePolicy);
+    SUITE_ADD_TEST(suite, testExpungeDeletes);
 
     return suite;
 }
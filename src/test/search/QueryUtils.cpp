@@ -263,6 +263,7 @@ void QueryUtils::check( CuTest* tc, Query * q1, Searcher * s )
             IndexSearcher * is = (IndexSearcher*) s;
             checkFirstSkipTo( tc, q1, is );
             checkSkipTo( tc, q1, is );
+            checkBatch( tc, q1, is );
         }
      
         checkExplanations( tc, q1, s );
@@ -345,6 +346,55 @@ void QueryUtils::checkSkipTo( CuTest* tc, Query * q, IndexSearcher * s )
     }
 }
     
+void QueryUtils::checkBatch( CuTest* tc, Query * q, IndexSearcher * s )
+{
+    if( BooleanQuery::getAllowDocsOutOfOrder())
+        return;  // in this case the order of the docs might differ
+
+    // the expected matches, using next() and score()
+    std::vector<int32_t> expectedDocs;
+    std::vector<float_t> expectedScores;
+    Weight * w = q->weight( s );
+    Scorer * scorer = w->scorer( s->getReader() );
+    while( scorer->next() )
+    {
+        expectedDocs.push_back( scorer->doc() );
+        expectedScores.push_back( scorer->score() );
+    }
+    _CLLDELETE( scorer );
+    _CLLDELETE( w );
+
+    int32_t sizes[] = { 1, 3, 32, 100 };
+    int32_t docs[ 100 ];
+    float_t scores[ 100 ];
+
+    for( size_t k = 0; k < sizeof( sizes ) / sizeof( sizes[ 0 ] ); k++ )
+    {
+        w = q->weight( s );
+        scorer = w->scorer( s->getReader() );
+
+        size_t count = 0;
+        int32_t n = sizes[ k ];
+        while( n == sizes[ k ] && ( n = scorer->nextBatch( docs, scores, sizes[ k ] )) > 0 )
+        {
+            assertTrue( n <= sizes[ k ] );
+            for( int32_t i = 0; i < n; i++, count++ )
+            {
+                assertTrue( count < expectedDocs.size() );
+                assertEquals( expectedDocs[ count ], docs[ i ] );
+                float_t sd = expectedScores[ count ] - scores[ i ];
+                assertTrue( ( sd < 0 ? sd * -1 : sd ) <= maxDiff );
+            }
+            if( n == sizes[ k ] )
+                assertEquals( docs[ n - 1 ], scorer->doc() );
+        }
+        assertTrue( count == expectedDocs.size() );
+
+        _CLLDELETE( scorer );
+        _CLLDELETE( w );
+    }
+}
+
 void QueryUtils::checkFirstSkipTo( CuTest* tc, Query * q, IndexSearcher * s )
 {
     int32_t lastDoc[] = {-1};
@@ -41,6 +41,11 @@ public:
      */
     static void checkSkipTo( CuTest* tc, Query * q, IndexSearcher * s );
 
+    /** check that Scorer::nextBatch returns the same docs and scores as
+     * next() and score(), for several batch sizes
+     */
+    static void checkBatch( CuTest* tc, Query * q, IndexSearcher * s );
+
 private:
     /** check that the query weight is serializable. 
      * @throws IOException if serialization check fail. 
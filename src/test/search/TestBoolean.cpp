@@ -9,6 +9,7 @@
 #include "CLucene/search/Similarity.h"
 #include "MockScorer.h"
 #include "MockHitCollector.h"
+#include "QueryUtils.h"
 
 /// TestBooleanQuery.java, ported 5/9/2009
 void testEquality(CuTest *tc) {
@@ -216,6 +217,82 @@ void testBooleanScorer2WithSubScorers(CuTest* tc) {
 
 }
 
+void testConjunctionScorerCost(CuTest* tc) {
+    RAMDirectory directory;
+    WhitespaceAnalyzer a;
+    IndexWriter* writer = _CLNEW IndexWriter(&directory, &a, true);
+    int32_t expected = 0;
+    for (int32_t i = 0; i < 500; i++) {
+        Document doc;
+        StringBuffer text(_T("common"));
+        if (i % 50 == 7)
+            text.append(_T(" rare"));
+        if (i % 3 == 1)
+            text.append(_T(" mid"));
+        if (i % 50 == 7 && i % 3 == 1)
+            expected++;
+        doc.add(*_CLNEW Field(_T("field"), text.getBuffer(), Field::STORE_NO | Field::INDEX_TOKENIZED));
+        writer->addDocument(&doc);
+    }
+    writer->close();
+    _CLLDELETE(writer);
+
+    IndexReader* reader = IndexReader::open(&directory);
+    IndexSearcher searcher(reader);
+
+    // the clauses are added from the most to the least common term
+    const TCHAR* terms[] = { _T("common"), _T("mid"), _T("rare") };
+    BooleanQuery query;
+    for (int32_t i = 0; i < 3; i++) {
+        Term* t = _CLNEW Term(_T("field"), terms[i]);
+        query.add(_CLNEW TermQuery(t), true, BooleanClause::MUST);
+        _CLDECDELETE(t);
+    }
+
+    Hits* hits = searcher.search(&query);
+    CuAssertIntEquals(tc, _T("hits"), expected, hits->length());
+    for (size_t i = 0; i < hits->length(); i++) {
+        int32_t id = hits->id(i);
+        assertTrue(id % 50 == 7 && id % 3 == 1);
+    }
+    _CLLDELETE(hits);
+    QueryUtils::check(tc, &query, &searcher);
+
+    // the term scorers expose their document frequency, the conjunction
+    // the cost of its cheapest clause
+    Weight* w = query.weight(&searcher);
+    Scorer* scorer = w->scorer(reader);
+    CuAssertIntEquals(tc, _T("conjunction cost"), 10, scorer->cost());
+    _CLLDELETE(scorer);
+    _CLLDELETE(w);
+
+    Term* t = _CLNEW Term(_T("field"), _T("mid"));
+    TermQuery tq(t);
+    _CLDECDELETE(t);
+    w = tq.weight(&searcher);
+    scorer = w->scorer(reader);
+    CuAssertIntEquals(tc, _T("term cost"), 167, scorer->cost());
+
+    // skipping within the buffered postings
+    assertTrue(scorer->skipTo(3));
+    CuAssertIntEquals(tc, _T("skipTo(3)"), 4, scorer->doc());
+    assertTrue(scorer->skipTo(5));
+    CuAssertIntEquals(tc, _T("skipTo(5)"), 7, scorer->doc());
+    assertTrue(scorer->skipTo(60));
+    CuAssertIntEquals(tc, _T("skipTo(60)"), 61, scorer->doc());
+    assertTrue(scorer->next());
+    CuAssertIntEquals(tc, _T("next"), 64, scorer->doc());
+    assertTrue(scorer->skipTo(498));
+    CuAssertIntEquals(tc, _T("skipTo(498)"), 499, scorer->doc());
+    assertTrue(!scorer->skipTo(500));
+    _CLLDELETE(scorer);
+    _CLLDELETE(w);
+
+    searcher.close();
+    reader->close();
+    _CLLDELETE(reader);
+}
+
 CuSuite *testBoolean(void)
 {
     CuSuite *suite = CuSuiteNew(_T("CLucene Boolean Tests"));
@@ -228,6 +305,7 @@ CuSuite *testBoolean(void)
     SUITE_ADD_TEST(suite, testBooleanPrefixQuery);
     SUITE_ADD_TEST(suite, testBooleanScorer2WithSubScorers);
     SUITE_ADD_TEST(suite, testBooleanScorer2WithProhibitedScorer);
+    SUITE_ADD_TEST(suite, testConjunctionScorerCost);
 
     //_CrtSetBreakAlloc(1179);
 
@@ -0,0 +1,158 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "test.h"
+#include "CLucene/search/FacetCollector.h"
+#include "CLucene/search/MatchAllDocsQuery.h"
+#include "MockHitCollector.h"
+
+static const TCHAR* facetColors[] = {_T("red"), _T("green"), _T("blue")};
+
+// color has one value per doc, tag has none, one or two
+static void facetAddDocs(Directory* dir, int32_t from, int32_t to){
+    WhitespaceAnalyzer a;
+    IndexWriter writer(dir, &a, true);
+    writer.setMaxBufferedDocs(7);
+    TCHAR buf[20];
+    for ( int32_t i=from;i<to;i++ ){
+        Document doc;
+        doc.add(*_CLNEW Field(_T("contents"), (i % 2) == 0 ? _T("even") : _T("odd"), Field::STORE_NO | Field::INDEX_TOKENIZED));
+        doc.add(*_CLNEW Field(_T("color"), facetColors[i % 3], Field::STORE_NO | Field::INDEX_UNTOKENIZED));
+        if ( i % 5 != 0 ){
+            _sntprintf(buf, 20, _T("t%d"), i % 4);
+            doc.add(*_CLNEW Field(_T("tag"), buf, Field::STORE_NO | Field::INDEX_UNTOKENIZED));
+        }
+        if ( i % 4 == 1 )
+            doc.add(*_CLNEW Field(_T("tag"), _T("x"), Field::STORE_NO | Field::INDEX_UNTOKENIZED));
+        writer.addDocument(&doc);
+    }
+    writer.close();
+}
+
+// the counts of the even docs in [from,to)
+static int32_t facetExpectedColor(int32_t from, int32_t to, int32_t color){
+    int32_t ret = 0;
+    for ( int32_t i=from;i<to;i++ )
+        if ( i % 2 == 0 && i % 3 == color ) ret++;
+    return ret;
+}
+static int32_t facetExpectedTag(int32_t from, int32_t to, int32_t tag){
+    int32_t ret = 0;
+    for ( int32_t i=from;i<to;i++ )
+        if ( i % 2 == 0 && i % 5 != 0 && i % 4 == tag ) ret++;
+    return ret;
+}
+
+static Query* facetEvenQuery(){
+    Term* t = _CLNEW Term(_T("contents"), _T("even"));
+    Query* q = _CLNEW TermQuery(t);
+    _CLDECDELETE(t);
+    return q;
+}
+
+void testFacetCounts(CuTest *tc){
+    RAMDirectory dir;
+    facetAddDocs(&dir, 0, 100);
+    IndexReader* reader = IndexReader::open(&dir);
+    IndexSearcher searcher(reader);
+    Query* q = facetEvenQuery();
+
+    const TCHAR* fields[] = {_T("color"), _T("tag"), NULL};
+    MockHitCollector hits;
+    FacetCollector facets(reader, fields, &hits);
+    searcher._search(q, NULL, &facets);
+    CuAssertIntEquals(tc, _T("collected hits"), 50, hits.getCollectCalls());
+
+    FacetCounts* colors = facets.getCounts(_T("color"));
+    CuAssertIntEquals(tc, _T("color values"), 3, colors->size());
+    for ( int32_t c=0;c<3;c++ )
+        CuAssertIntEquals(tc, facetColors[c], facetExpectedColor(0, 100, c), colors->getCount(facetColors[c]));
+
+    FacetCounts* tags = facets.getCounts(_T("tag"));
+    // odd docs have t1, t3 and x, so only t0 and t2 were hit
+    CuAssertIntEquals(tc, _T("tag values"), 2, tags->size());
+    CuAssertIntEquals(tc, _T("t0"), facetExpectedTag(0, 100, 0), tags->getCount(_T("t0")));
+    CuAssertIntEquals(tc, _T("t2"), facetExpectedTag(0, 100, 2), tags->getCount(_T("t2")));
+    CuAssertIntEquals(tc, _T("x"), 0, tags->getCount(_T("x")));
+
+    std::vector<FacetValue> top;
+    colors->getTopValues(2, top);
+    CuAssertIntEquals(tc, _T("top values"), 2, (int32_t)top.size());
+    CLUCENE_ASSERT(top[0].count >= top[1].count);
+    CuAssertIntEquals(tc, _T("top count"), cl_max(facetExpectedColor(0, 100, 0),
+        cl_max(facetExpectedColor(0, 100, 1), facetExpectedColor(0, 100, 2))), top[0].count);
+    _CLLDELETE(colors);
+    _CLLDELETE(tags);
+
+    // all docs: multi valued docs count once per value
+    MatchAllDocsQuery all;
+    FacetCollector allFacets(reader, fields);
+    searcher._search(&all, NULL, &allFacets);
+    tags = allFacets.getCounts(_T("tag"));
+    CuAssertIntEquals(tc, _T("all tag values"), 5, tags->size());
+    CuAssertIntEquals(tc, _T("x count"), 25, tags->getCount(_T("x")));
+    _CLLDELETE(tags);
+
+    _CLLDELETE(q);
+    searcher.close();
+    reader->close();
+    _CLLDELETE(reader);
+    dir.close();
+}
+
+void testFacetMultiSearcher(CuTest *tc){
+    RAMDirectory dir1, dir2;
+    facetAddDocs(&dir1, 0, 40);
+    facetAddDocs(&dir2, 40, 100);
+    IndexReader* reader1 = IndexReader::open(&dir1);
+    IndexReader* reader2 = IndexReader::open(&dir2);
+    IndexSearcher searcher1(reader1);
+    IndexSearcher searcher2(reader2);
+    Searchable* searchables[] = {&searcher1, &searcher2, NULL};
+    MultiSearcher searcher(searchables);
+    Query* q = facetEvenQuery();
+
+    const TCHAR* fields[] = {_T("color"), NULL};
+    ValueArray<IndexReader*> readers(2);
+    readers.values[0] = reader1;
+    readers.values[1] = reader2;
+    FacetCollector facets(&readers, fields);
+    searcher._search(q, NULL, &facets);
+    FacetCounts* colors = facets.getCounts(_T("color"));
+    for ( int32_t c=0;c<3;c++ )
+        CuAssertIntEquals(tc, facetColors[c], facetExpectedColor(0, 100, c), colors->getCount(facetColors[c]));
+
+    // counting each index on its own and merging gives the same counts
+    FacetCollector facets1(reader1, fields);
+    searcher1._search(q, NULL, &facets1);
+    FacetCollector facets2(reader2, fields);
+    searcher2._search(q, NULL, &facets2);
+    FacetCounts* merged = facets1.getCounts(_T("color"));
+    FacetCounts* colors2 = facets2.getCounts(_T("color"));
+    merged->merge(colors2);
+    CuAssertIntEquals(tc, _T("merged values"), colors->size(), merged->size());
+    for ( int32_t c=0;c<3;c++ )
+        CuAssertIntEquals(tc, facetColors[c], colors->getCount(facetColors[c]), merged->getCount(facetColors[c]));
+
+    _CLLDELETE(colors);
+    _CLLDELETE(colors2);
+    _CLLDELETE(merged);
+    _CLLDELETE(q);
+    searcher.close();
+    reader1->close();
+    reader2->close();
+    _CLLDELETE(reader1);
+    _CLLDELETE(reader2);
+}
+
+CuSuite *testFacets(void)
+{
+    CuSuite *suite = CuSuiteNew(_T("CLucene Facets Test"));
+    SUITE_ADD_TEST(suite, testFacetCounts);
+    SUITE_ADD_TEST(suite, testFacetMultiSearcher);
+    return suite;
+}
+// EOF
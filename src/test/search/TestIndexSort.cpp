@@ -0,0 +1,198 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "test.h"
+#include "CLucene/search/EarlyTerminatingCollector.h"
+#include "CLucene/search/QueryResultCache.h"
+#include "CLucene/search/Scorer.h"
+#include "CLucene/search/_FieldDocSortedHitQueue.h"
+#include "CLucene/index/TermVector.h"
+#include "MockHitCollector.h"
+
+// the sort value of doc i, every value is used by at most two docs
+static int32_t indexSortValue(int32_t i){
+    return (i * 37) % 53;
+}
+
+static void indexSortAddDocs(Directory* dir, int32_t numDocs, bool optimize){
+    WhitespaceAnalyzer a;
+    IndexWriter writer(dir, &a, true);
+    writer.setMaxBufferedDocs(10);
+    SortField sort(_T("ts"), SortField::INT, false);
+    writer.setIndexSort(&sort);
+    TCHAR buf[20];
+    for ( int32_t i=0;i<numDocs;i++ ){
+        Document doc;
+        _sntprintf(buf, 20, _T("%d"), i);
+        doc.add(*_CLNEW Field(_T("id"), buf, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+        _sntprintf(buf, 20, _T("%d"), indexSortValue(i));
+        doc.add(*_CLNEW Field(_T("ts"), buf, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+        doc.add(*_CLNEW Field(_T("contents"), (i % 2) == 0 ? _T("even all") : _T("odd all"),
+            Field::STORE_NO | Field::INDEX_TOKENIZED | Field::TERMVECTOR_WITH_POSITIONS));
+        writer.addDocument(&doc);
+    }
+    // deletions are collapsed by the merges
+    for ( int32_t i=0;i<numDocs;i+=10 ){
+        _sntprintf(buf, 20, _T("%d"), i);
+        Term* t = _CLNEW Term(_T("id"), buf);
+        writer.deleteDocuments(t);
+        _CLDECDELETE(t);
+    }
+    if ( optimize )
+        writer.optimize();
+    writer.close();
+}
+
+void testIndexSortMerge(CuTest *tc){
+    RAMDirectory dir;
+    indexSortAddDocs(&dir, 95, true);
+    IndexReader* reader = IndexReader::open(&dir);
+    CuAssertIntEquals(tc, _T("docs"), 85, reader->numDocs());
+    CLUCENE_ASSERT(!reader->hasDeletions());
+
+    const SortField* sort = reader->getIndexSort();
+    CLUCENE_ASSERT(sort != NULL);
+    CuAssertStrEquals(tc, _T("sort field"), _T("ts"), sort->getField());
+    CuAssertIntEquals(tc, _T("sort type"), SortField::INT, sort->getType());
+
+    // the stored fields, postings and vectors of every doc moved together
+    ValueArray<int32_t> ids(reader->maxDoc());
+    int32_t lastValue = -1;
+    int32_t lastId = -1;
+    for ( int32_t d=0;d<reader->maxDoc();d++ ){
+        Document doc;
+        reader->document(d, doc);
+        const int32_t id = _ttoi(doc.get(_T("id")));
+        const int32_t value = _ttoi(doc.get(_T("ts")));
+        CuAssertIntEquals(tc, _T("stored value"), indexSortValue(id), value);
+        CLUCENE_ASSERT(value > lastValue || (value == lastValue && id > lastId));
+        lastValue = value;
+        lastId = id;
+        ids.values[d] = id;
+
+        TermFreqVector* vector = reader->getTermFreqVector(d, _T("contents"));
+        CLUCENE_ASSERT(vector != NULL);
+        CLUCENE_ASSERT(vector->indexOf((id % 2) == 0 ? _T("even") : _T("odd")) >= 0);
+        _CLLDELETE(vector);
+    }
+
+    Term* t = _CLNEW Term(_T("contents"), _T("even"));
+    TermPositions* postings = reader->termPositions(t);
+    _CLDECDELETE(t);
+    int32_t numEven = 0;
+    int32_t lastDoc = -1;
+    while ( postings->next() ){
+        CLUCENE_ASSERT(postings->doc() > lastDoc);
+        lastDoc = postings->doc();
+        CuAssertIntEquals(tc, _T("even id"), 0, ids[lastDoc] % 2);
+        CuAssertIntEquals(tc, _T("freq"), 1, postings->freq());
+        CuAssertIntEquals(tc, _T("position"), 0, postings->nextPosition());
+        numEven++;
+    }
+    CuAssertIntEquals(tc, _T("even docs"), 38, numEven);
+    _CLLDELETE(postings);
+
+    reader->close();
+    _CLLDELETE(reader);
+}
+
+void testEarlyTermination(CuTest *tc){
+    RAMDirectory dir;
+    indexSortAddDocs(&dir, 95, false);
+    IndexReader* reader = IndexReader::open(&dir);
+    IndexSearcher searcher(reader);
+    Term* t = _CLNEW Term(_T("contents"), _T("all"));
+    Query* q = _CLNEW TermQuery(t);
+    _CLDECDELETE(t);
+
+    // every flushed segment was sorted when the writer closed
+    Sort sort(_CLNEW SortField(_T("ts"), SortField::INT, false));
+    CLUCENE_ASSERT(EarlyTerminatingCollector::canTerminate(reader, &sort));
+    Sort reverse(_CLNEW SortField(_T("ts"), SortField::INT, true));
+    CLUCENE_ASSERT(!EarlyTerminatingCollector::canTerminate(reader, &reverse));
+    Sort byString(_CLNEW SortField(_T("ts"), SortField::STRING, false));
+    CLUCENE_ASSERT(!EarlyTerminatingCollector::canTerminate(reader, &byString));
+
+    MockHitCollector hits;
+    EarlyTerminatingCollector early(reader, &sort, 3, &hits);
+    Weight* weight = q->weight(&searcher);
+    Scorer* scorer = weight->scorer(reader);
+    early.score(scorer);
+    _CLLDELETE(scorer);
+    _CLLDELETE(weight);
+    CLUCENE_ASSERT(early.getTerminatedSegments() > 0);
+    CLUCENE_ASSERT(hits.getCollectCalls() < reader->numDocs());
+
+    // the top hits do not change
+    TopFieldDocs* all = searcher._search(q, NULL, 7, &sort);
+    searcher.setEarlyTermination(true);
+    TopFieldDocs* top = searcher._search(q, NULL, 7, &sort);
+    CuAssertIntEquals(tc, _T("all hits"), 85, all->totalHits);
+    CLUCENE_ASSERT(top->totalHits < all->totalHits);
+    CuAssertIntEquals(tc, _T("top hits"), all->scoreDocsLength, top->scoreDocsLength);
+    for ( int32_t i=0;i<top->scoreDocsLength;i++ )
+        CuAssertIntEquals(tc, _T("top doc"), all->scoreDocs[i].doc, top->scoreDocs[i].doc);
+    _CLLDELETE(all);
+    _CLLDELETE(top);
+
+    // sorts that do not match are collected completely
+    top = searcher._search(q, NULL, 7, &reverse);
+    CuAssertIntEquals(tc, _T("reverse hits"), 85, top->totalHits);
+    _CLLDELETE(top);
+
+    _CLLDELETE(q);
+    searcher.close();
+    reader->close();
+    _CLLDELETE(reader);
+}
+
+void testEarlyTerminationCache(CuTest *tc){
+    RAMDirectory dir;
+    indexSortAddDocs(&dir, 95, false);
+    IndexReader* reader = IndexReader::open(&dir);
+    IndexSearcher searcher(reader);
+    QueryResultCache cache;
+    searcher.setQueryResultCache(&cache);
+    Term* t = _CLNEW Term(_T("contents"), _T("all"));
+    Query* q = _CLNEW TermQuery(t);
+    _CLDECDELETE(t);
+    Sort sort(_CLNEW SortField(_T("ts"), SortField::INT, false));
+
+    // the early terminated totals are not handed to a complete search...
+    searcher.setEarlyTermination(true);
+    TopFieldDocs* top = searcher._search(q, NULL, 7, &sort);
+    searcher.setEarlyTermination(false);
+    TopFieldDocs* all = searcher._search(q, NULL, 7, &sort);
+    CuAssertIntEquals(tc, _T("all hits"), 85, all->totalHits);
+    CLUCENE_ASSERT(top->totalHits < all->totalHits);
+    _CLLDELETE(top);
+    _CLLDELETE(all);
+
+    // ...and the complete totals are not handed to an early terminated one
+    searcher.setEarlyTermination(true);
+    top = searcher._search(q, NULL, 7, &sort);
+    CLUCENE_ASSERT(top->totalHits < 85);
+    _CLLDELETE(top);
+    searcher.setEarlyTermination(false);
+    all = searcher._search(q, NULL, 7, &sort);
+    CuAssertIntEquals(tc, _T("cached hits"), 85, all->totalHits);
+    _CLLDELETE(all);
+
+    _CLLDELETE(q);
+    searcher.close();
+    reader->close();
+    _CLLDELETE(reader);
+}
+
+CuSuite *testIndexSort(void)
+{
+    CuSuite *suite = CuSuiteNew(_T("CLucene Index Sort Test"));
+    SUITE_ADD_TEST(suite, testIndexSortMerge);
+    SUITE_ADD_TEST(suite, testEarlyTermination);
+    SUITE_ADD_TEST(suite, testEarlyTerminationCache);
+    return suite;
+}
+// EOF
@@ -365,12 +365,163 @@ void testMultiPhraseQuery( CuTest * tc )
     _CLLDELETE( pClone );
 }
 
+static const TCHAR* commonGramsWords[] = { _T("the"), _T("to"), _T("be"), _T("or"), _T("not"), NULL };
+
+class CommonGramsTestAnalyzer: public Analyzer {
+    TokenStream* lastStream;
+public:
+    CommonGramsTestAnalyzer() { lastStream = NULL; }
+    virtual ~CommonGramsTestAnalyzer() { _CLDELETE( lastStream ); }
+    TokenStream* tokenStream(const TCHAR* /*fieldName*/, Reader* reader){
+        return _CLNEW CommonGramsFilter(_CLNEW WhitespaceTokenizer(reader), true, commonGramsWords);
+    }
+    // the writer does not delete the streams it gets from here
+    TokenStream* reusableTokenStream(const TCHAR* fieldName, Reader* reader){
+        _CLDELETE( lastStream );
+        lastStream = tokenStream(fieldName, reader);
+        return lastStream;
+    }
+};
+
+static void commonGramsIndex(Directory* dir, bool withGrams){
+    const TCHAR* texts[] = {
+        _T("to be or not to be that is the question"),
+        _T("the who played to be or not"),
+        _T("not to be outdone the who"),
+        _T("who the band is"),
+        _T("to be to be or not to be"),
+        _T("be or not to be is the question"),
+        NULL };
+    PerFieldAnalyzerWrapper analyzer(_CLNEW WhitespaceAnalyzer());
+    analyzer.addAnalyzer(_T("body_grams"), _CLNEW CommonGramsTestAnalyzer());
+    IndexWriter writer(dir, &analyzer, true);
+    for ( int32_t i=0; texts[i]!=NULL; i++ ){
+        Document doc;
+        doc.add(*_CLNEW Field(_T("body"), texts[i], Field::STORE_NO | Field::INDEX_TOKENIZED));
+        if ( withGrams )
+            doc.add(*_CLNEW Field(_T("body_grams"), texts[i], Field::STORE_NO | Field::INDEX_TOKENIZED));
+        writer.addDocument(&doc);
+    }
+    writer.close();
+}
+
+static PhraseQuery* commonGramsPhrase(const TCHAR* text){
+    PhraseQuery* q = _CLNEW PhraseQuery();
+    TCHAR word[100];
+    const TCHAR* start = text;
+    while ( *start ){
+        const TCHAR* end = start;
+        while ( *end && *end != ' ' )
+            end++;
+        _tcsncpy(word, start, end - start);
+        word[end - start] = 0;
+        Term* t = _CLNEW Term(_T("body"), word);
+        q->add(t);
+        _CLDECDELETE(t);
+        start = *end ? end + 1 : end;
+    }
+    return q;
+}
+
+void testCommonGramsPhraseQuery(CuTest * tc)
+{
+    RAMDirectory dir;
+    commonGramsIndex(&dir, true);
+    IndexReader* reader = IndexReader::open(&dir);
+    IndexSearcher searcher(reader);
+
+    const TCHAR* phrases[] = { _T("to be or not to be"), _T("the who"), _T("who the"),
+        _T("is the question"), _T("be to"), _T("played to be"), _T("the band"), NULL };
+    const int32_t expectedHits[] = { 2, 2, 1, 2, 1, 1, 1 };
+
+    for ( int32_t i=0; phrases[i]!=NULL; i++ ){
+        PhraseQuery* plain = commonGramsPhrase(phrases[i]);
+        PhraseQuery* grams = commonGramsPhrase(phrases[i]);
+        grams->setCommonGrams(_T("body_grams"), commonGramsWords);
+
+        // the phrase is rewritten to the shadow field
+        Query* rewritten = grams->rewrite(reader);
+        CLUCENE_ASSERT(rewritten != grams);
+        TermSet termSet;
+        rewritten->extractTerms(&termSet);
+        for ( TermSet::iterator itr = termSet.begin(); itr != termSet.end(); itr++ ){
+            Term* t = *itr;
+            CuAssertStrEquals(tc, _T("field"), _T("body_grams"), t->field());
+            _CLLDECDELETE(t);
+        }
+        _CLLDELETE(rewritten);
+
+        // and matches the same documents
+        Hits* expected = searcher.search(plain);
+        Hits* actual = searcher.search(grams);
+        CuAssertIntEquals(tc, phrases[i], expectedHits[i], expected->length());
+        CuAssertIntEquals(tc, phrases[i], expected->length(), actual->length());
+        for ( size_t j=0; j<expected->length(); j++ ){
+            bool found = false;
+            for ( size_t k=0; k<actual->length(); k++ )
+                found |= expected->id(j) == actual->id(k);
+            CLUCENE_ASSERT(found);
+        }
+        _CLLDELETE(expected);
+        _CLLDELETE(actual);
+
+        Query* clone = grams->clone();
+        CuAssertStrEquals(tc, _T("clone"), _T("body_grams"), ((PhraseQuery*)clone)->getCommonGramsField());
+        CLUCENE_ASSERT(clone->equals(grams));
+        CLUCENE_ASSERT(clone->hashCode() == grams->hashCode());
+        _CLLDELETE(clone);
+
+        // the shadow field is part of the query's identity
+        CLUCENE_ASSERT(!plain->equals(grams));
+        CLUCENE_ASSERT(!grams->equals(plain));
+        CLUCENE_ASSERT(plain->hashCode() != grams->hashCode());
+        TCHAR* str = grams->toString(_T("body"));
+        CLUCENE_ASSERT(_tcsstr(str, _T("body_grams")) != NULL);
+        _CLDELETE_CARRAY(str);
+
+        _CLLDELETE(plain);
+        _CLLDELETE(grams);
+    }
+
+    // phrases without common words, and sloppy phrases, are not rewritten
+    PhraseQuery* q = commonGramsPhrase(_T("who played"));
+    q->setCommonGrams(_T("body_grams"), commonGramsWords);
+    CLUCENE_ASSERT(q->rewrite(reader) == q);
+    _CLLDELETE(q);
+    q = commonGramsPhrase(_T("the who"));
+    q->setCommonGrams(_T("body_grams"), commonGramsWords);
+    q->setSlop(1);
+    CLUCENE_ASSERT(q->rewrite(reader) == q);
+    _CLLDELETE(q);
+
+    searcher.close();
+    reader->close();
+    _CLLDELETE(reader);
+
+    // without the shadow field the phrase runs unchanged
+    RAMDirectory plainDir;
+    commonGramsIndex(&plainDir, false);
+    reader = IndexReader::open(&plainDir);
+    IndexSearcher plainSearcher(reader);
+    q = commonGramsPhrase(_T("the who"));
+    q->setCommonGrams(_T("body_grams"), commonGramsWords);
+    CLUCENE_ASSERT(q->rewrite(reader) == q);
+    Hits* hits = plainSearcher.search(q);
+    CuAssertIntEquals(tc, _T("fallback"), 2, hits->length());
+    _CLLDELETE(hits);
+    _CLLDELETE(q);
+    plainSearcher.close();
+    reader->close();
+    _CLLDELETE(reader);
+}
+
 CuSuite *testqueries(void)
 {
 	CuSuite *suite = CuSuiteNew(_T("CLucene Queries Test"));
 
 	SUITE_ADD_TEST(suite, testPrefixQuery);
 	SUITE_ADD_TEST(suite, testMultiPhraseQuery);
+	SUITE_ADD_TEST(suite, testCommonGramsPhraseQuery);
 	#ifndef NO_FUZZY_QUERY
 		SUITE_ADD_TEST(suite, testFuzzyQuery);
 	#else
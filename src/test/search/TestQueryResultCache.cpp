@@ -0,0 +1,236 @@
+/*------------------------------------------------------------------------------
+* Copyright (C) 2003-2006 Ben van Klinken and the CLucene Team
+*
+* Distributable under the terms of either the Apache License (Version 2.0) or
+* the GNU Lesser General Public License, as specified in the COPYING file.
+------------------------------------------------------------------------------*/
+#include "test.h"
+#include "CLucene/search/QueryResultCache.h"
+#include "CLucene/search/QueryFilter.h"
+#include "CLucene/util/BitSet.h"
+
+// Lets the even ids through. It prints like the QueryFilter of the tests,
+// but only equals itself
+class QrcEvenFilter: public Filter{
+public:
+    BitSet* bits(IndexReader* reader){
+        BitSet* bts = _CLNEW BitSet(reader->maxDoc());
+        for ( int32_t i=0;i<reader->maxDoc();i+=2 )
+            bts->set(i);
+        return bts;
+    }
+    Filter* clone() const{
+        return _CLNEW QrcEvenFilter();
+    }
+    TCHAR* toString(){
+        return STRDUP_TtoT(_T("QueryFilter(contents:even)"));
+    }
+};
+
+static void qrcAddDocs(Directory* dir, int32_t from, int32_t to, bool create){
+    WhitespaceAnalyzer a;
+    IndexWriter writer(dir, &a, create);
+    TCHAR buf[20];
+    for ( int32_t i=from;i<to;i++ ){
+        Document doc;
+        _i64tot(i, buf, 10);
+        doc.add(*_CLNEW Field(_T("id"), buf, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+        doc.add(*_CLNEW Field(_T("contents"), (i % 2) == 0 ? _T("all even") : _T("all odd"), Field::STORE_NO | Field::INDEX_TOKENIZED));
+        _i64tot(1000 - i, buf, 10);
+        doc.add(*_CLNEW Field(_T("sort"), buf, Field::STORE_NO | Field::INDEX_UNTOKENIZED));
+        writer.addDocument(&doc);
+    }
+    writer.close();
+}
+
+static Query* qrcTermQuery(const TCHAR* field, const TCHAR* text){
+    Term* t = _CLNEW Term(field, text);
+    Query* q = _CLNEW TermQuery(t);
+    _CLDECDELETE(t);
+    return q;
+}
+
+static void qrcCheckSameHits(CuTest* tc, Hits* expected, Hits* actual){
+    CuAssertIntEquals(tc, _T("length"), expected->length(), actual->length());
+    for ( size_t i=0;i<expected->length();i++ ){
+        CuAssertIntEquals(tc, _T("id"), expected->id(i), actual->id(i));
+        CLUCENE_ASSERT(expected->score(i) == actual->score(i));
+    }
+}
+
+void testQueryResultCacheHits(CuTest *tc){
+    RAMDirectory dir;
+    qrcAddDocs(&dir, 0, 300, true);
+    IndexReader* reader = IndexReader::open(&dir);
+    IndexSearcher searcher(reader);
+    QueryResultCache cache;
+
+    Query* q = qrcTermQuery(_T("contents"), _T("even"));
+    Hits* uncached = searcher.search(q);
+    uncached->id(uncached->length() - 1); // fetch all hits before caching
+
+    searcher.setQueryResultCache(&cache);
+    Hits* first = searcher.search(q);
+    CLUCENE_ASSERT(cache.getMissCount() == 1 && cache.getHitCount() == 0);
+    qrcCheckSameHits(tc, uncached, first);
+    CLUCENE_ASSERT(cache.getHitCount() == 0);
+
+    // an equal query is answered from the cache
+    Query* q2 = qrcTermQuery(_T("contents"), _T("even"));
+    Hits* second = searcher.search(q2);
+    CLUCENE_ASSERT(cache.getHitCount() == 1);
+    qrcCheckSameHits(tc, uncached, second);
+    int64_t hitCount = cache.getHitCount();
+
+    // the filter is part of the key
+    Query* filterQuery = qrcTermQuery(_T("contents"), _T("even"));
+    QueryFilter filter(filterQuery);
+    Hits* filtered = searcher.search(q, &filter);
+    CLUCENE_ASSERT(cache.getHitCount() == hitCount);
+    CuAssertIntEquals(tc, _T("filtered length"), 150, filtered->length());
+
+    // an equal filter finds the entry, a filter that only equals itself is not cached
+    QueryFilter filter2(filterQuery);
+    Hits* filtered2 = searcher.search(q2, &filter2);
+    CLUCENE_ASSERT(cache.getHitCount() == hitCount + 1);
+    qrcCheckSameHits(tc, filtered, filtered2);
+    hitCount = cache.getHitCount();
+    size_t cacheSize = cache.size();
+    QrcEvenFilter evenFilter;
+    Hits* evenFiltered = searcher.search(q, &evenFilter);
+    Hits* evenFiltered2 = searcher.search(q, &evenFilter);
+    qrcCheckSameHits(tc, evenFiltered, evenFiltered2);
+    CLUCENE_ASSERT(cache.getHitCount() == hitCount);
+    CLUCENE_ASSERT(cache.size() == cacheSize);
+
+    // sorted searches are cached with their sort
+    Sort sort(_T("sort"));
+    Hits* sorted = searcher.search(q, &sort);
+    Hits* sorted2 = searcher.search(q2, &sort);
+    CLUCENE_ASSERT(cache.getHitCount() == hitCount + 1);
+    qrcCheckSameHits(tc, sorted, sorted2);
+    CuAssertIntEquals(tc, _T("first sorted"), 298, sorted2->id(0));
+
+    // the type of the sort is part of the key
+    hitCount = cache.getHitCount();
+    Sort intSort(_CLNEW SortField(_T("sort"), SortField::INT, false));
+    Hits* intSorted = searcher.search(q, &intSort);
+    CLUCENE_ASSERT(cache.getHitCount() == hitCount);
+    CuAssertIntEquals(tc, _T("first int sorted"), 298, intSorted->id(0));
+
+    _CLDELETE(intSorted);
+    _CLDELETE(evenFiltered2);
+    _CLDELETE(evenFiltered);
+    _CLDELETE(filtered2);
+    _CLDELETE(sorted2);
+    _CLDELETE(sorted);
+    _CLDELETE(filtered);
+    _CLDELETE(second);
+    _CLDELETE(first);
+    _CLDELETE(uncached);
+    _CLDELETE(filterQuery);
+    _CLDELETE(q2);
+    _CLDELETE(q);
+
+    searcher.close();
+    reader->close();
+    _CLDELETE(reader);
+    dir.close();
+}
+
+void testQueryResultCacheReopen(CuTest *tc){
+    RAMDirectory dir;
+    qrcAddDocs(&dir, 0, 10, true);
+    IndexReader* reader = IndexReader::open(&dir);
+    QueryResultCache cache;
+    Query* q = qrcTermQuery(_T("contents"), _T("all"));
+
+    IndexSearcher* searcher = _CLNEW IndexSearcher(reader);
+    searcher->setQueryResultCache(&cache);
+    Hits* hits = searcher->search(q);
+    CuAssertIntEquals(tc, _T("length"), 10, hits->length());
+    _CLDELETE(hits);
+
+    // an unchanged reader keeps using the cached results
+    IndexReader* reopened = reader->reopen();
+    CLUCENE_ASSERT(reopened == reader);
+    hits = searcher->search(q);
+    CuAssertIntEquals(tc, _T("length"), 10, hits->length());
+    CLUCENE_ASSERT(cache.getHitCount() == 1);
+    _CLDELETE(hits);
+
+    // a changed reader does not see stale results
+    qrcAddDocs(&dir, 10, 15, false);
+    reopened = IndexReader::open(&dir);
+    IndexSearcher* searcher2 = _CLNEW IndexSearcher(reopened);
+    searcher2->setQueryResultCache(&cache);
+    hits = searcher2->search(q);
+    CuAssertIntEquals(tc, _T("length after reopen"), 15, hits->length());
+    CLUCENE_ASSERT(cache.getHitCount() == 1);
+    CLUCENE_ASSERT(cache.size() == 2);
+    _CLDELETE(hits);
+
+    // once the old searcher is gone its entries can be dropped
+    searcher->close();
+    _CLDELETE(searcher);
+    cache.purge(reopened);
+    CLUCENE_ASSERT(cache.size() == 1);
+
+    cache.clear();
+    CLUCENE_ASSERT(cache.size() == 0);
+    CLUCENE_ASSERT(cache.getSizeInBytes() == 0);
+
+    _CLDELETE(q);
+    searcher2->close();
+    _CLDELETE(searcher2);
+    reopened->close();
+    _CLDELETE(reopened);
+    reader->close();
+    _CLDELETE(reader);
+    dir.close();
+}
+
+void testQueryResultCacheEviction(CuTest *tc){
+    RAMDirectory dir;
+    qrcAddDocs(&dir, 0, 100, true);
+    IndexReader* reader = IndexReader::open(&dir);
+    IndexSearcher searcher(reader);
+    QueryResultCache cache(4096);
+    searcher.setQueryResultCache(&cache);
+
+    TCHAR buf[20];
+    for ( int32_t i=0;i<100;i++ ){
+        _i64tot(i, buf, 10);
+        Query* q = qrcTermQuery(_T("id"), buf);
+        Hits* hits = searcher.search(q);
+        CuAssertIntEquals(tc, _T("length"), 1, hits->length());
+        CuAssertIntEquals(tc, _T("id"), i, hits->id(0));
+        _CLDELETE(hits);
+        _CLDELETE(q);
+        CLUCENE_ASSERT(cache.getSizeInBytes() <= cache.getMaxBytes());
+    }
+    CLUCENE_ASSERT(cache.getEvictionCount() > 0);
+    CLUCENE_ASSERT(cache.size() < 100);
+
+    // the most recently used query is still cached
+    Query* q = qrcTermQuery(_T("id"), _T("99"));
+    Hits* hits = searcher.search(q);
+    CLUCENE_ASSERT(cache.getHitCount() == 1);
+    _CLDELETE(hits);
+    _CLDELETE(q);
+
+    searcher.close();
+    reader->close();
+    _CLDELETE(reader);
+    dir.close();
+}
+
+CuSuite *testQueryResultCache(void)
+{
+    CuSuite *suite = CuSuiteNew(_T("CLucene QueryResultCache Test"));
+    SUITE_ADD_TEST(suite, testQueryResultCacheHits);
+    SUITE_ADD_TEST(suite, testQueryResultCacheReopen);
+    SUITE_ADD_TEST(suite, testQueryResultCacheEviction);
+    return suite;
+}
+// EOF
@@ -5,6 +5,7 @@
 * the GNU Lesser General Public License, as specified in the COPYING file.
 ------------------------------------------------------------------------------*/
 #include "test.h"
+#include "CLucene/search/FieldCache.h"
 /**
  * Unit tests for sorting code.
  *
@@ -525,6 +526,96 @@ void testNormalizedScores(CuTest *tc) {
 	_CLDELETE(scoresA);
 }
 
+// test the packed ordinals and prefix compressed terms used by string sorting
+void testPackedStringIndex(CuTest *tc) {
+	RAMDirectory dir;
+	WhitespaceAnalyzer an;
+	IndexWriter writer(&dir, &an, true);
+	TCHAR buf[40];
+	for ( int32_t i=0;i<300;i++ ){
+		Document doc;
+		if ( i % 7 != 0 ){
+			_tcscpy(buf, (i % 3) == 0 ? _T("caf\xe9-") : _T("title-"));
+			_i64tot((i * 37) % 250, buf + _tcslen(buf), 10);
+			doc.add (*_CLNEW Field (_T("title"), buf, Field::STORE_YES | Field::INDEX_UNTOKENIZED));
+		}
+		doc.add (*_CLNEW Field (_T("all"), _T("x"), Field::INDEX_UNTOKENIZED));
+		writer.addDocument (&doc);
+	}
+	writer.close();
+
+	IndexReader* reader = IndexReader::open(&dir);
+	FieldCacheAuto* fa = FieldCache::DEFAULT()->getPackedStringIndex(reader, _T("title"));
+	CLUCENE_ASSERT(fa->contentType == FieldCacheAuto::PACKED_STRING_INDEX);
+	FieldCache::PackedStringIndex* index = fa->packedStringIndex;
+
+	// as few bits as the ordinals need
+	int32_t bits = index->getBitsPerOrd();
+	CLUCENE_ASSERT(((int64_t)1 << bits) >= index->getCount());
+	CLUCENE_ASSERT(((int64_t)1 << (bits-1)) < index->getCount());
+
+	// every term is restored, in order
+	int64_t stringIndexBytes = 300 * sizeof(int32_t) + index->getCount() * sizeof(TCHAR*);
+	TCHAR* prev = NULL;
+	for ( int32_t ord=1;ord<index->getCount();ord++ ){
+		TCHAR* term = index->lookup(ord);
+		CLUCENE_ASSERT(term != NULL);
+		CLUCENE_ASSERT(prev == NULL || _tcscmp(prev, term) < 0);
+		_CLDELETE_CARRAY(prev);
+		prev = term;
+		stringIndexBytes += (_tcslen(term) + 1) * sizeof(TCHAR);
+	}
+	_CLDELETE_CARRAY(prev);
+	CLUCENE_ASSERT(index->getSizeInBytes() < stringIndexBytes);
+	CLUCENE_ASSERT(index->lookup(0) == NULL);
+
+	for ( int32_t i=0;i<300;i++ ){
+		int32_t ord = index->getOrd(i);
+		Document doc;
+		reader->document(i, doc);
+		const TCHAR* title = doc.get(_T("title"));
+		if ( title == NULL ){
+			CuAssertIntEquals(tc, _T("no title"), 0, ord);
+		}else{
+			TCHAR* term = index->lookup(ord);
+			CuAssertStrEquals(tc, _T("title"), title, term);
+			_CLDELETE_CARRAY(term);
+		}
+	}
+
+	// AUTO detects the string field and reuses the packed index
+	FieldCacheAuto* autoFa = FieldCache::DEFAULT()->getAuto(reader, _T("title"));
+	CLUCENE_ASSERT(autoFa == fa);
+
+	// sorted hits come back in term order, the documents without a title first
+	IndexSearcher searcher(reader);
+	Term* t = _CLNEW Term(_T("all"), _T("x"));
+	TermQuery query(t);
+	_CLDECDELETE(t);
+	Sort sort(_T("title"));
+	Hits* hits = searcher.search(&query, &sort);
+	CuAssertIntEquals(tc, _T("hits"), 300, hits->length());
+	TCHAR* last = NULL;
+	for ( size_t i=0;i<hits->length();i++ ){
+		const TCHAR* title = hits->doc(i).get(_T("title"));
+		if ( i < 43 ){
+			CLUCENE_ASSERT(title == NULL);
+			continue;
+		}
+		CLUCENE_ASSERT(title != NULL);
+		CLUCENE_ASSERT(last == NULL || _tcscmp(last, title) <= 0);
+		_CLDELETE_CARRAY(last);
+		last = STRDUP_TtoT(title);
+	}
+	_CLDELETE_CARRAY(last);
+	_CLDELETE(hits);
+
+	searcher.close();
+	reader->close();
+	_CLDELETE(reader);
+	dir.close();
+}
+
 CuSuite *testsort(void)
 {
 	CuSuite *suite = CuSuiteNew(_T("CLucene Sort Test"));
@@ -540,6 +631,7 @@ CuSuite *testsort(void)
 	SUITE_ADD_TEST(suite, testMultiSort);
 	SUITE_ADD_TEST(suite, testNormalizedScores);
 	SUITE_ADD_TEST(suite, testReverseSort);
+	SUITE_ADD_TEST(suite, testPackedStringIndex);
 
     SUITE_ADD_TEST(suite, testSortCleanup);
     return suite;
@@ -5,6 +5,7 @@
 * the GNU Lesser General Public License, as specified in the COPYING file.
 ------------------------------------------------------------------------------*/
 #include "test.h"
+#include "CLucene/search/ConstantScoreQuery.h"
 
 #ifndef NO_WILDCARD_QUERY
 
@@ -109,6 +110,135 @@ void _testWildcard(CuTest* tc, IndexSearcher* searcher, const TCHAR* qt, int exp
 		_CLDELETE(reader);
 		_CLDELETE(searcher);
 	}
+
+	static int32_t _countHits(CuTest* tc, IndexSearcher* searcher, Query* query, bool constantScore){
+		Hits* result = searcher->search(query);
+		int32_t len = result->length();
+		for ( int32_t i=1;constantScore && i<len;i++ )
+			CLUCENE_ASSERT(result->score(i) == result->score(0));
+		_CLDELETE(result);
+		return len;
+	}
+
+	static bool _rewritesToConstantScore(IndexReader* reader, Query* query){
+		Query* rewritten = query->rewrite(reader);
+		bool ret = rewritten->instanceOf(ConstantScoreQuery::getClassName());
+		if ( rewritten != query )
+			_CLDELETE(rewritten);
+		return ret;
+	}
+
+	void testConstantScoreRewrite(CuTest *tc){
+		RAMDirectory indexStore;
+		WhitespaceAnalyzer an;
+		IndexWriter* writer = _CLNEW IndexWriter(&indexStore, &an, true);
+		TCHAR buf[20];
+		for ( int32_t i=0;i<1100;i++ ){
+			Document doc;
+			_tcscpy(buf, _T("all "));
+			_i64tot(10000 + i, buf + 4, 10);
+			buf[4] = _T('t'); //t0000 to t1099
+			doc.add(*_CLNEW Field(_T("body"), buf,Field::STORE_NO | Field::INDEX_TOKENIZED));
+			writer->addDocument(&doc);
+		}
+		writer->close();
+		_CLDELETE(writer);
+
+		IndexReader* reader = IndexReader::open(&indexStore);
+		IndexSearcher searcher(reader);
+
+		//many terms switch to a filter
+		Term* term = _CLNEW Term(_T("body"), _T("t0*"));
+		WildcardQuery* many = _CLNEW WildcardQuery(term);
+		_CLDECDELETE(term);
+		CLUCENE_ASSERT(many->getRewriteMethod() == MultiTermQuery::SCORING_BOOLEAN_QUERY_REWRITE);
+		many->setRewriteMethod(MultiTermQuery::CONSTANT_SCORE_AUTO_REWRITE);
+		CLUCENE_ASSERT(_rewritesToConstantScore(reader, many));
+		CuAssertIntEquals(tc, _T("auto"), 1000, _countHits(tc, &searcher, many, true));
+
+		many->setRewriteMethod(MultiTermQuery::SCORING_BOOLEAN_QUERY_REWRITE);
+		size_t maxClauseCount = BooleanQuery::getMaxClauseCount();
+		BooleanQuery::setMaxClauseCount(2000);
+		CLUCENE_ASSERT(!_rewritesToConstantScore(reader, many));
+		CuAssertIntEquals(tc, _T("scoring"), 1000, _countHits(tc, &searcher, many, false));
+		BooleanQuery::setMaxClauseCount(maxClauseCount);
+
+		//few terms keep scoring, unless asked otherwise
+		term = _CLNEW Term(_T("body"), _T("t00?1"));
+		WildcardQuery* few = _CLNEW WildcardQuery(term);
+		_CLDECDELETE(term);
+		CLUCENE_ASSERT(!_rewritesToConstantScore(reader, few));
+		few->setRewriteMethod(MultiTermQuery::CONSTANT_SCORE_FILTER_REWRITE);
+		CLUCENE_ASSERT(_rewritesToConstantScore(reader, few));
+		CuAssertIntEquals(tc, _T("filter"), 10, _countHits(tc, &searcher, few, true));
+
+		//a single term with many documents switches too
+		term = _CLNEW Term(_T("body"), _T("a"));
+		PrefixQuery* common = _CLNEW PrefixQuery(term);
+		_CLDECDELETE(term);
+		CLUCENE_ASSERT(!_rewritesToConstantScore(reader, common));
+		common->setRewriteMethod(MultiTermQuery::CONSTANT_SCORE_AUTO_REWRITE);
+		CLUCENE_ASSERT(_rewritesToConstantScore(reader, common));
+		CuAssertIntEquals(tc, _T("prefix"), 1100, _countHits(tc, &searcher, common, true));
+
+		//the cutoff and the clause limit apply to range queries
+		Term* lower = _CLNEW Term(_T("body"), _T("t0100"));
+		Term* upper = _CLNEW Term(_T("body"), _T("t0199"));
+		RangeQuery* range = _CLNEW RangeQuery(lower, upper, true);
+		_CLDECDELETE(lower);
+		_CLDECDELETE(upper);
+		range->setRewriteMethod(MultiTermQuery::CONSTANT_SCORE_AUTO_REWRITE);
+		CLUCENE_ASSERT(!_rewritesToConstantScore(reader, range));
+		BooleanQuery::setMaxClauseCount(50);
+		CLUCENE_ASSERT(_rewritesToConstantScore(reader, range));
+		CuAssertIntEquals(tc, _T("range"), 100, _countHits(tc, &searcher, range, true));
+		BooleanQuery::setMaxClauseCount(maxClauseCount);
+		MultiTermQuery::setAutoRewriteTermCountCutoff(10);
+		CLUCENE_ASSERT(_rewritesToConstantScore(reader, range));
+		MultiTermQuery::setAutoRewriteTermCountCutoff(MultiTermQuery::DEFAULT_TERM_COUNT_CUTOFF);
+
+		//the filter expands the query again for another reader
+		RAMDirectory otherStore;
+		writer = _CLNEW IndexWriter(&otherStore, &an, true);
+		for ( int32_t i=0;i<20;i++ ){
+			Document doc;
+			_i64tot(10000 + i * 10, buf, 10);
+			buf[0] = _T('t');
+			doc.add(*_CLNEW Field(_T("body"), buf,Field::STORE_NO | Field::INDEX_TOKENIZED));
+			writer->addDocument(&doc);
+		}
+		writer->close();
+		_CLDELETE(writer);
+		IndexReader* other = IndexReader::open(&otherStore);
+		Query* rewritten = many->rewrite(reader);
+		CLUCENE_ASSERT(rewritten != many);
+		many->setRewriteMethod(MultiTermQuery::CONSTANT_SCORE_AUTO_REWRITE);
+		_CLDELETE(rewritten);
+		rewritten = many->rewrite(reader);
+		CLUCENE_ASSERT(rewritten->instanceOf(ConstantScoreQuery::getClassName()));
+		Filter* filter = ((ConstantScoreQuery*)rewritten)->getFilter();
+		BitSet* bits = filter->bits(reader);
+		CuAssertIntEquals(tc, _T("same reader"), 1000, bits->count());
+		if ( filter->shouldDeleteBitSet(bits) )
+			_CLDELETE(bits);
+		bits = filter->bits(other);
+		CuAssertIntEquals(tc, _T("other reader"), 20, bits->count());
+		if ( filter->shouldDeleteBitSet(bits) )
+			_CLDELETE(bits);
+		_CLDELETE(rewritten);
+		other->close();
+		_CLDELETE(other);
+		otherStore.close();
+
+		_CLDELETE(range);
+		_CLDELETE(common);
+		_CLDELETE(few);
+		_CLDELETE(many);
+		searcher.close();
+		reader->close();
+		_CLDELETE(reader);
+		indexStore.close();
+	}
 #else
 	void _NO_WILDCARD_QUERY(CuTest *tc){
 		CuNotImpl(tc,_T("Wildcard"));
@@ -123,6 +253,7 @@ CuSuite *testwildcard(void)
 	#ifndef NO_WILDCARD_QUERY
 		SUITE_ADD_TEST(suite, testQuestionmark);
 		SUITE_ADD_TEST(suite, testAsterisk);
+		SUITE_ADD_TEST(suite, testConstantScoreRewrite);
 	#else
 		SUITE_ADD_TEST(suite, _NO_WILDCARD_QUERY);
     #endif
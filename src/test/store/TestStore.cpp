@@ -7,7 +7,9 @@
 #include "test.h"
 #include "CLucene/store/Directory.h"
 #include "CLucene/store/IndexInput.h"
+#include "CLucene/store/NRTCachingDirectory.h"
 #include <stdlib.h>
+#include <algorithm>
 
 
 void StoreTest(CuTest *tc,int32_t count, int mode){
@@ -46,6 +48,24 @@ void StoreTest(CuTest *tc,int32_t count, int mode){
 	CuMessageA(tc, "%d total milliseconds to create\n", (int32_t)(Misc::currentTimeMillis() - start));
 
 	if (mode != 1){
+		// the new files can be synced, missing files can not
+		std::vector<std::string> names;
+		for (i = 0; i < count; i++) {
+			_snprintf(name,260,"%d.dat",i);
+			names.push_back(name);
+		}
+		((FSDirectory*)store)->setSyncThreadCount(3);
+		store->sync(names);
+		names.push_back("missing.dat");
+		bool failed = false;
+		try {
+			store->sync(names);
+		} catch (CLuceneError& err) {
+			CuAssertIntEquals(tc, _T("sync error"), CL_ERR_IO, err.number());
+			failed = true;
+		}
+		CLUCENE_ASSERT(failed);
+
 		store->close();
 		_CLDECDELETE(store);
 		store = (Directory*)FSDirectory::getDirectory(fsdir);
@@ -110,6 +130,242 @@ void mmaptest(CuTest *tc){
 	StoreTest(tc,100,3);
 }
 
+static void writeNRTFile(Directory* dir, const char* name, int32_t length){
+	IndexOutput* file = dir->createOutput(name);
+	for (int32_t j = 0; j < length; j++)
+		file->writeByte((uint8_t)j);
+	file->close();
+	_CLDELETE(file);
+}
+
+static void checkNRTFile(CuTest *tc, IndexInput* file, int32_t length){
+	CuAssertIntEquals(tc, _T("file length"), length, (int32_t)file->length());
+	for (int32_t j = 0; j < length; j++){
+		if (file->readByte() != (uint8_t)j)
+			CuFail(tc, _T("contents incorrect"));
+	}
+}
+
+static void checkNRTFile(CuTest *tc, Directory* dir, const char* name, int32_t length){
+	IndexInput* file = dir->openInput(name);
+	checkNRTFile(tc, file, length);
+	file->close();
+	_CLDELETE(file);
+}
+
+void nrtcachingtest(CuTest *tc){
+	char fsdir[CL_MAX_PATH];
+	_snprintf(fsdir, CL_MAX_PATH, "%s/%s",cl_tempDir, "test.nrtcaching");
+	FSDirectory* fs = FSDirectory::getDirectory(fsdir);
+	std::vector<std::string> names;
+	fs->list(&names);
+	for (size_t i = 0; i < names.size(); i++)
+		fs->deleteFile(names[i].c_str());
+
+	// files up to 4KB are cached, up to 16KB in all
+	NRTCachingDirectory* dir = _CLNEW NRTCachingDirectory(fs, 4.0 / 1024, 16.0 / 1024);
+	writeNRTFile(dir, "a.dat", 1000);
+	CLUCENE_ASSERT(dir->fileExists("a.dat"));
+	CLUCENE_ASSERT(!fs->fileExists("a.dat"));
+	CuAssertIntEquals(tc, _T("cached bytes"), 1000, (int32_t)dir->getCachedBytes());
+	CuAssertIntEquals(tc, _T("cached length"), 1000, (int32_t)dir->fileLength("a.dat"));
+	checkNRTFile(tc, dir, "a.dat", 1000);
+
+	// a file that grows too large moves to the delegate while it is written
+	writeNRTFile(dir, "b.dat", 20000);
+	CLUCENE_ASSERT(fs->fileExists("b.dat"));
+	CuAssertIntEquals(tc, _T("cached bytes after spill"), 1000, (int32_t)dir->getCachedBytes());
+	checkNRTFile(tc, dir, "b.dat", 20000);
+
+	// a file deleted before it was synced never reaches the delegate
+	writeNRTFile(dir, "c.dat", 500);
+	dir->deleteFile("c.dat");
+	CLUCENE_ASSERT(!dir->fileExists("c.dat"));
+	CLUCENE_ASSERT(!fs->fileExists("c.dat"));
+	CuAssertIntEquals(tc, _T("cached bytes after delete"), 1000, (int32_t)dir->getCachedBytes());
+
+	// sync writes cached files through, they stay cached
+	IndexInput* a = ((Directory*)dir)->openInput("a.dat");
+	names.clear();
+	names.push_back("a.dat");
+	dir->sync(names);
+	CuAssertIntEquals(tc, _T("synced length"), 1000, (int32_t)fs->fileLength("a.dat"));
+	CuAssertIntEquals(tc, _T("cached bytes after sync"), 1000, (int32_t)dir->getCachedBytes());
+
+	// the oldest files are evicted when the cache is full, open inputs can
+	// still read them
+	char name[20];
+	for (int32_t i = 0; i < 7; i++){
+		_snprintf(name, 20, "d%d.dat", i);
+		writeNRTFile(dir, name, 3000);
+	}
+	CLUCENE_ASSERT(dir->getCachedBytes() < 16 * 1024 + 3000);
+	names.clear();
+	dir->listCachedFiles(names);
+	CLUCENE_ASSERT(std::find(names.begin(), names.end(), std::string("a.dat")) == names.end());
+	CLUCENE_ASSERT(std::find(names.begin(), names.end(), std::string("d6.dat")) != names.end());
+	CLUCENE_ASSERT(fs->fileExists("d0.dat"));
+	checkNRTFile(tc, a, 1000);
+	a->close();
+	_CLDELETE(a);
+	checkNRTFile(tc, dir, "d0.dat", 3000);
+
+	names.clear();
+	dir->list(&names);
+	CuAssertIntEquals(tc, _T("listed files"), 9, (int32_t)names.size());
+
+	// segments files go to the delegate
+	writeNRTFile(dir, "segments_1", 100);
+	CLUCENE_ASSERT(fs->fileExists("segments_1"));
+
+	// closing writes everything through, and closes the delegate
+	dir->close();
+	_CLDECDELETE(dir);
+	_CLDECDELETE(fs);
+	fs = FSDirectory::getDirectory(fsdir);
+	for (int32_t i = 0; i < 7; i++){
+		_snprintf(name, 20, "d%d.dat", i);
+		checkNRTFile(tc, fs, name, 3000);
+	}
+	checkNRTFile(tc, fs, "a.dat", 1000);
+	fs->close();
+	_CLDECDELETE(fs);
+}
+
+void nrtcachingindextest(CuTest *tc){
+	char fsdir[CL_MAX_PATH];
+	_snprintf(fsdir, CL_MAX_PATH, "%s/%s",cl_tempDir, "test.nrtcaching");
+	FSDirectory* fs = FSDirectory::getDirectory(fsdir);
+	NRTCachingDirectory* dir = _CLNEW NRTCachingDirectory(fs, 1, 4);
+	_CLDECDELETE(fs); // closed by dir
+
+	WhitespaceAnalyzer a;
+	IndexWriter writer(dir, false, &a, true);
+	writer.setMaxBufferedDocs(10);
+	for (int32_t i = 0; i < 95; i++){
+		Document doc;
+		doc.add(*_CLNEW Field(_T("content"), _T("aaa bbb"), Field::STORE_YES | Field::INDEX_TOKENIZED));
+		writer.addDocument(&doc);
+	}
+	writer.flush();
+	CLUCENE_ASSERT(dir->getCachedBytes() > 0);
+	IndexReader* reader = IndexReader::open(dir);
+	CuAssertIntEquals(tc, _T("docs before commit"), 0, reader->numDocs());
+	reader->close();
+	_CLLDELETE(reader);
+
+	// the commit writes the cached segments through to the disk
+	writer.commit();
+	fs = FSDirectory::getDirectory(fsdir);
+	reader = IndexReader::open(fs);
+	CuAssertIntEquals(tc, _T("docs on disk"), 95, reader->numDocs());
+	reader->close();
+	_CLLDELETE(reader);
+	fs->close();
+	_CLDECDELETE(fs);
+
+	writer.close();
+
+	// with autoCommit=true every flush writes a segments file without a
+	// sync, the cached files it references are written through first
+	IndexWriter autoWriter(dir, true, &a, true);
+	autoWriter.setMaxBufferedDocs(10);
+	for (int32_t i = 0; i < 25; i++){
+		Document doc;
+		doc.add(*_CLNEW Field(_T("content"), _T("aaa bbb"), Field::STORE_YES | Field::INDEX_TOKENIZED));
+		autoWriter.addDocument(&doc);
+	}
+	autoWriter.flush();
+	CLUCENE_ASSERT(dir->getCachedBytes() > 0);
+	fs = FSDirectory::getDirectory(fsdir);
+	reader = IndexReader::open(fs);
+	CuAssertIntEquals(tc, _T("docs on disk with autoCommit"), 25, reader->numDocs());
+	reader->close();
+	_CLLDELETE(reader);
+	fs->close();
+	_CLDECDELETE(fs);
+
+	autoWriter.close();
+	dir->close();
+	_CLDECDELETE(dir);
+}
+
+/** Copies src of from into to, behind and in front of some buffered bytes */
+static void checkCopyFile(CuTest *tc, Directory* from, Directory* to, int32_t length){
+	writeNRTFile(from, "src.dat", length);
+	IndexOutput* out = to->createOutput("dst.dat");
+	out->writeByte(1);
+	out->writeByte(2);
+	CuAssertIntEquals(tc, _T("copied bytes"), length, (int32_t)from->copyFile("src.dat", out));
+	CuAssertIntEquals(tc, _T("file pointer"), length + 2, (int32_t)out->getFilePointer());
+	out->writeByte(3);
+	out->close();
+	_CLDELETE(out);
+
+	IndexInput* in = to->openInput("dst.dat");
+	CuAssertIntEquals(tc, _T("copy length"), length + 3, (int32_t)in->length());
+	CLUCENE_ASSERT(in->readByte() == 1);
+	CLUCENE_ASSERT(in->readByte() == 2);
+	for (int32_t j = 0; j < length; j++){
+		if (in->readByte() != (uint8_t)j)
+			CuFail(tc, _T("copied contents incorrect"));
+	}
+	CLUCENE_ASSERT(in->readByte() == 3);
+	in->close();
+	_CLDELETE(in);
+	from->deleteFile("src.dat");
+	to->deleteFile("dst.dat");
+}
+
+void copyfiletest(CuTest *tc){
+	char fsdir[CL_MAX_PATH];
+	_snprintf(fsdir, CL_MAX_PATH, "%s/%s",cl_tempDir, "test.copyfile");
+	FSDirectory* fs = FSDirectory::getDirectory(fsdir);
+	RAMDirectory ram;
+
+	// copied by the kernel
+	checkCopyFile(tc, fs, fs, 100000);
+	checkCopyFile(tc, fs, fs, 0);
+	// copied through a buffer
+	checkCopyFile(tc, fs, &ram, 100000);
+	checkCopyFile(tc, &ram, fs, 100000);
+
+	// a part of a file is copied from the file pointer of the input,
+	// which is moved behind the copied bytes
+	writeNRTFile(fs, "src.dat", 1000);
+	IndexInput* in = NULL;
+	CLuceneError err;
+	CLUCENE_ASSERT(fs->openMergeInput("src.dat", in, err));
+	in->seek(10);
+	IndexOutput* out = fs->createOutput("dst.dat");
+	out->copyBytes(in, 50);
+	CLUCENE_ASSERT(in->getFilePointer() == 60);
+	CLUCENE_ASSERT(in->readByte() == 60);
+	out->copyBytes(in, 939);
+	out->close();
+	_CLDELETE(out);
+	in->close();
+	_CLDELETE(in);
+
+	in = ((Directory*)fs)->openInput("dst.dat");
+	CuAssertIntEquals(tc, _T("copy length"), 989, (int32_t)in->length());
+	for (int32_t j = 10; j < 60; j++){
+		if (in->readByte() != (uint8_t)j)
+			CuFail(tc, _T("copied contents incorrect"));
+	}
+	for (int32_t j = 61; j < 1000; j++){
+		if (in->readByte() != (uint8_t)j)
+			CuFail(tc, _T("copied contents incorrect"));
+	}
+	in->close();
+	_CLDELETE(in);
+	fs->deleteFile("src.dat");
+	fs->deleteFile("dst.dat");
+
+	fs->close();
+	_CLDECDELETE(fs);
+}
+
 CuSuite *teststore(void)
 {
 	CuSuite *suite = CuSuiteNew(_T("CLucene Store Test"));
@@ -117,6 +373,9 @@ CuSuite *teststore(void)
     SUITE_ADD_TEST(suite, ramtest);
     SUITE_ADD_TEST(suite, fstest);
     SUITE_ADD_TEST(suite, mmaptest);
+    SUITE_ADD_TEST(suite, nrtcachingtest);
+    SUITE_ADD_TEST(suite, nrtcachingindextest);
+    SUITE_ADD_TEST(suite, copyfiletest);
 
     return suite;
 }
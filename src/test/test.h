@@ -61,6 +61,9 @@ CuSuite *testConstantScoreQueries(void);
 CuSuite *testsearch(void);
 CuSuite *testtermvector(void);
 CuSuite *testsort(void);
+CuSuite *testQueryResultCache(void);
+CuSuite *testFacets(void);
+CuSuite *testIndexSort(void);
 CuSuite *testduplicates(void);
 CuSuite *testRangeFilter(void);
 CuSuite *testdatefilter(void);
@@ -33,6 +33,9 @@ unittest tests[] = {
     {"csrqueries", testConstantScoreQueries},
     {"termvector",testtermvector},
     {"sort",testsort},
+    {"queryresultcache",testQueryResultCache},
+    {"facets",testFacets},
+    {"indexsort",testIndexSort},
     {"duplicates", testduplicates},
     {"datefilter", testdatefilter},
     {"wildcard", testwildcard},